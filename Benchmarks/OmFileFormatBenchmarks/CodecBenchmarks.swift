@@ -0,0 +1,110 @@
+//
+//  CodecBenchmarks.swift
+//  OpenMeteoApi
+//
+
+import Foundation
+import OmFileFormat
+import OmFileFormatC
+
+/// Throughput of copy and conversion kernels for every instruction set supported by this CPU
+func benchmarkCopyKernels() throws {
+    let count = 1 << 20
+    let floats = (0..<count).map { $0 % 97 == 0 ? Float.nan : Float.random(in: -800..<800) }
+    let doubles = floats.map { Double($0) * 1000 }
+    let int16s = (0..<count).map { $0 % 50 == 0 ? Int16.max : Int16.random(in: Int16.min..<Int16.max) }
+    let int32s = (0..<count).map { $0 % 50 == 0 ? Int32.max : Int32.random(in: Int32.min..<Int32.max) }
+    let int64s = (0..<count).map { $0 % 50 == 0 ? Int64.max : Int64.random(in: -1<<50..<1<<50) }
+    let halfs = (0..<count).map { UInt16(truncatingIfNeeded: $0) }
+    let floatBits = (0..<count).map { _ in Float(bitPattern: UInt32.random(in: 0...UInt32.max)) }
+
+    let isaDefault = om_common_cpu_isa()
+    defer { _ = om_common_set_cpu_isa(isaDefault) }
+    func run<Src, Dst: Numeric>(_ name: String, _ fn: om_common_copy_function_t, _ src: [Src], _: Dst.Type) {
+        var out = [Dst](repeating: 0, count: src.count)
+        for isa in [OM_CPU_ISA_SCALAR, OM_CPU_ISA_SSE41, OM_CPU_ISA_AVX2, OM_CPU_ISA_NEON] {
+            guard om_common_set_cpu_isa(isa) else {
+                continue
+            }
+            let milliseconds = measureMilliseconds {
+                fn(UInt64(src.count), 20, 0.5, src, &out)
+            }
+            print("\(name) \(String(cString: om_common_cpu_isa_string(isa))): \(Int(Double(src.count) / milliseconds / 1e3)) M elements/s")
+        }
+    }
+    run("float_to_int16", om_common_copy_float_to_int16, floats, Int16.self)
+    run("float_to_int32", om_common_copy_float_to_int32, floats, Int32.self)
+    run("double_to_int64", om_common_copy_double_to_int64, doubles, Int64.self)
+    run("int16_to_float", om_common_copy_int16_to_float, int16s, Float.self)
+    run("int32_to_float", om_common_copy_int32_to_float, int32s, Float.self)
+    run("int64_to_double", om_common_copy_int64_to_double, int64s, Double.self)
+    run("float16_to_float", om_common_copy_float16_to_float, halfs, Float.self)
+    run("bfloat16_to_float", om_common_copy_bfloat16_to_float, halfs, Float.self)
+    run("float_to_float16", om_common_copy_float_to_float16, floatBits, UInt16.self)
+    run("float_to_bfloat16", om_common_copy_float_to_bfloat16, floatBits, UInt16.self)
+}
+
+/// Throughput of `delta2d_decode16` for every instruction set on chunk shapes used by Open-Meteo
+func benchmarkDelta2d() throws {
+    let isaDefault = om_common_cpu_isa()
+    defer { _ = om_common_set_cpu_isa(isaDefault) }
+    // [rows, length of the last dimension]
+    let shapes: [(Int, Int)] = [(9, 120), (50, 24), (25, 48), (20, 20), (1000, 3), (1, 8760)]
+    let iterations = 1000
+
+    for (length0, length1) in shapes {
+        var data = (0..<length0*length1).map { _ in Int16.random(in: -1000..<1000) }
+        for isa in [OM_CPU_ISA_SCALAR, OM_CPU_ISA_SSE41, OM_CPU_ISA_AVX2, OM_CPU_ISA_NEON] {
+            guard om_common_set_cpu_isa(isa) else {
+                continue
+            }
+            let milliseconds = measureMilliseconds {
+                for _ in 0..<iterations {
+                    delta2d_decode16(length0, length1, &data)
+                }
+            }
+            print("delta2d_decode16 \(length0)x\(length1) \(String(cString: om_common_cpu_isa_string(isa))): \(Int(Double(iterations * data.count) / milliseconds / 1e3)) M elements/s")
+        }
+    }
+}
+
+/// Compression ratio and decode throughput of lossless float compressions on a global float and double field
+func benchmarkFpxPredictors() throws {
+    let dims = [UInt64(181), 360, 48]
+    let chunks = [UInt64(6), 6, 48]
+    let count = Int(dims.reduce(1, *))
+    // Geopotential height like float field and mean sea level pressure like double field with a diurnal time series
+    let geopotential = (0..<count).map { i -> Float in
+        let lat = Double(i / 48 / 360 - 90) * .pi / 180, lon = Double(i / 48 % 360) * .pi / 180
+        return Float(5500 + 300 * cos(lat) + 80 * sin(3 * lon + Double(i % 48) * 0.05) * cos(2 * lat))
+    }
+    let pressure = (0..<count).map { i -> Double in
+        let lat = Double(i / 48 / 360 - 90) * .pi / 180, lon = Double(i / 48 % 360) * .pi / 180
+        return 101325 + 1500 * sin(2 * lon - Double(i % 48) * 0.03) * cos(lat) + 200 * cos(5 * lat)
+    }
+
+    func run<OmType: OmFileArrayDataTypeProtocol>(_ name: String, _ data: [OmType]) throws {
+        for compression in [CompressionType.fpx_xor2d, .fpx_fcm, .fpx_dfcm, .fpx_2dfcm] {
+            let file = try writeInMemory(data, dimensions: dims, chunks: chunks, compression: compression, scaleFactor: 1)
+            let read = try OmFileReader(fn: file.backend).asArray(of: OmType.self)!
+            let milliseconds = try measureMilliseconds {
+                _ = try read.read()
+            }
+            let bytes = Double(data.count * MemoryLayout<OmType>.size)
+            print("\(name) \(compression): ratio \(file.ratio), decode \(bytes / milliseconds / 1e6) GB/s")
+        }
+    }
+    try run("geopotential float", geopotential)
+    try run("pressure double", pressure)
+}
+
+/// Write `data` as a single array into a new in-memory file
+func writeInMemory<OmType: OmFileArrayDataTypeProtocol>(_ data: [OmType], dimensions: [UInt64], chunks: [UInt64], compression: CompressionType, scaleFactor: Float) throws -> (backend: DataAsClass, ratio: Double) {
+    let backend = DataAsClass(data: Data())
+    let fileWriter = OmFileWriter(fn: backend, initialCapacity: 1024)
+    let writer = try fileWriter.prepareArray(type: OmType.self, dimensions: dimensions, chunkDimensions: chunks, compression: compression, scale_factor: scaleFactor, add_offset: 0)
+    try writer.writeData(array: data)
+    let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+    try fileWriter.writeTrailer(rootVariable: variable)
+    return (backend, Double(data.count * MemoryLayout<OmType>.size) / Double(backend.data.count))
+}
@@ -0,0 +1,45 @@
+//
+//  CompressionRatioBenchmark.swift
+//  OpenMeteoApi
+//
+
+import Foundation
+import OmFileFormat
+
+/// Compression ratio of lossy and time series compressions compared to `pfor_delta2d`
+func benchmarkCompressionRatios() throws {
+    // Geopotential height like field with 24 hourly steps
+    let dims = [UInt64(60), 90, 24]
+    let count = Int(dims.reduce(1, *))
+    let geopotential = (0..<count).map { i -> Float in
+        if i % 997 == 0 { return .nan }
+        let lat = Double(i / 24 / 90) * .pi / 60, lon = Double(i / 24 % 90) * .pi / 45
+        return Float(5500 + 300 * cos(lat) + 80 * sin(3 * lon + Double(i % 24) * 0.05))
+    }
+    for maxError in [0.5, 0.05, 0.005] {
+        let scaleFactor = CompressionType.errorBoundScaleFactor(maxError: maxError)
+        let lorenzo = try writeInMemory(geopotential, dimensions: dims, chunks: [10, 10, 24], compression: .pfor_lorenzo, scaleFactor: scaleFactor)
+        let delta2d = try writeInMemory(geopotential, dimensions: dims, chunks: [10, 10, 24], compression: .pfor_delta2d, scaleFactor: scaleFactor)
+        print("max error \(maxError): pfor_lorenzo ratio \(lorenzo.ratio), pfor_delta2d \(delta2d.ratio)")
+    }
+
+    // Hourly temperature like time series with time as the fast dimension
+    let seriesDims = [UInt64(20), 20, 24 * 30]
+    let seriesCount = Int(seriesDims.reduce(1, *))
+    let temperature = (0..<seriesCount).map { i -> Float in
+        let location = i / Int(seriesDims[2]), hour = Double(i % Int(seriesDims[2]))
+        return Float(15 + Double(location % 20) * 0.1 + 5 * sin(hour * .pi / 12 + Double(location) * 0.01) + 3 * sin(hour * .pi / 60))
+    }
+    for compression in [CompressionType.pfor_delta2d, .pfor_dod, .pfor_delta2d_dod] {
+        let file = try writeInMemory(temperature, dimensions: seriesDims, chunks: [2, 5, 360], compression: compression, scaleFactor: 20)
+        print("temperature \(compression): ratio \(file.ratio)")
+    }
+
+#if !(os(macOS) && arch(x86_64))
+    let half = geopotential.map { Float16($0 - 5500) }
+    for compression in [CompressionType.fpx_xor2d, .pfor_delta2d] {
+        let file = try writeInMemory(half, dimensions: dims, chunks: [10, 10, 24], compression: compression, scaleFactor: 1)
+        print("float16 \(compression): ratio \(file.ratio)")
+    }
+#endif
+}
@@ -0,0 +1,53 @@
+//
+//  DeltaOfDeltaBenchmark.swift
+//  OpenMeteoApi
+//
+
+import Foundation
+import OmFileFormat
+import OmFileFormatC
+
+/// `COMPRESSION_PFOR_DOD` codes all rows of a chunk as one sequence. Compare size and speed with coding every row separately,
+/// which avoids one exception at the start of each row but adds block headers and calls per row.
+func benchmarkDeltaOfDelta() throws {
+    let codecs = om_common_codecs()!.pointee
+    let iterations = 2000
+    for (rows, length) in [(10, 360), (60, 60), (240, 24)] {
+        let count = rows * length
+        // Hourly temperature scaled by 20 and a linear time counter with time as the fast dimension
+        let temperature = (0..<count).map { i -> UInt32 in
+            let location = i / length, hour = Double(i % length)
+            let value = 15 + Double(location % 20) * 0.1 + 5 * sin(hour * .pi / 12 + Double(location) * 0.01) + 3 * sin(hour * .pi / 60)
+            return UInt32(bitPattern: Int32((value * 20).rounded()))
+        }
+        let counter = (0..<count).map { UInt32($0 % length * 3600) }
+
+        for (name, values) in [("temperature", temperature), ("counter", counter)] {
+            var input = values
+            var output = [UInt8](repeating: 0, count: count * 8 + 4096)
+            var flattenedSize = 0
+            let flattened = measureMilliseconds {
+                for _ in 0..<iterations {
+                    input = values
+                    flattenedSize = codecs.p4nzzenc128v32!(&input, count, &output, 0)
+                }
+            }
+            var perRowSize = 0
+            let perRow = measureMilliseconds {
+                for _ in 0..<iterations {
+                    input = values
+                    perRowSize = 0
+                    input.withUnsafeMutableBufferPointer { input in
+                        output.withUnsafeMutableBufferPointer { output in
+                            for row in 0..<rows {
+                                perRowSize += codecs.p4nzzenc128v32!(input.baseAddress! + row * length, length, output.baseAddress! + perRowSize, 0)
+                            }
+                        }
+                    }
+                }
+            }
+            let nanosecondsPerChunk = 1_000_000 / Double(iterations)
+            print("\(name) \(rows)x\(length): flattened \(flattenedSize) bytes \(flattened * nanosecondsPerChunk) ns, per row \(perRowSize) bytes \(perRow * nanosecondsPerChunk) ns")
+        }
+    }
+}
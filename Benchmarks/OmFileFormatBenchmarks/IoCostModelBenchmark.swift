@@ -0,0 +1,102 @@
+//
+//  IoCostModelBenchmark.swift
+//  OpenMeteoApi
+//
+
+import Foundation
+import OmFileFormat
+import OmFileFormatC
+
+/// Replay read patterns against simulated storage profiles and compare fixed merge thresholds with the IO cost model.
+/// A request takes `latency + bytes / bandwidth`. Data reads of one index read are issued concurrently, so their latencies overlap.
+/// The learned model starts with the NVMe profile and is updated with every simulated request of a first pass over all patterns.
+func benchmarkIoCostModel() throws {
+    let dims: [UInt64] = [1000, 2000]
+    let data = (0..<Int(dims.reduce(1, *))).map { i in Float(i % 2000) / 10 + Float(i / 2000) }
+    let file = try writeInMemory(data, dimensions: dims, chunks: [10, 100], compression: .pfor_delta2d, scaleFactor: 10)
+    let patterns: [(name: String, offset: [UInt64], count: [UInt64])] = [
+        ("full read", [0, 0], dims),
+        ("time series", [500, 0], [1, 2000]),
+        ("spatial column", [0, 1000], [1000, 1]),
+        ("box", [100, 300], [50, 300]),
+    ]
+    let profiles: [(name: String, latencyNanoseconds: Double, bytesPerNanosecond: Double)] = [
+        ("nvme", 100_000, 2),
+        ("network block storage", 1_000_000, 0.25),
+        ("object storage", 30_000_000, 0.1),
+    ]
+    let concurrency = 16.0
+
+    file.backend.data.withUnsafeBytes { (bytes: UnsafeRawBufferPointer) in
+        let base = bytes.baseAddress!
+        var variableOffset: UInt64 = 0
+        var variableSize: UInt64 = 0
+        guard om_trailer_read(base + bytes.count - om_trailer_size(), &variableOffset, &variableSize) else {
+            fatalError("Not an OM file")
+        }
+        let variable = om_variable_init(base + Int(variableOffset))
+
+        for profile in profiles {
+            func requestTime(_ bytes: UInt64) -> Double {
+                return profile.latencyNanoseconds + Double(bytes) / profile.bytesPerNanosecond
+            }
+
+            /// Simulated duration in nanoseconds, number of requests and bytes read
+            func simulate(offset: [UInt64], count: [UInt64], model: UnsafeMutablePointer<OmIoCostModel_t>?, learn: Bool) -> (nanoseconds: Double, requests: Int, bytes: UInt64) {
+                var decoder = OmDecoder_t()
+                guard om_decoder_init(&decoder, variable, 2, offset, count, [0, 0], count, 512, 65536) == ERROR_OK else {
+                    fatalError("om_decoder_init failed")
+                }
+                if let model {
+                    om_decoder_set_io_cost_model(&decoder, model)
+                }
+                var result: (nanoseconds: Double, requests: Int, bytes: UInt64) = (0, 0, 0)
+                var error: OmError_t = ERROR_OK
+                var indexRead = OmDecoder_indexRead_t()
+                om_decoder_init_index_read(&decoder, &indexRead)
+                while om_decoder_next_index_read(&decoder, &indexRead) {
+                    result.nanoseconds += requestTime(indexRead.count)
+                    result.requests += 1
+                    result.bytes += indexRead.count
+                    var dataRead = OmDecoder_dataRead_t()
+                    var dataReads = 0
+                    var dataBytes: UInt64 = 0
+                    om_decoder_init_data_read(&dataRead, &indexRead)
+                    while om_decoder_next_data_read(&decoder, &dataRead, base + Int(indexRead.offset), indexRead.count, &error) {
+                        dataReads += 1
+                        dataBytes += dataRead.count
+                        if learn, let model {
+                            om_io_cost_model_observe(model, dataRead.count, requestTime(dataRead.count))
+                        }
+                    }
+                    result.nanoseconds += (Double(dataReads) / concurrency).rounded(.up) * profile.latencyNanoseconds + Double(dataBytes) / profile.bytesPerNanosecond
+                    result.requests += dataReads
+                    result.bytes += dataBytes
+                }
+                guard error == ERROR_OK else {
+                    fatalError("om_decoder_next_data_read failed")
+                }
+                return result
+            }
+
+            var exact = OmIoCostModel_t()
+            om_io_cost_model_init(&exact, profile.latencyNanoseconds, profile.bytesPerNanosecond, concurrency)
+            var learned = OmIoCostModel_t()
+            om_io_cost_model_init(&learned, profiles[0].latencyNanoseconds, profiles[0].bytesPerNanosecond, concurrency)
+            for pattern in patterns {
+                _ = simulate(offset: pattern.offset, count: pattern.count, model: &learned, learn: true)
+            }
+            print("\(profile.name): learned latency \(Int(learned.latency_ns)) ns, \(learned.bytes_per_ns) bytes/ns")
+
+            for pattern in patterns {
+                let fixed = simulate(offset: pattern.offset, count: pattern.count, model: nil, learn: false)
+                let model = simulate(offset: pattern.offset, count: pattern.count, model: &exact, learn: false)
+                let online = simulate(offset: pattern.offset, count: pattern.count, model: &learned, learn: false)
+                func format(_ result: (nanoseconds: Double, requests: Int, bytes: UInt64)) -> String {
+                    return "\(result.nanoseconds / 1_000_000) ms \(result.requests) requests \(result.bytes) bytes"
+                }
+                print("  \(pattern.name): fixed thresholds \(format(fixed)), cost model \(format(model)), learned \(format(online))")
+            }
+        }
+    }
+}
@@ -0,0 +1,106 @@
+//
+//  IoReaderBenchmark.swift
+//  OpenMeteoApi
+//
+
+import Foundation
+import OmFileFormat
+import OmFileFormatC
+
+/// Compare `om_io_reader_decode` with io_uring and pread against memory mapped reads.
+/// The page cache is dropped before every run on Linux. Other platforms measure warm reads.
+func benchmarkIoReader() throws {
+    let file = "benchmarkIoReader.om"
+    let dims: [UInt64] = [10_000, 1_000]
+    let chunks: [UInt64] = [20, 100]
+    defer { try? FileManager.default.removeItem(atPath: file) }
+
+    let fn = try FileHandle.createNewFile(file: file, overwrite: true)
+    let fileWriter = OmFileWriter(fn: fn, initialCapacity: 1024 * 1024)
+    let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: chunks, compression: .pfor_delta2d, scale_factor: 20, add_offset: 0)
+    for x in stride(from: UInt64(0), to: dims[0], by: Int(chunks[0])) {
+        let data = (0..<Int(chunks[0] * dims[1])).map { i in Float(x) / 100 + sin(Float(i % Int(dims[1])) / 24) * 10 }
+        try writer.writeData(array: data, arrayDimensions: [chunks[0], dims[1]])
+    }
+    let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+    try fileWriter.writeTrailer(rootVariable: variable)
+    try fn.synchronize()
+
+    // A full read and 64 time series of single locations that each intersect 10 chunks
+    let reads: [(offset: [UInt64], count: [UInt64])] = [([0, 0], dims)] + (0..<64).map { i in ([UInt64(i) * 151, 0], [1, dims[1]]) }
+    print("file size \(try FileManager.default.attributesOfItem(atPath: file)[.size] as? Int ?? 0) bytes")
+
+    for (name, batch) in [("full read", Array(reads[0..<1])), ("64 time series", Array(reads[1...]))] {
+        for backend in [OM_IO_BACKEND_IO_URING, OM_IO_BACKEND_PREAD] {
+            let elapsed = try measureIoReader(file: file, backend: backend, reads: batch)
+            print("\(name) \(backend == OM_IO_BACKEND_IO_URING ? "io_uring" : "pread"): \(elapsed) ms")
+        }
+        try dropPageCache(file: file)
+        let elapsed = try measureMilliseconds {
+            let reader = try OmFileReader(fn: try MmapFile(fn: FileHandle.openFileReading(file: file))).asArray(of: Float.self)!
+            for read in batch {
+                _ = try reader.read(offset: read.offset, count: read.count)
+            }
+        }
+        print("\(name) mmap: \(elapsed) ms")
+    }
+}
+
+/// Evict all pages of a file from the page cache. Only available on Linux.
+func dropPageCache(file: String) throws {
+#if os(Linux)
+    let fn = try FileHandle.openFileReading(file: file)
+    guard posix_fadvise(fn.fileDescriptor, 0, 0, POSIX_FADV_DONTNEED) == 0 else {
+        fatalError("posix_fadvise failed")
+    }
+#endif
+}
+
+/// Decode all `reads` with a single call to `om_io_reader_decode` after dropping the page cache.
+/// Meta data is read with `pread`, because memory mapped pages cannot be evicted.
+func measureIoReader(file: String, backend: OmIoBackend_t, reads: [(offset: [UInt64], count: [UInt64])]) throws -> Double {
+    let fn = try FileHandle.openFileReading(file: file)
+    let fileSize = UInt64(try fn.seekToEnd())
+    func preadData(offset: UInt64, count: UInt64) -> UnsafeMutableRawPointer {
+        let data = UnsafeMutableRawPointer.allocate(byteCount: Int(count), alignment: 8)
+        guard pread(fn.fileDescriptor, data, Int(count), off_t(offset)) == Int(count) else {
+            fatalError("pread failed")
+        }
+        return data
+    }
+    let trailer = preadData(offset: fileSize - UInt64(om_trailer_size()), count: UInt64(om_trailer_size()))
+    defer { trailer.deallocate() }
+    var variableOffset: UInt64 = 0
+    var variableSize: UInt64 = 0
+    guard om_trailer_read(trailer, &variableOffset, &variableSize) else {
+        fatalError("Not an OM file")
+    }
+    let variableData = preadData(offset: variableOffset, count: variableSize)
+    defer { variableData.deallocate() }
+    let variable = om_variable_init(variableData)
+
+    let decoders = UnsafeMutablePointer<OmDecoder_t>.allocate(capacity: reads.count)
+    decoders.initialize(repeating: OmDecoder_t(), count: reads.count)
+    defer { decoders.deallocate() }
+    let outputs = reads.map { UnsafeMutableBufferPointer<Float>.allocate(capacity: Int($0.count.reduce(1, *))) }
+    defer { outputs.forEach { $0.deallocate() } }
+    for (i, read) in reads.enumerated() {
+        guard om_decoder_init(decoders + i, variable, UInt64(read.count.count), read.offset, read.count, [0, 0], read.count, 512, 65536) == ERROR_OK else {
+            fatalError("om_decoder_init failed")
+        }
+    }
+    let decoderPointers: [UnsafePointer<OmDecoder_t>?] = (0..<reads.count).map { UnsafePointer(decoders + $0) }
+    let into: [UnsafeMutableRawPointer?] = outputs.map { UnsafeMutableRawPointer($0.baseAddress) }
+
+    guard let reader = om_io_reader_create(fn.fileDescriptor, backend, 4 << 20, 8) else {
+        fatalError("om_io_reader_create failed")
+    }
+    defer { om_io_reader_destroy(reader) }
+    try dropPageCache(file: file)
+    return measureMilliseconds {
+        var error: OmError_t = ERROR_OK
+        guard om_io_reader_decode(reader, decoderPointers, into, UInt64(reads.count), &error) else {
+            fatalError("om_io_reader_decode failed: \(String(cString: om_error_string(error)))")
+        }
+    }
+}
@@ -0,0 +1,36 @@
+//
+//  main.swift
+//  OpenMeteoApi
+//
+//  Benchmarks that are too slow for unit tests.
+//  Run all with `swift run -c release OmFileFormatBenchmarks` or selected ones with `swift run -c release OmFileFormatBenchmarks ioReader`
+//
+
+import Foundation
+
+let benchmarks: [(name: String, run: () throws -> Void)] = [
+    ("ioReader", benchmarkIoReader),
+    ("ioCostModel", benchmarkIoCostModel),
+    ("deltaOfDelta", benchmarkDeltaOfDelta),
+    ("copyKernels", benchmarkCopyKernels),
+    ("delta2d", benchmarkDelta2d),
+    ("fpxPredictors", benchmarkFpxPredictors),
+    ("compressionRatios", benchmarkCompressionRatios),
+]
+
+let selected = CommandLine.arguments.dropFirst()
+for name in selected where !benchmarks.contains(where: { $0.name == name }) {
+    print("Unknown benchmark \(name). Available: \(benchmarks.map { $0.name }.joined(separator: ", "))")
+    exit(1)
+}
+for benchmark in benchmarks where selected.isEmpty || selected.contains(benchmark.name) {
+    print("# \(benchmark.name)")
+    try benchmark.run()
+}
+
+/// Run `block` and return the elapsed time in milliseconds
+func measureMilliseconds(_ block: () throws -> Void) rethrows -> Double {
+    let start = DispatchTime.now().uptimeNanoseconds
+    try block()
+    return Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000
+}
@@ -3,8 +3,8 @@
 import PackageDescription
 
 #if arch(x86_64)
-// Docker and Ubuntu release system uses `march=skylake`
-let mArch = ProcessInfo.processInfo.environment["MARCH_SKYLAKE"] == "TRUE" ? ["-march=skylake"] : ["-march=native"]
+// Portable baseline. AVX2 builds of the codecs are selected at runtime, see `om_common_codecs()`
+let mArch = ["-march=x86-64-v2"]
 #else
 let mArch: [String] = []
 #endif
@@ -47,5 +47,11 @@ let package = Package(
             name: "OmFileFormatTests",
             dependencies: ["OmFileFormat"]
         ),
+        .executableTarget(
+            name: "OmFileFormatBenchmarks",
+            dependencies: ["OmFileFormat", "OmFileFormatC"],
+            path: "Benchmarks/OmFileFormatBenchmarks",
+            swiftSettings: swiftFlags
+        ),
     ]
 )
@@ -0,0 +1,37 @@
+@_implementationOnly import OmFileFormatC
+
+/// Cache of decompressed chunks that can be shared by many readers and threads.
+/// Overlapping reads, e.g. neighbouring coordinates in the same chunk, only copy cached chunks into the output.
+public final class OmChunkCache: @unchecked Sendable {
+    /// Memory for the cache including slots and metadata
+    let memory: UnsafeMutableRawPointer
+
+    /// Handle to the C cache inside `memory`
+    let cache: OpaquePointer
+
+    /// `byteBudget` is the total memory of the cache. Each chunk occupies one slot of `slotSize` bytes. Larger chunks are not cached.
+    /// The slot size should be the number of elements in a chunk times the size of the compressed element type, e.g. 2 bytes for `pfor_delta2d_int16`.
+    public init(byteBudget: Int, slotSize: Int) throws {
+        let memorySize = max(byteBudget, Int(om_chunk_cache_min_memory_size(UInt64(slotSize))))
+        self.memory = UnsafeMutableRawPointer.allocate(byteCount: memorySize, alignment: 64)
+        guard let cache = om_chunk_cache_init(memory, UInt64(memorySize), UInt64(slotSize)) else {
+            memory.deallocate()
+            throw OmFileFormatSwiftError.omDecoder(error: "Invalid chunk cache size")
+        }
+        self.cache = cache
+    }
+
+    /// Number of chunks that were copied from the cache
+    public var hits: UInt64 {
+        return om_chunk_cache_statistics(cache).hits
+    }
+
+    /// Number of chunks that had to be decompressed
+    public var misses: UInt64 {
+        return om_chunk_cache_statistics(cache).misses
+    }
+
+    deinit {
+        memory.deallocate()
+    }
+}
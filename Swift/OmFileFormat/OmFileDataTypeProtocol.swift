@@ -70,6 +70,14 @@ extension Double: OmFileArrayDataTypeProtocol {
     }
 }
 
+#if !(os(macOS) && arch(x86_64))
+extension Float16: OmFileArrayDataTypeProtocol {
+    public static var dataTypeArray: DataType {
+        return .float16_array
+    }
+}
+#endif
+
 
 public protocol OmFileScalarDataTypeProtocol {
     init(unsafeFrom: UnsafeRawBufferPointer)
@@ -47,6 +47,10 @@ public enum DataType: UInt8, Codable {
     case float_array = 20
     case double_array = 21
     case string_array = 22
+    /// IEEE 754 half precision. Can be read as `Float`
+    case float16_array = 23
+    /// Brain floating point with 8 exponent and 7 mantissa bits. Stored as raw bits and read as `Float`
+    case bfloat16_array = 24
 
     func toC() -> OmDataType_t {
         return OmDataType_t(rawValue: UInt32(self.rawValue))
@@ -57,7 +61,8 @@ public enum CompressionType: UInt8, Codable {
     /// Lossy compression using 2D delta coding and scalefactor. Only support float which are scaled to 16 bit signed integers
     case pfor_delta2d_int16 = 0
 
-    /// Lossless compression using 2D xor coding for float and double values
+    /// Lossless compression using 2D xor coding for float, double, float16 and bfloat16 values.
+    /// Values can be rounded to fewer mantissa bits before coding with `mantissaBits` of `prepareArray`
     case fpx_xor2d = 1
 
     /// PFor integer compression. Floating point values are scaled to 32 bit signed integers. Doubles are scaled to 64 bit signed integers.
@@ -66,6 +71,35 @@ public enum CompressionType: UInt8, Codable {
     ///  Similar to `pfor_delta2d_int16` but applies `log10(1+x)` before
     case pfor_delta2d_int16_logarithmic = 3
 
+    /// Lossless compression for float and double values. Predicts each value from the values that preceded the same context (FCM)
+    case fpx_fcm = 5
+
+    /// Lossless compression for float and double values. Predicts the difference to the previous value from its context (DFCM). Often smaller than `fpx_xor2d` for smooth fields
+    case fpx_dfcm = 6
+
+    /// Like `fpx_dfcm` but takes the difference to the value two elements before
+    case fpx_2dfcm = 7
+
+    /// Error-bounded compression for float and double values. Values are rounded to multiples of `1/scale_factor` and predicted from neighbours in the last three chunk dimensions (3D Lorenzo).
+    /// The absolute error is at most `0.5/scale_factor`. Requires a power of two scale factor and no offset, see `errorBoundScaleFactor(maxError:)`
+    case pfor_lorenzo = 8
+
+    /// PFor integer compression with delta-of-delta coding along the last dimension. Suited for smooth time series if time is the fast dimension. Floating point values are scaled like `pfor_delta2d`
+    case pfor_dod = 9
+
+    /// Like `pfor_dod` but rows are first delta coded to the previous row like `pfor_delta2d`
+    case pfor_delta2d_dod = 10
+
+    /// Scale factor for `pfor_lorenzo` that keeps the absolute error of every value within `maxError`
+    public static func errorBoundScaleFactor(maxError: Double) -> Float {
+        return om_encoder_error_bound_scale_factor(maxError)
+    }
+
+    /// Number of mantissa bits to keep `significantDigits` decimal digits. Pass as `mantissaBits` to `prepareArray` with `fpx_xor2d`. Returns 0 (lossless) if the type has fewer mantissa bits.
+    public static func mantissaBits<OmType: OmFileArrayDataTypeProtocol>(significantDigits: UInt8, type: OmType.Type) -> UInt8 {
+        return om_encoder_mantissa_bits(OmType.dataTypeArray.toC(), significantDigits)
+    }
+
     func toC() -> OmCompression_t {
         switch self {
         case .pfor_delta2d_int16:
@@ -76,6 +110,72 @@ public enum CompressionType: UInt8, Codable {
             return COMPRESSION_PFOR_DELTA2D
         case .pfor_delta2d_int16_logarithmic:
             return COMPRESSION_PFOR_DELTA2D_INT16_LOGARITHMIC
+        case .fpx_fcm:
+            return COMPRESSION_FPX_FCM
+        case .fpx_dfcm:
+            return COMPRESSION_FPX_DFCM
+        case .fpx_2dfcm:
+            return COMPRESSION_FPX_2DFCM
+        case .pfor_lorenzo:
+            return COMPRESSION_PFOR_LORENZO
+        case .pfor_dod:
+            return COMPRESSION_PFOR_DOD
+        case .pfor_delta2d_dod:
+            return COMPRESSION_PFOR_DELTA2D_DOD
+        }
+    }
+}
+
+public enum LutEncoding: UInt8, Codable {
+    /// Blocks of 64 chunk offsets are compressed with PFor. Smallest LUT, but a read needs to decompress one block for each offset
+    case pfor = 0
+
+    /// Chunk offsets are stored with a fixed number of bytes. Single offsets can be read directly, which reduces index IO for sparse reads on remote files
+    case fixed_width = 1
+
+    /// Blocks of 64 chunk offsets are compressed with PFor without padding. Blocks are compressed while data is written, so the writer does not keep the entire LUT in memory
+    case pfor_variable = 2
+
+    func toC() -> OmLutEncoding_t {
+        switch self {
+        case .pfor:
+            return LUT_ENCODING_PFOR
+        case .fixed_width:
+            return LUT_ENCODING_FIXED_WIDTH
+        case .pfor_variable:
+            return LUT_ENCODING_PFOR_VARIABLE
+        }
+    }
+}
+
+public enum ReduceOperator: UInt8, Codable {
+    /// Sum of all values that are not NaN. 0 if all values are NaN
+    case sum = 0
+
+    /// Mean of all values that are not NaN
+    case mean = 1
+
+    /// Minimum of all values that are not NaN
+    case min = 2
+
+    /// Maximum of all values that are not NaN
+    case max = 3
+
+    /// Number of values that are not NaN
+    case count = 4
+
+    func toC() -> OmReduceOperator_t {
+        switch self {
+        case .sum:
+            return OM_REDUCE_SUM
+        case .mean:
+            return OM_REDUCE_MEAN
+        case .min:
+            return OM_REDUCE_MIN
+        case .max:
+            return OM_REDUCE_MAX
+        case .count:
+            return OM_REDUCE_COUNT
         }
     }
 }
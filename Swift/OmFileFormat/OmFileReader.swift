@@ -100,15 +100,44 @@ public struct OmFileReader<Backend: OmFileReaderBackend> {
     /// If it is an array of specified type. Return a type safe reader for this type
     /// `io_size_merge` The maximum size (in bytes) for merging consecutive IO operations. It helps to optimise read performance by merging small reads.
     /// `io_size_max` The maximum size (in bytes) for a single IO operation before it is split. It defines the threshold for splitting large reads.
-    public func asArray<OmType: OmFileArrayDataTypeProtocol>(of: OmType.Type, io_size_max: UInt64 = 65536, io_size_merge: UInt64 = 512) -> OmFileReaderArray<Backend, OmType>? {
-        guard OmType.dataTypeArray == self.dataType else {
+    /// `chunkCache` Optional cache of decompressed chunks. `chunkCacheFileId` must be unique for each file that uses the same cache.
+    public func asArray<OmType: OmFileArrayDataTypeProtocol>(of: OmType.Type, io_size_max: UInt64 = 65536, io_size_merge: UInt64 = 512, chunkCache: OmChunkCache? = nil, chunkCacheFileId: UInt64 = 0) -> OmFileReaderArray<Backend, OmType>? {
+        // Half precision arrays can also be read as float
+        let isHalf = self.dataType == .float16_array || self.dataType == .bfloat16_array
+        guard OmType.dataTypeArray == self.dataType || (isHalf && OmType.self == Float.self) else {
             return nil
         }
         return OmFileReaderArray(
             fn: fn,
             variable: variable,
             io_size_max: io_size_max,
-            io_size_merge: io_size_merge
+            io_size_merge: io_size_merge,
+            chunkCache: chunkCache,
+            chunkCacheFileId: chunkCacheFileId,
+            lutCache: nil
+        )
+    }
+
+    /// Same as `asArray` but keeps decoded LUT blocks for repeated reads with the returned reader if `lutCache` is set.
+    /// The LUT of memory mapped files is decoded at once. Throws if it is corrupted.
+    public func asArray<OmType: OmFileArrayDataTypeProtocol>(of: OmType.Type, io_size_max: UInt64 = 65536, io_size_merge: UInt64 = 512, chunkCache: OmChunkCache? = nil, chunkCacheFileId: UInt64 = 0, lutCache: Bool) throws -> OmFileReaderArray<Backend, OmType>? {
+        guard let array = asArray(of: of, io_size_max: io_size_max, io_size_merge: io_size_merge, chunkCache: chunkCache, chunkCacheFileId: chunkCacheFileId) else {
+            return nil
+        }
+        guard lutCache, let omLutCache = OmLutCache(variable: variable) else {
+            return array
+        }
+        if fn is MmapFile {
+            try omLutCache.load(fn: fn)
+        }
+        return OmFileReaderArray(
+            fn: fn,
+            variable: variable,
+            io_size_max: io_size_max,
+            io_size_merge: io_size_merge,
+            chunkCache: chunkCache,
+            chunkCacheFileId: chunkCacheFileId,
+            lutCache: omLutCache
         )
     }
 }
@@ -135,6 +164,14 @@ public struct OmFileReaderArray<Backend: OmFileReaderBackend, OmType: OmFileArra
 
     let io_size_merge: UInt64
 
+    /// Optional cache of decompressed chunks shared with other readers
+    let chunkCache: OmChunkCache?
+
+    let chunkCacheFileId: UInt64
+
+    /// Optional cache of decoded LUT blocks of this variable
+    public let lutCache: OmLutCache?
+
     public var compression: CompressionType {
         return CompressionType(rawValue: UInt8(om_variable_get_compression(variable).rawValue))!
     }
@@ -147,6 +184,11 @@ public struct OmFileReaderArray<Backend: OmFileReaderBackend, OmType: OmFileArra
         return om_variable_get_add_offset(variable)
     }
 
+    /// Number of mantissa bits kept by `fpx_xor2d` or 0 if values are stored lossless
+    public var mantissaBits: UInt8 {
+        return om_variable_get_mantissa_bits(variable)
+    }
+
     public func getDimensions() -> UnsafeBufferPointer<UInt64> {
         let dimensions = om_variable_get_dimensions(variable);
         return UnsafeBufferPointer<UInt64>(start: dimensions.values, count: Int(dimensions.count))
@@ -221,9 +263,59 @@ public struct OmFileReaderArray<Backend: OmFileReaderBackend, OmType: OmFileArra
         guard error == ERROR_OK else {
             throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
         }
+        let outputError = om_decoder_set_output_data_type(&decoder, OmType.dataTypeArray.toC())
+        guard outputError == ERROR_OK else {
+            throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(outputError)))
+        }
+        if let chunkCache {
+            om_decoder_set_chunk_cache(&decoder, chunkCache.cache, chunkCacheFileId)
+        }
+        if let lutCache {
+            om_decoder_set_lut_cache(&decoder, lutCache.cache)
+        }
+        try fn.setLutBlockOffsets(decoder: &decoder)
         try fn.decode(decoder: &decoder, into: into)
     }
 
+    /// Reduce a range over the dimensions in `dimensions` without decoding it into an array. The result has the shape of `range` with reduced dimensions collapsed to 1.
+    /// NaN values are ignored. Chunks are decoded row by row and accumulated in double precision.
+    public func reduce(range: [Range<UInt64>]? = nil, dimensions: Set<Int>, op: ReduceOperator) throws -> [Double] {
+        let range = range ?? self.getDimensions().map({ 0..<$0 })
+        let offset = range.map({$0.lowerBound})
+        let count = range.map({UInt64($0.count)})
+        var decoder = OmDecoder_t()
+        let error = om_decoder_init(&decoder, variable, UInt64(range.count), offset, count, nil, nil, io_size_merge, io_size_max)
+        guard error == ERROR_OK else {
+            throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
+        }
+        if let chunkCache {
+            om_decoder_set_chunk_cache(&decoder, chunkCache.cache, chunkCacheFileId)
+        }
+        if let lutCache {
+            om_decoder_set_lut_cache(&decoder, lutCache.cache)
+        }
+        try fn.setLutBlockOffsets(decoder: &decoder)
+        let reduceDimensions = range.indices.map { dimensions.contains($0) }
+        let n = Int(om_decoder_reduction_count(&decoder, reduceDimensions))
+        // Accumulators are referenced by the reduction and must remain allocated until it is finalised
+        var values = [Double](repeating: 0, count: n)
+        var counts = [UInt64](repeating: 0, count: n)
+        return try values.withUnsafeMutableBufferPointer { values -> [Double] in
+            try counts.withUnsafeMutableBufferPointer { counts -> [Double] in
+                var reduction = OmReduction_t()
+                let initError = om_decoder_reduction_init(&decoder, &reduction, op.toC(), reduceDimensions, values.baseAddress, counts.baseAddress)
+                guard initError == ERROR_OK else {
+                    throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(initError)))
+                }
+                try fn.reduce(decoder: &decoder, reduction: &reduction)
+                return [Double](unsafeUninitializedCapacity: n) {
+                    om_decoder_reduction_finalise(&reduction, $0.baseAddress)
+                    $1 = n
+                }
+            }
+        }
+    }
+
     /// Prefetch data
     public func willNeed(range: [Range<UInt64>]? = nil) throws {
         let range = range ?? self.getDimensions().map({ 0..<$0 })
@@ -254,7 +346,11 @@ public struct OmFileReaderArray<Backend: OmFileReaderBackend, OmType: OmFileArra
                 guard error == ERROR_OK else {
                     throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
                 }
-                fn.decodePrefetch(decoder: &decoder)
+                if let lutCache {
+                    om_decoder_set_lut_cache(&decoder, lutCache.cache)
+                }
+                try fn.setLutBlockOffsets(decoder: &decoder)
+                try fn.decodePrefetch(decoder: &decoder)
             })
         })
     }
@@ -325,11 +421,36 @@ public struct OmFileReaderArray<Backend: OmFileReaderBackend, OmType: OmFileArra
         guard error == ERROR_OK else {
             throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
         }
+        let outputError = om_decoder_set_output_data_type(&decoder, OmType.dataTypeArray.toC())
+        guard outputError == ERROR_OK else {
+            throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(outputError)))
+        }
+        if let chunkCache {
+            om_decoder_set_chunk_cache(&decoder, chunkCache.cache, chunkCacheFileId)
+        }
+        if let lutCache {
+            om_decoder_set_lut_cache(&decoder, lutCache.cache)
+        }
+        try fn.setLutBlockOffsets(decoder: &decoder)
         try await fn.decodeConcurrent(decoder: &decoder, into: into)
     }
 }
 
 extension OmFileReaderBackend {
+    /// Variable-length LUTs locate their LUT blocks with a block offset table at the end of the LUT. It is read once for each decoder.
+    /// Must be called after the LUT cache is set, because blocks in the cache do not require the table.
+    func setLutBlockOffsets(decoder: UnsafeMutablePointer<OmDecoder_t>) throws {
+        var offset: UInt64 = 0
+        var count: UInt64 = 0
+        guard om_decoder_lut_block_offsets_read(decoder, &offset, &count) else {
+            return
+        }
+        let blockOffsets = self.getData(offset: Int(offset), count: Int(count))
+        guard om_decoder_set_lut_block_offsets(decoder, blockOffsets, count) else {
+            throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(ERROR_OUT_OF_BOUND_READ)))
+        }
+    }
+
     /// Read and decode
     func decode(decoder: UnsafePointer<OmDecoder_t>, into: UnsafeMutableRawPointer) throws {
         var indexRead = OmDecoder_indexRead_t()
@@ -337,6 +458,11 @@ extension OmFileReaderBackend {
 
         /// The size to decode a single chunk
         let bufferSize = om_decoder_read_buffer_size(decoder)
+
+        /// Compressed chunk offsets to skip chunks that do not intersect the read
+        let chunkOffsetsCapacity = UInt64(OM_DECODER_CHUNK_OFFSETS_COUNT)
+        var chunkOffsets = [UInt64](repeating: 0, count: Int(chunkOffsetsCapacity))
+        var chunkOffsetsCount: UInt64 = 0
         try withUnsafeTemporaryAllocation(byteCount: Int(bufferSize), alignment: 1) { buffer in
             /// Loop over index blocks and read index data
             while om_decoder_next_index_read(decoder, &indexRead) {
@@ -348,10 +474,42 @@ extension OmFileReaderBackend {
 
                 var error: OmError_t = ERROR_OK
                 /// Loop over data blocks and read compressed data chunks
-                while om_decoder_next_data_read(decoder, &dataRead, indexData, indexRead.count, &error) {
+                while om_decoder_next_data_read_with_offsets(decoder, &dataRead, indexData, indexRead.count, &chunkOffsets, chunkOffsetsCapacity, &chunkOffsetsCount, &error) {
                     //print("Read data \(dataRead) for chunk index \(dataRead.chunkIndex)")
                     let dataData = self.getData(offset: Int(dataRead.offset), count: Int(dataRead.count))
-                    guard om_decoder_decode_chunks(decoder, dataRead.chunkIndex, dataData, dataRead.count, into, buffer.baseAddress, &error) else {
+                    guard om_decoder_decode_chunks_with_offsets(decoder, dataRead.chunkIndex, dataData, dataRead.count, chunkOffsets, chunkOffsetsCount, into, buffer.baseAddress, &error) else {
+                        throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
+                    }
+                }
+                guard error == ERROR_OK else {
+                    throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
+                }
+            }
+        }
+    }
+
+    /// Read and accumulate all chunks of a decoder into a reduction
+    func reduce(decoder: UnsafePointer<OmDecoder_t>, reduction: UnsafeMutablePointer<OmReduction_t>) throws {
+        var indexRead = OmDecoder_indexRead_t()
+        om_decoder_init_index_read(decoder, &indexRead)
+
+        /// The size to decode a single chunk and convert one row
+        let bufferSize = om_decoder_reduce_buffer_size(decoder)
+
+        let chunkOffsetsCapacity = UInt64(OM_DECODER_CHUNK_OFFSETS_COUNT)
+        var chunkOffsets = [UInt64](repeating: 0, count: Int(chunkOffsetsCapacity))
+        var chunkOffsetsCount: UInt64 = 0
+        try withUnsafeTemporaryAllocation(byteCount: Int(bufferSize), alignment: 8) { buffer in
+            while om_decoder_next_index_read(decoder, &indexRead) {
+                let indexData = self.getData(offset: Int(indexRead.offset), count: Int(indexRead.count))
+
+                var dataRead = OmDecoder_dataRead_t()
+                om_decoder_init_data_read(&dataRead, &indexRead)
+
+                var error: OmError_t = ERROR_OK
+                while om_decoder_next_data_read_with_offsets(decoder, &dataRead, indexData, indexRead.count, &chunkOffsets, chunkOffsetsCapacity, &chunkOffsetsCount, &error) {
+                    let dataData = self.getData(offset: Int(dataRead.offset), count: Int(dataRead.count))
+                    guard om_decoder_reduce_chunks_with_offsets(decoder, reduction, dataRead.chunkIndex, dataData, dataRead.count, chunkOffsets, chunkOffsetsCount, buffer.baseAddress, &error) else {
                         throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
                     }
                 }
@@ -364,7 +522,7 @@ extension OmFileReaderBackend {
 
     /// Read and decode
     /// Note: This function uses more memory
-    /// Decodes chunks concurrently (limited by io sizes). Only `om_decoder_decode_chunks` is called concurrently
+    /// Decodes chunks concurrently (limited by io sizes). Only `om_decoder_decode_chunks_with_offsets` is called concurrently
     func decodeConcurrent(decoder: UnsafePointer<OmDecoder_t>, into: UnsafeMutableRawPointer) async throws {
         var indexRead = OmDecoder_indexRead_t()
         om_decoder_init_index_read(decoder, &indexRead)
@@ -373,6 +531,11 @@ extension OmFileReaderBackend {
             /// The size to decode a single chunk
             let bufferSize = om_decoder_read_buffer_size(decoder)
 
+            /// Compressed chunk offsets to skip chunks that do not intersect the read
+            let chunkOffsetsCapacity = UInt64(OM_DECODER_CHUNK_OFFSETS_COUNT)
+            var chunkOffsets = [UInt64](repeating: 0, count: Int(chunkOffsetsCapacity))
+            var chunkOffsetsCount: UInt64 = 0
+
             /// Loop over index blocks and read index data
             while om_decoder_next_index_read(decoder, &indexRead) {
                 //print("Read index \(indexRead)")
@@ -383,16 +546,17 @@ extension OmFileReaderBackend {
 
                 var error: OmError_t = ERROR_OK
                 /// Loop over data blocks and read compressed data chunks
-                while om_decoder_next_data_read(decoder, &dataRead, indexData, indexRead.count, &error) {
+                while om_decoder_next_data_read_with_offsets(decoder, &dataRead, indexData, indexRead.count, &chunkOffsets, chunkOffsetsCapacity, &chunkOffsetsCount, &error) {
                     //print("ENQUEUE chunk index \(dataRead.chunkIndex)")
                     let dataReadOffset = dataRead.offset
                     let dataReadCount = dataRead.count
                     let chunkIndex = dataRead.chunkIndex
+                    let offsets = Array(chunkOffsets[0..<Int(chunkOffsetsCount)])
                     group.addTask {
                         try withUnsafeTemporaryAllocation(byteCount: Int(bufferSize), alignment: 1) { buffer in
                             //print("Read data chunk index \(chunkIndex), count=\(dataReadCount)")
                             let dataData = self.getData(offset: Int(dataReadOffset), count: Int(dataReadCount))
-                            guard om_decoder_decode_chunks(decoder, chunkIndex, dataData, dataReadCount, into, buffer.baseAddress, &error) else {
+                            guard om_decoder_decode_chunks_with_offsets(decoder, chunkIndex, dataData, dataReadCount, offsets, UInt64(offsets.count), into, buffer.baseAddress, &error) else {
                                 throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
                             }
                         }
@@ -407,7 +571,7 @@ extension OmFileReaderBackend {
     }
 
     /// Do an madvice to load data chunks from disk into page cache in the background
-    func decodePrefetch(decoder: UnsafePointer<OmDecoder_t>) {
+    func decodePrefetch(decoder: UnsafePointer<OmDecoder_t>) throws {
         var indexRead = OmDecoder_indexRead_t()
         om_decoder_init_index_read(decoder, &indexRead)
 
@@ -423,6 +587,9 @@ extension OmFileReaderBackend {
             while om_decoder_next_data_read(decoder, &dataRead, indexData, indexRead.count, &error) {
                 self.prefetchData(offset: Int(dataRead.offset), count: Int(dataRead.count))
             }
+            guard error == ERROR_OK else {
+                throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
+            }
         }
     }
 }
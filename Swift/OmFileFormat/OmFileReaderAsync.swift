@@ -113,15 +113,19 @@ public struct OmFileReaderAsync<Backend: OmFileReaderBackendAsync> {
     /// If it is an array of specified type. Return a type safe reader for this type
     /// `io_size_merge` The maximum size (in bytes) for merging consecutive IO operations. It helps to optimise read performance by merging small reads.
     /// `io_size_max` The maximum size (in bytes) for a single IO operation before it is split. It defines the threshold for splitting large reads.
-    public func asArray<OmType: OmFileArrayDataTypeProtocol>(of: OmType.Type, io_size_max: UInt64 = 65536, io_size_merge: UInt64 = 512) -> OmFileReaderAsyncArray<Backend, OmType>? {
-        guard OmType.dataTypeArray == self.dataType else {
+    /// `ioCostModel` Merge and split IO operations by the expected time of a latency and bandwidth model instead of `io_size_merge` and `io_size_max`. The model is updated with the duration of each read.
+    public func asArray<OmType: OmFileArrayDataTypeProtocol>(of: OmType.Type, io_size_max: UInt64 = 65536, io_size_merge: UInt64 = 512, ioCostModel: OmIoCostModel? = nil) -> OmFileReaderAsyncArray<Backend, OmType>? {
+        // Half precision arrays can also be read as float
+        let isHalf = self.dataType == .float16_array || self.dataType == .bfloat16_array
+        guard OmType.dataTypeArray == self.dataType || (isHalf && OmType.self == Float.self) else {
             return nil
         }
         return OmFileReaderAsyncArray(
             fn: fn,
             variable: variable,
             io_size_max: io_size_max,
-            io_size_merge: io_size_merge
+            io_size_merge: io_size_merge,
+            ioCostModel: ioCostModel
         )
     }
 }
@@ -138,6 +142,9 @@ public struct OmFileReaderAsyncArray<Backend: OmFileReaderBackendAsync, OmType:
 
     let io_size_merge: UInt64
 
+    /// If set, IO operations are merged by expected time and the model learns from observed read durations
+    let ioCostModel: OmIoCostModel?
+
     public var compression: CompressionType {
         return variable.withUnsafeBytes({
             let variable = om_variable_init($0.baseAddress)
@@ -159,6 +166,14 @@ public struct OmFileReaderAsyncArray<Backend: OmFileReaderBackendAsync, OmType:
         })
     }
 
+    /// Number of mantissa bits kept by `fpx_xor2d` or 0 if values are stored lossless
+    public var mantissaBits: UInt8 {
+        return variable.withUnsafeBytes({
+            let variable = om_variable_init($0.baseAddress)
+            return om_variable_get_mantissa_bits(variable)
+        })
+    }
+
     /// Zero copy access to dimensions
     public func withDimensions<R>(_ body: (_: UnsafeBufferPointer<UInt64>) -> R) -> R {
         return variable.withUnsafeBytes({
@@ -251,10 +266,17 @@ public struct OmFileReaderAsyncArray<Backend: OmFileReaderBackendAsync, OmType:
             guard error == ERROR_OK else {
                 throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
             }
+            let outputError = om_decoder_set_output_data_type(&decoder, OmType.dataTypeArray.toC())
+            guard outputError == ERROR_OK else {
+                throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(outputError)))
+            }
+            ioCostModel?.configure(decoder: &decoder)
             return decoder
         })
+        let lutBlockOffsets = try await fn.readLutBlockOffsets(decoder: &decoder, ioCostModel: ioCostModel)
+        defer { lutBlockOffsets?.deallocate() }
         // TODO: Technically memory from `variable` is escaping through decoder. Consider copy all dimension information into decoder
-        try await fn.decode(decoder: &decoder, into: into)
+        try await fn.decode(decoder: &decoder, into: into, ioCostModel: ioCostModel)
     }
 
     /// Prefetch data
@@ -361,38 +383,68 @@ public struct OmFileReaderAsyncArray<Backend: OmFileReaderBackendAsync, OmType:
             guard error == ERROR_OK else {
                 throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
             }
+            let outputError = om_decoder_set_output_data_type(&decoder, OmType.dataTypeArray.toC())
+            guard outputError == ERROR_OK else {
+                throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(outputError)))
+            }
+            ioCostModel?.configure(decoder: &decoder)
             return decoder
         })
+        let lutBlockOffsets = try await fn.readLutBlockOffsets(decoder: &decoder, ioCostModel: ioCostModel)
+        defer { lutBlockOffsets?.deallocate() }
         // TODO: Technically memory from `variable` is escaping through decoder. Consider copy all dimension information into decoder
-        try await fn.decodeConcurrent(decoder: &decoder, into: into)
+        try await fn.decodeConcurrent(decoder: &decoder, into: into, ioCostModel: ioCostModel)
     }
 }
 
 extension OmFileReaderBackendAsync {
+    /// Variable-length LUTs locate their LUT blocks with a block offset table at the end of the LUT. It is read once for each decoder.
+    /// Returns a copy of the table that must remain allocated while decoding or nil if the table is not required.
+    func readLutBlockOffsets(decoder: UnsafeMutablePointer<OmDecoder_t>, ioCostModel: OmIoCostModel? = nil) async throws -> UnsafeMutableRawBufferPointer? {
+        var offset: UInt64 = 0
+        var count: UInt64 = 0
+        guard om_decoder_lut_block_offsets_read(decoder, &offset, &count) else {
+            return nil
+        }
+        let data = try await self.getData(offset: Int(offset), count: Int(count), ioCostModel: ioCostModel)
+        let blockOffsets = UnsafeMutableRawBufferPointer.allocate(byteCount: Int(count), alignment: 8)
+        data.withUnsafeBytes({ blockOffsets.copyMemory(from: $0) })
+        guard om_decoder_set_lut_block_offsets(decoder, blockOffsets.baseAddress, count) else {
+            blockOffsets.deallocate()
+            throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(ERROR_OUT_OF_BOUND_READ)))
+        }
+        return blockOffsets
+    }
+
     /// Read and decode
-    func decode(decoder: UnsafePointer<OmDecoder_t>, into: UnsafeMutableRawPointer) async throws {
+    func decode(decoder: UnsafePointer<OmDecoder_t>, into: UnsafeMutableRawPointer, ioCostModel: OmIoCostModel? = nil) async throws {
         var indexRead = OmDecoder_indexRead_t()
         om_decoder_init_index_read(decoder, &indexRead)
 
         /// The size to decode a single chunk
         let bufferSize = om_decoder_read_buffer_size(decoder)
 
+        /// Compressed chunk offsets to skip chunks that do not intersect the read
+        let chunkOffsetsCapacity = UInt64(OM_DECODER_CHUNK_OFFSETS_COUNT)
+        var chunkOffsets = [UInt64](repeating: 0, count: Int(chunkOffsetsCapacity))
+        var chunkOffsetsCount: UInt64 = 0
+
         /// Loop over index blocks and read index data
         while om_decoder_next_index_read(decoder, &indexRead) {
             //print("Read index \(indexRead)")
-            let indexData = try await self.getData(offset: Int(indexRead.offset), count: Int(indexRead.count))
+            let indexData = try await self.getData(offset: Int(indexRead.offset), count: Int(indexRead.count), ioCostModel: ioCostModel)
 
             var dataRead = OmDecoder_dataRead_t()
             om_decoder_init_data_read(&dataRead, &indexRead)
 
             var error: OmError_t = ERROR_OK
                 /// Loop over data blocks and read compressed data chunks
-            while indexData.withUnsafeBytes({ om_decoder_next_data_read(decoder, &dataRead, $0.baseAddress, indexRead.count, &error) }) {
+            while indexData.withUnsafeBytes({ om_decoder_next_data_read_with_offsets(decoder, &dataRead, $0.baseAddress, indexRead.count, &chunkOffsets, chunkOffsetsCapacity, &chunkOffsetsCount, &error) }) {
                 //print("Read data \(dataRead) for chunk index \(dataRead.chunkIndex)")
-                let dataData = try await self.getData(offset: Int(dataRead.offset), count: Int(dataRead.count))
+                let dataData = try await self.getData(offset: Int(dataRead.offset), count: Int(dataRead.count), ioCostModel: ioCostModel)
                 try dataData.withUnsafeBytes({ dataData in
                     try withUnsafeTemporaryAllocation(byteCount: Int(bufferSize), alignment: 1) { buffer in
-                        guard om_decoder_decode_chunks(decoder, dataRead.chunkIndex, dataData.baseAddress, dataRead.count, into, buffer.baseAddress, &error) else {
+                        guard om_decoder_decode_chunks_with_offsets(decoder, dataRead.chunkIndex, dataData.baseAddress, dataRead.count, chunkOffsets, chunkOffsetsCount, into, buffer.baseAddress, &error) else {
                             throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
                         }
                     }
@@ -406,47 +458,65 @@ extension OmFileReaderBackendAsync {
 
     /// Read and decode
     /// Note: This function uses more memory
-    /// Decodes chunks concurrently (limited by io sizes). Only `om_decoder_decode_chunks` is called concurrently
-    func decodeConcurrent(decoder: UnsafePointer<OmDecoder_t>, into: UnsafeMutableRawPointer) async throws {
+    /// All index reads are issued at once. Data reads of each index read are collected in one batch and fetched and decoded concurrently.
+    func decodeConcurrent(decoder: UnsafePointer<OmDecoder_t>, into: UnsafeMutableRawPointer, ioCostModel: OmIoCostModel? = nil) async throws {
         var indexRead = OmDecoder_indexRead_t()
         om_decoder_init_index_read(decoder, &indexRead)
 
+        /// The size to decode a single chunk
+        let bufferSize = om_decoder_read_buffer_size(decoder)
+
+        /// Index reads do not depend on each other and can be fetched concurrently
+        var indexReads = [OmDecoder_indexRead_t]()
+        var indexReadsBatch = [OmDecoder_indexRead_t](repeating: OmDecoder_indexRead_t(), count: 64)
+        var indexReadsCount: UInt64 = 0
+        while om_decoder_next_index_reads(decoder, &indexRead, &indexReadsBatch, UInt64(indexReadsBatch.count), &indexReadsCount) {
+            indexReads.append(contentsOf: indexReadsBatch[0..<Int(indexReadsCount)])
+        }
+
         try await withThrowingTaskGroup(of: Void.self) { group in
-            /// The size to decode a single chunk
-            let bufferSize = om_decoder_read_buffer_size(decoder)
-
-            /// Loop over index blocks and read index data
-            while om_decoder_next_index_read(decoder, &indexRead) {
-                //print("Read index \(indexRead)")
-                let indexData = try await self.getData(offset: Int(indexRead.offset), count: Int(indexRead.count))
-
-                var dataRead = OmDecoder_dataRead_t()
-                om_decoder_init_data_read(&dataRead, &indexRead)
-
-                var error: OmError_t = ERROR_OK
-                indexData.withUnsafeBytes({ indexData in
-                    /// Loop over data blocks and read compressed data chunks
-                    while om_decoder_next_data_read(decoder, &dataRead, indexData.baseAddress, indexRead.count, &error) {
-                        //print("ENQUEUE chunk index \(dataRead.chunkIndex)")
-                        let dataReadOffset = dataRead.offset
-                        let dataReadCount = dataRead.count
-                        let chunkIndex = dataRead.chunkIndex
-                        group.addTask {
-                            //print("Read data chunk index \(chunkIndex), count=\(dataReadCount)")
-                            let dataData = try await self.getData(offset: Int(dataReadOffset), count: Int(dataReadCount))
-                            try withUnsafeTemporaryAllocation(byteCount: Int(bufferSize), alignment: 8) { buffer in
-                                try dataData.withUnsafeBytes({ dataData in
-                                    var error: OmError_t = ERROR_OK
-                                    guard om_decoder_decode_chunks(decoder, chunkIndex, dataData.baseAddress, dataReadCount, into, buffer.baseAddress, &error) else {
-                                        throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
-                                    }
-                                })
+            for indexRead in indexReads {
+                group.addTask {
+                    var indexRead = indexRead
+                    let indexData = try await self.getData(offset: Int(indexRead.offset), count: Int(indexRead.count), ioCostModel: ioCostModel)
+
+                    /// Capacities are large enough to collect all data reads of this index read at once
+                    var dataReadsCapacity: UInt64 = 0
+                    var chunkOffsetsCapacity: UInt64 = 0
+                    om_decoder_data_reads_capacity(&indexRead, &dataReadsCapacity, &chunkOffsetsCapacity)
+                    var dataReads = [OmDecoder_dataReadRequest_t](repeating: OmDecoder_dataReadRequest_t(), count: Int(dataReadsCapacity))
+                    var chunkOffsets = [UInt64](repeating: 0, count: Int(chunkOffsetsCapacity))
+                    var dataReadsCount: UInt64 = 0
+                    var chunkOffsetsCount: UInt64 = 0
+
+                    var dataRead = OmDecoder_dataRead_t()
+                    om_decoder_init_data_read(&dataRead, &indexRead)
+                    var error: OmError_t = ERROR_OK
+                    _ = indexData.withUnsafeBytes({
+                        om_decoder_next_data_reads(decoder, &dataRead, $0.baseAddress, indexRead.count, &dataReads, dataReadsCapacity, &dataReadsCount, &chunkOffsets, chunkOffsetsCapacity, &chunkOffsetsCount, &error)
+                    })
+                    guard error == ERROR_OK else {
+                        throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
+                    }
+
+                    try await withThrowingTaskGroup(of: Void.self) { group in
+                        for dataRead in dataReads[0..<Int(dataReadsCount)] {
+                            let offsets = Array(chunkOffsets[Int(dataRead.chunkOffsetsStart)..<Int(dataRead.chunkOffsetsStart + dataRead.chunkOffsetsCount)])
+                            group.addTask {
+                                //print("Read data chunk index \(dataRead.chunkIndex), count=\(dataRead.count)")
+                                let dataData = try await self.getData(offset: Int(dataRead.offset), count: Int(dataRead.count), ioCostModel: ioCostModel)
+                                try withUnsafeTemporaryAllocation(byteCount: Int(bufferSize), alignment: 8) { buffer in
+                                    try dataData.withUnsafeBytes({ dataData in
+                                        var error: OmError_t = ERROR_OK
+                                        guard om_decoder_decode_chunks_with_offsets(decoder, dataRead.chunkIndex, dataData.baseAddress, dataRead.count, offsets, UInt64(offsets.count), into, buffer.baseAddress, &error) else {
+                                            throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
+                                        }
+                                    })
+                                }
                             }
                         }
+                        try await group.waitForAll()
                     }
-                })
-                guard error == ERROR_OK else {
-                    throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
                 }
             }
             try await group.waitForAll()
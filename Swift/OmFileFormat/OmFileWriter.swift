@@ -11,152 +11,156 @@ import Foundation
 
 /// Writes om file header and trailer
 public struct OmFileWriter<FileHandle: OmFileWriterBackend> {
-    let buffer: OmBufferedWriter<FileHandle>
+    let writer: OmWriterHandle
 
     public init(fn: FileHandle, initialCapacity: Int) {
-        self.buffer = OmBufferedWriter(backend: fn, initialCapacity: initialCapacity)
+        self.writer = OmWriterHandle(backend: fn, initialCapacity: initialCapacity)
     }
 
+    /// The header is written when the writer is created
     public func writeHeaderIfRequired() throws {
-        if buffer.totalBytesWritten > 0 {
-            return
-        }
-        /// Write header
-        let size = om_header_write_size()
-        try buffer.reallocate(minimumCapacity: size)
-        om_header_write(buffer.bufferAtWritePosition)
-        buffer.incrementWritePosition(by: size)
     }
 
     public func write<OmType: OmFileScalarDataTypeProtocol>(value: OmType, name: String, children: [OmOffsetSize]) throws -> OmOffsetSize {
-        try writeHeaderIfRequired()
         var name = name
         return try name.withUTF8{ name in
             guard name.count <= UInt16.max else { fatalError() }
             guard children.count <= UInt32.max else { fatalError() }
-            let type = OmType.dataTypeScalar.toC()
-            try buffer.alignTo64Bytes()
-            let size = om_variable_write_scalar_size(UInt16(name.count), UInt32(children.count), type, 0)
-            let offset = UInt64(buffer.totalBytesWritten)
-            try buffer.reallocate(minimumCapacity: Int(size))
-            var value = value
-            withUnsafePointer(to: &value, { value in
-                let childrenOffsets = children.map {$0.offset}
-                let childrenSizes = children.map {$0.size}
-                om_variable_write_scalar(buffer.bufferAtWritePosition, UInt16(name.count), UInt32(children.count), childrenOffsets, childrenSizes, name.baseAddress, type, value, Int(name.count))
-            })
-            buffer.incrementWritePosition(by: size)
-            return OmOffsetSize(offset: offset, size: UInt64(size))
+            let childrenOffsets = children.map {$0.offset}
+            let childrenSizes = children.map {$0.size}
+            var offset: UInt64 = 0
+            var size: UInt64 = 0
+            var error = ERROR_OK
+            let success = value.withOmBytes { value in
+                om_writer_write_scalar(writer.writer, name.baseAddress, UInt16(name.count), UInt32(children.count), childrenOffsets, childrenSizes, OmType.dataTypeScalar.toC(), value.baseAddress, value.count, &offset, &size, &error)
+            }
+            guard success else {
+                throw writer.error(error)
+            }
+            return OmOffsetSize(offset: offset, size: size)
         }
     }
 
-    public func prepareArray<OmType: OmFileArrayDataTypeProtocol>(type: OmType.Type, dimensions: [UInt64], chunkDimensions: [UInt64], compression: CompressionType, scale_factor: Float, add_offset: Float) throws -> OmFileWriterArray<OmType, FileHandle> {
-        try writeHeaderIfRequired()
-        return try .init(dimensions: dimensions, chunkDimensions: chunkDimensions, compression: compression, scale_factor: scale_factor, add_offset: add_offset, buffer: buffer)
+    /// `lutEncoding` `.fixed_width` produces a larger LUT, but readers can resolve single chunk offsets without decompressing LUT blocks
+    /// With `threads` larger than 1, chunks are compressed in parallel. `inFlightChunks` limits how many compressed chunks are kept in memory before they are written. 0 uses 16 chunks per thread.
+    /// `chunkStatistics` stores min, max, sum and NaN count of each chunk, so that readers can skip chunks without matching values
+    /// `constantChunks` stores chunks with a single value, e.g. all NaN, as one value. Readers fill them without decompression.
+    /// `mantissaBits` rounds values of `fpx_xor2d` arrays to fewer mantissa bits, see `CompressionType.mantissaBits(significantDigits:type:)`. 0 is lossless.
+    public func prepareArray<OmType: OmFileArrayDataTypeProtocol>(type: OmType.Type, dimensions: [UInt64], chunkDimensions: [UInt64], compression: CompressionType, scale_factor: Float, add_offset: Float, lutEncoding: LutEncoding = .pfor, threads: Int = 1, inFlightChunks: Int = 0, chunkStatistics: Bool = false, constantChunks: Bool = false, mantissaBits: UInt8 = 0) throws -> OmFileWriterArray<OmType, FileHandle> {
+        return try .init(dimensions: dimensions, chunkDimensions: chunkDimensions, compression: compression, scale_factor: scale_factor, add_offset: add_offset, lutEncoding: lutEncoding, threads: threads, inFlightChunks: inFlightChunks, chunkStatistics: chunkStatistics, constantChunks: constantChunks, mantissaBits: mantissaBits, writer: writer)
     }
 
     public func write(array: OmFileWriterArrayFinalised, name: String, children: [OmOffsetSize]) throws -> OmOffsetSize {
-        try writeHeaderIfRequired()
-        guard array.dimensions.count == array.chunks.count else {
-            fatalError()
-        }
         var name = name
         return try name.withUTF8{ name in
             guard name.count <= UInt16.max else { fatalError() }
-            try buffer.alignTo64Bytes()
-            let size = om_variable_write_numeric_array_size(UInt16(name.count), UInt32(children.count), UInt64(array.dimensions.count))
-            let offset = UInt64(buffer.totalBytesWritten)
-            try buffer.reallocate(minimumCapacity: Int(size))
+            guard children.count <= UInt32.max else { fatalError() }
             let childrenOffsets = children.map {$0.offset}
             let childrenSizes = children.map {$0.size}
-            om_variable_write_numeric_array(buffer.bufferAtWritePosition, UInt16(name.count), UInt32(children.count), childrenOffsets, childrenSizes, name.baseAddress, array.datatype.toC(), array.compression.toC(), array.scale_factor, array.add_offset, UInt64(array.dimensions.count), array.dimensions, array.chunks, UInt64(array.lutSize), UInt64(array.lutOffset))
-            buffer.incrementWritePosition(by: size)
-            return OmOffsetSize(offset: offset, size: UInt64(size))
+            var offset: UInt64 = 0
+            var size: UInt64 = 0
+            var error = ERROR_OK
+            guard om_writer_write_array(writer.writer, array.array.array, name.baseAddress, UInt16(name.count), UInt32(children.count), childrenOffsets, childrenSizes, &offset, &size, &error) else {
+                throw writer.error(error)
+            }
+            return OmOffsetSize(offset: offset, size: size)
         }
     }
 
+    /// Write the trailer and flush all data to the backend
     public func writeTrailer(rootVariable: OmOffsetSize) throws {
-        try writeHeaderIfRequired()
-        try buffer.alignTo64Bytes()
-
-        // write length of JSON
-        let size = om_trailer_size()
-        try buffer.reallocate(minimumCapacity: size)
-        om_trailer_write(buffer.bufferAtWritePosition, rootVariable.offset, rootVariable.size)
-        buffer.incrementWritePosition(by: size)
-
-        // Flush
-        try buffer.writeToFile()
+        var error = ERROR_OK
+        guard om_writer_write_trailer(writer.writer, rootVariable.offset, rootVariable.size, &error) else {
+            throw writer.error(error)
+        }
     }
 }
 
-/// Compress a single variable inside an om file. A om file may contain multiple variables
-public final class OmFileWriterArray<OmType: OmFileArrayDataTypeProtocol, FileHandle: OmFileWriterBackend> {
-    /// Store all byte offsets where our compressed chunks start. Later, we want to decompress chunk 1234 and know it starts at byte offset 5346545
-    private var lookUpTable: [UInt64]
-
-    private var encoder: OmEncoder_t
+/// Receives filled buffers of the C writer. Keeps the error of the backend, because the C writer only reports `ERROR_IO_WRITE`.
+final class OmWriterSinkContext {
+    let write: (UnsafeRawBufferPointer) throws -> Void
+    var error: Error? = nil
 
-    /// Position of last chunk that has been written
-    var chunkIndex: Int = 0
+    init(write: @escaping (UnsafeRawBufferPointer) throws -> Void) {
+        self.write = write
+    }
+}
 
-    /// The scalefactor that is applied to all write data
-    let scale_factor: Float
+/// Owns the C writer that assembles the file. The writer buffers data and passes filled buffers to the backend.
+final class OmWriterHandle {
+    let writer: OpaquePointer
+
+    /// Referenced by the C writer. Must live as long as `writer`.
+    let context: OmWriterSinkContext
+
+    init<FileHandle: OmFileWriterBackend>(backend: FileHandle, initialCapacity: Int) {
+        let context = OmWriterSinkContext(write: { try backend.write(contentsOf: $0) })
+        let sink = OmWriterSink_t(write: { context, data, size in
+            let sinkContext = Unmanaged<OmWriterSinkContext>.fromOpaque(context!).takeUnretainedValue()
+            do {
+                try sinkContext.write(UnsafeRawBufferPointer(start: data, count: Int(size)))
+                return true
+            } catch {
+                sinkContext.error = error
+                return false
+            }
+        }, take: nil, context: Unmanaged.passUnretained(context).toOpaque())
+        guard let writer = om_writer_create(sink, UInt64(initialCapacity), 1) else {
+            fatalError("om_writer_create failed")
+        }
+        self.writer = writer
+        self.context = context
+    }
 
-    /// The offset that is applied to all write data
-    let add_offset: Float
+    /// The error of the backend if writing failed, otherwise `error` of the C writer
+    func error(_ error: OmError_t) -> Error {
+        if let backendError = context.error {
+            context.error = nil
+            return backendError
+        }
+        return OmFileFormatSwiftError.omEncoder(error: String(cString: om_error_string(error)))
+    }
 
-    /// Type of compression and coding. E.g. delta, zigzag coding is then implemented in different compression routines
-    let compression: CompressionType
+    deinit {
+        om_writer_destroy(writer)
+    }
+}
 
-    /// The dimensions of the file
-    var dimensions: [UInt64]
+/// Owns a C array of the writer. Shared by `OmFileWriterArray` and `OmFileWriterArrayFinalised`.
+final class OmWriterArrayHandle {
+    let array: OpaquePointer
 
-    /// How the dimensions are chunked
-    var chunks: [UInt64]
+    /// The array keeps a pointer to the writer
+    let writer: OmWriterHandle
 
-    let compressedChunkBufferSize: UInt64
+    init(array: OpaquePointer, writer: OmWriterHandle) {
+        self.array = array
+        self.writer = writer
+    }
 
-    let chunkBuffer: UnsafeMutableRawBufferPointer
+    deinit {
+        om_writer_array_destroy(array)
+    }
+}
 
-    /// Temporarily write data here. Keeps also track of `totalBytesWritten`
-    let buffer: OmBufferedWriter<FileHandle>
+/// Compress a single variable inside an om file. A om file may contain multiple variables
+public final class OmFileWriterArray<OmType: OmFileArrayDataTypeProtocol, FileHandle: OmFileWriterBackend> {
+    let array: OmWriterArrayHandle
 
+    /// The dimensions of the file
+    let dimensions: [UInt64]
 
-    public init(dimensions: [UInt64], chunkDimensions: [UInt64], compression: CompressionType, scale_factor: Float, add_offset: Float, buffer: OmBufferedWriter<FileHandle>) throws {
+    init(dimensions: [UInt64], chunkDimensions: [UInt64], compression: CompressionType, scale_factor: Float, add_offset: Float, lutEncoding: LutEncoding = .pfor, threads: Int = 1, inFlightChunks: Int = 0, chunkStatistics: Bool = false, constantChunks: Bool = false, mantissaBits: UInt8 = 0, writer: OmWriterHandle) throws {
 
         assert(dimensions.count == chunkDimensions.count)
 
-        self.chunks = chunkDimensions
         self.dimensions = dimensions
-        self.compression = compression
-        self.scale_factor = scale_factor
-        self.add_offset = add_offset
-
-        // Note: The encoder keeps the pointer to `&self.dimensions`. It is important that this array is not deallocated!
-        self.encoder = OmEncoder_t()
-        let error = om_encoder_init(&encoder, scale_factor, add_offset, compression.toC(), OmType.dataTypeArray.toC(), &self.dimensions, &self.chunks, UInt64(dimensions.count))
-
-        guard error == ERROR_OK else {
+        om_writer_set_threads(writer.writer, UInt32(max(threads, 1)), UInt64(inFlightChunks))
+        var error = ERROR_OK
+        guard let array = om_writer_array_create(writer.writer, OmType.dataTypeArray.toC(), compression.toC(), lutEncoding.toC(), scale_factor, add_offset, dimensions, chunkDimensions, UInt64(dimensions.count), chunkStatistics, constantChunks, mantissaBits, &error) else {
             throw OmFileFormatSwiftError.omEncoder(error: String(cString: om_error_string(error)))
         }
-
-        /// Number of total chunks in the compressed files
-        let nChunks = om_encoder_count_chunks(&encoder)
-
-        /// This is the minimum output buffer size for each compressed size. In practice the buffer should be much larger.
-        self.compressedChunkBufferSize = om_encoder_compressed_chunk_buffer_size(&encoder)
-
-        let chunkBufferSize = om_encoder_chunk_buffer_size(&encoder)
-
-        /// Each thread needs its own chunk buffer to compress data. This implementation is single threaded
-        self.chunkBuffer = UnsafeMutableRawBufferPointer.allocate(byteCount: Int(chunkBufferSize), alignment: 1)
-        chunkBuffer.initializeMemory(as: UInt8.self, repeating: 0)
-
-        /// Allocate space for a lookup table. Needs to be number_of_chunks+1 to store start address and for each chunk then end address
-        self.lookUpTable = .init(repeating: 0, count: Int(nChunks) + 1)
-
-        self.buffer = buffer
+        self.array = OmWriterArrayHandle(array: array, writer: writer)
     }
 
     /// Compress data and write it to file. Can be all, a single or multiple chunks. If multiple chunks are given at once, they must align with chunks.
@@ -183,88 +187,28 @@ public final class OmFileWriterArray<OmType: OmFileArrayDataTypeProtocol, FileHa
         assert(arrayOffset.allSatisfy({$0 >= 0}))
         assert(zip(arrayDimensions, zip(arrayOffset, arrayCount)).allSatisfy { $1.0 + $1.1 <= $0 })
 
-        /// For performance the output buffer should be able to hold a multiple of the chunk buffer size
-        try buffer.reallocate(minimumCapacity: Int(compressedChunkBufferSize) * 4)
-
-        /// How many chunks can be written to the output. This could be only a single one, or multiple
-        let numberOfChunksInArray = om_encoder_count_chunks_in_array(&encoder, arrayCount)
-
-        /// Store data start address if this is the first time this read is called
-        if chunkIndex == 0 {
-            lookUpTable[chunkIndex] = UInt64(buffer.totalBytesWritten)
-        }
-
-        // This loop could be done in parallel. However, the order of chunks must remain the same in the LUT and final output buffer.
-        // For multithreading, multiple buffers are required that need to be copied into the final buffer afterwards
-        for chunkIndexOffsetInThisArray in 0..<numberOfChunksInArray {
-            try buffer.reallocate(minimumCapacity: Int(compressedChunkBufferSize))
-
-            let bytes_written = om_encoder_compress_chunk(
-                &encoder,
-                pointer.baseAddress,
-                arrayDimensions,
-                arrayOffset,
-                arrayCount,
-                UInt64(chunkIndex),
-                chunkIndexOffsetInThisArray,
-                buffer.bufferAtWritePosition,
-                chunkBuffer.baseAddress
-            )
-
-            buffer.incrementWritePosition(by: Int(bytes_written))
-
-            // Store chunk offset in LUT
-            lookUpTable[chunkIndex+1] = UInt64(buffer.totalBytesWritten)
-            chunkIndex += 1
+        var error = ERROR_OK
+        guard om_writer_array_write(array.array, pointer.baseAddress, arrayDimensions, arrayOffset, arrayCount, &error) else {
+            throw array.writer.error(error)
         }
     }
 
-    /// Compress the lookup table and write it to the output buffer
+    /// Write chunk statistics and the lookup table after all chunks have been written
     public func finalise() throws -> OmFileWriterArrayFinalised {
-        let lut_offset = buffer.totalBytesWritten
-
-        /// The size of the total compressed LUT including some padding
-        let buffer_size = om_encoder_lut_buffer_size(lookUpTable, UInt64(lookUpTable.count))
-        try buffer.reallocate(minimumCapacity: Int(buffer_size))
-
-        /// Compress the LUT and return the actual compressed LUT size
-        let compressed_lut_size = om_encoder_compress_lut(lookUpTable, UInt64(lookUpTable.count), buffer.bufferAtWritePosition, buffer_size)
-        buffer.incrementWritePosition(by: Int(compressed_lut_size))
-        return OmFileWriterArrayFinalised(
-            scale_factor: scale_factor,
-            add_offset: add_offset,
-            compression: compression,
-            datatype: OmType.dataTypeArray,
-            dimensions: dimensions,
-            chunks: chunks,
-            lutSize: compressed_lut_size,
-            lutOffset: UInt64(lut_offset)
-        )
-    }
-
-    deinit {
-        chunkBuffer.deallocate()
+        var error = ERROR_OK
+        guard om_writer_array_finalise(array.array, &error) else {
+            throw array.writer.error(error)
+        }
+        var lutOffset: UInt64 = 0
+        var lutSize: UInt64 = 0
+        om_writer_array_get_lut_range(array.array, &lutOffset, &lutSize)
+        return OmFileWriterArrayFinalised(array: array, lutSize: lutSize, lutOffset: lutOffset)
     }
 }
 
-/// Attributes of an compressed array that had been written and now contains LUT size and offset
+/// An array whose chunks, statistics and LUT have been written. Its metadata is written with `OmFileWriter.write(array:name:children:)`.
 public struct OmFileWriterArrayFinalised {
-    /// The scale-factor that is applied to all write data
-    let scale_factor: Float
-
-    /// The offset that is applied to all write data
-    let add_offset: Float
-
-    /// Type of compression and coding. E.g. delta, zigzag coding is then implemented in different compression routines
-    let compression: CompressionType
-
-    let datatype: DataType
-
-    /// The dimensions of the file
-    let dimensions: [UInt64]
-
-    /// How the dimensions are chunked
-    let chunks: [UInt64]
+    let array: OmWriterArrayHandle
 
     let lutSize: UInt64
 
@@ -0,0 +1,71 @@
+import Foundation
+@_implementationOnly import OmFileFormatC
+
+/// Latency and bandwidth model of a storage backend. Async readers merge IO requests by expected time instead of fixed byte thresholds
+/// and update the model with the observed duration of each request. One model should be shared by all readers of the same backend.
+public final class OmIoCostModel: @unchecked Sendable {
+    /// Memory for the C model
+    let memory: UnsafeMutableRawPointer
+
+    /// Serialises updates and reads of the model
+    let lock = NSLock()
+
+    /// `latency` is the time to the first byte of a request, `bytesPerNanosecond` the transfer rate (1.0 equals 1 GB/s) and `concurrency` the number of requests in flight.
+    /// E.g. local NVMe: 100 µs and 2 bytes/ns, object storage: 30 ms and 0.1 bytes/ns.
+    public init(latencyNanoseconds: Double, bytesPerNanosecond: Double, concurrency: Double = 16) {
+        self.memory = UnsafeMutableRawPointer.allocate(byteCount: MemoryLayout<OmIoCostModel_t>.size, alignment: MemoryLayout<OmIoCostModel_t>.alignment)
+        om_io_cost_model_init(memory.assumingMemoryBound(to: OmIoCostModel_t.self), latencyNanoseconds, bytesPerNanosecond, concurrency)
+    }
+
+    /// Update the model with the duration of a completed request
+    public func observe(bytes: Int, nanoseconds: Double) {
+        lock.lock()
+        om_io_cost_model_observe(memory.assumingMemoryBound(to: OmIoCostModel_t.self), UInt64(bytes), nanoseconds)
+        lock.unlock()
+    }
+
+    /// Current estimate of the request latency
+    public var latencyNanoseconds: Double {
+        lock.lock()
+        defer { lock.unlock() }
+        return memory.assumingMemoryBound(to: OmIoCostModel_t.self).pointee.latency_ns
+    }
+
+    /// Current estimate of the transfer rate
+    public var bytesPerNanosecond: Double {
+        lock.lock()
+        defer { lock.unlock() }
+        return memory.assumingMemoryBound(to: OmIoCostModel_t.self).pointee.bytes_per_ns
+    }
+
+    /// Largest gap in bytes that is read instead of issuing a separate request
+    public var mergeGap: UInt64 {
+        lock.lock()
+        defer { lock.unlock() }
+        return om_io_cost_model_merge_gap(memory.assumingMemoryBound(to: OmIoCostModel_t.self))
+    }
+
+    /// Configure a decoder with the current estimate
+    func configure(decoder: UnsafeMutablePointer<OmDecoder_t>) {
+        lock.lock()
+        om_decoder_set_io_cost_model(decoder, memory.assumingMemoryBound(to: OmIoCostModel_t.self))
+        lock.unlock()
+    }
+
+    deinit {
+        memory.deallocate()
+    }
+}
+
+extension OmFileReaderBackendAsync {
+    /// Read data and update `ioCostModel` with the duration of the request
+    func getData(offset: Int, count: Int, ioCostModel: OmIoCostModel?) async throws -> DataType {
+        guard let ioCostModel else {
+            return try await getData(offset: offset, count: count)
+        }
+        let start = DispatchTime.now().uptimeNanoseconds
+        let data = try await getData(offset: offset, count: count)
+        ioCostModel.observe(bytes: count, nanoseconds: Double(DispatchTime.now().uptimeNanoseconds - start))
+        return data
+    }
+}
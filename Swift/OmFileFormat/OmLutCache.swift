@@ -0,0 +1,46 @@
+@_implementationOnly import OmFileFormatC
+
+/// Decoded look-up table of one variable. Reads that find all required LUT blocks in the cache skip the index read and LUT decompression.
+/// Blocks are decoded lazily while reading and are never evicted. The cache can be shared by many reads and threads of the same variable.
+public final class OmLutCache: @unchecked Sendable {
+    /// Memory for the cache including decoded LUT entries
+    let memory: UnsafeMutableRawPointer
+
+    /// Handle to the C cache inside `memory`
+    let cache: OpaquePointer
+
+    /// Returns nil if the LUT of the variable is not compressed in blocks, e.g. for version 1/2 files or fixed width LUTs which can be read directly.
+    init?(variable: UnsafePointer<OmVariable_t?>?) {
+        let memorySize = Int(om_lut_cache_memory_size(variable))
+        guard memorySize > 0 else {
+            return nil
+        }
+        self.memory = UnsafeMutableRawPointer.allocate(byteCount: memorySize, alignment: 64)
+        guard let cache = om_lut_cache_init(memory, UInt64(memorySize), variable) else {
+            memory.deallocate()
+            return nil
+        }
+        self.cache = cache
+    }
+
+    /// Decode the entire LUT at once. Useful for memory mapped files where the LUT is already in memory.
+    func load<Backend: OmFileReaderBackend>(fn: Backend) throws {
+        var lutOffset: UInt64 = 0
+        var lutSize: UInt64 = 0
+        om_lut_cache_get_lut_range(cache, &lutOffset, &lutSize)
+        let lutData = fn.getData(offset: Int(lutOffset), count: Int(lutSize))
+        var error: OmError_t = ERROR_OK
+        guard om_lut_cache_load(cache, lutData, lutSize, &error) else {
+            throw OmFileFormatSwiftError.omDecoder(error: String(cString: om_error_string(error)))
+        }
+    }
+
+    /// Number of decoded LUT blocks with 64 entries each
+    public var residentBlockCount: UInt64 {
+        return om_lut_cache_resident_block_count(cache)
+    }
+
+    deinit {
+        memory.deallocate()
+    }
+}
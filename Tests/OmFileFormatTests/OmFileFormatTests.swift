@@ -554,6 +554,814 @@ import Foundation
         }
     }
 
+    @Test(arguments: [LutEncoding.fixed_width, .pfor_variable])
+    func writeLutEncoding(lutEncoding: LutEncoding) throws {
+        let file = "writeLutEncoding_\(lutEncoding).om"
+        let dims = [UInt64(100),100]
+        let fn = try FileHandle.createNewFile(file: file, overwrite: true)
+        defer { try? FileManager.default.removeItem(atPath: file) }
+        let fileWriter = OmFileWriter(fn: fn, initialCapacity: 8)
+
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [3,7], compression: .pfor_delta2d, scale_factor: 1, add_offset: 0, lutEncoding: lutEncoding)
+
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) }
+        try writer.writeData(array: data)
+        let variableMeta = try writer.finalise()
+        if lutEncoding == .fixed_width {
+            // 34*15 chunks plus start offset with 2 bytes each
+            #expect(variableMeta.lutSize == (34*15+1) * 2)
+        }
+        let variable = try fileWriter.write(array: variableMeta, name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+
+        let readFn = try MmapFile(fn: FileHandle.openFileReading(file: file))
+        let reader = try OmFileReader(fn: readFn)
+        #expect(om_variable_get_lut_encoding(reader.variable) == lutEncoding.toC())
+
+        for (ioSizeMax, ioSizeMerge) in [(UInt64(65536), UInt64(512)), (0, 0)] {
+            let read = try reader.asArray(of: Float.self, io_size_max: ioSizeMax, io_size_merge: ioSizeMerge)!
+            #expect(read.compression == .pfor_delta2d)
+            #expect(try read.read(range: [0..<100, 0..<100]) == data)
+            #expect(try read.read(range: [5..<6, 13..<14]) == [data[5*100 + 13]])
+            #expect(try read.read(range: [40..<43, 90..<100]) == (40..<43).flatMap { x in data[x*100+90..<x*100+100] })
+        }
+
+        if lutEncoding == .pfor_variable {
+            // Without the block offset table, data reads fail instead of misreading LUT blocks
+            var decoder = OmDecoder_t()
+            let offset = [UInt64(0), 0]
+            #expect(om_decoder_init(&decoder, reader.variable, 2, offset, dims, offset, dims, 512, 65536) == ERROR_OK)
+            var indexRead = OmDecoder_indexRead_t()
+            om_decoder_init_index_read(&decoder, &indexRead)
+            #expect(om_decoder_next_index_read(&decoder, &indexRead))
+            #expect(indexRead.count == 0)
+            var dataRead = OmDecoder_dataRead_t()
+            om_decoder_init_data_read(&dataRead, &indexRead)
+            var error = ERROR_OK
+            #expect(!om_decoder_next_data_read(&decoder, &dataRead, nil, 0, &error))
+            #expect(error == ERROR_LUT_BLOCK_OFFSETS_REQUIRED)
+        }
+    }
+
+    @Test(arguments: [LutEncoding.pfor, .pfor_variable, .fixed_width])
+    func readWithLutCache(lutEncoding: LutEncoding) throws {
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+        let dims = [UInt64(100),100]
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [3,7], compression: .pfor_delta2d, scale_factor: 1, add_offset: 0, lutEncoding: lutEncoding)
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) }
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+
+        let read = try OmFileReader(fn: inMemoryBackend).asArray(of: Float.self, lutCache: true)!
+        guard let lutCache = read.lutCache else {
+            // Fixed width LUTs are read without decompression
+            #expect(lutEncoding == .fixed_width)
+            return
+        }
+        // 34*15 chunks plus start offset in blocks of 64 entries
+        #expect(lutCache.residentBlockCount == 0)
+        #expect(try read.read(range: [5..<6, 13..<14]) == [data[5*100 + 13]])
+        #expect(lutCache.residentBlockCount == 1)
+        #expect(try read.read(range: [0..<100, 0..<100]) == data)
+        #expect(lutCache.residentBlockCount == 8)
+        // All index reads are served from the cache
+        #expect(try read.read(range: [40..<43, 90..<100]) == (40..<43).flatMap { x in data[x*100+90..<x*100+100] })
+        #expect(try read.read(range: [0..<100, 0..<100]) == data)
+        #expect(lutCache.residentBlockCount == 8)
+    }
+
+    @Test(arguments: [LutEncoding.pfor, .pfor_variable])
+    func writeParallel(lutEncoding: LutEncoding) throws {
+        let dims = [UInt64(100),100]
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) }
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [3,7], compression: .pfor_delta2d_int16, scale_factor: 1, add_offset: 0, lutEncoding: lutEncoding, threads: 4, inFlightChunks: 5)
+        // Write the first rows separately to continue with a chunk index in the middle of the LUT
+        try writer.writeData(array: Array(data[0..<3*100]), arrayDimensions: [3,100], arrayOffset: [0,0], arrayCount: [3,100])
+        try writer.writeData(array: Array(data[3*100..<100*100]), arrayDimensions: [97,100], arrayOffset: [0,0], arrayCount: [97,100])
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+
+        let read = try OmFileReader(fn: inMemoryBackend).asArray(of: Float.self)!
+        #expect(try read.read(range: [0..<100, 0..<100]) == data)
+        #expect(try read.read(range: [50..<51, 20..<30]) == Array(data[50*100+20..<50*100+30]))
+    }
+
+    @Test func writeWithCWriter() throws {
+        let dims = [UInt64(100),100]
+        let chunks = [UInt64(3),7]
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) }
+        let inMemoryBackend = DataAsClass(data: Data())
+        let sink = OmWriterSink_t(write: { context, data, size in
+            let backend = Unmanaged<DataAsClass>.fromOpaque(context!).takeUnretainedValue()
+            backend.data.append(data!.assumingMemoryBound(to: UInt8.self), count: Int(size))
+            return true
+        }, take: nil, context: Unmanaged.passUnretained(inMemoryBackend).toOpaque())
+
+        // A small buffer forces flushes at offsets that are not a multiple of 8
+        let writer = om_writer_create(sink, 67, 2)!
+        defer { om_writer_destroy(writer) }
+        var error = ERROR_OK
+        let array = om_writer_array_create(writer, DATA_TYPE_FLOAT_ARRAY, COMPRESSION_PFOR_DELTA2D_INT16, LUT_ENCODING_PFOR_VARIABLE, 1, 0, dims, chunks, 2, false, false, 0, &error)!
+        defer { om_writer_array_destroy(array) }
+        #expect(om_writer_array_write(array, data, dims, [0,0], dims, &error))
+        #expect(om_writer_array_finalise(array, &error))
+
+        var scalarOffset: UInt64 = 0
+        var scalarSize: UInt64 = 0
+        var value: Int32 = 42
+        #expect(om_writer_write_scalar(writer, "int32", 5, 0, nil, nil, DATA_TYPE_INT32, &value, 0, &scalarOffset, &scalarSize, &error))
+        var offset: UInt64 = 0
+        var size: UInt64 = 0
+        #expect(om_writer_write_array(writer, array, "data", 4, 1, [scalarOffset], [scalarSize], &offset, &size, &error))
+        #expect(om_writer_write_trailer(writer, offset, size, &error))
+        #expect(error == ERROR_OK)
+        #expect(om_writer_total_bytes_written(writer) == inMemoryBackend.data.count)
+
+        let reader = try OmFileReader(fn: inMemoryBackend)
+        #expect(reader.getName() == "data")
+        #expect(reader.getChild(0)?.readScalar() == Int32(42))
+        #expect(try reader.asArray(of: Float.self)?.read(range: [0..<100, 0..<100]) == data)
+    }
+
+    @Test func writeWithCWriterTake() throws {
+        let dims = [UInt64(100),100]
+        let chunks = [UInt64(3),7]
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) }
+        let inMemoryBackend = DataAsClass(data: Data())
+        // The sink owns filled buffers and releases them after appending their data
+        let sink = OmWriterSink_t(write: nil, take: { context, buffer, data, size in
+            let backend = Unmanaged<DataAsClass>.fromOpaque(context!).takeUnretainedValue()
+            backend.data.append(data!.assumingMemoryBound(to: UInt8.self), count: Int(size))
+            free(buffer)
+            return true
+        }, context: Unmanaged.passUnretained(inMemoryBackend).toOpaque())
+
+        let writer = om_writer_create(sink, 67, 2)!
+        defer { om_writer_destroy(writer) }
+        var error = ERROR_OK
+        let array = om_writer_array_create(writer, DATA_TYPE_FLOAT_ARRAY, COMPRESSION_PFOR_DELTA2D_INT16, LUT_ENCODING_PFOR_VARIABLE, 1, 0, dims, chunks, 2, true, false, 0, &error)!
+        defer { om_writer_array_destroy(array) }
+        var offset: UInt64 = 0
+        var size: UInt64 = 0
+
+        // Arrays can only be finalised after all chunks are written and only be written before they are finalised
+        #expect(!om_writer_array_finalise(array, &error))
+        #expect(error == ERROR_INVALID_STATE)
+        #expect(!om_writer_write_array(writer, array, "data", 4, 0, nil, nil, &offset, &size, &error))
+        #expect(error == ERROR_INVALID_STATE)
+        error = ERROR_OK
+        #expect(om_writer_array_write(array, data, dims, [0,0], dims, &error))
+        #expect(om_writer_array_finalise(array, &error))
+        #expect(!om_writer_array_write(array, data, dims, [0,0], dims, &error))
+        #expect(error == ERROR_INVALID_STATE)
+        #expect(!om_writer_array_finalise(array, &error))
+        #expect(error == ERROR_INVALID_STATE)
+
+        error = ERROR_OK
+        #expect(om_writer_write_array(writer, array, "data", 4, 0, nil, nil, &offset, &size, &error))
+        #expect(om_writer_write_trailer(writer, offset, size, &error))
+        #expect(error == ERROR_OK)
+        #expect(om_writer_total_bytes_written(writer) == inMemoryBackend.data.count)
+
+        let reader = try OmFileReader(fn: inMemoryBackend)
+        #expect(reader.getName() == "data")
+        #expect(try reader.asArray(of: Float.self)?.read(range: [0..<100, 0..<100]) == data)
+    }
+
+    /// Adjacent chunks of multi-dimensional reads are merged into one data read until `io_size_max` is exceeded
+    @Test func readMergesAdjacentChunks() throws {
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+        let dims = [UInt64(10),20,30]
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [2,5,6], compression: .pfor_delta2d, scale_factor: 1, add_offset: 0)
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) }
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+        let reader = try OmFileReader(fn: inMemoryBackend)
+
+        /// Chunk ranges and byte ranges of all data reads
+        func dataReads(offset: [UInt64], count: [UInt64], ioSizeMerge: UInt64, ioSizeMax: UInt64) -> [(chunks: Range<UInt64>, offset: UInt64, count: UInt64)] {
+            var decoder = OmDecoder_t()
+            #expect(om_decoder_init(&decoder, reader.variable, 3, offset, count, nil, nil, ioSizeMerge, ioSizeMax) == ERROR_OK)
+            var reads = [(chunks: Range<UInt64>, offset: UInt64, count: UInt64)]()
+            var error: OmError_t = ERROR_OK
+            var indexRead = OmDecoder_indexRead_t()
+            om_decoder_init_index_read(&decoder, &indexRead)
+            while om_decoder_next_index_read(&decoder, &indexRead) {
+                let indexData = inMemoryBackend.getData(offset: Int(indexRead.offset), count: Int(indexRead.count))
+                var dataRead = OmDecoder_dataRead_t()
+                om_decoder_init_data_read(&dataRead, &indexRead)
+                while om_decoder_next_data_read(&decoder, &dataRead, indexData, indexRead.count, &error) {
+                    reads.append((chunks: dataRead.chunkIndex.lowerBound..<dataRead.chunkIndex.upperBound, offset: dataRead.offset, count: dataRead.count))
+                }
+            }
+            #expect(error == ERROR_OK)
+            return reads
+        }
+
+        // The last two dimensions are read entirely. Chunks 20..<60 are adjacent and read at once.
+        let merged = dataReads(offset: [2, 0, 0], count: [4, 20, 30], ioSizeMerge: 512, ioSizeMax: 65536)
+        #expect(merged.count == 1)
+        #expect(merged.first?.chunks == 20..<60)
+
+        // Reads are split before they exceed `io_size_max`, but stay contiguous
+        let split = dataReads(offset: [2, 0, 0], count: [4, 20, 30], ioSizeMerge: 512, ioSizeMax: 256)
+        #expect(split.count > 1)
+        #expect(split.allSatisfy { $0.count <= 256 })
+        #expect(split.first?.chunks.lowerBound == 20)
+        #expect(split.last?.chunks.upperBound == 60)
+        #expect(split.first?.offset == merged.first?.offset)
+        #expect(split.reduce(0, { $0 + $1.count }) == merged.first?.count)
+        for (a, b) in zip(split, split.dropFirst()) {
+            #expect(a.chunks.upperBound == b.chunks.lowerBound)
+            #expect(a.offset + a.count == b.offset)
+        }
+
+        // Only the second chunk of the middle dimension is read. 5 adjacent chunks are merged, the 15 chunks in between are too large to merge.
+        let runs = dataReads(offset: [0, 5, 0], count: [10, 5, 30], ioSizeMerge: 128, ioSizeMax: 65536)
+        #expect(runs.map { $0.chunks } == [5..<10, 25..<30, 45..<50, 65..<70, 85..<90])
+
+        for (ioSizeMax, ioSizeMerge) in [(UInt64(65536), UInt64(512)), (256, 512), (65536, 128)] {
+            let read = try reader.asArray(of: Float.self, io_size_max: ioSizeMax, io_size_merge: ioSizeMerge)!
+            #expect(try read.read(range: [2..<6, 0..<20, 0..<30]) == Array(data[2*600..<6*600]))
+            #expect(try read.read(range: [0..<10, 5..<10, 0..<30]) == (0..<10).flatMap { x in (5..<10).flatMap { y in data[x*600+y*30..<x*600+y*30+30] } })
+        }
+    }
+
+    @Test func readWithBatchedIoRequests() throws {
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+        let dims = [UInt64(100),100]
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [3,7], compression: .pfor_delta2d, scale_factor: 1, add_offset: 0)
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) }
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+        let reader = try OmFileReader(fn: inMemoryBackend)
+
+        let readOffset: [UInt64] = [10, 20]
+        let readCount: [UInt64] = [50, 60]
+        var decoder = OmDecoder_t()
+        #expect(om_decoder_init(&decoder, reader.variable, 2, readOffset, readCount, [0, 0], readCount, 512, 256) == ERROR_OK)
+
+        var indexRead = OmDecoder_indexRead_t()
+        om_decoder_init_index_read(&decoder, &indexRead)
+        var indexReads = [OmDecoder_indexRead_t](repeating: OmDecoder_indexRead_t(), count: 1000)
+        var indexReadsCount: UInt64 = 0
+        #expect(om_decoder_next_index_reads(&decoder, &indexRead, &indexReads, 1000, &indexReadsCount))
+        #expect(indexReadsCount > 1)
+        #expect(!om_decoder_next_index_reads(&decoder, &indexRead, &indexReads, 1000, &indexReadsCount))
+
+        // Complete all IO requests in reverse order
+        var out = [Float](repeating: .nan, count: 50 * 60)
+        var buffer = [UInt8](repeating: 0, count: Int(om_decoder_read_buffer_size(&decoder)))
+        for indexRead in indexReads[0..<Int(indexReadsCount)].reversed() {
+            var dataReadsCapacity: UInt64 = 0
+            var chunkOffsetsCapacity: UInt64 = 0
+            om_decoder_data_reads_capacity([indexRead], &dataReadsCapacity, &chunkOffsetsCapacity)
+            var dataReads = [OmDecoder_dataReadRequest_t](repeating: OmDecoder_dataReadRequest_t(), count: Int(dataReadsCapacity))
+            var chunkOffsets = [UInt64](repeating: 0, count: Int(chunkOffsetsCapacity))
+            var dataReadsCount: UInt64 = 0
+            var chunkOffsetsCount: UInt64 = 0
+            var dataRead = OmDecoder_dataRead_t()
+            om_decoder_init_data_read(&dataRead, [indexRead])
+            var error: OmError_t = ERROR_OK
+            let indexData = inMemoryBackend.getData(offset: Int(indexRead.offset), count: Int(indexRead.count))
+            #expect(om_decoder_next_data_reads(&decoder, &dataRead, indexData, indexRead.count, &dataReads, dataReadsCapacity, &dataReadsCount, &chunkOffsets, chunkOffsetsCapacity, &chunkOffsetsCount, &error))
+            #expect(!om_decoder_next_data_reads(&decoder, &dataRead, indexData, indexRead.count, &dataReads, dataReadsCapacity, &dataReadsCount, &chunkOffsets, chunkOffsetsCapacity, &chunkOffsetsCount, &error))
+            #expect(error == ERROR_OK)
+            for dataRead in dataReads[0..<Int(dataReadsCount)].reversed() {
+                let dataData = inMemoryBackend.getData(offset: Int(dataRead.offset), count: Int(dataRead.count))
+                let offsets = Array(chunkOffsets[Int(dataRead.chunkOffsetsStart)..<Int(dataRead.chunkOffsetsStart + dataRead.chunkOffsetsCount)])
+                #expect(om_decoder_decode_chunks_with_offsets(&decoder, dataRead.chunkIndex, dataData, dataRead.count, offsets, UInt64(offsets.count), &out, &buffer, &error))
+            }
+        }
+        #expect(out == (10..<60).flatMap { x in data[x*100+20..<x*100+80] })
+    }
+
+    @Test func readWithChunkOffsets() throws {
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+        let dims = [UInt64(100),100]
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10,10], compression: .pfor_delta2d, scale_factor: 1, add_offset: 0, lutEncoding: .fixed_width)
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) }
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+        let reader = try OmFileReader(fn: inMemoryBackend)
+
+        // A single column intersects chunks 5, 15, ..., 95. Large merge thresholds read all chunks in between with one request.
+        // The fixed width LUT keeps all LUT entries in one index read.
+        // The column is written into a larger cube at offset [2, 3]. All other values of the cube must stay unchanged.
+        let cache = try OmChunkCache(byteBudget: 1 << 20, slotSize: 10 * 10 * 4)
+        var decoder = OmDecoder_t()
+        #expect(om_decoder_init(&decoder, reader.variable, 2, [0, 55], [100, 1], [2, 3], [104, 5], 1 << 20, 1 << 20) == ERROR_OK)
+        om_decoder_set_chunk_cache(&decoder, cache.cache, 1)
+        var out = [Float](repeating: -1, count: 104 * 5)
+        var buffer = [UInt8](repeating: 0, count: Int(om_decoder_read_buffer_size(&decoder)))
+        var error: OmError_t = ERROR_OK
+        var dataReads = 0
+        var indexRead = OmDecoder_indexRead_t()
+        om_decoder_init_index_read(&decoder, &indexRead)
+        while om_decoder_next_index_read(&decoder, &indexRead) {
+            let indexData = inMemoryBackend.getData(offset: Int(indexRead.offset), count: Int(indexRead.count))
+            var dataRead = OmDecoder_dataRead_t()
+            om_decoder_init_data_read(&dataRead, &indexRead)
+            var chunkOffsets = [UInt64](repeating: 0, count: Int(OM_DECODER_CHUNK_OFFSETS_COUNT))
+            var chunkOffsetsCount: UInt64 = 0
+            while om_decoder_next_data_read_with_offsets(&decoder, &dataRead, indexData, indexRead.count, &chunkOffsets, UInt64(chunkOffsets.count), &chunkOffsetsCount, &error) {
+                dataReads += 1
+                #expect(dataRead.chunkIndex.lowerBound == 5)
+                #expect(dataRead.chunkIndex.upperBound == 96)
+                // The end of each of the 10 intersecting chunks and the start of the chunk after each of the 9 skipped runs
+                #expect(chunkOffsetsCount == 1 + 10 + 9)
+                #expect(chunkOffsets[0] == 0)
+                #expect(chunkOffsets[Int(chunkOffsetsCount) - 1] == dataRead.count)
+
+                // Skipped chunks are not decoded and may contain anything
+                var compressed = [UInt8](UnsafeRawBufferPointer(start: inMemoryBackend.getData(offset: Int(dataRead.offset), count: Int(dataRead.count)), count: Int(dataRead.count)))
+                for i in stride(from: 1, to: Int(chunkOffsetsCount) - 1, by: 2) {
+                    for j in Int(chunkOffsets[i])..<Int(chunkOffsets[i + 1]) {
+                        compressed[j] = 0xFF
+                    }
+                }
+                #expect(om_decoder_decode_chunks_with_offsets(&decoder, dataRead.chunkIndex, compressed, dataRead.count, chunkOffsets, chunkOffsetsCount, &out, &buffer, &error))
+            }
+        }
+        #expect(error == ERROR_OK)
+        #expect(dataReads == 1)
+        #expect(cache.misses == 10)
+        #expect(cache.hits == 0)
+        for x in 0..<104 {
+            for y in 0..<5 {
+                let expected = (2..<102).contains(x) && y == 3 ? data[(x - 2) * 100 + 55] : -1
+                #expect(out[x * 5 + y] == expected, "\(x) \(y)")
+            }
+        }
+    }
+
+    /// A read of the leading rows of a chunk only decodes the leading PFOR blocks. Bytes after these blocks are never touched.
+    @Test func readPartialChunkPforPrefix() throws {
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+        let dims = [UInt64(100),10]
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [100,10], compression: .pfor_delta2d_int16, scale_factor: 10, add_offset: 0)
+        let data = (0..<dims.reduce(1, *)).map { Float(($0 * 7919) % 1000) / 10 }
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+        let reader = try OmFileReader(fn: inMemoryBackend)
+        let expected = Array(try reader.asArray(of: Float.self)!.read()[0..<50])
+
+        // Rows 0..<5 are the first 50 elements. Only the first value and one block of 128 deltas are decoded.
+        var decoder = OmDecoder_t()
+        #expect(om_decoder_init(&decoder, reader.variable, 2, [0, 0], [5, 10], [0, 0], [5, 10], 512, 65536) == ERROR_OK)
+        var out = [Float](repeating: .nan, count: 50)
+        var buffer = [UInt8](repeating: 0, count: Int(om_decoder_read_buffer_size(&decoder)))
+        var error: OmError_t = ERROR_OK
+        var dataReads = 0
+        var indexRead = OmDecoder_indexRead_t()
+        om_decoder_init_index_read(&decoder, &indexRead)
+        while om_decoder_next_index_read(&decoder, &indexRead) {
+            let indexData = inMemoryBackend.getData(offset: Int(indexRead.offset), count: Int(indexRead.count))
+            var dataRead = OmDecoder_dataRead_t()
+            om_decoder_init_data_read(&dataRead, &indexRead)
+            var chunkOffsets = [UInt64](repeating: 0, count: Int(OM_DECODER_CHUNK_OFFSETS_COUNT))
+            var chunkOffsetsCount: UInt64 = 0
+            while om_decoder_next_data_read_with_offsets(&decoder, &dataRead, indexData, indexRead.count, &chunkOffsets, UInt64(chunkOffsets.count), &chunkOffsetsCount, &error) {
+                dataReads += 1
+                var compressed = [UInt8](UnsafeRawBufferPointer(start: inMemoryBackend.getData(offset: Int(dataRead.offset), count: Int(dataRead.count)), count: Int(dataRead.count)))
+                var prefix = [UInt16](repeating: 0, count: 1000 + 32)
+                let prefixBytes = om_common_codecs()!.pointee.p4nzdec128v16(&compressed, 129, &prefix)
+                #expect(prefixBytes > 0)
+                #expect(prefixBytes < Int(dataRead.count))
+                for i in prefixBytes..<Int(dataRead.count) {
+                    compressed[i] = 0xFF
+                }
+                #expect(om_decoder_decode_chunks_with_offsets(&decoder, dataRead.chunkIndex, compressed, dataRead.count, chunkOffsets, chunkOffsetsCount, &out, &buffer, &error))
+            }
+        }
+        #expect(error == ERROR_OK)
+        #expect(dataReads == 1)
+        #expect(out == expected)
+    }
+
+    /// Fully read `pfor_delta2d_int16` chunks are delta decoded and scaled in one pass. The chunk cache always takes the unfused path.
+    @Test func readDelta2dInt16Fused() throws {
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+        let dims = [UInt64(37),53]
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10,8], compression: .pfor_delta2d_int16, scale_factor: 20, add_offset: 5)
+        let data = (0..<Int(dims.reduce(1, *))).map { i -> Float in i % 101 == 0 ? .nan : Float(i % 53) * 0.35 - Float(i / 53) * 0.2 + 40 }
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+        let reader = try OmFileReader(fn: inMemoryBackend)
+        let fused = reader.asArray(of: Float.self)!
+        let cache = try OmChunkCache(byteBudget: 1 << 20, slotSize: 10 * 8 * 2)
+        let unfused = reader.asArray(of: Float.self, chunkCache: cache)!
+
+        // Values are stored as `round(value * scale_factor + add_offset)`
+        let expected = data.map { $0.isNaN ? $0 : ($0 * 20 + 5).rounded() / 20 - 5 }
+        let values = try fused.read()
+        let valuesUnfused = try unfused.read()
+        #expect(values.testSimilar(expected, accuracy: 0.0001))
+        #expect(values.map { $0.bitPattern } == valuesUnfused.map { $0.bitPattern })
+
+        // Chunks inside the range are fully read and fused, chunks at the border are not
+        let partial = try fused.read(range: [3..<29, 5..<50])
+        let partialUnfused = try unfused.read(range: [3..<29, 5..<50])
+        #expect(partial.map { $0.bitPattern } == (3..<29).flatMap { x in values[x*53+5..<x*53+50] }.map { $0.bitPattern })
+        #expect(partial.map { $0.bitPattern } == partialUnfused.map { $0.bitPattern })
+    }
+
+    @Test func readParallel() throws {
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+        let dims = [UInt64(100),100]
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [3,7], compression: .pfor_delta2d, scale_factor: 1, add_offset: 0, lutEncoding: .pfor_variable)
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) }
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+        let reader = try OmFileReader(fn: inMemoryBackend)
+
+        // Return data from the in-memory file without copying
+        let read: OmDecoder_readCallback_t = { context, offset, _, _ in
+            return UnsafeRawPointer(context!) + Int(offset)
+        }
+        // Fails every read
+        let fail: OmDecoder_readCallback_t = { _, _, _, _ in
+            return nil
+        }
+        let readOffset: [UInt64] = [10, 20]
+        let readCount: [UInt64] = [50, 60]
+        for threads: UInt32 in [0, 1, 4] {
+            // Without a pool, all work is done on the calling thread. A pool is reused for both reads.
+            let pool = threads == 0 ? nil : om_thread_pool_create(threads)
+            defer { if let pool = pool { om_thread_pool_destroy(pool) } }
+            var decoder = OmDecoder_t()
+            #expect(om_decoder_init(&decoder, reader.variable, 2, readOffset, readCount, [0, 0], readCount, 512, 256) == ERROR_OK)
+            var out = [Float](repeating: .nan, count: 50 * 60)
+            var error: OmError_t = ERROR_OK
+            inMemoryBackend.data.withUnsafeBytes { file in
+                #expect(om_decoder_decode_parallel(&decoder, read, UnsafeMutableRawPointer(mutating: file.baseAddress), pool, &out, &error))
+            }
+            #expect(error == ERROR_OK)
+            #expect(out == (10..<60).flatMap { x in data[x*100+20..<x*100+80] })
+            #expect(!om_decoder_decode_parallel(&decoder, fail, nil, pool, &out, &error))
+            #expect(error == ERROR_IO_READ)
+        }
+    }
+
+    @Test func readChunkStatisticsAndPredicate() throws {
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+        let dims = [UInt64(100),100]
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10,10], compression: .pfor_delta2d, scale_factor: 1, add_offset: 0, chunkStatistics: true)
+        var data = (0..<dims.reduce(1, *)).map { Float($0 / 100) }
+        data[95*100 + 5] = .nan
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+        let reader = try OmFileReader(fn: inMemoryBackend)
+
+        let readOffset: [UInt64] = [0, 0]
+        let readCount: [UInt64] = [100, 10]
+        var decoder = OmDecoder_t()
+        #expect(om_decoder_init(&decoder, reader.variable, 2, readOffset, readCount, [0, 0], readCount, 512, 256) == ERROR_OK)
+        #expect(om_decoder_count_read_chunks(&decoder) == 10)
+        var statisticsOffset: UInt64 = 0
+        var statisticsCount: UInt64 = 0
+        #expect(om_decoder_statistics_read(&decoder, &statisticsOffset, &statisticsCount))
+        let statisticsData = inMemoryBackend.getData(offset: Int(statisticsOffset), count: Int(statisticsCount))
+
+        var statistics = [OmChunkStatistics_t](repeating: OmChunkStatistics_t(), count: 10)
+        var chunkIndices = [UInt64](repeating: 0, count: 10)
+        var error: OmError_t = ERROR_OK
+        #expect(om_decoder_get_chunk_statistics(&decoder, statisticsData, statisticsCount, &statistics, &chunkIndices, &error))
+        #expect(chunkIndices == (0..<10).map { $0 * 10 })
+        #expect(statistics.map { $0.min } == (0..<10).map { Double($0 * 10) })
+        #expect(statistics.map { $0.max } == (0..<10).map { Double($0 * 10 + 9) })
+        #expect(statistics[0].sum == 450)
+        #expect(statistics.map { $0.nan_count } == [0, 0, 0, 0, 0, 0, 0, 0, 0, 1])
+
+        // Only chunks with values between 25 and 34 are decoded
+        #expect(om_decoder_set_predicate(&decoder, statisticsData, statisticsCount, 25, 34))
+        let read: OmDecoder_readCallback_t = { context, offset, _, _ in
+            return UnsafeRawPointer(context!) + Int(offset)
+        }
+        var out = [Float](repeating: -1, count: 100 * 10)
+        inMemoryBackend.data.withUnsafeBytes { file in
+            #expect(om_decoder_decode_parallel(&decoder, read, UnsafeMutableRawPointer(mutating: file.baseAddress), nil, &out, &error))
+        }
+        #expect(error == ERROR_OK)
+        #expect(out == (0..<100).flatMap { x in (20..<40).contains(x) ? Array(data[x*100..<x*100+10]) : [Float](repeating: -1, count: 10) })
+    }
+
+    @Test func readReduced() throws {
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+        let dims = [UInt64(10),20]
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [3,7], compression: .pfor_delta2d_int16, scale_factor: 1, add_offset: 0)
+        var data = (0..<dims.reduce(1, *)).map { Float($0 % 20) }
+        data[3*20 + 5] = .nan
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+        let read = try OmFileReader(fn: inMemoryBackend).asArray(of: Float.self)!
+
+        // Mean over the fast dimension of rows 2..<5 and columns 4..<10
+        #expect(try read.reduce(range: [2..<5, 4..<10], dimensions: [1], op: .mean) == [6.5, 6.8, 6.5])
+        #expect(try read.reduce(range: [2..<5, 4..<10], dimensions: [0], op: .count) == [3, 2, 3, 3, 3, 3])
+        #expect(try read.reduce(dimensions: [0, 1], op: .sum) == [1895])
+        #expect(try read.reduce(dimensions: [0, 1], op: .max) == [19])
+        #expect(try read.reduce(range: [3..<4, 5..<6], dimensions: [0, 1], op: .min).map { $0.isNaN } == [true])
+    }
+
+    @Test func readReducedParallel() throws {
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+        let dims = [UInt64(40),50]
+        let writer = try fileWriter.prepareArray(type: Double.self, dimensions: dims, chunkDimensions: [3,7], compression: .fpx_xor2d, scale_factor: 1, add_offset: 0)
+        // Row 10 and column 20 are missing. Integer values keep sums exact regardless of the order of additions.
+        let data = (0..<Int(dims.reduce(1, *))).map { $0 / 50 == 10 || $0 % 50 == 20 ? Double.nan : Double(($0 * 7) % 97) - 40 }
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+        let reader = try OmFileReader(fn: inMemoryBackend)
+        let read = reader.asArray(of: Double.self)!
+
+        let readCallback: OmDecoder_readCallback_t = { context, offset, _, _ in
+            return UnsafeRawPointer(context!) + Int(offset)
+        }
+        /// Accumulate rows `rows` of all columns into `reduction` with `om_decoder_reduce_parallel`
+        func reduceParallel(rows: Range<UInt64>, reduceDimensions: [Bool], op: ReduceOperator, pool: OpaquePointer?, reduction: inout OmReduction_t, values: UnsafeMutablePointer<Double>, counts: UnsafeMutablePointer<UInt64>) {
+            let readOffset = [rows.lowerBound, 0]
+            let readCount = [UInt64(rows.count), dims[1]]
+            var decoder = OmDecoder_t()
+            #expect(om_decoder_init(&decoder, reader.variable, 2, readOffset, readCount, nil, nil, 512, 256) == ERROR_OK)
+            #expect(om_decoder_reduction_init(&decoder, &reduction, op.toC(), reduceDimensions, values, counts) == ERROR_OK)
+            var error: OmError_t = ERROR_OK
+            inMemoryBackend.data.withUnsafeBytes { file in
+                #expect(om_decoder_reduce_parallel(&decoder, readCallback, UnsafeMutableRawPointer(mutating: file.baseAddress), pool, &reduction, &error))
+            }
+            #expect(error == ERROR_OK)
+        }
+        /// NaN marks outputs without any values
+        func same(_ a: [Double], _ b: [Double]) -> Bool {
+            return a.count == b.count && zip(a, b).allSatisfy { $0 == $1 || ($0.isNaN && $1.isNaN) }
+        }
+
+        let values = UnsafeMutablePointer<Double>.allocate(capacity: 2 * 50)
+        let counts = UnsafeMutablePointer<UInt64>.allocate(capacity: 2 * 50)
+        defer {
+            values.deallocate()
+            counts.deallocate()
+        }
+        let pool = om_thread_pool_create(4)
+        defer { om_thread_pool_destroy(pool) }
+        for op in [ReduceOperator.sum, .mean, .min, .max, .count] {
+            for (reduced, n) in [(0, 50), (1, 40)] {
+                let sequential = try read.reduce(dimensions: [reduced], op: op)
+                #expect(sequential.count == n)
+                // Column 20 or row 10 has no values
+                #expect(sequential.filter { $0.isNaN }.count == ([.mean, .min, .max].contains(op) ? 1 : 0))
+
+                var reduction = OmReduction_t()
+                reduceParallel(rows: 0..<40, reduceDimensions: [reduced == 0, reduced == 1], op: op, pool: pool, reduction: &reduction, values: values, counts: counts)
+                var parallel = [Double](repeating: 0, count: n)
+                om_decoder_reduction_finalise(&reduction, &parallel)
+                #expect(same(parallel, sequential))
+            }
+
+            // Partial reductions of the upper and lower rows are merged into the reduction of all rows
+            var upper = OmReduction_t()
+            var lower = OmReduction_t()
+            reduceParallel(rows: 0..<17, reduceDimensions: [true, false], op: op, pool: pool, reduction: &upper, values: values, counts: counts)
+            reduceParallel(rows: 17..<40, reduceDimensions: [true, false], op: op, pool: pool, reduction: &lower, values: values + 50, counts: counts + 50)
+            om_decoder_reduction_merge(&upper, &lower)
+            var merged = [Double](repeating: 0, count: 50)
+            om_decoder_reduction_finalise(&upper, &merged)
+            #expect(same(merged, try read.reduce(dimensions: [0], op: op)))
+        }
+    }
+
+    @Test func writeConstantChunks() throws {
+        let dims = [UInt64(100),100]
+        // Upper half missing, followed by a block of zeros
+        let data = (0..<dims.reduce(1, *)).map { $0 < 5000 ? Float.nan : $0 < 8000 ? 0 : Float($0 % 13) }
+        func write(constantChunks: Bool) throws -> DataAsClass {
+            let inMemoryBackend = DataAsClass(data: Data())
+            let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+            let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10,10], compression: .pfor_delta2d_int16, scale_factor: 10, add_offset: 0, constantChunks: constantChunks)
+            try writer.writeData(array: data)
+            let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+            try fileWriter.writeTrailer(rootVariable: variable)
+            return inMemoryBackend
+        }
+        let compressed = try write(constantChunks: false)
+        let constant = try write(constantChunks: true)
+        #expect(constant.data.count < compressed.data.count)
+
+        let read = try OmFileReader(fn: constant).asArray(of: Float.self)!
+        let values = try read.read()
+        #expect(values.count == data.count)
+        #expect(zip(values, data).allSatisfy { $0.isNaN ? $1.isNaN : $0 == $1 })
+        #expect(try read.read(range: [45..<55, 5..<6]).map { $0.isNaN } == (45..<55).map { $0 < 50 })
+        #expect(try read.reduce(range: [50..<80, 0..<100], dimensions: [0, 1], op: .sum) == [0])
+        #expect(try read.reduce(range: [0..<50, 0..<100], dimensions: [0, 1], op: .count) == [0])
+    }
+
+    @Test func writeMantissaRounding() throws {
+        let dims = [UInt64(100), 100]
+        let data = (0..<dims.reduce(1, *)).map { i -> Float in i % 997 == 0 ? .nan : 280 + 20 * sin(Float(i) * 0.001) + Float(i % 7) * 0.0173 }
+        func write(mantissaBits: UInt8, addOffset: Float = 0) throws -> DataAsClass {
+            let inMemoryBackend = DataAsClass(data: Data())
+            let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 8)
+            let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10, 10], compression: .fpx_xor2d, scale_factor: 1, add_offset: addOffset, mantissaBits: mantissaBits)
+            try writer.writeData(array: data)
+            let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+            try fileWriter.writeTrailer(rootVariable: variable)
+            return inMemoryBackend
+        }
+        let bits = CompressionType.mantissaBits(significantDigits: 3, type: Float.self)
+        #expect(bits == 10)
+        let lossless = try write(mantissaBits: 0)
+        let rounded = try write(mantissaBits: bits)
+        #expect(rounded.data.count * 3 < lossless.data.count * 2)
+
+        let read = try OmFileReader(fn: rounded).asArray(of: Float.self)!
+        #expect(read.mantissaBits == bits)
+        #expect(try OmFileReader(fn: lossless).asArray(of: Float.self)!.mantissaBits == 0)
+        // `add_offset` is not used by `fpx_xor2d` and does not change precision
+        for addOffset: Float in [10, 0.5] {
+            let withOffset = try OmFileReader(fn: try write(mantissaBits: 0, addOffset: addOffset)).asArray(of: Float.self)!
+            #expect(withOffset.mantissaBits == 0)
+            #expect(try withOffset.read().elementsEqual(data, by: { $0.bitPattern == $1.bitPattern }))
+        }
+        // Rounding to nearest keeps the relative error within half a unit of the last kept bit
+        #expect(zip(try read.read(), data).allSatisfy { $1.isNaN ? $0.isNaN : abs($0 - $1) <= abs($1) * 0x1p-11 && $0.bitPattern & 0x1FFF == 0 })
+
+        #expect(throws: (any Error).self) {
+            try OmFileWriter(fn: DataAsClass(data: Data()), initialCapacity: 8).prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10, 10], compression: .fpx_xor2d, scale_factor: 1, add_offset: 0, mantissaBits: 23)
+        }
+        #expect(throws: (any Error).self) {
+            try OmFileWriter(fn: DataAsClass(data: Data()), initialCapacity: 8).prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10, 10], compression: .pfor_delta2d, scale_factor: 1, add_offset: 0, mantissaBits: 10)
+        }
+    }
+
+    @Test func readWithChunkCache() throws {
+        let file = "readWithChunkCache.om"
+        let dims = [UInt64(100),100]
+        let fn = try FileHandle.createNewFile(file: file, overwrite: true)
+        defer { try? FileManager.default.removeItem(atPath: file) }
+        let fileWriter = OmFileWriter(fn: fn, initialCapacity: 8)
+
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10,10], compression: .fpx_xor2d, scale_factor: 1, add_offset: 0)
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) / 7 }
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+
+        let cache = try OmChunkCache(byteBudget: 1 << 20, slotSize: 10 * 10 * 4)
+        let reader = try OmFileReader(fn: try MmapFile(fn: FileHandle.openFileReading(file: file)))
+        let read = try reader.asArray(of: Float.self, chunkCache: cache, chunkCacheFileId: 1)!
+
+        #expect(try read.read(range: [5..<6, 13..<14]) == [data[5*100 + 13]])
+        #expect(cache.hits == 0)
+        #expect(cache.misses == 1)
+        // Second read of the same chunk is served from the cache
+        #expect(try read.read(range: [0..<10, 10..<20]) == (0..<10).flatMap { x in data[x*100+10..<x*100+20] })
+        #expect(cache.hits == 1)
+        #expect(try read.read(range: [0..<100, 0..<100]) == data)
+        #expect(cache.hits == 2)
+        #expect(cache.misses == 100)
+    }
+
+    @Test func readWithIoCostModel() async throws {
+        let file = "readWithIoCostModel.om"
+        let dims = [UInt64(100),100]
+        let fn = try FileHandle.createNewFile(file: file, overwrite: true)
+        defer { try? FileManager.default.removeItem(atPath: file) }
+        let fileWriter = OmFileWriter(fn: fn, initialCapacity: 8)
+
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10,10], compression: .pfor_delta2d, scale_factor: 1, add_offset: 0)
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) }
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+
+        // A single column intersects every 10th chunk. Count data reads with fixed byte thresholds and with cost models.
+        let reader = try OmFileReader(fn: try MmapFile(fn: FileHandle.openFileReading(file: file)))
+        func countDataReads(_ model: OmIoCostModel?) -> Int {
+            var decoder = OmDecoder_t()
+            #expect(om_decoder_init(&decoder, reader.variable, 2, [0, 55], [100, 1], [0, 0], [100, 1], 512, 65536) == ERROR_OK)
+            model?.configure(decoder: &decoder)
+            var count = 0
+            var error: OmError_t = ERROR_OK
+            var indexRead = OmDecoder_indexRead_t()
+            om_decoder_init_index_read(&decoder, &indexRead)
+            while om_decoder_next_index_read(&decoder, &indexRead) {
+                let indexData = reader.fn.getData(offset: Int(indexRead.offset), count: Int(indexRead.count))
+                var dataRead = OmDecoder_dataRead_t()
+                om_decoder_init_data_read(&dataRead, &indexRead)
+                while om_decoder_next_data_read(&decoder, &dataRead, indexData, indexRead.count, &error) {
+                    count += 1
+                }
+            }
+            #expect(error == ERROR_OK)
+            return count
+        }
+        #expect(countDataReads(nil) == 9)
+        // With 16 concurrent requests, 0.1 µs latency is not worth reading 9 unused chunks
+        #expect(countDataReads(OmIoCostModel(latencyNanoseconds: 100, bytesPerNanosecond: 2)) == 10)
+        // Object storage reads all chunks at once
+        let s3 = OmIoCostModel(latencyNanoseconds: 30_000_000, bytesPerNanosecond: 0.1)
+        #expect(s3.mergeGap == 187_500)
+        #expect(countDataReads(s3) == 1)
+
+        // Latency and bandwidth are learned from request durations of different sizes
+        let model = OmIoCostModel(latencyNanoseconds: 1000, bytesPerNanosecond: 2)
+        for i in 0..<64 {
+            let bytes = 1000 * (1 + i % 8)
+            model.observe(bytes: bytes, nanoseconds: 20_000_000 + Double(bytes) / 0.1)
+        }
+        #expect(abs(model.latencyNanoseconds - 20_000_000) < 1000)
+        #expect(abs(model.bytesPerNanosecond - 0.1) < 0.001)
+
+        let readFn = try FileHandle.openFileReading(file: file)
+        let read = try await OmFileReaderAsync(fn: readFn).asArray(of: Float.self, ioCostModel: s3)!
+        #expect(try await read.read(range: [0..<100, 55..<56]) == (0..<100).map { data[$0 * 100 + 55] })
+        #expect(try await read.readConcurrent(range: [0..<100, 0..<100]) == data)
+    }
+
+    @Test func readIoReader() throws {
+        let file = "readIoReader.om"
+        let truncatedFile = "readIoReaderTruncated.om"
+        let dims = [UInt64(100),100]
+        let fn = try FileHandle.createNewFile(file: file, overwrite: true)
+        defer { try? FileManager.default.removeItem(atPath: file) }
+        defer { try? FileManager.default.removeItem(atPath: truncatedFile) }
+        let fileWriter = OmFileWriter(fn: fn, initialCapacity: 8)
+
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10,10], compression: .fpx_xor2d, scale_factor: 1, add_offset: 0)
+        let data = (0..<dims.reduce(1, *)).map { Float($0 % 1000) / 7 }
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+
+        // The second half of the file including the LUT is missing and reads return fewer bytes than requested
+        let fileData = try Data(contentsOf: URL(fileURLWithPath: file))
+        #expect(FileManager.default.createFile(atPath: truncatedFile, contents: fileData.prefix(fileData.count / 2)))
+
+        let reader = try OmFileReader(fn: try MmapFile(fn: FileHandle.openFileReading(file: file)))
+        let readFn = try FileHandle.openFileReading(file: file)
+        let truncatedFn = try FileHandle.openFileReading(file: truncatedFile)
+
+        // A full read, a block of chunks and a single column that intersects every 10th chunk are decoded in one batch
+        let reads: [(offset: [UInt64], count: [UInt64])] = [([0, 0], [100, 100]), ([10, 20], [50, 60]), ([0, 55], [100, 1])]
+        let expected = reads.map { read in
+            (Int(read.offset[0])..<Int(read.offset[0] + read.count[0])).flatMap { x in data[x*100+Int(read.offset[1])..<x*100+Int(read.offset[1] + read.count[1])] }
+        }
+        let decoders = UnsafeMutablePointer<OmDecoder_t>.allocate(capacity: reads.count)
+        decoders.initialize(repeating: OmDecoder_t(), count: reads.count)
+        defer { decoders.deallocate() }
+        for (i, read) in reads.enumerated() {
+            #expect(om_decoder_init(decoders + i, reader.variable, 2, read.offset, read.count, [0, 0], read.count, 512, 65536) == ERROR_OK)
+        }
+        let decoderPointers: [UnsafePointer<OmDecoder_t>?] = (0..<reads.count).map { UnsafePointer(decoders + $0) }
+        let outputs = reads.map { UnsafeMutableBufferPointer<Float>.allocate(capacity: Int($0.count.reduce(1, *))) }
+        defer { outputs.forEach { $0.deallocate() } }
+        let into: [UnsafeMutableRawPointer?] = outputs.map { UnsafeMutableRawPointer($0.baseAddress) }
+
+        for backend in [OM_IO_BACKEND_IO_URING, OM_IO_BACKEND_PREAD] {
+            // Data reads larger than 4096 bytes do not fit into the buffer of the reader and use separate allocations
+            for bufferSize: UInt64 in [4096, 1 << 20] {
+                for threads: UInt32 in [1, 4] {
+                    let ioReader = om_io_reader_create(readFn.fileDescriptor, backend, bufferSize, threads)
+                    defer { om_io_reader_destroy(ioReader) }
+                    #expect(ioReader != nil)
+                    outputs.forEach { $0.initialize(repeating: .nan) }
+                    var error: OmError_t = ERROR_OK
+                    #expect(om_io_reader_decode(ioReader, decoderPointers, into, UInt64(reads.count), &error))
+                    #expect(error == ERROR_OK)
+                    #expect(outputs.map { Array($0) } == expected)
+
+                    let truncatedReader = om_io_reader_create(truncatedFn.fileDescriptor, backend, bufferSize, threads)
+                    defer { om_io_reader_destroy(truncatedReader) }
+                    #expect(!om_io_reader_decode(truncatedReader, decoderPointers, into, UInt64(reads.count), &error))
+                    #expect(error == ERROR_IO_READ)
+                }
+            }
+        }
+    }
+
     /*@Test func oldWriterNewReader() throws {
         let file = "oldWriterNewReader.om"
         try FileManager.default.removeItemIfExists(at: file)
@@ -895,6 +1703,246 @@ import Foundation
 
         #expect(ints == intsRoundtrip)
     }
+
+    /// Compare all SIMD conversion kernels against the scalar version
+    @Test func copyKernelsSimd() {
+        // Not a multiple of the vector width to cover the scalar tail of every kernel
+        let count = 4096 + 7
+        let floats = (0..<count).map { $0 % 97 == 0 ? Float.nan : Float.random(in: -800..<800) }
+        let doubles = floats.map { Double($0) * 1000 }
+        let int16s = (0..<count).map { $0 % 50 == 0 ? Int16.max : Int16.random(in: Int16.min..<Int16.max) }
+        let int32s = (0..<count).map { $0 % 50 == 0 ? Int32.max : Int32.random(in: Int32.min..<Int32.max) }
+        let int64s = (0..<count).map { $0 % 50 == 0 ? Int64.max : Int64.random(in: -1<<50..<1<<50) }
+        let halfs = (0..<count).map { UInt16(truncatingIfNeeded: $0) }
+        let floatBits = (0..<count).map { _ in Float(bitPattern: UInt32.random(in: 0...UInt32.max)) }
+
+        func run<Src, Dst: Equatable & Numeric>(_ name: String, _ fn: om_common_copy_function_t, _ src: [Src], _: Dst.Type) {
+            let isaDefault = om_common_cpu_isa()
+            defer { _ = om_common_set_cpu_isa(isaDefault) }
+            var reference = [Dst](repeating: 0, count: src.count)
+            _ = om_common_set_cpu_isa(OM_CPU_ISA_SCALAR)
+            fn(UInt64(src.count), 20, 0.5, src, &reference)
+
+            for isa in [OM_CPU_ISA_SCALAR, OM_CPU_ISA_SSE41, OM_CPU_ISA_AVX2, OM_CPU_ISA_NEON] {
+                guard om_common_set_cpu_isa(isa) else {
+                    continue
+                }
+                var out = [Dst](repeating: 0, count: src.count)
+                fn(UInt64(src.count), 20, 0.5, src, &out)
+                // Compare bit patterns, NaN != NaN
+                #expect(out.withUnsafeBytes { a in reference.withUnsafeBytes { b in a.elementsEqual(b) } }, "\(name) \(String(cString: om_common_cpu_isa_string(isa)))")
+            }
+        }
+        run("float_to_int16", om_common_copy_float_to_int16, floats, Int16.self)
+        run("float_to_int32", om_common_copy_float_to_int32, floats, Int32.self)
+        run("double_to_int64", om_common_copy_double_to_int64, doubles, Int64.self)
+        run("int16_to_float", om_common_copy_int16_to_float, int16s, Float.self)
+        run("int32_to_float", om_common_copy_int32_to_float, int32s, Float.self)
+        run("int64_to_double", om_common_copy_int64_to_double, int64s, Double.self)
+        run("float16_to_float", om_common_copy_float16_to_float, halfs, Float.self)
+        run("bfloat16_to_float", om_common_copy_bfloat16_to_float, halfs, Float.self)
+        run("float_to_float16", om_common_copy_float_to_float16, floatBits, UInt16.self)
+        run("float_to_bfloat16", om_common_copy_float_to_bfloat16, floatBits, UInt16.self)
+    }
+
+    /// Roundtrip delta2d filters with all instruction sets on chunk shapes used by Open-Meteo
+    @Test func delta2dSimd() {
+        let isaDefault = om_common_cpu_isa()
+        defer { _ = om_common_set_cpu_isa(isaDefault) }
+        // [rows, length of the last dimension]
+        let shapes: [(Int, Int)] = [(9, 120), (50, 24), (25, 48), (20, 20), (1000, 3), (1, 8760)]
+
+        for (length0, length1) in shapes {
+            let data = (0..<length0*length1).map { _ in Int16.random(in: -1000..<1000) }
+            var reference = data
+            _ = om_common_set_cpu_isa(OM_CPU_ISA_SCALAR)
+            delta2d_encode16(length0, length1, &reference)
+
+            for isa in [OM_CPU_ISA_SCALAR, OM_CPU_ISA_SSE41, OM_CPU_ISA_AVX2, OM_CPU_ISA_NEON] {
+                guard om_common_set_cpu_isa(isa) else {
+                    continue
+                }
+                let name = "\(length0)x\(length1) \(String(cString: om_common_cpu_isa_string(isa)))"
+                var encoded = data
+                delta2d_encode16(length0, length1, &encoded)
+                #expect(encoded == reference, "\(name)")
+                var decoded = encoded
+                delta2d_decode16(length0, length1, &decoded)
+                #expect(decoded == data, "\(name)")
+
+                var floats = data.map { Float($0) * 0.1 }
+                let floatsOriginal = floats
+                delta2d_encode_xor(length0, length1, &floats)
+                delta2d_decode_xor(length0, length1, &floats)
+                #expect(floats == floatsOriginal, "\(name)")
+            }
+        }
+    }
+
+    /// Roundtrip smooth float and double fields with all lossless float compressions
+    @Test func fpxPredictors() throws {
+        // Partial chunks at the end of the first two dimensions
+        let dims = [UInt64(19), 38, 48]
+        let chunks = [UInt64(6), 6, 48]
+        let count = Int(dims.reduce(1, *))
+        // Geopotential height like float field and mean sea level pressure like double field with a diurnal time series
+        let geopotential = (0..<count).map { i -> Float in
+            let lat = Double(i / 48 / 38 * 10 - 90) * .pi / 180, lon = Double(i / 48 % 38 * 10) * .pi / 180
+            return Float(5500 + 300 * cos(lat) + 80 * sin(3 * lon + Double(i % 48) * 0.05) * cos(2 * lat))
+        }
+        let pressure = (0..<count).map { i -> Double in
+            let lat = Double(i / 48 / 38 * 10 - 90) * .pi / 180, lon = Double(i / 48 % 38 * 10) * .pi / 180
+            return 101325 + 1500 * sin(2 * lon - Double(i % 48) * 0.03) * cos(lat) + 200 * cos(5 * lat)
+        }
+
+        func run<OmType: OmFileArrayDataTypeProtocol & Equatable>(_ name: String, _ data: [OmType]) throws {
+            for compression in [CompressionType.fpx_xor2d, .fpx_fcm, .fpx_dfcm, .fpx_2dfcm] {
+                let inMemoryBackend = DataAsClass(data: Data())
+                let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 1024)
+                let writer = try fileWriter.prepareArray(type: OmType.self, dimensions: dims, chunkDimensions: chunks, compression: compression, scale_factor: 1, add_offset: 0)
+                try writer.writeData(array: data)
+                let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+                try fileWriter.writeTrailer(rootVariable: variable)
+                let read = try OmFileReader(fn: inMemoryBackend).asArray(of: OmType.self)!
+                #expect(try read.read() == data, "\(name) \(compression)")
+                #expect(try read.read(range: [7..<8, 33..<35, 0..<48]) == (33..<35).flatMap { y in data[(7*38+y)*48..<(7*38+y+1)*48] }, "\(name) \(compression)")
+            }
+        }
+        try run("geopotential float", geopotential)
+        try run("pressure double", pressure)
+    }
+
+    @Test func writeErrorBounded() throws {
+        let dims = [UInt64(60), 90, 24]
+        let count = Int(dims.reduce(1, *))
+        let data = (0..<count).map { i -> Float in
+            if i % 997 == 0 { return .nan }
+            let lat = Double(i / 24 / 90) * .pi / 60, lon = Double(i / 24 % 90) * .pi / 45
+            return Float(5500 + 300 * cos(lat) + 80 * sin(3 * lon + Double(i % 24) * 0.05))
+        }
+        let maxError: Float = 0.05
+        let scaleFactor = CompressionType.errorBoundScaleFactor(maxError: Double(maxError))
+        #expect(scaleFactor == 16)
+
+        let inMemoryBackend = DataAsClass(data: Data())
+        let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 1024)
+        #expect(throws: (any Error).self) {
+            try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10, 10, 24], compression: .pfor_lorenzo, scale_factor: 10, add_offset: 0)
+        }
+        let writer = try fileWriter.prepareArray(type: Float.self, dimensions: dims, chunkDimensions: [10, 10, 24], compression: .pfor_lorenzo, scale_factor: scaleFactor, add_offset: 0)
+        try writer.writeData(array: data)
+        let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+        try fileWriter.writeTrailer(rootVariable: variable)
+
+        let read = try OmFileReader(fn: inMemoryBackend).asArray(of: Float.self)!
+        let values = try read.read()
+        #expect(zip(values, data).allSatisfy { $1.isNaN ? $0.isNaN : abs($0 - $1) <= maxError })
+        #expect(try read.read(range: [15..<16, 33..<34, 0..<24]).enumerated().allSatisfy { abs($1 - data[(15*90+33)*24+$0]) <= maxError })
+
+        // Values that do not fit into 32 bit integers after scaling would be clamped and exceed the error bound
+        for value in [Float(2e8), -2e8, .infinity] {
+            let outOfRangeWriter = OmFileWriter(fn: DataAsClass(data: Data()), initialCapacity: 1024)
+            let outOfRange = try outOfRangeWriter.prepareArray(type: Float.self, dimensions: [2, 2], chunkDimensions: [2, 2], compression: .pfor_lorenzo, scale_factor: scaleFactor, add_offset: 0)
+            #expect(throws: (any Error).self) {
+                try outOfRange.writeData(array: [1, .nan, value, 4])
+            }
+        }
+    }
+
+    @Test func writeDeltaOfDelta() throws {
+        // Hourly temperature like time series with time as the fast dimension
+        let dims = [UInt64(20), 20, 24 * 30]
+        let count = Int(dims.reduce(1, *))
+        let temperature = (0..<count).map { i -> Float in
+            let location = i / Int(dims[2]), hour = Double(i % Int(dims[2]))
+            return Float(15 + Double(location % 20) * 0.1 + 5 * sin(hour * .pi / 12 + Double(location) * 0.01) + 3 * sin(hour * .pi / 60))
+        }
+        let counter = (0..<count).map { Int32($0 % Int(dims[2]) * 3600) }
+
+        func run<OmType: OmFileArrayDataTypeProtocol & Equatable>(_ data: [OmType], compression: CompressionType, scaleFactor: Float) throws -> (values: [OmType], subset: [OmType], size: Int) {
+            let inMemoryBackend = DataAsClass(data: Data())
+            let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 1024)
+            let writer = try fileWriter.prepareArray(type: OmType.self, dimensions: dims, chunkDimensions: [2, 5, 360], compression: compression, scale_factor: scaleFactor, add_offset: 0)
+            try writer.writeData(array: data)
+            let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+            try fileWriter.writeTrailer(rootVariable: variable)
+            let read = try OmFileReader(fn: inMemoryBackend).asArray(of: OmType.self)!
+            return (try read.read(), try read.read(range: [3..<4, 7..<8, 0..<100]), inMemoryBackend.data.count)
+        }
+
+        let delta2d = try run(temperature, compression: .pfor_delta2d, scaleFactor: 20)
+        for compression in [CompressionType.pfor_dod, .pfor_delta2d_dod] {
+            let result = try run(temperature, compression: compression, scaleFactor: 20)
+            #expect(result.values == delta2d.values)
+            #expect(result.subset == Array(delta2d.values[(3*20+7)*720..<(3*20+7)*720+100]))
+
+            let integers = try run(counter, compression: compression, scaleFactor: 1)
+            #expect(integers.values == counter)
+            #expect(integers.size < count / 4)
+        }
+    }
+
+#if !(os(macOS) && arch(x86_64))
+    @Test func writeHalfPrecision() throws {
+        let dims = [UInt64(60), 90, 24]
+        let count = Int(dims.reduce(1, *))
+        let data = (0..<count).map { i -> Float16 in
+            if i % 997 == 0 { return .nan }
+            let lat = Double(i / 24 / 90) * .pi / 60, lon = Double(i / 24 % 90) * .pi / 45
+            return Float16(15 + 10 * cos(lat) + 5 * sin(3 * lon + Double(i % 24) * 0.25))
+        }
+
+        for compression in [CompressionType.fpx_xor2d, .pfor_delta2d] {
+            let inMemoryBackend = DataAsClass(data: Data())
+            let fileWriter = OmFileWriter(fn: inMemoryBackend, initialCapacity: 1024)
+            #expect(throws: (any Error).self) {
+                try fileWriter.prepareArray(type: Float16.self, dimensions: dims, chunkDimensions: [10, 10, 24], compression: .fpx_dfcm, scale_factor: 1, add_offset: 0)
+            }
+            let writer = try fileWriter.prepareArray(type: Float16.self, dimensions: dims, chunkDimensions: [10, 10, 24], compression: compression, scale_factor: 1, add_offset: 0)
+            try writer.writeData(array: data)
+            let variable = try fileWriter.write(array: try writer.finalise(), name: "data", children: [])
+            try fileWriter.writeTrailer(rootVariable: variable)
+
+            let reader = try OmFileReader(fn: inMemoryBackend)
+            #expect(reader.dataType == .float16_array)
+            #expect(reader.asArray(of: Double.self) == nil)
+            let values = try reader.asArray(of: Float16.self)!.read()
+            #expect(values.map { $0.bitPattern } == data.map { $0.bitPattern }, "\(compression)")
+            let floats = try reader.asArray(of: Float.self)!.read(range: [15..<16, 33..<34, 0..<24])
+            #expect(floats.enumerated().allSatisfy { Float(data[(15*90+33)*24+$0]).bitPattern == $1.bitPattern }, "\(compression)")
+        }
+    }
+#endif
+
+    /// Data compressed by one codec build must decode with every other build
+    @Test func codecsCrossIsa() {
+        let isaDefault = om_common_cpu_isa()
+        defer { _ = om_common_set_cpu_isa(isaDefault) }
+        var data = (0..<10_000).map { _ in UInt16.random(in: 0..<2000) }
+        var floats = (0..<10_000).map { _ in Float.random(in: -100..<100) }
+
+        let isas = [OM_CPU_ISA_SCALAR, OM_CPU_ISA_SSE41, OM_CPU_ISA_AVX2, OM_CPU_ISA_NEON].filter { om_common_set_cpu_isa($0) }
+        for encodeIsa in isas {
+            _ = om_common_set_cpu_isa(encodeIsa)
+            let encoder = om_common_codecs()!.pointee
+            var compressed = [UInt8](repeating: 0, count: data.count * 4 + 1024)
+            let length = encoder.p4nzenc128v16(&data, data.count, &compressed)
+            var compressedFloats = [UInt8](repeating: 0, count: floats.count * 8 + 1024)
+            let lengthFloats = om_common_compress_fpxenc32(&floats, UInt64(floats.count), &compressedFloats)
+
+            for decodeIsa in isas {
+                _ = om_common_set_cpu_isa(decodeIsa)
+                let decoder = om_common_codecs()!.pointee
+                let name = "\(String(cString: om_common_cpu_isa_string(encoder.isa))) -> \(String(cString: om_common_cpu_isa_string(decoder.isa)))"
+                var decoded = [UInt16](repeating: 0, count: data.count + 32)
+                #expect(decoder.p4nzdec128v16(&compressed, data.count, &decoded) == length, "\(name)")
+                #expect(Array(decoded[0..<data.count]) == data, "\(name)")
+                var decodedFloats = [Float](repeating: 0, count: floats.count + 32)
+                #expect(om_common_decompress_fpxdec32(&compressedFloats, UInt64(floats.count), &decodedFloats) == lengthFloats, "\(name)")
+                #expect(Array(decodedFloats[0..<floats.count]) == floats, "\(name)")
+            }
+        }
+    }
 }
 
 extension Array where Element == Float {
@@ -22,5 +22,20 @@ void delta2d_decode_xor(const size_t length0, const size_t length1, float* chunk
 void delta2d_encode_xor_double(const size_t length0, const size_t length1, double* chunkBuffer);
 void delta2d_decode_xor_double(const size_t length0, const size_t length1, double* chunkBuffer);
 
+/// 2D xor coding of half precision and bfloat16 bit patterns
+void delta2d_encode_xor_half(const size_t length0, const size_t length1, uint16_t* chunkBuffer);
+void delta2d_decode_xor_half(const size_t length0, const size_t length1, uint16_t* chunkBuffer);
+
+/// 2D delta coding of half precision and bfloat16 values. Bit patterns are first mapped to integers in the order of their values, so that close values have small differences.
+void delta2d_encode_ordered_half(const size_t length0, const size_t length1, uint16_t* chunkBuffer);
+void delta2d_decode_ordered_half(const size_t length0, const size_t length1, uint16_t* chunkBuffer);
+
+/// 3D Lorenzo prediction over `length0` planes of `length1` rows with `length2` elements. Only plane and row differences are applied, the difference along `length2` is taken by the PFor delta coder.
+void lorenzo3d_encode32(const size_t length0, const size_t length1, const size_t length2, int32_t* chunkBuffer);
+void lorenzo3d_decode32(const size_t length0, const size_t length1, const size_t length2, int32_t* chunkBuffer);
+
+void lorenzo3d_encode64(const size_t length0, const size_t length1, const size_t length2, int64_t* chunkBuffer);
+void lorenzo3d_decode64(const size_t length0, const size_t length1, const size_t length2, int64_t* chunkBuffer);
+
 
 #endif /* deleta2d_h */
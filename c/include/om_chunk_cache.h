@@ -0,0 +1,59 @@
+/**
+ * @file om_chunk_cache.h
+ * @brief OmChunkCache: Cache of decompressed and filtered chunks shared across reads and threads
+ *
+ * The cache lives entirely in memory provided by the caller. Chunks are identified by a caller defined file
+ * identifier, the LUT offset of the variable and the chunk index. Entries are stored in fixed size slots of
+ * a set-associative table. Each set is evicted in least-recently-used order. Sets are protected by sharded
+ * spin locks, so concurrent reads of different chunks rarely contend.
+ */
+
+#ifndef OM_CHUNK_CACHE_H
+#define OM_CHUNK_CACHE_H
+
+#include "om_common.h"
+
+/// Number of slots in one set of the cache
+#define OM_CHUNK_CACHE_WAYS 8
+
+/// Number of locks. Sets are assigned to locks round-robin.
+#define OM_CHUNK_CACHE_SHARDS 64
+
+/// Opaque cache handle. The cache is stored in the memory passed to `om_chunk_cache_init`.
+typedef struct OmChunkCache OmChunkCache_t;
+
+/// Counters of cache lookups
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t inserts;
+    uint64_t evictions;
+} OmChunkCacheStatistics_t;
+
+/// Minimum memory size for a cache with at least one set of slots with `slot_size` bytes
+uint64_t om_chunk_cache_min_memory_size(uint64_t slot_size);
+
+/// Initialise a chunk cache inside `memory`. The number of slots is derived from `memory_size`. Each slot holds one chunk of up to `slot_size` bytes.
+/// `memory` must remain valid while the cache is used. The cache starts at the first 64 byte aligned address inside `memory`. Returns NULL if `memory_size` is smaller than `om_chunk_cache_min_memory_size`.
+OmChunkCache_t* om_chunk_cache_init(void* memory, uint64_t memory_size, uint64_t slot_size);
+
+/// Maximum chunk size in bytes that can be stored
+uint64_t om_chunk_cache_slot_size(const OmChunkCache_t* cache);
+
+/// Look up a chunk and keep it locked, so it can be read without copying it first. Returns NULL on a cache miss or if the cached chunk size differs from `size`.
+/// On success, `om_chunk_cache_release` must be called with the same key as soon as the data is not used anymore. Other chunks of the same shard are blocked until then.
+const void* om_chunk_cache_acquire(OmChunkCache_t* cache, uint64_t file_id, uint64_t variable_id, uint64_t chunk_index, uint64_t size);
+
+/// Unlock a chunk returned by `om_chunk_cache_acquire`
+void om_chunk_cache_release(OmChunkCache_t* cache, uint64_t file_id, uint64_t variable_id, uint64_t chunk_index);
+
+/// Copy a cached chunk into `out`. Returns false on a cache miss or if the cached chunk size differs from `size`.
+bool om_chunk_cache_get(OmChunkCache_t* cache, uint64_t file_id, uint64_t variable_id, uint64_t chunk_index, void* out, uint64_t size);
+
+/// Store a chunk. The least recently used chunk of the set is evicted. Returns false if `size` exceeds the slot size.
+bool om_chunk_cache_put(OmChunkCache_t* cache, uint64_t file_id, uint64_t variable_id, uint64_t chunk_index, const void* data, uint64_t size);
+
+/// Read the lookup counters. Counters are updated without locks and may be slightly out of date while other threads use the cache.
+OmChunkCacheStatistics_t om_chunk_cache_statistics(OmChunkCache_t* cache);
+
+#endif // OM_CHUNK_CACHE_H
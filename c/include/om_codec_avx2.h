@@ -0,0 +1,75 @@
+//
+//  om_codec_avx2.h
+//  OpenMeteoApi
+//
+//  Compile TurboPFor sources a second time for AVX2 (x86-64-v3) with prefixed symbols.
+//  The library itself is built for a portable baseline and `om_common_codecs()` selects the AVX2 build at runtime.
+//
+//  Usage in a translation unit:
+//  #include "om_codec_avx2.h"
+//  #if OM_CODEC_AVX2
+//  #include "vp4d_sse.c"
+//  OM_CODEC_AVX2_END
+//  #endif
+//
+
+#ifndef OM_CODEC_AVX2_H
+#define OM_CODEC_AVX2_H
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || defined(__GNUC__))
+#define OM_CODEC_AVX2 1
+
+// System and intrinsic headers are included before target attributes are applied
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <immintrin.h>
+#include <x86intrin.h>
+
+#define OM_TURBOPFOR_SYMBOL(name) om_avx2_##name
+#include "turbopfor_symbols.h"
+
+#if defined(__clang__)
+// Clang does not define feature macros for target attributes. TurboPFor selects code paths with them.
+#ifndef __AVX__
+#define __AVX__ 1
+#endif
+#ifndef __AVX2__
+#define __AVX2__ 1
+#endif
+#ifndef __BMI__
+#define __BMI__ 1
+#endif
+#ifndef __BMI2__
+#define __BMI2__ 1
+#endif
+#ifndef __LZCNT__
+#define __LZCNT__ 1
+#endif
+#ifndef __POPCNT__
+#define __POPCNT__ 1
+#endif
+#ifndef __SSSE3__
+#define __SSSE3__ 1
+#endif
+#ifndef __SSE4_1__
+#define __SSE4_1__ 1
+#endif
+#ifndef __SSE4_2__
+#define __SSE4_2__ 1
+#endif
+#pragma clang attribute push (__attribute__((target("avx2,bmi,bmi2,lzcnt,popcnt,fma,sse4.2"))), apply_to = function)
+#define OM_CODEC_AVX2_END _Pragma("clang attribute pop")
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,bmi,bmi2,lzcnt,popcnt,fma,sse4.2")
+#define OM_CODEC_AVX2_END _Pragma("GCC pop_options")
+#endif
+
+#else
+#define OM_CODEC_AVX2 0
+#endif
+
+#endif // OM_CODEC_AVX2_H
@@ -29,6 +29,14 @@ typedef enum {
     ERROR_INVALID_READ_OFFSET = 8,
     ERROR_INVALID_READ_COUNT = 9,
     ERROR_INVALID_CUBE_OFFSET = 10,
+    ERROR_IO_READ = 11,
+    ERROR_OUT_OF_MEMORY = 12,
+    ERROR_IO_WRITE = 13,
+    ERROR_INVALID_SCALE_FACTOR = 14,
+    ERROR_INVALID_MANTISSA_BITS = 15,
+    ERROR_INVALID_STATE = 16,
+    ERROR_VALUE_OUT_OF_RANGE = 17,
+    ERROR_LUT_BLOCK_OFFSETS_REQUIRED = 18,
 } OmError_t;
 
 const char* om_error_string(OmError_t error);
@@ -57,18 +65,49 @@ typedef enum {
     DATA_TYPE_UINT64_ARRAY = 19,
     DATA_TYPE_FLOAT_ARRAY = 20,
     DATA_TYPE_DOUBLE_ARRAY = 21,
-    DATA_TYPE_STRING_ARRAY = 22
+    DATA_TYPE_STRING_ARRAY = 22,
+    DATA_TYPE_FLOAT16_ARRAY = 23, // IEEE 754 half precision. Stored as 16 bit patterns and decoded as such or as float, see `om_decoder_set_output_data_type`.
+    DATA_TYPE_BFLOAT16_ARRAY = 24 // Brain floating point with the exponent range of float and 7 mantissa bits. Stored like `DATA_TYPE_FLOAT16_ARRAY`.
 } OmDataType_t;
 
 /// Compression types
 typedef enum {
     COMPRESSION_PFOR_DELTA2D_INT16 = 0, // Lossy compression using 2D delta coding and scale-factor. Only supports float and scales to 16-bit signed integer.
-    COMPRESSION_FPX_XOR2D = 1, // Lossless float/double compression using 2D xor coding.
+    COMPRESSION_FPX_XOR2D = 1, // Lossless float/double compression using 2D xor coding. Values can be rounded to fewer mantissa bits before coding, see `om_encoder_set_mantissa_bits`.
     COMPRESSION_PFOR_DELTA2D = 2, // PFor integer compression. Floating point values are scaled to 32 bit signed integers. Doubles are scaled to 64 bit signed integers.
     COMPRESSION_PFOR_DELTA2D_INT16_LOGARITHMIC = 3, // Similar to `COMPRESSION_PFOR_DELTA2D_INT16` but applies `log10(1+x)` before.
-    COMPRESSION_NONE = 4
+    COMPRESSION_NONE = 4,
+    COMPRESSION_FPX_FCM = 5, // Lossless float/double compression. Predicts each value from a hash table indexed by the preceding values (finite context method).
+    COMPRESSION_FPX_DFCM = 6, // Lossless float/double compression. Like `COMPRESSION_FPX_FCM` but predicts the difference to the previous value. Suited for smooth fields.
+    COMPRESSION_FPX_2DFCM = 7, // Lossless float/double compression. Like `COMPRESSION_FPX_DFCM` but the difference is taken to the value two elements before.
+    COMPRESSION_PFOR_LORENZO = 8, // Error-bounded float/double compression. Values are rounded to multiples of `1/scale_factor` and predicted with a 3D Lorenzo predictor over the last three chunk dimensions. The absolute error is at most `0.5/scale_factor`. Requires a power of two scale factor and no offset, see `om_encoder_error_bound_scale_factor`.
+    COMPRESSION_PFOR_DOD = 9, // PFor integer compression with delta-of-delta coding along the last dimension. Suited for smooth time series if time is the fast dimension. Floating point values are scaled like `COMPRESSION_PFOR_DELTA2D`. All rows of a chunk are coded as one sequence, see `om_encode_compress`.
+    COMPRESSION_PFOR_DELTA2D_DOD = 10 // Like `COMPRESSION_PFOR_DOD` but rows are first delta coded to the previous row like `COMPRESSION_PFOR_DELTA2D`.
 } OmCompression_t;
 
+/// Encoding of the look-up table (LUT) with compressed chunk offsets
+typedef enum {
+    LUT_ENCODING_PFOR = 0, // Blocks of 64 offsets compressed with PFor delta coding. Resolving one offset requires decompressing a block.
+    LUT_ENCODING_FIXED_WIDTH = 1, // Little-endian offsets with the minimum number of bytes. Single offsets are read directly.
+    LUT_ENCODING_PFOR_VARIABLE = 2, // Blocks of 64 offsets compressed with PFor without padding and a table with the start and end of each block. Blocks are written between chunks while chunks are written.
+} OmLutEncoding_t;
+
+/// First byte of each chunk of arrays with `OM_COMPRESSION_FLAG_CONSTANT_CHUNKS`
+typedef enum {
+    OM_CHUNK_HEADER_COMPRESSED = 0, // Followed by the compressed chunk
+    OM_CHUNK_HEADER_CONSTANT = 1, // Followed by a single value with `bytes_per_element_compressed` bytes that is repeated for all elements. Nothing has to be decompressed.
+} OmChunkHeader_t;
+
+/// Statistics of a single chunk in the unit of the decoded array. Values are converted with the scale factor and offset of the array,
+/// so that they match decoded data exactly. Missing values (NaN) are counted in `nan_count` and excluded from `min`, `max` and `sum`.
+/// If all values are missing, `min` and `max` are NaN. Stored in files as little-endian array with one entry per chunk.
+typedef struct {
+    double min;
+    double max;
+    double sum;
+    uint64_t nan_count;
+} OmChunkStatistics_t;
+
 /// Get the number of bytes per element.
 /// This function will set an error if called for an invalid data type.
 /// It only supports array types.
@@ -97,11 +136,94 @@ uint8_t om_get_bytes_per_element_compressed(OmDataType_t data_type, OmCompressio
       __typeof__ (b) _b = (b); \
     _a < _b ? _a : _b; })
 
+/// Instruction sets for SIMD conversion kernels
+typedef enum {
+    OM_CPU_ISA_SCALAR = 0,
+    OM_CPU_ISA_SSE41 = 1,
+    OM_CPU_ISA_AVX2 = 2,
+    OM_CPU_ISA_NEON = 3,
+} OmCpuIsa_t;
+
+/// Signature of all copy and conversion functions
+typedef void (*om_common_copy_function_t)(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
+
+/// TurboPFor and FPX codecs used to compress chunks and look-up tables.
+/// The library is built for a portable baseline. On x86 a second build for AVX2 is selected at runtime.
+typedef struct {
+    /// Instruction set the codecs were compiled for
+    OmCpuIsa_t isa;
+
+    size_t (*p4nzdec8)(unsigned char* in, size_t n, uint8_t* out);
+    size_t (*p4nddec8)(unsigned char* in, size_t n, uint8_t* out);
+    size_t (*p4nzdec128v16)(unsigned char* in, size_t n, uint16_t* out);
+    size_t (*p4nddec128v16)(unsigned char* in, size_t n, uint16_t* out);
+    size_t (*p4nzdec128v32)(unsigned char* in, size_t n, uint32_t* out);
+    size_t (*p4nddec128v32)(unsigned char* in, size_t n, uint32_t* out);
+    size_t (*p4nzdec64)(unsigned char* in, size_t n, uint64_t* out);
+    size_t (*p4nddec64)(unsigned char* in, size_t n, uint64_t* out);
+
+    size_t (*p4nzenc8)(uint8_t* in, size_t n, unsigned char* out);
+    size_t (*p4ndenc8)(uint8_t* in, size_t n, unsigned char* out);
+    size_t (*p4nzenc128v16)(uint16_t* in, size_t n, unsigned char* out);
+    size_t (*p4ndenc128v16)(uint16_t* in, size_t n, unsigned char* out);
+    size_t (*p4nzenc128v32)(uint32_t* in, size_t n, unsigned char* out);
+    size_t (*p4ndenc128v32)(uint32_t* in, size_t n, unsigned char* out);
+    size_t (*p4nzenc64)(uint64_t* in, size_t n, unsigned char* out);
+    size_t (*p4ndenc64)(uint64_t* in, size_t n, unsigned char* out);
+
+    size_t (*p4nzzdec128v8)(unsigned char* in, size_t n, uint8_t* out, uint8_t start);
+    size_t (*p4nzzdec128v16)(unsigned char* in, size_t n, uint16_t* out, uint16_t start);
+    size_t (*p4nzzdec128v32)(unsigned char* in, size_t n, uint32_t* out, uint32_t start);
+    size_t (*p4nzzdec128v64)(unsigned char* in, size_t n, uint64_t* out, uint64_t start);
+    size_t (*p4nzzenc128v8)(uint8_t* in, size_t n, unsigned char* out, uint8_t start);
+    size_t (*p4nzzenc128v16)(uint16_t* in, size_t n, unsigned char* out, uint16_t start);
+    size_t (*p4nzzenc128v32)(uint32_t* in, size_t n, unsigned char* out, uint32_t start);
+    size_t (*p4nzzenc128v64)(uint64_t* in, size_t n, unsigned char* out, uint64_t start);
+
+    size_t (*fpxdec16)(unsigned char* in, size_t n, uint16_t* out, uint16_t start);
+    size_t (*fpxdec32)(unsigned char* in, size_t n, uint32_t* out, uint32_t start);
+    size_t (*fpxdec64)(unsigned char* in, size_t n, uint64_t* out, uint64_t start);
+    size_t (*fpxenc16)(uint16_t* in, size_t n, unsigned char* out, uint16_t start);
+    size_t (*fpxenc32)(uint32_t* in, size_t n, unsigned char* out, uint32_t start);
+    size_t (*fpxenc64)(uint64_t* in, size_t n, unsigned char* out, uint64_t start);
+
+    size_t (*fpfcmdec32)(unsigned char* in, size_t n, uint32_t* out, uint32_t start);
+    size_t (*fpfcmdec64)(unsigned char* in, size_t n, uint64_t* out, uint64_t start);
+    size_t (*fpfcmenc32)(uint32_t* in, size_t n, unsigned char* out, uint32_t start);
+    size_t (*fpfcmenc64)(uint64_t* in, size_t n, unsigned char* out, uint64_t start);
+    size_t (*fpdfcmdec32)(unsigned char* in, size_t n, uint32_t* out, uint32_t start);
+    size_t (*fpdfcmdec64)(unsigned char* in, size_t n, uint64_t* out, uint64_t start);
+    size_t (*fpdfcmenc32)(uint32_t* in, size_t n, unsigned char* out, uint32_t start);
+    size_t (*fpdfcmenc64)(uint64_t* in, size_t n, unsigned char* out, uint64_t start);
+    size_t (*fp2dfcmdec32)(unsigned char* in, size_t n, uint32_t* out, uint32_t start);
+    size_t (*fp2dfcmdec64)(unsigned char* in, size_t n, uint64_t* out, uint64_t start);
+    size_t (*fp2dfcmenc32)(uint32_t* in, size_t n, unsigned char* out, uint32_t start);
+    size_t (*fp2dfcmenc64)(uint64_t* in, size_t n, unsigned char* out, uint64_t start);
+} OmCodecs_t;
+
+/// Get the instruction set used by the conversion kernels. The best supported instruction set is detected on first use.
+OmCpuIsa_t om_common_cpu_isa(void);
+
+/// Force the conversion kernels and codecs to a specific instruction set. Returns false if the CPU does not support it.
+/// All instruction sets produce identical results. This is intended for benchmarks and tests.
+bool om_common_set_cpu_isa(OmCpuIsa_t isa);
+
+/// Get the codecs selected for this CPU. `isa` reports which build is used.
+const OmCodecs_t* om_common_codecs(void);
+
+/// Get a name for an instruction set
+const char* om_common_cpu_isa_string(OmCpuIsa_t isa);
+
 /// Copy 16 bit integer array and convert to float
 void om_common_copy_float_to_int16(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
 void om_common_copy_float_to_int32(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
 void om_common_copy_double_to_int64(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
 
+/// Like `om_common_copy_float_to_int32` and `om_common_copy_double_to_int64`, but return false if a value is infinite or does not fit into
+/// the integer type after scaling. The largest integer is excluded, because it marks missing values. NaN is stored as missing.
+bool om_common_copy_float_to_int32_checked(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
+bool om_common_copy_double_to_int64_checked(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
+
 /// Copy 16 bit integer array and convert to float and scale log10
 void om_common_copy_float_to_int16_log10(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
 
@@ -113,11 +235,56 @@ void om_common_copy_int64_to_double(uint64_t length, float scale_factor, float a
 /// Convert int16 and scale to float with log10
 void om_common_copy_int16_to_float_log10(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
 
+/// Convert half precision and bfloat16 bit patterns to float. Exact for all values including subnormals and infinity. Half precision signalling NaN become quiet NaN like in hardware conversions.
+void om_common_copy_float16_to_float(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
+void om_common_copy_bfloat16_to_float(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
+
+/// Convert float to half precision and bfloat16 bit patterns. Rounds to nearest, ties to even. Values out of range become infinity and NaN stays NaN.
+void om_common_copy_float_to_float16(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
+void om_common_copy_float_to_bfloat16(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
+
+/// Convert a single half precision bit pattern to float
+static inline float om_common_float16_to_float(uint16_t value) {
+    const uint32_t sign = (uint32_t)(value & 0x8000) << 16;
+    const uint32_t exponent = (value >> 10) & 0x1F;
+    const uint32_t mantissa = value & 0x3FF;
+    union { uint32_t u; float f; } result;
+    if (exponent == 0x1F) {
+        // Infinity or NaN. NaN are quieted.
+        result.u = sign | 0x7F800000 | (mantissa << 13) | (mantissa != 0 ? 0x400000 : 0);
+    } else if (exponent != 0) {
+        // Rebias the exponent from 15 to 127
+        result.u = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else {
+        // Zero and subnormals are `mantissa * 2^-24`, which is exact in float
+        result.f = (float)mantissa * 0x1p-24f;
+        result.u |= sign;
+    }
+    return result.f;
+}
+
+/// Convert a single bfloat16 bit pattern to float. Bfloat16 is the upper half of a float, therefore NaN are kept as they are.
+static inline float om_common_bfloat16_to_float(uint16_t value) {
+    union { uint32_t u; float f; } result = {.u = (uint32_t)value << 16};
+    return result.f;
+}
+
+/// Undo 2D delta coding of `length0` rows with `length1` elements in place and convert them to scaled float in the same pass.
+/// `previous_row` is the already decoded row before `src` or NULL if `src` starts at the first row of the chunk.
+void om_common_decode_delta2d_int16_to_float(uint64_t length0, uint64_t length1, float scale_factor, float add_offset, const int16_t* previous_row, int16_t* src, float* dst);
+
 void om_common_copy8(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
 void om_common_copy16(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
 void om_common_copy32(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
 void om_common_copy64(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst);
 
+/// Copy floats and round them to `mantissa_bits` mantissa bits (round to nearest, ties to even). Trailing mantissa bits are zero afterwards.
+/// NaN and infinity are copied unchanged. Values that would round to infinity are truncated instead.
+void om_common_copy_float_round_mantissa(uint64_t length, uint8_t mantissa_bits, const void* src, void* dst);
+void om_common_copy_double_round_mantissa(uint64_t length, uint8_t mantissa_bits, const void* src, void* dst);
+void om_common_copy_float16_round_mantissa(uint64_t length, uint8_t mantissa_bits, const void* src, void* dst);
+void om_common_copy_bfloat16_round_mantissa(uint64_t length, uint8_t mantissa_bits, const void* src, void* dst);
+
 uint64_t om_common_compress_fpxenc32(const void* src, uint64_t length, void* dst);
 uint64_t om_common_compress_fpxenc64(const void* src, uint64_t length, void* dst);
 uint64_t om_common_decompress_fpxdec32(const void* src, uint64_t length, void* dst);
@@ -14,22 +14,108 @@
 
 #include "om_common.h"
 #include "om_variable.h"
+#include "om_chunk_cache.h"
+#include "om_lut_cache.h"
+#include "om_io_cost_model.h"
+#include "om_thread_pool.h"
 
 typedef struct {
     uint64_t lowerBound;
     uint64_t upperBound;
 } OmRange_t;
 
+/// Maximum number of dimensions for which `om_decoder_init` precomputes a read plan. Arrays with more dimensions use the generic code path.
+#define OM_READ_PLAN_MAX_DIMENSIONS 8
+
 typedef struct {
     uint64_t offset;
     uint64_t count;
     OmRange_t indexRange;
     OmRange_t chunkIndex;
     OmRange_t nextChunk;
+
+    /// Chunk coordinates of the last chunk of `chunkIndex` and `nextChunk`. Advanced incrementally if the decoder has a read plan.
+    uint64_t chunkCoordinate[OM_READ_PLAN_MAX_DIMENSIONS];
+    uint64_t nextChunkCoordinate[OM_READ_PLAN_MAX_DIMENSIONS];
 } OmDecoder_indexRead_t;
 
 typedef OmDecoder_indexRead_t OmDecoder_dataRead_t;
 
+/// A data read of a batch returned by `om_decoder_next_data_reads`. The chunk offsets of this read are stored in the shared chunk offsets buffer.
+typedef struct {
+    uint64_t offset;
+    uint64_t count;
+    OmRange_t chunkIndex;
+
+    /// Position of the first chunk offset of this read in the chunk offsets buffer
+    uint64_t chunkOffsetsStart;
+
+    /// Number of chunk offsets of this read
+    uint64_t chunkOffsetsCount;
+} OmDecoder_dataReadRequest_t;
+
+/// Chunk shape classes along one dimension. The first and last chunk of a read may be clamped by the read range. The last chunk may also be truncated by the array edge. All other chunks are interior and are read entirely.
+typedef enum {
+    OM_CHUNK_SHAPE_FIRST = 0,
+    OM_CHUNK_SHAPE_INTERIOR = 1,
+    OM_CHUNK_SHAPE_LAST = 2,
+} OmChunkShape_t;
+
+/// Geometry of one chunk shape class along a single dimension
+typedef struct {
+    /// Number of elements of the chunk in this dimension. Smaller than the chunk length for the last chunk of the array
+    uint64_t length;
+
+    /// First element inside the chunk that is read
+    uint64_t read_start;
+
+    /// Number of elements inside the chunk that are read
+    uint64_t read_count;
+} OmReadPlanShape_t;
+
+/// Precomputed geometry of a single dimension
+typedef struct {
+    /// Number of chunks in this dimension
+    uint64_t chunk_count;
+
+    /// First chunk in this dimension that intersects the read
+    uint64_t chunk_lower;
+
+    /// One past the last chunk in this dimension that intersects the read
+    uint64_t chunk_upper;
+
+    /// Distance between 2 neighbouring chunks in this dimension in the linear chunk index. Product of all faster chunk counts.
+    uint64_t chunk_stride;
+
+    /// Number of chunks that can be read linearly if the chunk iteration overflows in this dimension
+    uint64_t linear_chunk_count;
+
+    /// Chunk length of this dimension
+    uint64_t chunk;
+
+    /// Read offset and cube offset of this dimension
+    uint64_t read_offset;
+    uint64_t cube_offset;
+
+    /// Target cube dimension and the distance between 2 neighbouring elements of this dimension in the target cube
+    uint64_t cube_dimension;
+    uint64_t cube_stride;
+
+    /// Geometry for each `OmChunkShape_t`
+    OmReadPlanShape_t shape[3];
+} OmReadPlanDimension_t;
+
+/// Read geometry that is computed once in `om_decoder_init`. Decoding chunks only walks copy runs with additions and does not need any integer division.
+typedef struct {
+    /// Number of dimensions in the plan. 0 if no plan is available and the generic code path is used.
+    uint64_t dimensions_count;
+
+    /// Number of fastest dimensions that every linear run of chunks covers entirely from `chunk_lower` to `chunk_upper`
+    uint64_t linear_dimensions_count;
+
+    OmReadPlanDimension_t dimensions[OM_READ_PLAN_MAX_DIMENSIONS];
+} OmReadPlan_t;
+
 
 typedef struct {
     /// Number of dimensions
@@ -41,9 +127,26 @@ typedef struct {
     /// The maximum IO size before IO operations are split up. Default 64k. If data is in memory, this can be set higher.
     uint64_t io_size_max;
 
+    /// Marginal time of an additional IO request of the IO cost model set with `om_decoder_set_io_cost_model`. If 0, reads are merged with the `io_size_merge` byte threshold.
+    double io_request_ns;
+
+    /// Transfer time per byte of the IO cost model in nanoseconds
+    double io_ns_per_byte;
+
     /// Each 64 LUT entries are compressed into a LUT chunk. The LUT chunk length returns the size in byte how large a maximum compressed size for a LUT chunk is. 0 for version 1/2 files that do not compress LUT.
+    /// For `LUT_ENCODING_FIXED_WIDTH` this is the size in bytes of a single LUT entry. For `LUT_ENCODING_PFOR_VARIABLE` it is 1, because block positions are read from the block offset table.
     uint64_t lut_chunk_length;
 
+    /// Number of LUT entries in one LUT chunk. `LUT_CHUNK_COUNT` for PFor compressed LUTs, 1 for fixed width LUTs and version 1/2 files.
+    uint64_t lut_chunk_element_count;
+
+    /// File offset of the block offset table of a `LUT_ENCODING_PFOR_VARIABLE` LUT. 0 for all other LUT encodings.
+    uint64_t lut_block_offsets_start;
+
+    /// Entries of the block offset table set by `om_decoder_set_lut_block_offsets`, starting at block `lut_block_offsets_first`. NULL if not set.
+    const uint8_t* lut_block_offsets;
+    uint64_t lut_block_offsets_first;
+
     /// The offset position where the LUT should start
     uint64_t lut_start;
 
@@ -77,6 +180,9 @@ typedef struct {
     /// The data type of the data
     uint8_t data_type;
 
+    /// The data type of decoded values written to the output. Equal to `data_type` unless set with `om_decoder_set_output_data_type`
+    uint8_t output_data_type;
+
     /// The compression type of the data
     uint8_t compression;
 
@@ -85,6 +191,33 @@ typedef struct {
 
     /// The size of the elements in bytes after compression, e.g. Int16 could be used to scale floats
     uint8_t bytes_per_element_compressed;
+
+    /// Precomputed read geometry
+    OmReadPlan_t plan;
+
+    /// Optional cache of decompressed and filtered chunks. NULL if no cache is used.
+    OmChunkCache_t* chunk_cache;
+
+    /// Identifies the file of this variable in `chunk_cache`
+    uint64_t chunk_cache_file_id;
+
+    /// Optional cache of decoded LUT blocks of this variable. NULL if no cache is used.
+    OmLutCache_t* lut_cache;
+
+    /// File offset and size of the `OmChunkStatistics_t` array of this variable. 0 if no statistics are stored.
+    uint64_t statistics_offset;
+    uint64_t statistics_size;
+
+    /// Statistics of the chunks of the read set by `om_decoder_set_predicate`, starting at chunk `predicate_first_chunk`. NULL if all chunks are read.
+    const uint8_t* predicate_statistics;
+    uint64_t predicate_first_chunk;
+
+    /// Only chunks that may contain values in `[predicate_lower, predicate_upper]` are read
+    double predicate_lower;
+    double predicate_upper;
+
+    /// True if every chunk starts with an `OmChunkHeader_t`. Constant chunks are filled without decompression.
+    bool constant_chunks;
 } OmDecoder_t;
 
 /**
@@ -92,7 +225,8 @@ typedef struct {
  *
  * This function sets up the `om_decoder_t` instance, configuring its dimensions, chunk information,
  * reading parameters, LUT (Look-Up Table) properties, and decompression methods. It prepares the
- * decoder for reading and processing compressed data.
+ * decoder for reading and processing compressed data. For up to `OM_READ_PLAN_MAX_DIMENSIONS` dimensions,
+ * the read geometry is precomputed into `decoder->plan` to avoid integer divisions while decoding chunks.
  *
  * @param decoder A pointer to an `om_decoder_t` structure that will be initialized.
  * @param variable A pointer to the data region of the variable to read
@@ -154,6 +288,67 @@ void om_decoder_init_index_read(const OmDecoder_t* decoder, OmDecoder_indexRead_
  */
 bool om_decoder_next_index_read(const OmDecoder_t* decoder, OmDecoder_indexRead_t* index_read);
 
+/**
+ * @brief Collects multiple index reads at once, so that they can be submitted together, e.g. with `preadv`, io_uring or parallel range requests.
+ *
+ * Works like calling `om_decoder_next_index_read` repeatedly. `index_read` holds the iteration state and must be initialised
+ * with `om_decoder_init_index_read`. Index reads are independent of each other and may be completed in any order.
+ * Index reads with a `count` of 0 are resolved by the LUT cache and do not require IO.
+ *
+ * @param[out] index_reads           Buffer for index reads.
+ * @param[in]  index_reads_capacity  Number of elements in `index_reads`.
+ * @param[out] index_reads_count     Number of index reads written to `index_reads`.
+ *
+ * @returns `false` if there are no more index reads.
+ */
+bool om_decoder_next_index_reads(const OmDecoder_t* decoder, OmDecoder_indexRead_t* index_read, OmDecoder_indexRead_t* index_reads, uint64_t index_reads_capacity, uint64_t* index_reads_count);
+
+/// Decode values as `output_data_type`. `DATA_TYPE_FLOAT16_ARRAY` and `DATA_TYPE_BFLOAT16_ARRAY` can be decoded to `DATA_TYPE_FLOAT_ARRAY`.
+/// Other data types only decode to their own type. Must be called after `om_decoder_init` and before buffer sizes are calculated.
+OmError_t om_decoder_set_output_data_type(OmDecoder_t* decoder, OmDataType_t output_data_type);
+
+/// Use a chunk cache in `om_decoder_decode_chunks_with_offsets`. Must be called after `om_decoder_init`.
+/// Chunks are identified by `file_id`, the LUT offset of the variable and the chunk index. `file_id` must be unique for each file that uses the same cache.
+/// Cached chunks are copied into the target cube without decompression. `om_decoder_decode_chunks` does not use the cache, because it needs to decompress chunks to find the next chunk.
+void om_decoder_set_chunk_cache(OmDecoder_t* decoder, OmChunkCache_t* cache, uint64_t file_id);
+
+/// Use decoded LUT blocks from `cache` and store newly decoded blocks. Must be called after `om_decoder_init`.
+/// If all LUT blocks of an index read are resident, `om_decoder_next_index_read` returns a `count` of 0 and no index data needs to be read.
+/// Returns false and does not use the cache if it was initialised for a different variable.
+bool om_decoder_set_lut_cache(OmDecoder_t* decoder, OmLutCache_t* cache);
+
+/// Merge and split IO requests by expected time of `model` instead of the `io_size_merge` and `io_size_max` byte thresholds. Must be called after `om_decoder_init`.
+/// Gaps of unused bytes are read if their transfer time is lower than the marginal time of a separate request. The model is copied,
+/// later updates only affect decoders that are configured afterwards.
+void om_decoder_set_io_cost_model(OmDecoder_t* decoder, const OmIoCostModel_t* model);
+
+/// Number of chunks that intersect the read
+uint64_t om_decoder_count_read_chunks(const OmDecoder_t* decoder);
+
+/// File range of the chunk statistics from the first to the last chunk that intersects the read. Statistics are read without touching
+/// the LUT or any data. Returns false if the variable has no chunk statistics.
+bool om_decoder_statistics_read(const OmDecoder_t* decoder, uint64_t* offset, uint64_t* count);
+
+/// Copy the statistics of all chunks that intersect the read in chunk order. `statistics_data` contains the range of `om_decoder_statistics_read`.
+/// `statistics` and the optional `chunk_indices` must have room for `om_decoder_count_read_chunks` entries. Statistics cover entire chunks, including
+/// elements outside of the read. Returns false and sets `ERROR_OUT_OF_BOUND_READ` if `statistics_data_size` does not match.
+bool om_decoder_get_chunk_statistics(const OmDecoder_t* decoder, const void* statistics_data, uint64_t statistics_data_size, OmChunkStatistics_t* statistics, uint64_t* chunk_indices, OmError_t* error);
+
+/// Only read chunks that may contain values in `[lower, upper]` according to their statistics. Use infinity for open bounds. Must be called after `om_decoder_init`.
+/// `statistics_data` contains the range of `om_decoder_statistics_read` and must remain accessible while decoding. Chunks without matching values are
+/// skipped by `om_decoder_next_data_read_with_offsets`, `om_decoder_next_data_reads` and `om_decoder_decode_chunks_with_offsets`, and their elements
+/// in the target cube are not modified. `om_decoder_decode_chunks` still decodes them. Returns false if `statistics_data_size` does not match.
+bool om_decoder_set_predicate(OmDecoder_t* decoder, const void* statistics_data, uint64_t statistics_data_size, double lower, double upper);
+
+/// File range of the block offset table entries of all LUT blocks of the read. Returns false if the LUT does not use `LUT_ENCODING_PFOR_VARIABLE`
+/// or all blocks of the read are resident in the LUT cache. Otherwise the range has to be read once per read and passed to `om_decoder_set_lut_block_offsets`
+/// before index reads are computed. Without it, `om_decoder_next_index_read` returns a `count` of 0 and data reads fail with `ERROR_LUT_BLOCK_OFFSETS_REQUIRED`.
+bool om_decoder_lut_block_offsets_read(const OmDecoder_t* decoder, uint64_t* offset, uint64_t* count);
+
+/// Use the block offset table entries of the range of `om_decoder_lut_block_offsets_read` to locate variable-length LUT blocks. Must be called after
+/// `om_decoder_set_lut_cache`. `block_offsets_data` must remain accessible while decoding. Returns false if the size does not match or the table is corrupted.
+bool om_decoder_set_lut_block_offsets(OmDecoder_t* decoder, const void* block_offsets_data, uint64_t block_offsets_data_size);
+
 
 /**
  * @brief Initializes an `om_decoder_data_read_t` structure for data reading.
@@ -204,6 +399,53 @@ void om_decoder_init_data_read(OmDecoder_dataRead_t *data_read, const OmDecoder_
  */
 bool om_decoder_next_data_read(const OmDecoder_t *decoder, OmDecoder_dataRead_t* dataRead, const void* indexData, uint64_t indexDataCount, OmError_t* error);
 
+/// Suggested capacity for chunk offsets in `om_decoder_next_data_read_with_offsets`
+#define OM_DECODER_CHUNK_OFFSETS_COUNT 1024
+
+/**
+ * @brief Prepares the next data read operation and records the compressed offsets of each chunk.
+ *
+ * Works like `om_decoder_next_data_read`, but also stores the byte offsets of all chunks from the LUT,
+ * so that `om_decoder_decode_chunks_with_offsets` can skip chunks that do not intersect the read without
+ * decompressing them. Merged IO reads regularly include such chunks.
+ *
+ * Offsets are relative to `dataRead->offset`. The first offset is 0 and the last offset equals `dataRead->count`.
+ * Each chunk that intersects the read adds its end offset. A sequence of non-intersecting chunks adds the start
+ * offset of the next intersecting chunk.
+ *
+ * @param[in]  chunkOffsets          Buffer for chunk offsets.
+ * @param[in]  chunkOffsetsCapacity  Number of elements in `chunkOffsets`. Must be at least 2. Data reads are
+ *                                   split if more offsets would be required.
+ * @param[out] chunkOffsetsCount     Number of offsets written to `chunkOffsets`.
+ *
+ * @returns `true` if the next data segment was prepared, `false` if there are no more data segments to read or an error occurred.
+ */
+bool om_decoder_next_data_read_with_offsets(const OmDecoder_t *decoder, OmDecoder_dataRead_t* dataRead, const void* indexData, uint64_t indexDataCount, uint64_t* chunkOffsets, uint64_t chunkOffsetsCapacity, uint64_t* chunkOffsetsCount, OmError_t* error);
+
+
+/// Request and chunk offset capacities for `om_decoder_next_data_reads` that are sufficient to return all data reads of an index read in one batch
+void om_decoder_data_reads_capacity(const OmDecoder_indexRead_t* index_read, uint64_t* data_reads_capacity, uint64_t* chunk_offsets_capacity);
+
+/**
+ * @brief Collects multiple data reads of an index read at once, including the chunk offsets of each data read.
+ *
+ * Works like calling `om_decoder_next_data_read_with_offsets` repeatedly. `data_read` holds the iteration state and must be
+ * initialised with `om_decoder_init_data_read`. With the capacities of `om_decoder_data_reads_capacity`, a single call returns
+ * all data reads. Otherwise, the function has to be called again until it returns `false`.
+ *
+ * Data reads can be completed and decoded in any order and from multiple threads with `om_decoder_decode_chunks_with_offsets`,
+ * passing `&chunk_offsets[request.chunkOffsetsStart]` and `request.chunkOffsetsCount`.
+ *
+ * @param[out] data_reads              Buffer for data reads.
+ * @param[in]  data_reads_capacity     Number of elements in `data_reads`.
+ * @param[out] data_reads_count        Number of data reads written to `data_reads`.
+ * @param[out] chunk_offsets           Buffer for the chunk offsets of all data reads.
+ * @param[in]  chunk_offsets_capacity  Number of elements in `chunk_offsets`. Must be at least 2.
+ * @param[out] chunk_offsets_count     Number of chunk offsets written to `chunk_offsets`.
+ *
+ * @returns `false` if there are no more data reads or an error occurred.
+ */
+bool om_decoder_next_data_reads(const OmDecoder_t *decoder, OmDecoder_dataRead_t* data_read, const void* index_data, uint64_t index_data_size, OmDecoder_dataReadRequest_t* data_reads, uint64_t data_reads_capacity, uint64_t* data_reads_count, uint64_t* chunk_offsets, uint64_t chunk_offsets_capacity, uint64_t* chunk_offsets_count, OmError_t* error);
 
 /**
  * @brief Calculates the size of the buffer required to read a single data chunk.
@@ -259,4 +501,115 @@ uint64_t om_decoder_read_buffer_size(const OmDecoder_t* decoder);
  */
 bool om_decoder_decode_chunks(const OmDecoder_t *decoder, OmRange_t chunkIndex, const void *data, uint64_t dataCount, void *into, void *chunkBuffer, OmError_t* error);
 
+/**
+ * @brief Decodes multiple data chunks using chunk offsets from `om_decoder_next_data_read_with_offsets`.
+ *
+ * Chunks that do not intersect the read are skipped entirely. `om_decoder_decode_chunks` has to decompress
+ * them to learn their compressed size. Because the compressed size of each chunk is known, PFOR compressed chunks
+ * are only decoded up to the 128 element block that contains the last element read.
+ *
+ * @param[in]  chunkOffsets       Chunk offsets returned by `om_decoder_next_data_read_with_offsets`.
+ * @param[in]  chunkOffsetsCount  Number of chunk offsets.
+ *
+ * Other parameters are identical to `om_decoder_decode_chunks`.
+ *
+ * @returns `false` if an error occurred.
+ */
+bool om_decoder_decode_chunks_with_offsets(const OmDecoder_t *decoder, OmRange_t chunkIndex, const void *data, uint64_t dataCount, const uint64_t* chunkOffsets, uint64_t chunkOffsetsCount, void *into, void *chunkBuffer, OmError_t* error);
+
+/// Read `count` bytes at `offset` of the file. Data may be written to `buffer`, which has room for `count` bytes, or returned
+/// from memory owned by the caller, e.g. a memory-mapped file. Returns NULL if the data could not be read.
+/// Called concurrently from multiple threads.
+typedef const void* (*OmDecoder_readCallback_t)(void* context, uint64_t offset, uint64_t count, void* buffer);
+
+/**
+ * @brief Reads and decodes all chunks of a decoder using multiple threads.
+ *
+ * Index reads and data reads are distributed over a work-stealing thread pool. Each worker owns a range of consecutive
+ * reads and steals from other workers once its range is empty. Every worker has its own read and chunk buffers and
+ * decodes into disjoint regions of `into`. The calling thread takes part in decoding. The pool is owned by the caller and can be
+ * reused for many calls to avoid starting threads for every read, but must not be used by two calls at the same time.
+ *
+ * @param[in]  decoder  Initialised decoder. Chunk and LUT caches of the decoder are used.
+ * @param[in]  read     Callback to read data of the file. Must be thread safe.
+ * @param[in]  context  Passed to `read`.
+ * @param[in]  pool     Pool created with `om_thread_pool_create`. With NULL all work is done on the calling thread.
+ * @param[out] into     Output cube with the dimensions of `cube_dimensions`.
+ * @param[out] error    `ERROR_IO_READ` if `read` failed, `ERROR_OUT_OF_MEMORY` if buffers could not be allocated or a decoding error on corrupted data.
+ *
+ * @returns `false` if an error occurred.
+ */
+bool om_decoder_decode_parallel(const OmDecoder_t* decoder, OmDecoder_readCallback_t read, void* context, OmThreadPool_t* pool, void* into, OmError_t* error);
+
+// MARK: Reductions
+
+/// Operators of reductions. Missing values (NaN) are ignored by all operators.
+typedef enum {
+    OM_REDUCE_SUM = 0, // Sum of all values. 0 if all values are missing.
+    OM_REDUCE_MEAN = 1, // Mean of all values. NaN if all values are missing.
+    OM_REDUCE_MIN = 2, // Minimum. NaN if all values are missing.
+    OM_REDUCE_MAX = 3, // Maximum. NaN if all values are missing.
+    OM_REDUCE_COUNT = 4, // Number of values that are not missing
+} OmReduceOperator_t;
+
+/// Accumulators of a reduction over some dimensions of a read. The output has the shape of `read_count` with reduced dimensions collapsed to 1.
+/// Values are accumulated in double precision. Accumulators of multiple decoders with the same output shape can be combined, e.g. to reduce over multiple files.
+typedef struct {
+    OmReduceOperator_t op;
+
+    /// Number of output elements
+    uint64_t count;
+
+    /// Stride of each read dimension in the output. 0 for reduced dimensions.
+    uint64_t output_stride[OM_READ_PLAN_MAX_DIMENSIONS];
+
+    /// Partial sum, minimum or maximum and the number of values that are not missing for each output element. Owned by the caller.
+    double* values;
+    uint64_t* counts;
+} OmReduction_t;
+
+/// Number of output elements of a reduction. `reduce_dimensions` marks the dimensions to reduce over and has one entry per dimension of the decoder.
+uint64_t om_decoder_reduction_count(const OmDecoder_t* decoder, const bool* reduce_dimensions);
+
+/// Initialise accumulators for a reduction of the read of `decoder`. `values` and `counts` must have room for `om_decoder_reduction_count` elements.
+/// Returns `ERROR_INVALID_DIMENSIONS` if the decoder has more than `OM_READ_PLAN_MAX_DIMENSIONS` dimensions.
+OmError_t om_decoder_reduction_init(const OmDecoder_t* decoder, OmReduction_t* reduction, OmReduceOperator_t op, const bool* reduce_dimensions, double* values, uint64_t* counts);
+
+/// Add the partial results of `other` to `reduction`. Both must have the same operator and output shape.
+void om_decoder_reduction_merge(OmReduction_t* reduction, const OmReduction_t* other);
+
+/// Compute the result of each output element into `into`, which has room for `reduction->count` values
+void om_decoder_reduction_finalise(const OmReduction_t* reduction, double* into);
+
+/// Size of the chunk buffer for `om_decoder_reduce_chunks_with_offsets`. Larger than `om_decoder_read_buffer_size` to convert one row of a chunk at a time.
+uint64_t om_decoder_reduce_buffer_size(const OmDecoder_t* decoder);
+
+/**
+ * @brief Decodes chunks like `om_decoder_decode_chunks_with_offsets`, but accumulates values into a reduction instead of writing them into a cube.
+ *
+ * Values are converted row by row from the chunk buffer and never materialised in an output cube. Chunks skipped by a predicate do not contribute.
+ *
+ * @param[in,out] reduction    Accumulators initialised with `om_decoder_reduction_init` for this decoder.
+ * @param[out]    chunkBuffer  Temporary buffer of size `om_decoder_reduce_buffer_size`.
+ *
+ * Other parameters are identical to `om_decoder_decode_chunks_with_offsets`.
+ *
+ * @returns `false` if an error occurred.
+ */
+bool om_decoder_reduce_chunks_with_offsets(const OmDecoder_t *decoder, OmReduction_t* reduction, OmRange_t chunkIndex, const void *data, uint64_t dataCount, const uint64_t* chunkOffsets, uint64_t chunkOffsetsCount, void *chunkBuffer, OmError_t* error);
+
+/**
+ * @brief Reads all chunks of a decoder using multiple threads and accumulates them into a reduction.
+ *
+ * Works like `om_decoder_decode_parallel`. Each worker accumulates into its own partial reduction, which are merged into `reduction` at the end.
+ * Memory is bounded by one set of accumulators per thread. With multiple threads, the order of additions depends on scheduling and sums may differ in the last bits.
+ *
+ * @param[in,out] reduction  Accumulators initialised with `om_decoder_reduction_init` for this decoder. Call `om_decoder_reduction_finalise` afterwards.
+ *
+ * Other parameters are identical to `om_decoder_decode_parallel`.
+ *
+ * @returns `false` if an error occurred. `reduction` is not modified in this case.
+ */
+bool om_decoder_reduce_parallel(const OmDecoder_t* decoder, OmDecoder_readCallback_t read, void* context, OmThreadPool_t* pool, OmReduction_t* reduction, OmError_t* error);
+
 #endif // OM_DECODER_H
@@ -25,6 +25,9 @@ typedef struct {
     /// The data type of the data
     uint8_t data_type;
 
+    /// The data type of arrays passed to the encoder. Equal to `data_type` unless set with `om_encoder_set_input_data_type`
+    uint8_t input_data_type;
+
     /// The compression type of the data
     uint8_t compression;
 
@@ -33,12 +36,41 @@ typedef struct {
 
     /// The size of the elements in bytes after compression, e.g. Int16 could be used to scale floats
     uint8_t bytes_per_element_compressed;
+
+    /// Prefix chunks with an `OmChunkHeader_t` and store chunks with a single value as constant
+    bool constant_chunks;
+
+    /// Number of kept mantissa bits for `COMPRESSION_FPX_XOR2D` or 0 if lossless
+    uint8_t mantissa_bits;
 } OmEncoder_t;
 
 /// Initialise the OmEncoder structure with information about the shape of data
 /// May return an error on invalid compression or data types
 OmError_t om_encoder_init(OmEncoder_t* encoder, float scale_factor, float add_offset, OmCompression_t compression, OmDataType_t data_type, const uint64_t* dimensions, const uint64_t* chunks, uint64_t dimension_count);
 
+/// Scale factor for `COMPRESSION_PFOR_LORENZO` that keeps the absolute error of every value within `max_error`.
+/// The result is a power of two, so the actual bound `0.5 / scale_factor` can be up to 2 times tighter. For a bound relative to the value range, pass `relative_error * (max - min)`.
+float om_encoder_error_bound_scale_factor(double max_error);
+
+/// Number of mantissa bits to keep `significant_digits` decimal digits of float, double, float16 or bfloat16 values. Pass the result to `om_encoder_set_mantissa_bits`.
+/// Returns 0 (lossless) if the data type has fewer mantissa bits.
+uint8_t om_encoder_mantissa_bits(OmDataType_t data_type, uint8_t significant_digits);
+
+/// Round values of `COMPRESSION_FPX_XOR2D` arrays to `mantissa_bits` mantissa bits (round to nearest, ties to even) before coding. 0 keeps values lossless.
+/// Returns `ERROR_INVALID_MANTISSA_BITS` for other compression types or if the data type does not have more mantissa bits.
+/// The array must be written with the same number of mantissa bits, see `OmVariableArrayOptions_t`.
+OmError_t om_encoder_set_mantissa_bits(OmEncoder_t* encoder, uint8_t mantissa_bits);
+
+/// Store chunks in which all values are identical after scaling as `OM_CHUNK_HEADER_CONSTANT` with a single value, e.g. all-NaN or zero chunks.
+/// All other chunks are prefixed with `OM_CHUNK_HEADER_COMPRESSED`. Must be called before buffer sizes are calculated.
+/// The array must be written with `constant_chunks` set in `OmVariableArrayOptions_t`.
+void om_encoder_set_constant_chunks(OmEncoder_t* encoder, bool constant_chunks);
+
+/// Pass arrays of `input_data_type` to the encoder. `DATA_TYPE_FLOAT16_ARRAY` and `DATA_TYPE_BFLOAT16_ARRAY` accept `DATA_TYPE_FLOAT_ARRAY`,
+/// which is rounded to nearest even while copying into the chunk buffer. Other data types only accept their own type.
+/// Must be called before buffer sizes are calculated.
+OmError_t om_encoder_set_input_data_type(OmEncoder_t* encoder, OmDataType_t input_data_type);
+
 /// Get the number of chunks that is calculated from dimensions and chunks
 uint64_t om_encoder_count_chunks(const OmEncoder_t* encoder);
 
@@ -57,7 +89,58 @@ uint64_t om_encoder_lut_buffer_size(const uint64_t* lookUpTable, uint64_t lookUp
 /// Compress the LUT and return the size of compressed LUT in bytes
 uint64_t om_encoder_compress_lut(const uint64_t* lookUpTable, uint64_t lookUpTableCount, uint8_t* out, uint64_t size_of_compressed_lut);
 
+/// Calculate the required buffer size for the entire LUT in a given encoding
+uint64_t om_encoder_lut_buffer_size_with_encoding(const uint64_t* lookUpTable, uint64_t lookUpTableCount, OmLutEncoding_t lut_encoding);
+
+/// Encode the LUT and return its size in bytes. `LUT_ENCODING_FIXED_WIDTH` allows readers to fetch single offsets. It is larger than `LUT_ENCODING_PFOR`.
+/// The variable must be written with `om_variable_write_numeric_array_with_lut_encoding` using the same encoding.
+uint64_t om_encoder_compress_lut_with_encoding(const uint64_t* lookUpTable, uint64_t lookUpTableCount, OmLutEncoding_t lut_encoding, uint8_t* out, uint64_t size_of_compressed_lut);
+
+/// Maximum number of bytes `om_encoder_compress_lut_block` writes
+uint64_t om_encoder_lut_block_buffer_size(void);
+
+/// Compress up to `LUT_CHUNK_COUNT` LUT entries into one block of a `LUT_ENCODING_PFOR_VARIABLE` LUT and return the number of bytes written.
+/// Blocks can be compressed as soon as 64 chunks are written and do not need the rest of the LUT. Streaming writers store block `k` directly after chunk `64k+63`,
+/// so that LUT entry `64k+64` is the end of the block. The last block is written after all chunks. Blocks are located with the block offset table that ends the LUT.
+uint64_t om_encoder_compress_lut_block(const uint64_t* lookUpTable, uint64_t lookUpTableCount, uint8_t* out, uint64_t size_of_compressed_block);
+
+/// Size of the block offset table of a `LUT_ENCODING_PFOR_VARIABLE` LUT with `block_count` blocks
+uint64_t om_encoder_lut_block_offsets_size(uint64_t block_count);
+
+/// Write the block offset table after the last LUT block. `block_ranges` contains the start and end of each block relative to the start of the first block,
+/// which is the LUT offset of the variable. The LUT size extends to the end of the table.
+uint64_t om_encoder_write_lut_block_offsets(const uint64_t* block_ranges, uint64_t block_count, uint8_t* out, uint64_t size_of_block_offsets);
+
 /// Compress a single chunk. Chunk buffer must be of size `OmEncoder_chunkBufferSize`
+/// Returns 0 if values of `COMPRESSION_PFOR_LORENZO` are infinite or out of the integer range after scaling. Compressed chunks are never empty.
 uint64_t om_encoder_compress_chunk(const OmEncoder_t* encoder, const void* array, const uint64_t* arrayDimensions, const uint64_t* arrayOffset, const uint64_t* arrayCount, uint64_t chunkIndex, uint64_t chunkIndexOffsetInThisArray, uint8_t* out, uint8_t* chunkBuffer);
 
+/// Compress a single chunk like `om_encoder_compress_chunk` and compute min, max, sum and NaN count of the chunk into `statistics`.
+/// Statistics are computed from the quantised values in `chunkBuffer` before filtering and match the decoded data.
+/// Returns 0 and sets `ERROR_VALUE_OUT_OF_RANGE` if values of `COMPRESSION_PFOR_LORENZO` are infinite or out of the integer range after scaling.
+uint64_t om_encoder_compress_chunk_with_statistics(const OmEncoder_t* encoder, const void* array, const uint64_t* arrayDimensions, const uint64_t* arrayOffset, const uint64_t* arrayCount, uint64_t chunkIndex, uint64_t chunkIndexOffsetInThisArray, uint8_t* out, uint8_t* chunkBuffer, OmChunkStatistics_t* statistics, OmError_t* error);
+
+/// Opaque state to compress chunks with multiple threads
+typedef struct OmEncoderParallel OmEncoderParallel_t;
+
+/// Create a thread pool and buffers to compress up to `window` chunks at once with `threads` threads including the calling thread.
+/// Memory is bounded by `window` compressed chunk buffers plus one chunk buffer per thread. A `window` of 0 uses 16 chunks per thread.
+/// The encoder is copied, but its dimensions and chunks must outlive the returned state. Returns NULL if memory could not be allocated.
+OmEncoderParallel_t* om_encoder_parallel_create(const OmEncoder_t* encoder, uint32_t threads, uint64_t window);
+
+/// Stop all threads and release buffers
+void om_encoder_parallel_destroy(OmEncoderParallel_t* parallel);
+
+/// Maximum number of chunks that can be compressed with a single call to `om_encoder_parallel_compress_chunks`
+uint64_t om_encoder_parallel_window(const OmEncoderParallel_t* parallel);
+
+/// Compress `chunk_count` consecutive chunks in parallel. Arguments are identical to `om_encoder_compress_chunk` for the first chunk.
+/// `chunk_count` must not exceed the window. Afterwards, compressed chunks are returned by `om_encoder_parallel_chunk` and have to be
+/// written in order to keep the LUT monotonic. If `statistics` is not NULL, the statistics of each chunk are stored in `statistics[0..<chunk_count]`.
+/// Returns false and sets `ERROR_OUT_OF_MEMORY` if the work queue could not be allocated or `ERROR_VALUE_OUT_OF_RANGE` if a chunk could not be compressed.
+bool om_encoder_parallel_compress_chunks(OmEncoderParallel_t* parallel, const void* array, const uint64_t* arrayDimensions, const uint64_t* arrayOffset, const uint64_t* arrayCount, uint64_t chunkIndex, uint64_t chunkIndexOffsetInThisArray, uint64_t chunk_count, OmChunkStatistics_t* statistics, OmError_t* error);
+
+/// Compressed data of the chunk at position `index` of the last call to `om_encoder_parallel_compress_chunks`. The size in bytes is stored in `size`.
+const uint8_t* om_encoder_parallel_chunk(const OmEncoderParallel_t* parallel, uint64_t index, uint64_t* size);
+
 #endif // OM_ENCODER_H
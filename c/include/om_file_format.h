@@ -3,7 +3,12 @@
 #include "vp4.h"
 #include "fp.h"
 #include "delta2d.h"
+#include "om_thread_pool.h"
 #include "om_decoder.h"
+#include "om_chunk_cache.h"
+#include "om_lut_cache.h"
+#include "om_io_reader.h"
 #include "om_encoder.h"
+#include "om_writer.h"
 #include "om_variable.h"
 #include "om_file.h"
@@ -0,0 +1,68 @@
+/**
+ * @file om_io_cost_model.h
+ * @brief OmIoCostModel: Latency and bandwidth model of a storage backend to merge IO requests by expected time
+ *
+ * Fixed `io_size_merge` and `io_size_max` thresholds only fit one kind of storage. Merging reads over a gap of
+ * unused bytes costs the transfer time of the gap, while a separate request costs one more request latency. With
+ * `concurrency` requests in flight, latencies overlap and an additional request only costs `latency_ns / concurrency`.
+ * Local NVMe and object storage differ by about 100x in the break-even gap. The model predicts the time of a
+ * request as `latency_ns + bytes / bytes_per_ns` and decoders merge reads if this is cheaper than an additional request.
+ *
+ * Parameters can be updated online from observed IO completion times with `om_io_cost_model_observe`.
+ * Typical starting values:
+ * - Local NVMe: latency 100 µs, 2 bytes/ns, concurrency 16
+ * - Network block storage: latency 1 ms, 0.25 bytes/ns, concurrency 16
+ * - Object storage (S3): latency 30 ms, 0.1 bytes/ns, concurrency 16
+ */
+
+#ifndef OM_IO_COST_MODEL_H
+#define OM_IO_COST_MODEL_H
+
+#include "om_common.h"
+
+/// Number of recent observations that dominate the online estimate. Older observations decay exponentially.
+#define OM_IO_COST_MODEL_WINDOW 64
+
+/// A read is split once its transfer time exceeds this multiple of the request latency. Larger reads do not amortise latency
+/// any further, while smaller requests can be fetched concurrently.
+#define OM_IO_COST_MODEL_MAX_TRANSFER_LATENCY_RATIO 8
+
+typedef struct {
+    /// Time until the first byte of a request arrives in nanoseconds
+    double latency_ns;
+
+    /// Transfer rate in bytes per nanosecond. 1.0 equals 1 GB/s.
+    double bytes_per_ns;
+
+    /// Number of requests the caller keeps in flight. 1 for strictly sequential IO.
+    double concurrency;
+
+    /// Exponentially decayed sums of observed request sizes and durations to fit latency and bandwidth
+    double sum_weight;
+    double sum_bytes;
+    double sum_time;
+    double sum_bytes_squared;
+    double sum_bytes_time;
+} OmIoCostModel_t;
+
+/// Initialise a model with prior latency and bandwidth. Values are clamped to small positive minima. `concurrency` is at least 1.
+void om_io_cost_model_init(OmIoCostModel_t* model, double latency_ns, double bytes_per_ns, double concurrency);
+
+/// Update latency and bandwidth with the observed duration of a request of `bytes` bytes.
+/// Latency and bandwidth are fitted by least squares over recent observations. If all recent requests have a similar size,
+/// only the latency is updated. Not thread safe. Callers must serialise updates and reads of the model.
+void om_io_cost_model_observe(OmIoCostModel_t* model, uint64_t bytes, double duration_ns);
+
+/// Expected duration in nanoseconds to read `bytes` with a single request
+double om_io_cost_model_read_time(const OmIoCostModel_t* model, uint64_t bytes);
+
+/// Marginal time in nanoseconds of one additional request if `concurrency` requests are in flight
+double om_io_cost_model_request_time(const OmIoCostModel_t* model);
+
+/// Largest gap in bytes that is cheaper to read than to issue a separate request
+uint64_t om_io_cost_model_merge_gap(const OmIoCostModel_t* model);
+
+/// Size at which reads are split. See `OM_IO_COST_MODEL_MAX_TRANSFER_LATENCY_RATIO`.
+uint64_t om_io_cost_model_max_size(const OmIoCostModel_t* model);
+
+#endif // OM_IO_COST_MODEL_H
@@ -0,0 +1,48 @@
+/**
+ * @file om_io_reader.h
+ * @brief OmIoReader: Optional file reader that executes the IO requests of many decoders in batches
+ *
+ * Decoders and encoders do not perform any IO. This reader is an optional layer on top for C users that read local files.
+ * It collects all index reads and all data reads of one or more decoders with `om_decoder_next_index_reads` and
+ * `om_decoder_next_data_reads` and submits each phase as a single batch.
+ *
+ * On Linux, requests are submitted to io_uring. Compressed data is read into a registered buffer and completed reads are
+ * decoded in parallel by the threads of the reader while the calling thread keeps the ring busy. Requests the kernel
+ * rejects with `EINVAL` or `EOPNOTSUPP` are read again with `pread`. If io_uring is not available, a pool of threads
+ * reads requests with `pread` and decodes them.
+ * The reader is not available on Windows.
+ */
+
+#ifndef OM_IO_READER_H
+#define OM_IO_READER_H
+
+#include "om_common.h"
+#include "om_decoder.h"
+
+typedef enum {
+    OM_IO_BACKEND_IO_URING = 0, // Linux io_uring. Falls back to `OM_IO_BACKEND_PREAD` if io_uring is not available.
+    OM_IO_BACKEND_PREAD = 1, // Pool of threads using blocking `pread`
+} OmIoBackend_t;
+
+/// Opaque reader handle
+typedef struct OmIoReader OmIoReader_t;
+
+/// Create a reader for the open file descriptor `fd`. The file descriptor is not closed by the reader.
+/// `buffer_size` is the size of the registered buffer for compressed data. Larger data reads use a separate allocation.
+/// `threads` is the number of threads that read or decode requests including the calling thread.
+/// Returns NULL if no backend is available or memory could not be allocated.
+OmIoReader_t* om_io_reader_create(int fd, OmIoBackend_t backend, uint64_t buffer_size, uint32_t threads);
+
+/// Stop all threads and release all resources of the reader
+void om_io_reader_destroy(OmIoReader_t* reader);
+
+/// Backend that is used by the reader
+OmIoBackend_t om_io_reader_backend(const OmIoReader_t* reader);
+
+/// Read and decode the data of `decoder_count` decoders. Data of `decoders[i]` is written to `into[i]`.
+/// All index reads of all decoders are submitted as one batch, followed by all data reads.
+/// Must not be called concurrently for the same reader.
+/// Returns false and sets `ERROR_IO_READ` if the file could not be read or `ERROR_OUT_OF_MEMORY` if buffers could not be allocated. May return an out-of-bounds read error on corrupted data.
+bool om_io_reader_decode(OmIoReader_t* reader, const OmDecoder_t* const* decoders, void* const* into, uint64_t decoder_count, OmError_t* error);
+
+#endif // OM_IO_READER_H
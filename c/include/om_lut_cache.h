@@ -0,0 +1,49 @@
+/**
+ * @file om_lut_cache.h
+ * @brief OmLutCache: Decoded look-up table of a single variable shared across reads and threads
+ *
+ * PFor compressed LUTs store 64 chunk offsets per block. Without a cache, each read fetches and decompresses
+ * the LUT blocks it needs again. The LUT cache keeps decoded blocks as plain `uint64_t` offsets in memory
+ * provided by the caller. Blocks are filled lazily while reading or eagerly with `om_lut_cache_load` if the
+ * entire LUT is in memory, e.g. for memory mapped files. Blocks are never evicted. Once all blocks of an index
+ * read are resident, no index data has to be read.
+ */
+
+#ifndef OM_LUT_CACHE_H
+#define OM_LUT_CACHE_H
+
+#include "om_common.h"
+#include "om_variable.h"
+
+/// Opaque cache handle. The cache is stored in the memory passed to `om_lut_cache_init`.
+typedef struct OmLutCache OmLutCache_t;
+
+/// Memory size required to cache the entire LUT of `variable`. Returns 0 if the LUT is not compressed in blocks.
+/// Version 1/2 files and `LUT_ENCODING_FIXED_WIDTH` LUTs can be read without decompression and are not cached.
+uint64_t om_lut_cache_memory_size(const OmVariable_t* variable);
+
+/// Initialise a LUT cache for `variable` inside `memory`. `memory` must be aligned to 8 bytes and remain valid while the cache is used.
+/// Returns NULL if the LUT of the variable is not compressed in blocks or `memory_size` is smaller than `om_lut_cache_memory_size`.
+OmLutCache_t* om_lut_cache_init(void* memory, uint64_t memory_size, const OmVariable_t* variable);
+
+/// File offset and size of the LUT. Used to read the entire LUT for `om_lut_cache_load`.
+void om_lut_cache_get_lut_range(const OmLutCache_t* cache, uint64_t* lut_offset, uint64_t* lut_size);
+
+/// Decode all LUT blocks. `lut_data` contains `lut_size` bytes starting at the LUT offset of the variable. For `LUT_ENCODING_PFOR_VARIABLE`, this range
+/// also contains chunk data between the blocks.
+/// May return an out-of-bounds read error on corrupted data.
+bool om_lut_cache_load(OmLutCache_t* cache, const void* lut_data, uint64_t lut_data_size, OmError_t* error);
+
+/// Number of LUT blocks that are decoded and resident in the cache
+uint64_t om_lut_cache_resident_block_count(OmLutCache_t* cache);
+
+/// Decoded entries of LUT block `block` or NULL if the block is not resident. Entries stay valid as long as the cache memory.
+const uint64_t* om_lut_cache_get_block(const OmLutCache_t* cache, uint64_t block);
+
+/// Store the decoded entries of LUT block `block`. If another thread is already storing the same block, the call returns without storing.
+void om_lut_cache_put_block(OmLutCache_t* cache, uint64_t block, const uint64_t* entries);
+
+/// Check if the cache was initialised for a variable with the LUT at `lut_offset` and `number_of_chunks` chunks.
+bool _om_lut_cache_matches(const OmLutCache_t* cache, uint64_t lut_offset, uint64_t number_of_chunks);
+
+#endif // OM_LUT_CACHE_H
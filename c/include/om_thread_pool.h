@@ -0,0 +1,63 @@
+/**
+ * @file om_thread_pool.h
+ * @brief OmThreadPool: Thread pool and work-stealing task distribution for parallel encoding, decoding and IO
+ *
+ * Pools are created by callers of `om_decoder_decode_parallel` and kept alive across reads. Running jobs and the work
+ * queue are internal. A pool runs the same job on all workers and returns once every worker has finished.
+ * The calling thread participates as worker 0. Tasks of a job are distributed with `OmWorkQueue_t`: each worker owns a
+ * contiguous range of task indices and takes tasks from its front. Idle workers steal the back half of another range,
+ * so neighbouring tasks stay on the same worker while imbalanced work is still spread evenly.
+ */
+
+#ifndef OM_THREAD_POOL_H
+#define OM_THREAD_POOL_H
+
+#include <stdatomic.h>
+#include "om_common.h"
+
+/// Opaque pool handle
+typedef struct OmThreadPool OmThreadPool_t;
+
+/// Job executed by all workers. `worker` is 0 for the calling thread and 1 to `threads-1` for pool threads.
+typedef void (*OmThreadPoolJob_t)(void* context, uint32_t worker);
+
+/// Create a pool with `threads` workers including the calling thread. With 1 thread, jobs run on the calling thread only.
+/// If fewer threads can be started, the pool uses the threads that are available. Returns NULL if memory could not be allocated.
+OmThreadPool_t* om_thread_pool_create(uint32_t threads);
+
+/// Stop and join all threads
+void om_thread_pool_destroy(OmThreadPool_t* pool);
+
+/// Number of workers including the calling thread
+uint32_t om_thread_pool_threads(const OmThreadPool_t* pool);
+
+/// Run `job` on all workers and wait until all have finished. Must not be called concurrently for the same pool.
+void om_thread_pool_run(OmThreadPool_t* pool, OmThreadPoolJob_t job, void* context);
+
+/// Range of task indices owned by one worker. Aligned to a cache line to avoid false sharing.
+typedef struct {
+    _Alignas(64) atomic_flag lock;
+    uint64_t begin;
+    uint64_t end;
+} OmWorkRange_t;
+_Static_assert(sizeof(OmWorkRange_t) == 64, "A work range must occupy exactly one cache line");
+
+/// Work-stealing distribution of tasks `0..<count` over a number of workers
+typedef struct {
+    /// First 64 byte aligned range inside `memory`
+    OmWorkRange_t* ranges;
+    /// Allocation of the ranges. `malloc` does not guarantee cache line alignment.
+    void* memory;
+    uint32_t workers;
+} OmWorkQueue_t;
+
+/// Split `count` tasks into equal ranges for `workers` workers. Returns false if memory could not be allocated.
+bool om_work_queue_init(OmWorkQueue_t* queue, uint64_t count, uint32_t workers);
+
+/// Release the memory of the queue
+void om_work_queue_destroy(OmWorkQueue_t* queue);
+
+/// Next task of `worker`. Steals from other workers if its own range is empty. Returns false once all tasks are taken.
+bool om_work_queue_next(OmWorkQueue_t* queue, uint32_t worker, uint64_t* task);
+
+#endif // OM_THREAD_POOL_H
@@ -35,9 +35,28 @@ typedef struct {
     //char[name_size] name;
 } OmVariableV3_t;
 
+/// Set in `OmVariableArrayV3_t.compression_type` if the LUT uses `LUT_ENCODING_FIXED_WIDTH`. Older readers reject such arrays as invalid compression.
+#define OM_COMPRESSION_FLAG_LUT_FIXED_WIDTH 0x80
+
+/// Set in `OmVariableArrayV3_t.compression_type` if the LUT uses `LUT_ENCODING_PFOR_VARIABLE`
+#define OM_COMPRESSION_FLAG_LUT_VARIABLE 0x40
+
+/// Set in `OmVariableArrayV3_t.compression_type` if an `OmChunkStatistics_t` array is stored. Offset and size follow the chunk dimensions.
+#define OM_COMPRESSION_FLAG_CHUNK_STATISTICS 0x20
+
+/// Set in `OmVariableArrayV3_t.compression_type` if every chunk starts with an `OmChunkHeader_t` byte. Chunks with a single value are stored as constant.
+#define OM_COMPRESSION_FLAG_CONSTANT_CHUNKS 0x10
+
+/// All flags in `OmVariableArrayV3_t.compression_type`
+#define OM_COMPRESSION_FLAGS (OM_COMPRESSION_FLAG_LUT_FIXED_WIDTH | OM_COMPRESSION_FLAG_LUT_VARIABLE | OM_COMPRESSION_FLAG_CHUNK_STATISTICS | OM_COMPRESSION_FLAG_CONSTANT_CHUNKS)
+
+/// Set in `OmVariableArrayV3_t.data_type` if the number of kept mantissa bits follows the chunk statistics. All bits of `compression_type` are in use.
+/// Older readers reject such arrays as invalid data type.
+#define OM_DATA_TYPE_FLAG_MANTISSA_BITS 0x80
+
 typedef struct {
     uint8_t data_type; // OmDataType_t
-    uint8_t compression_type; // OmCompression_t
+    uint8_t compression_type; // OmCompression_t. The 4 highest bits are `OM_COMPRESSION_FLAGS`
     uint16_t name_size; // maximum 65k characters in name strings
     uint32_t children_count;
     uint64_t lut_size;
@@ -55,6 +74,13 @@ typedef struct {
     //uint64_t[dimension_count] dimensions;
     //uint64_t[dimension_count] chunks;
 
+    // Only if `OM_COMPRESSION_FLAG_CHUNK_STATISTICS` is set
+    //uint64_t statistics_offset;
+    //uint64_t statistics_size;
+
+    // Only if `OM_DATA_TYPE_FLAG_MANTISSA_BITS` is set
+    //uint64_t mantissa_bits;
+
     // name is always last
     //char[name_size] name;
 } OmVariableArrayV3_t;
@@ -90,16 +116,28 @@ OmDataType_t om_variable_get_type(const OmVariable_t* variable);
 /// Get the compression type of the current variable
 OmCompression_t om_variable_get_compression(const OmVariable_t* variable);
 
+/// Get the encoding of the look-up table of an array variable
+OmLutEncoding_t om_variable_get_lut_encoding(const OmVariable_t* variable);
+
 float om_variable_get_scale_factor(const OmVariable_t* variable);
 
 float om_variable_get_add_offset(const OmVariable_t* variable);
 
+/// Number of mantissa bits kept by `COMPRESSION_FPX_XOR2D` arrays or 0 if values are stored lossless
+uint8_t om_variable_get_mantissa_bits(const OmVariable_t* variable);
+
 /// Get a pointer to the dimensions of a OM variable
 OmDimensions_t om_variable_get_dimensions(const OmVariable_t* variable);
 
 /// Get a pointer to the chunk dimensions of an OM Variable
 OmDimensions_t om_variable_get_chunks(const OmVariable_t* variable);
 
+/// True if every chunk of an array variable starts with an `OmChunkHeader_t` byte
+bool om_variable_has_constant_chunks(const OmVariable_t* variable);
+
+/// Get the file offset and size of the `OmChunkStatistics_t` array of an array variable. Returns false if no statistics are stored.
+bool om_variable_get_chunk_statistics(const OmVariable_t* variable, uint64_t* statistics_offset, uint64_t* statistics_size);
+
 /// Return how many children are available for a given variable
 uint32_t om_variable_get_children_count(const OmVariable_t* variable);
 
@@ -159,6 +197,31 @@ size_t om_variable_write_numeric_array_size(uint16_t name_size, uint32_t childre
 /// Write meta data for a numeric array to file
 void om_variable_write_numeric_array(void* dst, uint16_t name_size, uint32_t children_count, const uint64_t* children_offsets, const uint64_t* children_sizes, const char* name, OmDataType_t data_type, OmCompression_t compression_type, float scale_factor, float add_offset, uint64_t dimension_count, const uint64_t *dimensions, const uint64_t *chunks, uint64_t lut_size, uint64_t lut_offset);
 
+/// Write an array variable whose LUT was compressed with `om_encoder_compress_lut_with_encoding`
+void om_variable_write_numeric_array_with_lut_encoding(void* dst, uint16_t name_size, uint32_t children_count, const uint64_t* children_offsets, const uint64_t* children_sizes, const char* name, OmDataType_t data_type, OmCompression_t compression_type, OmLutEncoding_t lut_encoding, float scale_factor, float add_offset, uint64_t dimension_count, const uint64_t *dimensions, const uint64_t *chunks, uint64_t lut_size, uint64_t lut_offset);
+
+/// Optional attributes of an array variable. A zero-initialised struct writes the same variable as `om_variable_write_numeric_array`.
+typedef struct {
+    /// Encoding of the LUT, see `om_encoder_compress_lut_with_encoding`
+    OmLutEncoding_t lut_encoding;
+
+    /// File offset and size of an `OmChunkStatistics_t` array with one entry per chunk. Statistics are not stored if `statistics_size` is 0.
+    uint64_t statistics_offset;
+    uint64_t statistics_size;
+
+    /// Set if chunks were compressed with `om_encoder_set_constant_chunks`
+    bool constant_chunks;
+
+    /// Number of mantissa bits set with `om_encoder_set_mantissa_bits` or 0 if values are stored lossless
+    uint8_t mantissa_bits;
+} OmVariableArrayOptions_t;
+
+/// Get the size of meta attributes of a numeric array written with `om_variable_write_numeric_array_with_options`
+size_t om_variable_write_numeric_array_with_options_size(uint16_t name_size, uint32_t children_count, uint64_t dimension_count, const OmVariableArrayOptions_t* options);
+
+/// Write meta data for a numeric array with optional attributes. Older readers reject arrays with statistics, constant chunks or mantissa bits.
+void om_variable_write_numeric_array_with_options(void* dst, uint16_t name_size, uint32_t children_count, const uint64_t* children_offsets, const uint64_t* children_sizes, const char* name, OmDataType_t data_type, OmCompression_t compression_type, float scale_factor, float add_offset, uint64_t dimension_count, const uint64_t *dimensions, const uint64_t *chunks, uint64_t lut_size, uint64_t lut_offset, const OmVariableArrayOptions_t* options);
+
 
 
 /// =========== Internal functions ===============
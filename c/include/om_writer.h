@@ -0,0 +1,87 @@
+/**
+ * @file om_writer.h
+ * @brief OmWriter: Assemble OM files with buffering, LUT tracking, variable metadata and trailer
+ *
+ * The writer collects the header, compressed chunks, LUTs, variable metadata and the trailer in a reusable output
+ * buffer and passes filled buffers to a sink. Bindings only provide the sink and call the functions in file order:
+ * 1. Create an array with `om_writer_array_create`, add data with `om_writer_array_write` and write chunk statistics and the LUT with `om_writer_array_finalise`
+ * 2. Write variable metadata with `om_writer_write_array` or `om_writer_write_scalar`. Children must be written before their parent.
+ * 3. Write the trailer with the root variable using `om_writer_write_trailer`
+ *
+ * Only one array can be written at a time, because the data of an array must be contiguous in the file.
+ */
+
+#ifndef OM_WRITER_H
+#define OM_WRITER_H
+
+#include "om_common.h"
+#include "om_encoder.h"
+
+/// Destination of filled buffers
+typedef struct {
+    /// Write `size` bytes. `data` is only valid during the call. Return false on error.
+    bool (*write)(void* context, const void* data, uint64_t size);
+    /// Optional. Take ownership of a filled buffer instead of writing a copy, e.g. to submit it to an asynchronous write. `size` bytes
+    /// of `data` inside `buffer` are written. `buffer` was allocated with `malloc` and must be released with `free`. The writer allocates
+    /// a new buffer afterwards. If set, `write` is not called. Return false on error.
+    bool (*take)(void* context, void* buffer, const void* data, uint64_t size);
+    void* context;
+} OmWriterSink_t;
+
+/// Opaque writer handle
+typedef struct OmWriter OmWriter_t;
+
+/// Opaque handle of an array that is being written
+typedef struct OmWriterArray OmWriterArray_t;
+
+/// Create a writer and write the file header into its buffer. `buffer_capacity` is the size of the buffers passed to the sink.
+/// Larger buffers are allocated if a single chunk or LUT does not fit. Arrays compress chunks with `threads` threads if larger than 1.
+/// Returns NULL if memory could not be allocated.
+OmWriter_t* om_writer_create(OmWriterSink_t sink, uint64_t buffer_capacity, uint32_t threads);
+
+/// Compress chunks of arrays created afterwards with `threads` threads. `in_flight_chunks` limits how many compressed chunks are kept in memory
+/// before they are appended. 0 uses 16 chunks per thread.
+void om_writer_set_threads(OmWriter_t* writer, uint32_t threads, uint64_t in_flight_chunks);
+
+/// Release the writer without flushing buffered data
+void om_writer_destroy(OmWriter_t* writer);
+
+/// Number of bytes written to the file including buffered data
+uint64_t om_writer_total_bytes_written(const OmWriter_t* writer);
+
+/// Pass all buffered data to the sink
+bool om_writer_flush(OmWriter_t* writer, OmError_t* error);
+
+/// Start a new array. Dimensions and chunks are copied. With `chunk_statistics`, min, max, sum and NaN count of each chunk are stored before the LUT.
+/// With `constant_chunks`, chunks with a single value, e.g. all missing, are stored as one value and read without decompression.
+/// A non-zero `mantissa_bits` rounds values of `COMPRESSION_FPX_XOR2D` arrays, see `om_encoder_set_mantissa_bits`.
+/// Returns NULL and sets `error` on invalid arguments or if memory could not be allocated.
+OmWriterArray_t* om_writer_array_create(OmWriter_t* writer, OmDataType_t data_type, OmCompression_t compression, OmLutEncoding_t lut_encoding, float scale_factor, float add_offset, const uint64_t* dimensions, const uint64_t* chunks, uint64_t dimension_count, bool chunk_statistics, bool constant_chunks, uint8_t mantissa_bits, OmError_t* error);
+
+/// Compress data and append it to the file. Can be all, a single or multiple chunks. If multiple chunks are given at once, they must align with chunks.
+/// `array_dimensions` are the dimensions of `array`, `array_offset` and `array_count` select the part of `array` to write.
+/// Returns `ERROR_INVALID_STATE` after the array was finalised and `ERROR_INVALID_DIMENSIONS` if more chunks are written than the array contains.
+/// Returns `ERROR_VALUE_OUT_OF_RANGE` if values of `COMPRESSION_PFOR_LORENZO` do not fit into integers after scaling.
+/// With `LUT_ENCODING_PFOR_VARIABLE`, every 64 chunks a compressed LUT block is written after the chunk data, so that only 64 LUT entries are kept in memory.
+bool om_writer_array_write(OmWriterArray_t* array, const void* data, const uint64_t* array_dimensions, const uint64_t* array_offset, const uint64_t* array_count, OmError_t* error);
+
+/// Write chunk statistics and the LUT after all chunks have been written. Returns `ERROR_INVALID_STATE` if chunks are missing or the array was already finalised.
+bool om_writer_array_finalise(OmWriterArray_t* array, OmError_t* error);
+
+/// File offset and size of the LUT of a finalised array
+void om_writer_array_get_lut_range(const OmWriterArray_t* array, uint64_t* lut_offset, uint64_t* lut_size);
+
+/// Release an array
+void om_writer_array_destroy(OmWriterArray_t* array);
+
+/// Write the metadata of a finalised array. Returns offset and size of the variable, which are used as children or root.
+/// Returns `ERROR_INVALID_STATE` if the array was not finalised.
+bool om_writer_write_array(OmWriter_t* writer, const OmWriterArray_t* array, const char* name, uint16_t name_size, uint32_t children_count, const uint64_t* children_offsets, const uint64_t* children_sizes, uint64_t* offset, uint64_t* size, OmError_t* error);
+
+/// Write a scalar variable. Arguments are identical to `om_variable_write_scalar`. Returns offset and size of the variable.
+bool om_writer_write_scalar(OmWriter_t* writer, const char* name, uint16_t name_size, uint32_t children_count, const uint64_t* children_offsets, const uint64_t* children_sizes, OmDataType_t data_type, const void* value, size_t string_size, uint64_t* offset, uint64_t* size, OmError_t* error);
+
+/// Write the trailer with the root variable and flush all data to the sink
+bool om_writer_write_trailer(OmWriter_t* writer, uint64_t root_offset, uint64_t root_size, OmError_t* error);
+
+#endif // OM_WRITER_H
@@ -0,0 +1,2089 @@
+// Symbols of all TurboPFor sources used by OM files.
+// Instruction set specific builds (see om_codec_avx2.h) define `OM_TURBOPFOR_SYMBOL` to give every
+// function and table a unique prefix, so that multiple builds can be linked into the same library.
+//
+// Regenerate after updating TurboPFor:
+// nm bitpack_def.o bitpack_sse.o bitunpack_def.o bitunpack_sse.o bitutil.o fp.o vint.o vp4c_def.o vp4c_sse.o vp4d_def.o vp4d_sse.o \
+//   | awk '$2 ~ /^[TDRB]$/ {print "#define " $3 " OM_TURBOPFOR_SYMBOL(" $3 ")"}' | sort -u
+
+#ifndef TURBOPFOR_SYMBOLS_H
+#define TURBOPFOR_SYMBOLS_H
+
+#define _bitd1unpack128v16 OM_TURBOPFOR_SYMBOL(_bitd1unpack128v16)
+#define _bitd1unpack128v32 OM_TURBOPFOR_SYMBOL(_bitd1unpack128v32)
+#define _bitdunpack128v16 OM_TURBOPFOR_SYMBOL(_bitdunpack128v16)
+#define _bitdunpack128v32 OM_TURBOPFOR_SYMBOL(_bitdunpack128v32)
+#define _bits1unpack128v16 OM_TURBOPFOR_SYMBOL(_bits1unpack128v16)
+#define _bits1unpack128v32 OM_TURBOPFOR_SYMBOL(_bits1unpack128v32)
+#define _bitunpack128v16 OM_TURBOPFOR_SYMBOL(_bitunpack128v16)
+#define _bitunpack128v32 OM_TURBOPFOR_SYMBOL(_bitunpack128v32)
+#define _bitunpack128v64 OM_TURBOPFOR_SYMBOL(_bitunpack128v64)
+#define _bitunpack256w32 OM_TURBOPFOR_SYMBOL(_bitunpack256w32)
+#define _bitzunpack128v16 OM_TURBOPFOR_SYMBOL(_bitzunpack128v16)
+#define _bitzunpack128v32 OM_TURBOPFOR_SYMBOL(_bitzunpack128v32)
+#define _p4bits16 OM_TURBOPFOR_SYMBOL(_p4bits16)
+#define _p4bits32 OM_TURBOPFOR_SYMBOL(_p4bits32)
+#define _p4bits64 OM_TURBOPFOR_SYMBOL(_p4bits64)
+#define _p4bits8 OM_TURBOPFOR_SYMBOL(_p4bits8)
+#define _p4d1dec128v16 OM_TURBOPFOR_SYMBOL(_p4d1dec128v16)
+#define _p4d1dec128v32 OM_TURBOPFOR_SYMBOL(_p4d1dec128v32)
+#define _p4d1dec16 OM_TURBOPFOR_SYMBOL(_p4d1dec16)
+#define _p4d1dec32 OM_TURBOPFOR_SYMBOL(_p4d1dec32)
+#define _p4d1dec64 OM_TURBOPFOR_SYMBOL(_p4d1dec64)
+#define _p4d1dec8 OM_TURBOPFOR_SYMBOL(_p4d1dec8)
+#define _p4ddec128v16 OM_TURBOPFOR_SYMBOL(_p4ddec128v16)
+#define _p4ddec128v32 OM_TURBOPFOR_SYMBOL(_p4ddec128v32)
+#define _p4ddec16 OM_TURBOPFOR_SYMBOL(_p4ddec16)
+#define _p4ddec32 OM_TURBOPFOR_SYMBOL(_p4ddec32)
+#define _p4ddec64 OM_TURBOPFOR_SYMBOL(_p4ddec64)
+#define _p4ddec8 OM_TURBOPFOR_SYMBOL(_p4ddec8)
+#define _p4dec128v16 OM_TURBOPFOR_SYMBOL(_p4dec128v16)
+#define _p4dec128v32 OM_TURBOPFOR_SYMBOL(_p4dec128v32)
+#define _p4dec128v64 OM_TURBOPFOR_SYMBOL(_p4dec128v64)
+#define _p4dec16 OM_TURBOPFOR_SYMBOL(_p4dec16)
+#define _p4dec32 OM_TURBOPFOR_SYMBOL(_p4dec32)
+#define _p4dec64 OM_TURBOPFOR_SYMBOL(_p4dec64)
+#define _p4dec8 OM_TURBOPFOR_SYMBOL(_p4dec8)
+#define _p4enc128v16 OM_TURBOPFOR_SYMBOL(_p4enc128v16)
+#define _p4enc128v32 OM_TURBOPFOR_SYMBOL(_p4enc128v32)
+#define _p4enc128v64 OM_TURBOPFOR_SYMBOL(_p4enc128v64)
+#define _p4enc16 OM_TURBOPFOR_SYMBOL(_p4enc16)
+#define _p4enc32 OM_TURBOPFOR_SYMBOL(_p4enc32)
+#define _p4enc64 OM_TURBOPFOR_SYMBOL(_p4enc64)
+#define _p4enc8 OM_TURBOPFOR_SYMBOL(_p4enc8)
+#define _p4zdec128v16 OM_TURBOPFOR_SYMBOL(_p4zdec128v16)
+#define _p4zdec128v32 OM_TURBOPFOR_SYMBOL(_p4zdec128v32)
+#define _p4zdec16 OM_TURBOPFOR_SYMBOL(_p4zdec16)
+#define _p4zdec32 OM_TURBOPFOR_SYMBOL(_p4zdec32)
+#define _p4zdec64 OM_TURBOPFOR_SYMBOL(_p4zdec64)
+#define _p4zdec8 OM_TURBOPFOR_SYMBOL(_p4zdec8)
+#define _shuffle_16 OM_TURBOPFOR_SYMBOL(_shuffle_16)
+#define _shuffle_32 OM_TURBOPFOR_SYMBOL(_shuffle_32)
+#define bit16 OM_TURBOPFOR_SYMBOL(bit16)
+#define bit32 OM_TURBOPFOR_SYMBOL(bit32)
+#define bit64 OM_TURBOPFOR_SYMBOL(bit64)
+#define bit8 OM_TURBOPFOR_SYMBOL(bit8)
+#define bitd116 OM_TURBOPFOR_SYMBOL(bitd116)
+#define bitd132 OM_TURBOPFOR_SYMBOL(bitd132)
+#define bitd16 OM_TURBOPFOR_SYMBOL(bitd16)
+#define bitd164 OM_TURBOPFOR_SYMBOL(bitd164)
+#define bitd18 OM_TURBOPFOR_SYMBOL(bitd18)
+#define bitd1dec16 OM_TURBOPFOR_SYMBOL(bitd1dec16)
+#define bitd1dec32 OM_TURBOPFOR_SYMBOL(bitd1dec32)
+#define bitd1dec64 OM_TURBOPFOR_SYMBOL(bitd1dec64)
+#define bitd1dec8 OM_TURBOPFOR_SYMBOL(bitd1dec8)
+#define bitd1pack128v16 OM_TURBOPFOR_SYMBOL(bitd1pack128v16)
+#define bitd1pack128v32 OM_TURBOPFOR_SYMBOL(bitd1pack128v32)
+#define bitd1pack16 OM_TURBOPFOR_SYMBOL(bitd1pack16)
+#define bitd1pack16_0 OM_TURBOPFOR_SYMBOL(bitd1pack16_0)
+#define bitd1pack16_1 OM_TURBOPFOR_SYMBOL(bitd1pack16_1)
+#define bitd1pack16_10 OM_TURBOPFOR_SYMBOL(bitd1pack16_10)
+#define bitd1pack16_11 OM_TURBOPFOR_SYMBOL(bitd1pack16_11)
+#define bitd1pack16_12 OM_TURBOPFOR_SYMBOL(bitd1pack16_12)
+#define bitd1pack16_13 OM_TURBOPFOR_SYMBOL(bitd1pack16_13)
+#define bitd1pack16_14 OM_TURBOPFOR_SYMBOL(bitd1pack16_14)
+#define bitd1pack16_15 OM_TURBOPFOR_SYMBOL(bitd1pack16_15)
+#define bitd1pack16_16 OM_TURBOPFOR_SYMBOL(bitd1pack16_16)
+#define bitd1pack16_2 OM_TURBOPFOR_SYMBOL(bitd1pack16_2)
+#define bitd1pack16_3 OM_TURBOPFOR_SYMBOL(bitd1pack16_3)
+#define bitd1pack16_4 OM_TURBOPFOR_SYMBOL(bitd1pack16_4)
+#define bitd1pack16_5 OM_TURBOPFOR_SYMBOL(bitd1pack16_5)
+#define bitd1pack16_6 OM_TURBOPFOR_SYMBOL(bitd1pack16_6)
+#define bitd1pack16_7 OM_TURBOPFOR_SYMBOL(bitd1pack16_7)
+#define bitd1pack16_8 OM_TURBOPFOR_SYMBOL(bitd1pack16_8)
+#define bitd1pack16_9 OM_TURBOPFOR_SYMBOL(bitd1pack16_9)
+#define bitd1pack32 OM_TURBOPFOR_SYMBOL(bitd1pack32)
+#define bitd1pack32_0 OM_TURBOPFOR_SYMBOL(bitd1pack32_0)
+#define bitd1pack32_1 OM_TURBOPFOR_SYMBOL(bitd1pack32_1)
+#define bitd1pack32_10 OM_TURBOPFOR_SYMBOL(bitd1pack32_10)
+#define bitd1pack32_11 OM_TURBOPFOR_SYMBOL(bitd1pack32_11)
+#define bitd1pack32_12 OM_TURBOPFOR_SYMBOL(bitd1pack32_12)
+#define bitd1pack32_13 OM_TURBOPFOR_SYMBOL(bitd1pack32_13)
+#define bitd1pack32_14 OM_TURBOPFOR_SYMBOL(bitd1pack32_14)
+#define bitd1pack32_15 OM_TURBOPFOR_SYMBOL(bitd1pack32_15)
+#define bitd1pack32_16 OM_TURBOPFOR_SYMBOL(bitd1pack32_16)
+#define bitd1pack32_17 OM_TURBOPFOR_SYMBOL(bitd1pack32_17)
+#define bitd1pack32_18 OM_TURBOPFOR_SYMBOL(bitd1pack32_18)
+#define bitd1pack32_19 OM_TURBOPFOR_SYMBOL(bitd1pack32_19)
+#define bitd1pack32_2 OM_TURBOPFOR_SYMBOL(bitd1pack32_2)
+#define bitd1pack32_20 OM_TURBOPFOR_SYMBOL(bitd1pack32_20)
+#define bitd1pack32_21 OM_TURBOPFOR_SYMBOL(bitd1pack32_21)
+#define bitd1pack32_22 OM_TURBOPFOR_SYMBOL(bitd1pack32_22)
+#define bitd1pack32_23 OM_TURBOPFOR_SYMBOL(bitd1pack32_23)
+#define bitd1pack32_24 OM_TURBOPFOR_SYMBOL(bitd1pack32_24)
+#define bitd1pack32_25 OM_TURBOPFOR_SYMBOL(bitd1pack32_25)
+#define bitd1pack32_26 OM_TURBOPFOR_SYMBOL(bitd1pack32_26)
+#define bitd1pack32_27 OM_TURBOPFOR_SYMBOL(bitd1pack32_27)
+#define bitd1pack32_28 OM_TURBOPFOR_SYMBOL(bitd1pack32_28)
+#define bitd1pack32_29 OM_TURBOPFOR_SYMBOL(bitd1pack32_29)
+#define bitd1pack32_3 OM_TURBOPFOR_SYMBOL(bitd1pack32_3)
+#define bitd1pack32_30 OM_TURBOPFOR_SYMBOL(bitd1pack32_30)
+#define bitd1pack32_31 OM_TURBOPFOR_SYMBOL(bitd1pack32_31)
+#define bitd1pack32_32 OM_TURBOPFOR_SYMBOL(bitd1pack32_32)
+#define bitd1pack32_4 OM_TURBOPFOR_SYMBOL(bitd1pack32_4)
+#define bitd1pack32_5 OM_TURBOPFOR_SYMBOL(bitd1pack32_5)
+#define bitd1pack32_6 OM_TURBOPFOR_SYMBOL(bitd1pack32_6)
+#define bitd1pack32_7 OM_TURBOPFOR_SYMBOL(bitd1pack32_7)
+#define bitd1pack32_8 OM_TURBOPFOR_SYMBOL(bitd1pack32_8)
+#define bitd1pack32_9 OM_TURBOPFOR_SYMBOL(bitd1pack32_9)
+#define bitd1pack64 OM_TURBOPFOR_SYMBOL(bitd1pack64)
+#define bitd1pack64_0 OM_TURBOPFOR_SYMBOL(bitd1pack64_0)
+#define bitd1pack64_1 OM_TURBOPFOR_SYMBOL(bitd1pack64_1)
+#define bitd1pack64_10 OM_TURBOPFOR_SYMBOL(bitd1pack64_10)
+#define bitd1pack64_11 OM_TURBOPFOR_SYMBOL(bitd1pack64_11)
+#define bitd1pack64_12 OM_TURBOPFOR_SYMBOL(bitd1pack64_12)
+#define bitd1pack64_13 OM_TURBOPFOR_SYMBOL(bitd1pack64_13)
+#define bitd1pack64_14 OM_TURBOPFOR_SYMBOL(bitd1pack64_14)
+#define bitd1pack64_15 OM_TURBOPFOR_SYMBOL(bitd1pack64_15)
+#define bitd1pack64_16 OM_TURBOPFOR_SYMBOL(bitd1pack64_16)
+#define bitd1pack64_17 OM_TURBOPFOR_SYMBOL(bitd1pack64_17)
+#define bitd1pack64_18 OM_TURBOPFOR_SYMBOL(bitd1pack64_18)
+#define bitd1pack64_19 OM_TURBOPFOR_SYMBOL(bitd1pack64_19)
+#define bitd1pack64_2 OM_TURBOPFOR_SYMBOL(bitd1pack64_2)
+#define bitd1pack64_20 OM_TURBOPFOR_SYMBOL(bitd1pack64_20)
+#define bitd1pack64_21 OM_TURBOPFOR_SYMBOL(bitd1pack64_21)
+#define bitd1pack64_22 OM_TURBOPFOR_SYMBOL(bitd1pack64_22)
+#define bitd1pack64_23 OM_TURBOPFOR_SYMBOL(bitd1pack64_23)
+#define bitd1pack64_24 OM_TURBOPFOR_SYMBOL(bitd1pack64_24)
+#define bitd1pack64_25 OM_TURBOPFOR_SYMBOL(bitd1pack64_25)
+#define bitd1pack64_26 OM_TURBOPFOR_SYMBOL(bitd1pack64_26)
+#define bitd1pack64_27 OM_TURBOPFOR_SYMBOL(bitd1pack64_27)
+#define bitd1pack64_28 OM_TURBOPFOR_SYMBOL(bitd1pack64_28)
+#define bitd1pack64_29 OM_TURBOPFOR_SYMBOL(bitd1pack64_29)
+#define bitd1pack64_3 OM_TURBOPFOR_SYMBOL(bitd1pack64_3)
+#define bitd1pack64_30 OM_TURBOPFOR_SYMBOL(bitd1pack64_30)
+#define bitd1pack64_31 OM_TURBOPFOR_SYMBOL(bitd1pack64_31)
+#define bitd1pack64_32 OM_TURBOPFOR_SYMBOL(bitd1pack64_32)
+#define bitd1pack64_33 OM_TURBOPFOR_SYMBOL(bitd1pack64_33)
+#define bitd1pack64_34 OM_TURBOPFOR_SYMBOL(bitd1pack64_34)
+#define bitd1pack64_35 OM_TURBOPFOR_SYMBOL(bitd1pack64_35)
+#define bitd1pack64_36 OM_TURBOPFOR_SYMBOL(bitd1pack64_36)
+#define bitd1pack64_37 OM_TURBOPFOR_SYMBOL(bitd1pack64_37)
+#define bitd1pack64_38 OM_TURBOPFOR_SYMBOL(bitd1pack64_38)
+#define bitd1pack64_39 OM_TURBOPFOR_SYMBOL(bitd1pack64_39)
+#define bitd1pack64_4 OM_TURBOPFOR_SYMBOL(bitd1pack64_4)
+#define bitd1pack64_40 OM_TURBOPFOR_SYMBOL(bitd1pack64_40)
+#define bitd1pack64_41 OM_TURBOPFOR_SYMBOL(bitd1pack64_41)
+#define bitd1pack64_42 OM_TURBOPFOR_SYMBOL(bitd1pack64_42)
+#define bitd1pack64_43 OM_TURBOPFOR_SYMBOL(bitd1pack64_43)
+#define bitd1pack64_44 OM_TURBOPFOR_SYMBOL(bitd1pack64_44)
+#define bitd1pack64_45 OM_TURBOPFOR_SYMBOL(bitd1pack64_45)
+#define bitd1pack64_46 OM_TURBOPFOR_SYMBOL(bitd1pack64_46)
+#define bitd1pack64_47 OM_TURBOPFOR_SYMBOL(bitd1pack64_47)
+#define bitd1pack64_48 OM_TURBOPFOR_SYMBOL(bitd1pack64_48)
+#define bitd1pack64_49 OM_TURBOPFOR_SYMBOL(bitd1pack64_49)
+#define bitd1pack64_5 OM_TURBOPFOR_SYMBOL(bitd1pack64_5)
+#define bitd1pack64_50 OM_TURBOPFOR_SYMBOL(bitd1pack64_50)
+#define bitd1pack64_51 OM_TURBOPFOR_SYMBOL(bitd1pack64_51)
+#define bitd1pack64_52 OM_TURBOPFOR_SYMBOL(bitd1pack64_52)
+#define bitd1pack64_53 OM_TURBOPFOR_SYMBOL(bitd1pack64_53)
+#define bitd1pack64_54 OM_TURBOPFOR_SYMBOL(bitd1pack64_54)
+#define bitd1pack64_55 OM_TURBOPFOR_SYMBOL(bitd1pack64_55)
+#define bitd1pack64_56 OM_TURBOPFOR_SYMBOL(bitd1pack64_56)
+#define bitd1pack64_57 OM_TURBOPFOR_SYMBOL(bitd1pack64_57)
+#define bitd1pack64_58 OM_TURBOPFOR_SYMBOL(bitd1pack64_58)
+#define bitd1pack64_59 OM_TURBOPFOR_SYMBOL(bitd1pack64_59)
+#define bitd1pack64_6 OM_TURBOPFOR_SYMBOL(bitd1pack64_6)
+#define bitd1pack64_60 OM_TURBOPFOR_SYMBOL(bitd1pack64_60)
+#define bitd1pack64_61 OM_TURBOPFOR_SYMBOL(bitd1pack64_61)
+#define bitd1pack64_62 OM_TURBOPFOR_SYMBOL(bitd1pack64_62)
+#define bitd1pack64_63 OM_TURBOPFOR_SYMBOL(bitd1pack64_63)
+#define bitd1pack64_64 OM_TURBOPFOR_SYMBOL(bitd1pack64_64)
+#define bitd1pack64_7 OM_TURBOPFOR_SYMBOL(bitd1pack64_7)
+#define bitd1pack64_8 OM_TURBOPFOR_SYMBOL(bitd1pack64_8)
+#define bitd1pack64_9 OM_TURBOPFOR_SYMBOL(bitd1pack64_9)
+#define bitd1pack8 OM_TURBOPFOR_SYMBOL(bitd1pack8)
+#define bitd1pack8_0 OM_TURBOPFOR_SYMBOL(bitd1pack8_0)
+#define bitd1pack8_1 OM_TURBOPFOR_SYMBOL(bitd1pack8_1)
+#define bitd1pack8_2 OM_TURBOPFOR_SYMBOL(bitd1pack8_2)
+#define bitd1pack8_3 OM_TURBOPFOR_SYMBOL(bitd1pack8_3)
+#define bitd1pack8_4 OM_TURBOPFOR_SYMBOL(bitd1pack8_4)
+#define bitd1pack8_5 OM_TURBOPFOR_SYMBOL(bitd1pack8_5)
+#define bitd1pack8_6 OM_TURBOPFOR_SYMBOL(bitd1pack8_6)
+#define bitd1pack8_7 OM_TURBOPFOR_SYMBOL(bitd1pack8_7)
+#define bitd1pack8_8 OM_TURBOPFOR_SYMBOL(bitd1pack8_8)
+#define bitd1packa16 OM_TURBOPFOR_SYMBOL(bitd1packa16)
+#define bitd1packa32 OM_TURBOPFOR_SYMBOL(bitd1packa32)
+#define bitd1packa64 OM_TURBOPFOR_SYMBOL(bitd1packa64)
+#define bitd1packa8 OM_TURBOPFOR_SYMBOL(bitd1packa8)
+#define bitd1unpack128v16 OM_TURBOPFOR_SYMBOL(bitd1unpack128v16)
+#define bitd1unpack128v32 OM_TURBOPFOR_SYMBOL(bitd1unpack128v32)
+#define bitd1unpack16 OM_TURBOPFOR_SYMBOL(bitd1unpack16)
+#define bitd1unpack16_0 OM_TURBOPFOR_SYMBOL(bitd1unpack16_0)
+#define bitd1unpack16_1 OM_TURBOPFOR_SYMBOL(bitd1unpack16_1)
+#define bitd1unpack16_10 OM_TURBOPFOR_SYMBOL(bitd1unpack16_10)
+#define bitd1unpack16_11 OM_TURBOPFOR_SYMBOL(bitd1unpack16_11)
+#define bitd1unpack16_12 OM_TURBOPFOR_SYMBOL(bitd1unpack16_12)
+#define bitd1unpack16_13 OM_TURBOPFOR_SYMBOL(bitd1unpack16_13)
+#define bitd1unpack16_14 OM_TURBOPFOR_SYMBOL(bitd1unpack16_14)
+#define bitd1unpack16_15 OM_TURBOPFOR_SYMBOL(bitd1unpack16_15)
+#define bitd1unpack16_16 OM_TURBOPFOR_SYMBOL(bitd1unpack16_16)
+#define bitd1unpack16_2 OM_TURBOPFOR_SYMBOL(bitd1unpack16_2)
+#define bitd1unpack16_3 OM_TURBOPFOR_SYMBOL(bitd1unpack16_3)
+#define bitd1unpack16_4 OM_TURBOPFOR_SYMBOL(bitd1unpack16_4)
+#define bitd1unpack16_5 OM_TURBOPFOR_SYMBOL(bitd1unpack16_5)
+#define bitd1unpack16_6 OM_TURBOPFOR_SYMBOL(bitd1unpack16_6)
+#define bitd1unpack16_7 OM_TURBOPFOR_SYMBOL(bitd1unpack16_7)
+#define bitd1unpack16_8 OM_TURBOPFOR_SYMBOL(bitd1unpack16_8)
+#define bitd1unpack16_9 OM_TURBOPFOR_SYMBOL(bitd1unpack16_9)
+#define bitd1unpack32 OM_TURBOPFOR_SYMBOL(bitd1unpack32)
+#define bitd1unpack32_0 OM_TURBOPFOR_SYMBOL(bitd1unpack32_0)
+#define bitd1unpack32_1 OM_TURBOPFOR_SYMBOL(bitd1unpack32_1)
+#define bitd1unpack32_10 OM_TURBOPFOR_SYMBOL(bitd1unpack32_10)
+#define bitd1unpack32_11 OM_TURBOPFOR_SYMBOL(bitd1unpack32_11)
+#define bitd1unpack32_12 OM_TURBOPFOR_SYMBOL(bitd1unpack32_12)
+#define bitd1unpack32_13 OM_TURBOPFOR_SYMBOL(bitd1unpack32_13)
+#define bitd1unpack32_14 OM_TURBOPFOR_SYMBOL(bitd1unpack32_14)
+#define bitd1unpack32_15 OM_TURBOPFOR_SYMBOL(bitd1unpack32_15)
+#define bitd1unpack32_16 OM_TURBOPFOR_SYMBOL(bitd1unpack32_16)
+#define bitd1unpack32_17 OM_TURBOPFOR_SYMBOL(bitd1unpack32_17)
+#define bitd1unpack32_18 OM_TURBOPFOR_SYMBOL(bitd1unpack32_18)
+#define bitd1unpack32_19 OM_TURBOPFOR_SYMBOL(bitd1unpack32_19)
+#define bitd1unpack32_2 OM_TURBOPFOR_SYMBOL(bitd1unpack32_2)
+#define bitd1unpack32_20 OM_TURBOPFOR_SYMBOL(bitd1unpack32_20)
+#define bitd1unpack32_21 OM_TURBOPFOR_SYMBOL(bitd1unpack32_21)
+#define bitd1unpack32_22 OM_TURBOPFOR_SYMBOL(bitd1unpack32_22)
+#define bitd1unpack32_23 OM_TURBOPFOR_SYMBOL(bitd1unpack32_23)
+#define bitd1unpack32_24 OM_TURBOPFOR_SYMBOL(bitd1unpack32_24)
+#define bitd1unpack32_25 OM_TURBOPFOR_SYMBOL(bitd1unpack32_25)
+#define bitd1unpack32_26 OM_TURBOPFOR_SYMBOL(bitd1unpack32_26)
+#define bitd1unpack32_27 OM_TURBOPFOR_SYMBOL(bitd1unpack32_27)
+#define bitd1unpack32_28 OM_TURBOPFOR_SYMBOL(bitd1unpack32_28)
+#define bitd1unpack32_29 OM_TURBOPFOR_SYMBOL(bitd1unpack32_29)
+#define bitd1unpack32_3 OM_TURBOPFOR_SYMBOL(bitd1unpack32_3)
+#define bitd1unpack32_30 OM_TURBOPFOR_SYMBOL(bitd1unpack32_30)
+#define bitd1unpack32_31 OM_TURBOPFOR_SYMBOL(bitd1unpack32_31)
+#define bitd1unpack32_32 OM_TURBOPFOR_SYMBOL(bitd1unpack32_32)
+#define bitd1unpack32_4 OM_TURBOPFOR_SYMBOL(bitd1unpack32_4)
+#define bitd1unpack32_5 OM_TURBOPFOR_SYMBOL(bitd1unpack32_5)
+#define bitd1unpack32_6 OM_TURBOPFOR_SYMBOL(bitd1unpack32_6)
+#define bitd1unpack32_7 OM_TURBOPFOR_SYMBOL(bitd1unpack32_7)
+#define bitd1unpack32_8 OM_TURBOPFOR_SYMBOL(bitd1unpack32_8)
+#define bitd1unpack32_9 OM_TURBOPFOR_SYMBOL(bitd1unpack32_9)
+#define bitd1unpack64 OM_TURBOPFOR_SYMBOL(bitd1unpack64)
+#define bitd1unpack64_0 OM_TURBOPFOR_SYMBOL(bitd1unpack64_0)
+#define bitd1unpack64_1 OM_TURBOPFOR_SYMBOL(bitd1unpack64_1)
+#define bitd1unpack64_10 OM_TURBOPFOR_SYMBOL(bitd1unpack64_10)
+#define bitd1unpack64_11 OM_TURBOPFOR_SYMBOL(bitd1unpack64_11)
+#define bitd1unpack64_12 OM_TURBOPFOR_SYMBOL(bitd1unpack64_12)
+#define bitd1unpack64_13 OM_TURBOPFOR_SYMBOL(bitd1unpack64_13)
+#define bitd1unpack64_14 OM_TURBOPFOR_SYMBOL(bitd1unpack64_14)
+#define bitd1unpack64_15 OM_TURBOPFOR_SYMBOL(bitd1unpack64_15)
+#define bitd1unpack64_16 OM_TURBOPFOR_SYMBOL(bitd1unpack64_16)
+#define bitd1unpack64_17 OM_TURBOPFOR_SYMBOL(bitd1unpack64_17)
+#define bitd1unpack64_18 OM_TURBOPFOR_SYMBOL(bitd1unpack64_18)
+#define bitd1unpack64_19 OM_TURBOPFOR_SYMBOL(bitd1unpack64_19)
+#define bitd1unpack64_2 OM_TURBOPFOR_SYMBOL(bitd1unpack64_2)
+#define bitd1unpack64_20 OM_TURBOPFOR_SYMBOL(bitd1unpack64_20)
+#define bitd1unpack64_21 OM_TURBOPFOR_SYMBOL(bitd1unpack64_21)
+#define bitd1unpack64_22 OM_TURBOPFOR_SYMBOL(bitd1unpack64_22)
+#define bitd1unpack64_23 OM_TURBOPFOR_SYMBOL(bitd1unpack64_23)
+#define bitd1unpack64_24 OM_TURBOPFOR_SYMBOL(bitd1unpack64_24)
+#define bitd1unpack64_25 OM_TURBOPFOR_SYMBOL(bitd1unpack64_25)
+#define bitd1unpack64_26 OM_TURBOPFOR_SYMBOL(bitd1unpack64_26)
+#define bitd1unpack64_27 OM_TURBOPFOR_SYMBOL(bitd1unpack64_27)
+#define bitd1unpack64_28 OM_TURBOPFOR_SYMBOL(bitd1unpack64_28)
+#define bitd1unpack64_29 OM_TURBOPFOR_SYMBOL(bitd1unpack64_29)
+#define bitd1unpack64_3 OM_TURBOPFOR_SYMBOL(bitd1unpack64_3)
+#define bitd1unpack64_30 OM_TURBOPFOR_SYMBOL(bitd1unpack64_30)
+#define bitd1unpack64_31 OM_TURBOPFOR_SYMBOL(bitd1unpack64_31)
+#define bitd1unpack64_32 OM_TURBOPFOR_SYMBOL(bitd1unpack64_32)
+#define bitd1unpack64_33 OM_TURBOPFOR_SYMBOL(bitd1unpack64_33)
+#define bitd1unpack64_34 OM_TURBOPFOR_SYMBOL(bitd1unpack64_34)
+#define bitd1unpack64_35 OM_TURBOPFOR_SYMBOL(bitd1unpack64_35)
+#define bitd1unpack64_36 OM_TURBOPFOR_SYMBOL(bitd1unpack64_36)
+#define bitd1unpack64_37 OM_TURBOPFOR_SYMBOL(bitd1unpack64_37)
+#define bitd1unpack64_38 OM_TURBOPFOR_SYMBOL(bitd1unpack64_38)
+#define bitd1unpack64_39 OM_TURBOPFOR_SYMBOL(bitd1unpack64_39)
+#define bitd1unpack64_4 OM_TURBOPFOR_SYMBOL(bitd1unpack64_4)
+#define bitd1unpack64_40 OM_TURBOPFOR_SYMBOL(bitd1unpack64_40)
+#define bitd1unpack64_41 OM_TURBOPFOR_SYMBOL(bitd1unpack64_41)
+#define bitd1unpack64_42 OM_TURBOPFOR_SYMBOL(bitd1unpack64_42)
+#define bitd1unpack64_43 OM_TURBOPFOR_SYMBOL(bitd1unpack64_43)
+#define bitd1unpack64_44 OM_TURBOPFOR_SYMBOL(bitd1unpack64_44)
+#define bitd1unpack64_45 OM_TURBOPFOR_SYMBOL(bitd1unpack64_45)
+#define bitd1unpack64_46 OM_TURBOPFOR_SYMBOL(bitd1unpack64_46)
+#define bitd1unpack64_47 OM_TURBOPFOR_SYMBOL(bitd1unpack64_47)
+#define bitd1unpack64_48 OM_TURBOPFOR_SYMBOL(bitd1unpack64_48)
+#define bitd1unpack64_49 OM_TURBOPFOR_SYMBOL(bitd1unpack64_49)
+#define bitd1unpack64_5 OM_TURBOPFOR_SYMBOL(bitd1unpack64_5)
+#define bitd1unpack64_50 OM_TURBOPFOR_SYMBOL(bitd1unpack64_50)
+#define bitd1unpack64_51 OM_TURBOPFOR_SYMBOL(bitd1unpack64_51)
+#define bitd1unpack64_52 OM_TURBOPFOR_SYMBOL(bitd1unpack64_52)
+#define bitd1unpack64_53 OM_TURBOPFOR_SYMBOL(bitd1unpack64_53)
+#define bitd1unpack64_54 OM_TURBOPFOR_SYMBOL(bitd1unpack64_54)
+#define bitd1unpack64_55 OM_TURBOPFOR_SYMBOL(bitd1unpack64_55)
+#define bitd1unpack64_56 OM_TURBOPFOR_SYMBOL(bitd1unpack64_56)
+#define bitd1unpack64_57 OM_TURBOPFOR_SYMBOL(bitd1unpack64_57)
+#define bitd1unpack64_58 OM_TURBOPFOR_SYMBOL(bitd1unpack64_58)
+#define bitd1unpack64_59 OM_TURBOPFOR_SYMBOL(bitd1unpack64_59)
+#define bitd1unpack64_6 OM_TURBOPFOR_SYMBOL(bitd1unpack64_6)
+#define bitd1unpack64_60 OM_TURBOPFOR_SYMBOL(bitd1unpack64_60)
+#define bitd1unpack64_61 OM_TURBOPFOR_SYMBOL(bitd1unpack64_61)
+#define bitd1unpack64_62 OM_TURBOPFOR_SYMBOL(bitd1unpack64_62)
+#define bitd1unpack64_63 OM_TURBOPFOR_SYMBOL(bitd1unpack64_63)
+#define bitd1unpack64_64 OM_TURBOPFOR_SYMBOL(bitd1unpack64_64)
+#define bitd1unpack64_7 OM_TURBOPFOR_SYMBOL(bitd1unpack64_7)
+#define bitd1unpack64_8 OM_TURBOPFOR_SYMBOL(bitd1unpack64_8)
+#define bitd1unpack64_9 OM_TURBOPFOR_SYMBOL(bitd1unpack64_9)
+#define bitd1unpack8 OM_TURBOPFOR_SYMBOL(bitd1unpack8)
+#define bitd1unpack8_0 OM_TURBOPFOR_SYMBOL(bitd1unpack8_0)
+#define bitd1unpack8_1 OM_TURBOPFOR_SYMBOL(bitd1unpack8_1)
+#define bitd1unpack8_2 OM_TURBOPFOR_SYMBOL(bitd1unpack8_2)
+#define bitd1unpack8_3 OM_TURBOPFOR_SYMBOL(bitd1unpack8_3)
+#define bitd1unpack8_4 OM_TURBOPFOR_SYMBOL(bitd1unpack8_4)
+#define bitd1unpack8_5 OM_TURBOPFOR_SYMBOL(bitd1unpack8_5)
+#define bitd1unpack8_6 OM_TURBOPFOR_SYMBOL(bitd1unpack8_6)
+#define bitd1unpack8_7 OM_TURBOPFOR_SYMBOL(bitd1unpack8_7)
+#define bitd1unpack8_8 OM_TURBOPFOR_SYMBOL(bitd1unpack8_8)
+#define bitd1unpacka16 OM_TURBOPFOR_SYMBOL(bitd1unpacka16)
+#define bitd1unpacka32 OM_TURBOPFOR_SYMBOL(bitd1unpacka32)
+#define bitd1unpacka64 OM_TURBOPFOR_SYMBOL(bitd1unpacka64)
+#define bitd1unpacka8 OM_TURBOPFOR_SYMBOL(bitd1unpacka8)
+#define bitd32 OM_TURBOPFOR_SYMBOL(bitd32)
+#define bitd64 OM_TURBOPFOR_SYMBOL(bitd64)
+#define bitd8 OM_TURBOPFOR_SYMBOL(bitd8)
+#define bitddec16 OM_TURBOPFOR_SYMBOL(bitddec16)
+#define bitddec32 OM_TURBOPFOR_SYMBOL(bitddec32)
+#define bitddec64 OM_TURBOPFOR_SYMBOL(bitddec64)
+#define bitddec8 OM_TURBOPFOR_SYMBOL(bitddec8)
+#define bitdi16 OM_TURBOPFOR_SYMBOL(bitdi16)
+#define bitdi32 OM_TURBOPFOR_SYMBOL(bitdi32)
+#define bitdi64 OM_TURBOPFOR_SYMBOL(bitdi64)
+#define bitdi8 OM_TURBOPFOR_SYMBOL(bitdi8)
+#define bitdidec16 OM_TURBOPFOR_SYMBOL(bitdidec16)
+#define bitdidec32 OM_TURBOPFOR_SYMBOL(bitdidec32)
+#define bitdidec64 OM_TURBOPFOR_SYMBOL(bitdidec64)
+#define bitdidec8 OM_TURBOPFOR_SYMBOL(bitdidec8)
+#define bitdienc16 OM_TURBOPFOR_SYMBOL(bitdienc16)
+#define bitdienc32 OM_TURBOPFOR_SYMBOL(bitdienc32)
+#define bitdienc64 OM_TURBOPFOR_SYMBOL(bitdienc64)
+#define bitdienc8 OM_TURBOPFOR_SYMBOL(bitdienc8)
+#define bitdpack128v16 OM_TURBOPFOR_SYMBOL(bitdpack128v16)
+#define bitdpack128v32 OM_TURBOPFOR_SYMBOL(bitdpack128v32)
+#define bitdpack16 OM_TURBOPFOR_SYMBOL(bitdpack16)
+#define bitdpack16_0 OM_TURBOPFOR_SYMBOL(bitdpack16_0)
+#define bitdpack16_1 OM_TURBOPFOR_SYMBOL(bitdpack16_1)
+#define bitdpack16_10 OM_TURBOPFOR_SYMBOL(bitdpack16_10)
+#define bitdpack16_11 OM_TURBOPFOR_SYMBOL(bitdpack16_11)
+#define bitdpack16_12 OM_TURBOPFOR_SYMBOL(bitdpack16_12)
+#define bitdpack16_13 OM_TURBOPFOR_SYMBOL(bitdpack16_13)
+#define bitdpack16_14 OM_TURBOPFOR_SYMBOL(bitdpack16_14)
+#define bitdpack16_15 OM_TURBOPFOR_SYMBOL(bitdpack16_15)
+#define bitdpack16_16 OM_TURBOPFOR_SYMBOL(bitdpack16_16)
+#define bitdpack16_2 OM_TURBOPFOR_SYMBOL(bitdpack16_2)
+#define bitdpack16_3 OM_TURBOPFOR_SYMBOL(bitdpack16_3)
+#define bitdpack16_4 OM_TURBOPFOR_SYMBOL(bitdpack16_4)
+#define bitdpack16_5 OM_TURBOPFOR_SYMBOL(bitdpack16_5)
+#define bitdpack16_6 OM_TURBOPFOR_SYMBOL(bitdpack16_6)
+#define bitdpack16_7 OM_TURBOPFOR_SYMBOL(bitdpack16_7)
+#define bitdpack16_8 OM_TURBOPFOR_SYMBOL(bitdpack16_8)
+#define bitdpack16_9 OM_TURBOPFOR_SYMBOL(bitdpack16_9)
+#define bitdpack32 OM_TURBOPFOR_SYMBOL(bitdpack32)
+#define bitdpack32_0 OM_TURBOPFOR_SYMBOL(bitdpack32_0)
+#define bitdpack32_1 OM_TURBOPFOR_SYMBOL(bitdpack32_1)
+#define bitdpack32_10 OM_TURBOPFOR_SYMBOL(bitdpack32_10)
+#define bitdpack32_11 OM_TURBOPFOR_SYMBOL(bitdpack32_11)
+#define bitdpack32_12 OM_TURBOPFOR_SYMBOL(bitdpack32_12)
+#define bitdpack32_13 OM_TURBOPFOR_SYMBOL(bitdpack32_13)
+#define bitdpack32_14 OM_TURBOPFOR_SYMBOL(bitdpack32_14)
+#define bitdpack32_15 OM_TURBOPFOR_SYMBOL(bitdpack32_15)
+#define bitdpack32_16 OM_TURBOPFOR_SYMBOL(bitdpack32_16)
+#define bitdpack32_17 OM_TURBOPFOR_SYMBOL(bitdpack32_17)
+#define bitdpack32_18 OM_TURBOPFOR_SYMBOL(bitdpack32_18)
+#define bitdpack32_19 OM_TURBOPFOR_SYMBOL(bitdpack32_19)
+#define bitdpack32_2 OM_TURBOPFOR_SYMBOL(bitdpack32_2)
+#define bitdpack32_20 OM_TURBOPFOR_SYMBOL(bitdpack32_20)
+#define bitdpack32_21 OM_TURBOPFOR_SYMBOL(bitdpack32_21)
+#define bitdpack32_22 OM_TURBOPFOR_SYMBOL(bitdpack32_22)
+#define bitdpack32_23 OM_TURBOPFOR_SYMBOL(bitdpack32_23)
+#define bitdpack32_24 OM_TURBOPFOR_SYMBOL(bitdpack32_24)
+#define bitdpack32_25 OM_TURBOPFOR_SYMBOL(bitdpack32_25)
+#define bitdpack32_26 OM_TURBOPFOR_SYMBOL(bitdpack32_26)
+#define bitdpack32_27 OM_TURBOPFOR_SYMBOL(bitdpack32_27)
+#define bitdpack32_28 OM_TURBOPFOR_SYMBOL(bitdpack32_28)
+#define bitdpack32_29 OM_TURBOPFOR_SYMBOL(bitdpack32_29)
+#define bitdpack32_3 OM_TURBOPFOR_SYMBOL(bitdpack32_3)
+#define bitdpack32_30 OM_TURBOPFOR_SYMBOL(bitdpack32_30)
+#define bitdpack32_31 OM_TURBOPFOR_SYMBOL(bitdpack32_31)
+#define bitdpack32_32 OM_TURBOPFOR_SYMBOL(bitdpack32_32)
+#define bitdpack32_4 OM_TURBOPFOR_SYMBOL(bitdpack32_4)
+#define bitdpack32_5 OM_TURBOPFOR_SYMBOL(bitdpack32_5)
+#define bitdpack32_6 OM_TURBOPFOR_SYMBOL(bitdpack32_6)
+#define bitdpack32_7 OM_TURBOPFOR_SYMBOL(bitdpack32_7)
+#define bitdpack32_8 OM_TURBOPFOR_SYMBOL(bitdpack32_8)
+#define bitdpack32_9 OM_TURBOPFOR_SYMBOL(bitdpack32_9)
+#define bitdpack64 OM_TURBOPFOR_SYMBOL(bitdpack64)
+#define bitdpack64_0 OM_TURBOPFOR_SYMBOL(bitdpack64_0)
+#define bitdpack64_1 OM_TURBOPFOR_SYMBOL(bitdpack64_1)
+#define bitdpack64_10 OM_TURBOPFOR_SYMBOL(bitdpack64_10)
+#define bitdpack64_11 OM_TURBOPFOR_SYMBOL(bitdpack64_11)
+#define bitdpack64_12 OM_TURBOPFOR_SYMBOL(bitdpack64_12)
+#define bitdpack64_13 OM_TURBOPFOR_SYMBOL(bitdpack64_13)
+#define bitdpack64_14 OM_TURBOPFOR_SYMBOL(bitdpack64_14)
+#define bitdpack64_15 OM_TURBOPFOR_SYMBOL(bitdpack64_15)
+#define bitdpack64_16 OM_TURBOPFOR_SYMBOL(bitdpack64_16)
+#define bitdpack64_17 OM_TURBOPFOR_SYMBOL(bitdpack64_17)
+#define bitdpack64_18 OM_TURBOPFOR_SYMBOL(bitdpack64_18)
+#define bitdpack64_19 OM_TURBOPFOR_SYMBOL(bitdpack64_19)
+#define bitdpack64_2 OM_TURBOPFOR_SYMBOL(bitdpack64_2)
+#define bitdpack64_20 OM_TURBOPFOR_SYMBOL(bitdpack64_20)
+#define bitdpack64_21 OM_TURBOPFOR_SYMBOL(bitdpack64_21)
+#define bitdpack64_22 OM_TURBOPFOR_SYMBOL(bitdpack64_22)
+#define bitdpack64_23 OM_TURBOPFOR_SYMBOL(bitdpack64_23)
+#define bitdpack64_24 OM_TURBOPFOR_SYMBOL(bitdpack64_24)
+#define bitdpack64_25 OM_TURBOPFOR_SYMBOL(bitdpack64_25)
+#define bitdpack64_26 OM_TURBOPFOR_SYMBOL(bitdpack64_26)
+#define bitdpack64_27 OM_TURBOPFOR_SYMBOL(bitdpack64_27)
+#define bitdpack64_28 OM_TURBOPFOR_SYMBOL(bitdpack64_28)
+#define bitdpack64_29 OM_TURBOPFOR_SYMBOL(bitdpack64_29)
+#define bitdpack64_3 OM_TURBOPFOR_SYMBOL(bitdpack64_3)
+#define bitdpack64_30 OM_TURBOPFOR_SYMBOL(bitdpack64_30)
+#define bitdpack64_31 OM_TURBOPFOR_SYMBOL(bitdpack64_31)
+#define bitdpack64_32 OM_TURBOPFOR_SYMBOL(bitdpack64_32)
+#define bitdpack64_33 OM_TURBOPFOR_SYMBOL(bitdpack64_33)
+#define bitdpack64_34 OM_TURBOPFOR_SYMBOL(bitdpack64_34)
+#define bitdpack64_35 OM_TURBOPFOR_SYMBOL(bitdpack64_35)
+#define bitdpack64_36 OM_TURBOPFOR_SYMBOL(bitdpack64_36)
+#define bitdpack64_37 OM_TURBOPFOR_SYMBOL(bitdpack64_37)
+#define bitdpack64_38 OM_TURBOPFOR_SYMBOL(bitdpack64_38)
+#define bitdpack64_39 OM_TURBOPFOR_SYMBOL(bitdpack64_39)
+#define bitdpack64_4 OM_TURBOPFOR_SYMBOL(bitdpack64_4)
+#define bitdpack64_40 OM_TURBOPFOR_SYMBOL(bitdpack64_40)
+#define bitdpack64_41 OM_TURBOPFOR_SYMBOL(bitdpack64_41)
+#define bitdpack64_42 OM_TURBOPFOR_SYMBOL(bitdpack64_42)
+#define bitdpack64_43 OM_TURBOPFOR_SYMBOL(bitdpack64_43)
+#define bitdpack64_44 OM_TURBOPFOR_SYMBOL(bitdpack64_44)
+#define bitdpack64_45 OM_TURBOPFOR_SYMBOL(bitdpack64_45)
+#define bitdpack64_46 OM_TURBOPFOR_SYMBOL(bitdpack64_46)
+#define bitdpack64_47 OM_TURBOPFOR_SYMBOL(bitdpack64_47)
+#define bitdpack64_48 OM_TURBOPFOR_SYMBOL(bitdpack64_48)
+#define bitdpack64_49 OM_TURBOPFOR_SYMBOL(bitdpack64_49)
+#define bitdpack64_5 OM_TURBOPFOR_SYMBOL(bitdpack64_5)
+#define bitdpack64_50 OM_TURBOPFOR_SYMBOL(bitdpack64_50)
+#define bitdpack64_51 OM_TURBOPFOR_SYMBOL(bitdpack64_51)
+#define bitdpack64_52 OM_TURBOPFOR_SYMBOL(bitdpack64_52)
+#define bitdpack64_53 OM_TURBOPFOR_SYMBOL(bitdpack64_53)
+#define bitdpack64_54 OM_TURBOPFOR_SYMBOL(bitdpack64_54)
+#define bitdpack64_55 OM_TURBOPFOR_SYMBOL(bitdpack64_55)
+#define bitdpack64_56 OM_TURBOPFOR_SYMBOL(bitdpack64_56)
+#define bitdpack64_57 OM_TURBOPFOR_SYMBOL(bitdpack64_57)
+#define bitdpack64_58 OM_TURBOPFOR_SYMBOL(bitdpack64_58)
+#define bitdpack64_59 OM_TURBOPFOR_SYMBOL(bitdpack64_59)
+#define bitdpack64_6 OM_TURBOPFOR_SYMBOL(bitdpack64_6)
+#define bitdpack64_60 OM_TURBOPFOR_SYMBOL(bitdpack64_60)
+#define bitdpack64_61 OM_TURBOPFOR_SYMBOL(bitdpack64_61)
+#define bitdpack64_62 OM_TURBOPFOR_SYMBOL(bitdpack64_62)
+#define bitdpack64_63 OM_TURBOPFOR_SYMBOL(bitdpack64_63)
+#define bitdpack64_64 OM_TURBOPFOR_SYMBOL(bitdpack64_64)
+#define bitdpack64_7 OM_TURBOPFOR_SYMBOL(bitdpack64_7)
+#define bitdpack64_8 OM_TURBOPFOR_SYMBOL(bitdpack64_8)
+#define bitdpack64_9 OM_TURBOPFOR_SYMBOL(bitdpack64_9)
+#define bitdpack8 OM_TURBOPFOR_SYMBOL(bitdpack8)
+#define bitdpack8_0 OM_TURBOPFOR_SYMBOL(bitdpack8_0)
+#define bitdpack8_1 OM_TURBOPFOR_SYMBOL(bitdpack8_1)
+#define bitdpack8_2 OM_TURBOPFOR_SYMBOL(bitdpack8_2)
+#define bitdpack8_3 OM_TURBOPFOR_SYMBOL(bitdpack8_3)
+#define bitdpack8_4 OM_TURBOPFOR_SYMBOL(bitdpack8_4)
+#define bitdpack8_5 OM_TURBOPFOR_SYMBOL(bitdpack8_5)
+#define bitdpack8_6 OM_TURBOPFOR_SYMBOL(bitdpack8_6)
+#define bitdpack8_7 OM_TURBOPFOR_SYMBOL(bitdpack8_7)
+#define bitdpack8_8 OM_TURBOPFOR_SYMBOL(bitdpack8_8)
+#define bitdpacka16 OM_TURBOPFOR_SYMBOL(bitdpacka16)
+#define bitdpacka32 OM_TURBOPFOR_SYMBOL(bitdpacka32)
+#define bitdpacka64 OM_TURBOPFOR_SYMBOL(bitdpacka64)
+#define bitdpacka8 OM_TURBOPFOR_SYMBOL(bitdpacka8)
+#define bitdunpack128v16 OM_TURBOPFOR_SYMBOL(bitdunpack128v16)
+#define bitdunpack128v32 OM_TURBOPFOR_SYMBOL(bitdunpack128v32)
+#define bitdunpack16 OM_TURBOPFOR_SYMBOL(bitdunpack16)
+#define bitdunpack16_0 OM_TURBOPFOR_SYMBOL(bitdunpack16_0)
+#define bitdunpack16_1 OM_TURBOPFOR_SYMBOL(bitdunpack16_1)
+#define bitdunpack16_10 OM_TURBOPFOR_SYMBOL(bitdunpack16_10)
+#define bitdunpack16_11 OM_TURBOPFOR_SYMBOL(bitdunpack16_11)
+#define bitdunpack16_12 OM_TURBOPFOR_SYMBOL(bitdunpack16_12)
+#define bitdunpack16_13 OM_TURBOPFOR_SYMBOL(bitdunpack16_13)
+#define bitdunpack16_14 OM_TURBOPFOR_SYMBOL(bitdunpack16_14)
+#define bitdunpack16_15 OM_TURBOPFOR_SYMBOL(bitdunpack16_15)
+#define bitdunpack16_16 OM_TURBOPFOR_SYMBOL(bitdunpack16_16)
+#define bitdunpack16_2 OM_TURBOPFOR_SYMBOL(bitdunpack16_2)
+#define bitdunpack16_3 OM_TURBOPFOR_SYMBOL(bitdunpack16_3)
+#define bitdunpack16_4 OM_TURBOPFOR_SYMBOL(bitdunpack16_4)
+#define bitdunpack16_5 OM_TURBOPFOR_SYMBOL(bitdunpack16_5)
+#define bitdunpack16_6 OM_TURBOPFOR_SYMBOL(bitdunpack16_6)
+#define bitdunpack16_7 OM_TURBOPFOR_SYMBOL(bitdunpack16_7)
+#define bitdunpack16_8 OM_TURBOPFOR_SYMBOL(bitdunpack16_8)
+#define bitdunpack16_9 OM_TURBOPFOR_SYMBOL(bitdunpack16_9)
+#define bitdunpack32 OM_TURBOPFOR_SYMBOL(bitdunpack32)
+#define bitdunpack32_0 OM_TURBOPFOR_SYMBOL(bitdunpack32_0)
+#define bitdunpack32_1 OM_TURBOPFOR_SYMBOL(bitdunpack32_1)
+#define bitdunpack32_10 OM_TURBOPFOR_SYMBOL(bitdunpack32_10)
+#define bitdunpack32_11 OM_TURBOPFOR_SYMBOL(bitdunpack32_11)
+#define bitdunpack32_12 OM_TURBOPFOR_SYMBOL(bitdunpack32_12)
+#define bitdunpack32_13 OM_TURBOPFOR_SYMBOL(bitdunpack32_13)
+#define bitdunpack32_14 OM_TURBOPFOR_SYMBOL(bitdunpack32_14)
+#define bitdunpack32_15 OM_TURBOPFOR_SYMBOL(bitdunpack32_15)
+#define bitdunpack32_16 OM_TURBOPFOR_SYMBOL(bitdunpack32_16)
+#define bitdunpack32_17 OM_TURBOPFOR_SYMBOL(bitdunpack32_17)
+#define bitdunpack32_18 OM_TURBOPFOR_SYMBOL(bitdunpack32_18)
+#define bitdunpack32_19 OM_TURBOPFOR_SYMBOL(bitdunpack32_19)
+#define bitdunpack32_2 OM_TURBOPFOR_SYMBOL(bitdunpack32_2)
+#define bitdunpack32_20 OM_TURBOPFOR_SYMBOL(bitdunpack32_20)
+#define bitdunpack32_21 OM_TURBOPFOR_SYMBOL(bitdunpack32_21)
+#define bitdunpack32_22 OM_TURBOPFOR_SYMBOL(bitdunpack32_22)
+#define bitdunpack32_23 OM_TURBOPFOR_SYMBOL(bitdunpack32_23)
+#define bitdunpack32_24 OM_TURBOPFOR_SYMBOL(bitdunpack32_24)
+#define bitdunpack32_25 OM_TURBOPFOR_SYMBOL(bitdunpack32_25)
+#define bitdunpack32_26 OM_TURBOPFOR_SYMBOL(bitdunpack32_26)
+#define bitdunpack32_27 OM_TURBOPFOR_SYMBOL(bitdunpack32_27)
+#define bitdunpack32_28 OM_TURBOPFOR_SYMBOL(bitdunpack32_28)
+#define bitdunpack32_29 OM_TURBOPFOR_SYMBOL(bitdunpack32_29)
+#define bitdunpack32_3 OM_TURBOPFOR_SYMBOL(bitdunpack32_3)
+#define bitdunpack32_30 OM_TURBOPFOR_SYMBOL(bitdunpack32_30)
+#define bitdunpack32_31 OM_TURBOPFOR_SYMBOL(bitdunpack32_31)
+#define bitdunpack32_32 OM_TURBOPFOR_SYMBOL(bitdunpack32_32)
+#define bitdunpack32_4 OM_TURBOPFOR_SYMBOL(bitdunpack32_4)
+#define bitdunpack32_5 OM_TURBOPFOR_SYMBOL(bitdunpack32_5)
+#define bitdunpack32_6 OM_TURBOPFOR_SYMBOL(bitdunpack32_6)
+#define bitdunpack32_7 OM_TURBOPFOR_SYMBOL(bitdunpack32_7)
+#define bitdunpack32_8 OM_TURBOPFOR_SYMBOL(bitdunpack32_8)
+#define bitdunpack32_9 OM_TURBOPFOR_SYMBOL(bitdunpack32_9)
+#define bitdunpack64 OM_TURBOPFOR_SYMBOL(bitdunpack64)
+#define bitdunpack64_0 OM_TURBOPFOR_SYMBOL(bitdunpack64_0)
+#define bitdunpack64_1 OM_TURBOPFOR_SYMBOL(bitdunpack64_1)
+#define bitdunpack64_10 OM_TURBOPFOR_SYMBOL(bitdunpack64_10)
+#define bitdunpack64_11 OM_TURBOPFOR_SYMBOL(bitdunpack64_11)
+#define bitdunpack64_12 OM_TURBOPFOR_SYMBOL(bitdunpack64_12)
+#define bitdunpack64_13 OM_TURBOPFOR_SYMBOL(bitdunpack64_13)
+#define bitdunpack64_14 OM_TURBOPFOR_SYMBOL(bitdunpack64_14)
+#define bitdunpack64_15 OM_TURBOPFOR_SYMBOL(bitdunpack64_15)
+#define bitdunpack64_16 OM_TURBOPFOR_SYMBOL(bitdunpack64_16)
+#define bitdunpack64_17 OM_TURBOPFOR_SYMBOL(bitdunpack64_17)
+#define bitdunpack64_18 OM_TURBOPFOR_SYMBOL(bitdunpack64_18)
+#define bitdunpack64_19 OM_TURBOPFOR_SYMBOL(bitdunpack64_19)
+#define bitdunpack64_2 OM_TURBOPFOR_SYMBOL(bitdunpack64_2)
+#define bitdunpack64_20 OM_TURBOPFOR_SYMBOL(bitdunpack64_20)
+#define bitdunpack64_21 OM_TURBOPFOR_SYMBOL(bitdunpack64_21)
+#define bitdunpack64_22 OM_TURBOPFOR_SYMBOL(bitdunpack64_22)
+#define bitdunpack64_23 OM_TURBOPFOR_SYMBOL(bitdunpack64_23)
+#define bitdunpack64_24 OM_TURBOPFOR_SYMBOL(bitdunpack64_24)
+#define bitdunpack64_25 OM_TURBOPFOR_SYMBOL(bitdunpack64_25)
+#define bitdunpack64_26 OM_TURBOPFOR_SYMBOL(bitdunpack64_26)
+#define bitdunpack64_27 OM_TURBOPFOR_SYMBOL(bitdunpack64_27)
+#define bitdunpack64_28 OM_TURBOPFOR_SYMBOL(bitdunpack64_28)
+#define bitdunpack64_29 OM_TURBOPFOR_SYMBOL(bitdunpack64_29)
+#define bitdunpack64_3 OM_TURBOPFOR_SYMBOL(bitdunpack64_3)
+#define bitdunpack64_30 OM_TURBOPFOR_SYMBOL(bitdunpack64_30)
+#define bitdunpack64_31 OM_TURBOPFOR_SYMBOL(bitdunpack64_31)
+#define bitdunpack64_32 OM_TURBOPFOR_SYMBOL(bitdunpack64_32)
+#define bitdunpack64_33 OM_TURBOPFOR_SYMBOL(bitdunpack64_33)
+#define bitdunpack64_34 OM_TURBOPFOR_SYMBOL(bitdunpack64_34)
+#define bitdunpack64_35 OM_TURBOPFOR_SYMBOL(bitdunpack64_35)
+#define bitdunpack64_36 OM_TURBOPFOR_SYMBOL(bitdunpack64_36)
+#define bitdunpack64_37 OM_TURBOPFOR_SYMBOL(bitdunpack64_37)
+#define bitdunpack64_38 OM_TURBOPFOR_SYMBOL(bitdunpack64_38)
+#define bitdunpack64_39 OM_TURBOPFOR_SYMBOL(bitdunpack64_39)
+#define bitdunpack64_4 OM_TURBOPFOR_SYMBOL(bitdunpack64_4)
+#define bitdunpack64_40 OM_TURBOPFOR_SYMBOL(bitdunpack64_40)
+#define bitdunpack64_41 OM_TURBOPFOR_SYMBOL(bitdunpack64_41)
+#define bitdunpack64_42 OM_TURBOPFOR_SYMBOL(bitdunpack64_42)
+#define bitdunpack64_43 OM_TURBOPFOR_SYMBOL(bitdunpack64_43)
+#define bitdunpack64_44 OM_TURBOPFOR_SYMBOL(bitdunpack64_44)
+#define bitdunpack64_45 OM_TURBOPFOR_SYMBOL(bitdunpack64_45)
+#define bitdunpack64_46 OM_TURBOPFOR_SYMBOL(bitdunpack64_46)
+#define bitdunpack64_47 OM_TURBOPFOR_SYMBOL(bitdunpack64_47)
+#define bitdunpack64_48 OM_TURBOPFOR_SYMBOL(bitdunpack64_48)
+#define bitdunpack64_49 OM_TURBOPFOR_SYMBOL(bitdunpack64_49)
+#define bitdunpack64_5 OM_TURBOPFOR_SYMBOL(bitdunpack64_5)
+#define bitdunpack64_50 OM_TURBOPFOR_SYMBOL(bitdunpack64_50)
+#define bitdunpack64_51 OM_TURBOPFOR_SYMBOL(bitdunpack64_51)
+#define bitdunpack64_52 OM_TURBOPFOR_SYMBOL(bitdunpack64_52)
+#define bitdunpack64_53 OM_TURBOPFOR_SYMBOL(bitdunpack64_53)
+#define bitdunpack64_54 OM_TURBOPFOR_SYMBOL(bitdunpack64_54)
+#define bitdunpack64_55 OM_TURBOPFOR_SYMBOL(bitdunpack64_55)
+#define bitdunpack64_56 OM_TURBOPFOR_SYMBOL(bitdunpack64_56)
+#define bitdunpack64_57 OM_TURBOPFOR_SYMBOL(bitdunpack64_57)
+#define bitdunpack64_58 OM_TURBOPFOR_SYMBOL(bitdunpack64_58)
+#define bitdunpack64_59 OM_TURBOPFOR_SYMBOL(bitdunpack64_59)
+#define bitdunpack64_6 OM_TURBOPFOR_SYMBOL(bitdunpack64_6)
+#define bitdunpack64_60 OM_TURBOPFOR_SYMBOL(bitdunpack64_60)
+#define bitdunpack64_61 OM_TURBOPFOR_SYMBOL(bitdunpack64_61)
+#define bitdunpack64_62 OM_TURBOPFOR_SYMBOL(bitdunpack64_62)
+#define bitdunpack64_63 OM_TURBOPFOR_SYMBOL(bitdunpack64_63)
+#define bitdunpack64_64 OM_TURBOPFOR_SYMBOL(bitdunpack64_64)
+#define bitdunpack64_7 OM_TURBOPFOR_SYMBOL(bitdunpack64_7)
+#define bitdunpack64_8 OM_TURBOPFOR_SYMBOL(bitdunpack64_8)
+#define bitdunpack64_9 OM_TURBOPFOR_SYMBOL(bitdunpack64_9)
+#define bitdunpack8 OM_TURBOPFOR_SYMBOL(bitdunpack8)
+#define bitdunpack8_0 OM_TURBOPFOR_SYMBOL(bitdunpack8_0)
+#define bitdunpack8_1 OM_TURBOPFOR_SYMBOL(bitdunpack8_1)
+#define bitdunpack8_2 OM_TURBOPFOR_SYMBOL(bitdunpack8_2)
+#define bitdunpack8_3 OM_TURBOPFOR_SYMBOL(bitdunpack8_3)
+#define bitdunpack8_4 OM_TURBOPFOR_SYMBOL(bitdunpack8_4)
+#define bitdunpack8_5 OM_TURBOPFOR_SYMBOL(bitdunpack8_5)
+#define bitdunpack8_6 OM_TURBOPFOR_SYMBOL(bitdunpack8_6)
+#define bitdunpack8_7 OM_TURBOPFOR_SYMBOL(bitdunpack8_7)
+#define bitdunpack8_8 OM_TURBOPFOR_SYMBOL(bitdunpack8_8)
+#define bitdunpacka16 OM_TURBOPFOR_SYMBOL(bitdunpacka16)
+#define bitdunpacka32 OM_TURBOPFOR_SYMBOL(bitdunpacka32)
+#define bitdunpacka64 OM_TURBOPFOR_SYMBOL(bitdunpacka64)
+#define bitdunpacka8 OM_TURBOPFOR_SYMBOL(bitdunpacka8)
+#define bitf116 OM_TURBOPFOR_SYMBOL(bitf116)
+#define bitf132 OM_TURBOPFOR_SYMBOL(bitf132)
+#define bitf16 OM_TURBOPFOR_SYMBOL(bitf16)
+#define bitf164 OM_TURBOPFOR_SYMBOL(bitf164)
+#define bitf18 OM_TURBOPFOR_SYMBOL(bitf18)
+#define bitf1pack128v16 OM_TURBOPFOR_SYMBOL(bitf1pack128v16)
+#define bitf1pack128v32 OM_TURBOPFOR_SYMBOL(bitf1pack128v32)
+#define bitf1pack16 OM_TURBOPFOR_SYMBOL(bitf1pack16)
+#define bitf1pack16_0 OM_TURBOPFOR_SYMBOL(bitf1pack16_0)
+#define bitf1pack16_1 OM_TURBOPFOR_SYMBOL(bitf1pack16_1)
+#define bitf1pack16_10 OM_TURBOPFOR_SYMBOL(bitf1pack16_10)
+#define bitf1pack16_11 OM_TURBOPFOR_SYMBOL(bitf1pack16_11)
+#define bitf1pack16_12 OM_TURBOPFOR_SYMBOL(bitf1pack16_12)
+#define bitf1pack16_13 OM_TURBOPFOR_SYMBOL(bitf1pack16_13)
+#define bitf1pack16_14 OM_TURBOPFOR_SYMBOL(bitf1pack16_14)
+#define bitf1pack16_15 OM_TURBOPFOR_SYMBOL(bitf1pack16_15)
+#define bitf1pack16_16 OM_TURBOPFOR_SYMBOL(bitf1pack16_16)
+#define bitf1pack16_2 OM_TURBOPFOR_SYMBOL(bitf1pack16_2)
+#define bitf1pack16_3 OM_TURBOPFOR_SYMBOL(bitf1pack16_3)
+#define bitf1pack16_4 OM_TURBOPFOR_SYMBOL(bitf1pack16_4)
+#define bitf1pack16_5 OM_TURBOPFOR_SYMBOL(bitf1pack16_5)
+#define bitf1pack16_6 OM_TURBOPFOR_SYMBOL(bitf1pack16_6)
+#define bitf1pack16_7 OM_TURBOPFOR_SYMBOL(bitf1pack16_7)
+#define bitf1pack16_8 OM_TURBOPFOR_SYMBOL(bitf1pack16_8)
+#define bitf1pack16_9 OM_TURBOPFOR_SYMBOL(bitf1pack16_9)
+#define bitf1pack32 OM_TURBOPFOR_SYMBOL(bitf1pack32)
+#define bitf1pack32_0 OM_TURBOPFOR_SYMBOL(bitf1pack32_0)
+#define bitf1pack32_1 OM_TURBOPFOR_SYMBOL(bitf1pack32_1)
+#define bitf1pack32_10 OM_TURBOPFOR_SYMBOL(bitf1pack32_10)
+#define bitf1pack32_11 OM_TURBOPFOR_SYMBOL(bitf1pack32_11)
+#define bitf1pack32_12 OM_TURBOPFOR_SYMBOL(bitf1pack32_12)
+#define bitf1pack32_13 OM_TURBOPFOR_SYMBOL(bitf1pack32_13)
+#define bitf1pack32_14 OM_TURBOPFOR_SYMBOL(bitf1pack32_14)
+#define bitf1pack32_15 OM_TURBOPFOR_SYMBOL(bitf1pack32_15)
+#define bitf1pack32_16 OM_TURBOPFOR_SYMBOL(bitf1pack32_16)
+#define bitf1pack32_17 OM_TURBOPFOR_SYMBOL(bitf1pack32_17)
+#define bitf1pack32_18 OM_TURBOPFOR_SYMBOL(bitf1pack32_18)
+#define bitf1pack32_19 OM_TURBOPFOR_SYMBOL(bitf1pack32_19)
+#define bitf1pack32_2 OM_TURBOPFOR_SYMBOL(bitf1pack32_2)
+#define bitf1pack32_20 OM_TURBOPFOR_SYMBOL(bitf1pack32_20)
+#define bitf1pack32_21 OM_TURBOPFOR_SYMBOL(bitf1pack32_21)
+#define bitf1pack32_22 OM_TURBOPFOR_SYMBOL(bitf1pack32_22)
+#define bitf1pack32_23 OM_TURBOPFOR_SYMBOL(bitf1pack32_23)
+#define bitf1pack32_24 OM_TURBOPFOR_SYMBOL(bitf1pack32_24)
+#define bitf1pack32_25 OM_TURBOPFOR_SYMBOL(bitf1pack32_25)
+#define bitf1pack32_26 OM_TURBOPFOR_SYMBOL(bitf1pack32_26)
+#define bitf1pack32_27 OM_TURBOPFOR_SYMBOL(bitf1pack32_27)
+#define bitf1pack32_28 OM_TURBOPFOR_SYMBOL(bitf1pack32_28)
+#define bitf1pack32_29 OM_TURBOPFOR_SYMBOL(bitf1pack32_29)
+#define bitf1pack32_3 OM_TURBOPFOR_SYMBOL(bitf1pack32_3)
+#define bitf1pack32_30 OM_TURBOPFOR_SYMBOL(bitf1pack32_30)
+#define bitf1pack32_31 OM_TURBOPFOR_SYMBOL(bitf1pack32_31)
+#define bitf1pack32_32 OM_TURBOPFOR_SYMBOL(bitf1pack32_32)
+#define bitf1pack32_4 OM_TURBOPFOR_SYMBOL(bitf1pack32_4)
+#define bitf1pack32_5 OM_TURBOPFOR_SYMBOL(bitf1pack32_5)
+#define bitf1pack32_6 OM_TURBOPFOR_SYMBOL(bitf1pack32_6)
+#define bitf1pack32_7 OM_TURBOPFOR_SYMBOL(bitf1pack32_7)
+#define bitf1pack32_8 OM_TURBOPFOR_SYMBOL(bitf1pack32_8)
+#define bitf1pack32_9 OM_TURBOPFOR_SYMBOL(bitf1pack32_9)
+#define bitf1pack64 OM_TURBOPFOR_SYMBOL(bitf1pack64)
+#define bitf1pack64_0 OM_TURBOPFOR_SYMBOL(bitf1pack64_0)
+#define bitf1pack64_1 OM_TURBOPFOR_SYMBOL(bitf1pack64_1)
+#define bitf1pack64_10 OM_TURBOPFOR_SYMBOL(bitf1pack64_10)
+#define bitf1pack64_11 OM_TURBOPFOR_SYMBOL(bitf1pack64_11)
+#define bitf1pack64_12 OM_TURBOPFOR_SYMBOL(bitf1pack64_12)
+#define bitf1pack64_13 OM_TURBOPFOR_SYMBOL(bitf1pack64_13)
+#define bitf1pack64_14 OM_TURBOPFOR_SYMBOL(bitf1pack64_14)
+#define bitf1pack64_15 OM_TURBOPFOR_SYMBOL(bitf1pack64_15)
+#define bitf1pack64_16 OM_TURBOPFOR_SYMBOL(bitf1pack64_16)
+#define bitf1pack64_17 OM_TURBOPFOR_SYMBOL(bitf1pack64_17)
+#define bitf1pack64_18 OM_TURBOPFOR_SYMBOL(bitf1pack64_18)
+#define bitf1pack64_19 OM_TURBOPFOR_SYMBOL(bitf1pack64_19)
+#define bitf1pack64_2 OM_TURBOPFOR_SYMBOL(bitf1pack64_2)
+#define bitf1pack64_20 OM_TURBOPFOR_SYMBOL(bitf1pack64_20)
+#define bitf1pack64_21 OM_TURBOPFOR_SYMBOL(bitf1pack64_21)
+#define bitf1pack64_22 OM_TURBOPFOR_SYMBOL(bitf1pack64_22)
+#define bitf1pack64_23 OM_TURBOPFOR_SYMBOL(bitf1pack64_23)
+#define bitf1pack64_24 OM_TURBOPFOR_SYMBOL(bitf1pack64_24)
+#define bitf1pack64_25 OM_TURBOPFOR_SYMBOL(bitf1pack64_25)
+#define bitf1pack64_26 OM_TURBOPFOR_SYMBOL(bitf1pack64_26)
+#define bitf1pack64_27 OM_TURBOPFOR_SYMBOL(bitf1pack64_27)
+#define bitf1pack64_28 OM_TURBOPFOR_SYMBOL(bitf1pack64_28)
+#define bitf1pack64_29 OM_TURBOPFOR_SYMBOL(bitf1pack64_29)
+#define bitf1pack64_3 OM_TURBOPFOR_SYMBOL(bitf1pack64_3)
+#define bitf1pack64_30 OM_TURBOPFOR_SYMBOL(bitf1pack64_30)
+#define bitf1pack64_31 OM_TURBOPFOR_SYMBOL(bitf1pack64_31)
+#define bitf1pack64_32 OM_TURBOPFOR_SYMBOL(bitf1pack64_32)
+#define bitf1pack64_33 OM_TURBOPFOR_SYMBOL(bitf1pack64_33)
+#define bitf1pack64_34 OM_TURBOPFOR_SYMBOL(bitf1pack64_34)
+#define bitf1pack64_35 OM_TURBOPFOR_SYMBOL(bitf1pack64_35)
+#define bitf1pack64_36 OM_TURBOPFOR_SYMBOL(bitf1pack64_36)
+#define bitf1pack64_37 OM_TURBOPFOR_SYMBOL(bitf1pack64_37)
+#define bitf1pack64_38 OM_TURBOPFOR_SYMBOL(bitf1pack64_38)
+#define bitf1pack64_39 OM_TURBOPFOR_SYMBOL(bitf1pack64_39)
+#define bitf1pack64_4 OM_TURBOPFOR_SYMBOL(bitf1pack64_4)
+#define bitf1pack64_40 OM_TURBOPFOR_SYMBOL(bitf1pack64_40)
+#define bitf1pack64_41 OM_TURBOPFOR_SYMBOL(bitf1pack64_41)
+#define bitf1pack64_42 OM_TURBOPFOR_SYMBOL(bitf1pack64_42)
+#define bitf1pack64_43 OM_TURBOPFOR_SYMBOL(bitf1pack64_43)
+#define bitf1pack64_44 OM_TURBOPFOR_SYMBOL(bitf1pack64_44)
+#define bitf1pack64_45 OM_TURBOPFOR_SYMBOL(bitf1pack64_45)
+#define bitf1pack64_46 OM_TURBOPFOR_SYMBOL(bitf1pack64_46)
+#define bitf1pack64_47 OM_TURBOPFOR_SYMBOL(bitf1pack64_47)
+#define bitf1pack64_48 OM_TURBOPFOR_SYMBOL(bitf1pack64_48)
+#define bitf1pack64_49 OM_TURBOPFOR_SYMBOL(bitf1pack64_49)
+#define bitf1pack64_5 OM_TURBOPFOR_SYMBOL(bitf1pack64_5)
+#define bitf1pack64_50 OM_TURBOPFOR_SYMBOL(bitf1pack64_50)
+#define bitf1pack64_51 OM_TURBOPFOR_SYMBOL(bitf1pack64_51)
+#define bitf1pack64_52 OM_TURBOPFOR_SYMBOL(bitf1pack64_52)
+#define bitf1pack64_53 OM_TURBOPFOR_SYMBOL(bitf1pack64_53)
+#define bitf1pack64_54 OM_TURBOPFOR_SYMBOL(bitf1pack64_54)
+#define bitf1pack64_55 OM_TURBOPFOR_SYMBOL(bitf1pack64_55)
+#define bitf1pack64_56 OM_TURBOPFOR_SYMBOL(bitf1pack64_56)
+#define bitf1pack64_57 OM_TURBOPFOR_SYMBOL(bitf1pack64_57)
+#define bitf1pack64_58 OM_TURBOPFOR_SYMBOL(bitf1pack64_58)
+#define bitf1pack64_59 OM_TURBOPFOR_SYMBOL(bitf1pack64_59)
+#define bitf1pack64_6 OM_TURBOPFOR_SYMBOL(bitf1pack64_6)
+#define bitf1pack64_60 OM_TURBOPFOR_SYMBOL(bitf1pack64_60)
+#define bitf1pack64_61 OM_TURBOPFOR_SYMBOL(bitf1pack64_61)
+#define bitf1pack64_62 OM_TURBOPFOR_SYMBOL(bitf1pack64_62)
+#define bitf1pack64_63 OM_TURBOPFOR_SYMBOL(bitf1pack64_63)
+#define bitf1pack64_64 OM_TURBOPFOR_SYMBOL(bitf1pack64_64)
+#define bitf1pack64_7 OM_TURBOPFOR_SYMBOL(bitf1pack64_7)
+#define bitf1pack64_8 OM_TURBOPFOR_SYMBOL(bitf1pack64_8)
+#define bitf1pack64_9 OM_TURBOPFOR_SYMBOL(bitf1pack64_9)
+#define bitf1pack8 OM_TURBOPFOR_SYMBOL(bitf1pack8)
+#define bitf1pack8_0 OM_TURBOPFOR_SYMBOL(bitf1pack8_0)
+#define bitf1pack8_1 OM_TURBOPFOR_SYMBOL(bitf1pack8_1)
+#define bitf1pack8_2 OM_TURBOPFOR_SYMBOL(bitf1pack8_2)
+#define bitf1pack8_3 OM_TURBOPFOR_SYMBOL(bitf1pack8_3)
+#define bitf1pack8_4 OM_TURBOPFOR_SYMBOL(bitf1pack8_4)
+#define bitf1pack8_5 OM_TURBOPFOR_SYMBOL(bitf1pack8_5)
+#define bitf1pack8_6 OM_TURBOPFOR_SYMBOL(bitf1pack8_6)
+#define bitf1pack8_7 OM_TURBOPFOR_SYMBOL(bitf1pack8_7)
+#define bitf1pack8_8 OM_TURBOPFOR_SYMBOL(bitf1pack8_8)
+#define bitf1packa16 OM_TURBOPFOR_SYMBOL(bitf1packa16)
+#define bitf1packa32 OM_TURBOPFOR_SYMBOL(bitf1packa32)
+#define bitf1packa64 OM_TURBOPFOR_SYMBOL(bitf1packa64)
+#define bitf1packa8 OM_TURBOPFOR_SYMBOL(bitf1packa8)
+#define bitf1unpack128v16 OM_TURBOPFOR_SYMBOL(bitf1unpack128v16)
+#define bitf1unpack128v32 OM_TURBOPFOR_SYMBOL(bitf1unpack128v32)
+#define bitf1unpack16 OM_TURBOPFOR_SYMBOL(bitf1unpack16)
+#define bitf1unpack16_0 OM_TURBOPFOR_SYMBOL(bitf1unpack16_0)
+#define bitf1unpack16_1 OM_TURBOPFOR_SYMBOL(bitf1unpack16_1)
+#define bitf1unpack16_10 OM_TURBOPFOR_SYMBOL(bitf1unpack16_10)
+#define bitf1unpack16_11 OM_TURBOPFOR_SYMBOL(bitf1unpack16_11)
+#define bitf1unpack16_12 OM_TURBOPFOR_SYMBOL(bitf1unpack16_12)
+#define bitf1unpack16_13 OM_TURBOPFOR_SYMBOL(bitf1unpack16_13)
+#define bitf1unpack16_14 OM_TURBOPFOR_SYMBOL(bitf1unpack16_14)
+#define bitf1unpack16_15 OM_TURBOPFOR_SYMBOL(bitf1unpack16_15)
+#define bitf1unpack16_16 OM_TURBOPFOR_SYMBOL(bitf1unpack16_16)
+#define bitf1unpack16_2 OM_TURBOPFOR_SYMBOL(bitf1unpack16_2)
+#define bitf1unpack16_3 OM_TURBOPFOR_SYMBOL(bitf1unpack16_3)
+#define bitf1unpack16_4 OM_TURBOPFOR_SYMBOL(bitf1unpack16_4)
+#define bitf1unpack16_5 OM_TURBOPFOR_SYMBOL(bitf1unpack16_5)
+#define bitf1unpack16_6 OM_TURBOPFOR_SYMBOL(bitf1unpack16_6)
+#define bitf1unpack16_7 OM_TURBOPFOR_SYMBOL(bitf1unpack16_7)
+#define bitf1unpack16_8 OM_TURBOPFOR_SYMBOL(bitf1unpack16_8)
+#define bitf1unpack16_9 OM_TURBOPFOR_SYMBOL(bitf1unpack16_9)
+#define bitf1unpack32 OM_TURBOPFOR_SYMBOL(bitf1unpack32)
+#define bitf1unpack32_0 OM_TURBOPFOR_SYMBOL(bitf1unpack32_0)
+#define bitf1unpack32_1 OM_TURBOPFOR_SYMBOL(bitf1unpack32_1)
+#define bitf1unpack32_10 OM_TURBOPFOR_SYMBOL(bitf1unpack32_10)
+#define bitf1unpack32_11 OM_TURBOPFOR_SYMBOL(bitf1unpack32_11)
+#define bitf1unpack32_12 OM_TURBOPFOR_SYMBOL(bitf1unpack32_12)
+#define bitf1unpack32_13 OM_TURBOPFOR_SYMBOL(bitf1unpack32_13)
+#define bitf1unpack32_14 OM_TURBOPFOR_SYMBOL(bitf1unpack32_14)
+#define bitf1unpack32_15 OM_TURBOPFOR_SYMBOL(bitf1unpack32_15)
+#define bitf1unpack32_16 OM_TURBOPFOR_SYMBOL(bitf1unpack32_16)
+#define bitf1unpack32_17 OM_TURBOPFOR_SYMBOL(bitf1unpack32_17)
+#define bitf1unpack32_18 OM_TURBOPFOR_SYMBOL(bitf1unpack32_18)
+#define bitf1unpack32_19 OM_TURBOPFOR_SYMBOL(bitf1unpack32_19)
+#define bitf1unpack32_2 OM_TURBOPFOR_SYMBOL(bitf1unpack32_2)
+#define bitf1unpack32_20 OM_TURBOPFOR_SYMBOL(bitf1unpack32_20)
+#define bitf1unpack32_21 OM_TURBOPFOR_SYMBOL(bitf1unpack32_21)
+#define bitf1unpack32_22 OM_TURBOPFOR_SYMBOL(bitf1unpack32_22)
+#define bitf1unpack32_23 OM_TURBOPFOR_SYMBOL(bitf1unpack32_23)
+#define bitf1unpack32_24 OM_TURBOPFOR_SYMBOL(bitf1unpack32_24)
+#define bitf1unpack32_25 OM_TURBOPFOR_SYMBOL(bitf1unpack32_25)
+#define bitf1unpack32_26 OM_TURBOPFOR_SYMBOL(bitf1unpack32_26)
+#define bitf1unpack32_27 OM_TURBOPFOR_SYMBOL(bitf1unpack32_27)
+#define bitf1unpack32_28 OM_TURBOPFOR_SYMBOL(bitf1unpack32_28)
+#define bitf1unpack32_29 OM_TURBOPFOR_SYMBOL(bitf1unpack32_29)
+#define bitf1unpack32_3 OM_TURBOPFOR_SYMBOL(bitf1unpack32_3)
+#define bitf1unpack32_30 OM_TURBOPFOR_SYMBOL(bitf1unpack32_30)
+#define bitf1unpack32_31 OM_TURBOPFOR_SYMBOL(bitf1unpack32_31)
+#define bitf1unpack32_32 OM_TURBOPFOR_SYMBOL(bitf1unpack32_32)
+#define bitf1unpack32_4 OM_TURBOPFOR_SYMBOL(bitf1unpack32_4)
+#define bitf1unpack32_5 OM_TURBOPFOR_SYMBOL(bitf1unpack32_5)
+#define bitf1unpack32_6 OM_TURBOPFOR_SYMBOL(bitf1unpack32_6)
+#define bitf1unpack32_7 OM_TURBOPFOR_SYMBOL(bitf1unpack32_7)
+#define bitf1unpack32_8 OM_TURBOPFOR_SYMBOL(bitf1unpack32_8)
+#define bitf1unpack32_9 OM_TURBOPFOR_SYMBOL(bitf1unpack32_9)
+#define bitf1unpack64 OM_TURBOPFOR_SYMBOL(bitf1unpack64)
+#define bitf1unpack64_0 OM_TURBOPFOR_SYMBOL(bitf1unpack64_0)
+#define bitf1unpack64_1 OM_TURBOPFOR_SYMBOL(bitf1unpack64_1)
+#define bitf1unpack64_10 OM_TURBOPFOR_SYMBOL(bitf1unpack64_10)
+#define bitf1unpack64_11 OM_TURBOPFOR_SYMBOL(bitf1unpack64_11)
+#define bitf1unpack64_12 OM_TURBOPFOR_SYMBOL(bitf1unpack64_12)
+#define bitf1unpack64_13 OM_TURBOPFOR_SYMBOL(bitf1unpack64_13)
+#define bitf1unpack64_14 OM_TURBOPFOR_SYMBOL(bitf1unpack64_14)
+#define bitf1unpack64_15 OM_TURBOPFOR_SYMBOL(bitf1unpack64_15)
+#define bitf1unpack64_16 OM_TURBOPFOR_SYMBOL(bitf1unpack64_16)
+#define bitf1unpack64_17 OM_TURBOPFOR_SYMBOL(bitf1unpack64_17)
+#define bitf1unpack64_18 OM_TURBOPFOR_SYMBOL(bitf1unpack64_18)
+#define bitf1unpack64_19 OM_TURBOPFOR_SYMBOL(bitf1unpack64_19)
+#define bitf1unpack64_2 OM_TURBOPFOR_SYMBOL(bitf1unpack64_2)
+#define bitf1unpack64_20 OM_TURBOPFOR_SYMBOL(bitf1unpack64_20)
+#define bitf1unpack64_21 OM_TURBOPFOR_SYMBOL(bitf1unpack64_21)
+#define bitf1unpack64_22 OM_TURBOPFOR_SYMBOL(bitf1unpack64_22)
+#define bitf1unpack64_23 OM_TURBOPFOR_SYMBOL(bitf1unpack64_23)
+#define bitf1unpack64_24 OM_TURBOPFOR_SYMBOL(bitf1unpack64_24)
+#define bitf1unpack64_25 OM_TURBOPFOR_SYMBOL(bitf1unpack64_25)
+#define bitf1unpack64_26 OM_TURBOPFOR_SYMBOL(bitf1unpack64_26)
+#define bitf1unpack64_27 OM_TURBOPFOR_SYMBOL(bitf1unpack64_27)
+#define bitf1unpack64_28 OM_TURBOPFOR_SYMBOL(bitf1unpack64_28)
+#define bitf1unpack64_29 OM_TURBOPFOR_SYMBOL(bitf1unpack64_29)
+#define bitf1unpack64_3 OM_TURBOPFOR_SYMBOL(bitf1unpack64_3)
+#define bitf1unpack64_30 OM_TURBOPFOR_SYMBOL(bitf1unpack64_30)
+#define bitf1unpack64_31 OM_TURBOPFOR_SYMBOL(bitf1unpack64_31)
+#define bitf1unpack64_32 OM_TURBOPFOR_SYMBOL(bitf1unpack64_32)
+#define bitf1unpack64_33 OM_TURBOPFOR_SYMBOL(bitf1unpack64_33)
+#define bitf1unpack64_34 OM_TURBOPFOR_SYMBOL(bitf1unpack64_34)
+#define bitf1unpack64_35 OM_TURBOPFOR_SYMBOL(bitf1unpack64_35)
+#define bitf1unpack64_36 OM_TURBOPFOR_SYMBOL(bitf1unpack64_36)
+#define bitf1unpack64_37 OM_TURBOPFOR_SYMBOL(bitf1unpack64_37)
+#define bitf1unpack64_38 OM_TURBOPFOR_SYMBOL(bitf1unpack64_38)
+#define bitf1unpack64_39 OM_TURBOPFOR_SYMBOL(bitf1unpack64_39)
+#define bitf1unpack64_4 OM_TURBOPFOR_SYMBOL(bitf1unpack64_4)
+#define bitf1unpack64_40 OM_TURBOPFOR_SYMBOL(bitf1unpack64_40)
+#define bitf1unpack64_41 OM_TURBOPFOR_SYMBOL(bitf1unpack64_41)
+#define bitf1unpack64_42 OM_TURBOPFOR_SYMBOL(bitf1unpack64_42)
+#define bitf1unpack64_43 OM_TURBOPFOR_SYMBOL(bitf1unpack64_43)
+#define bitf1unpack64_44 OM_TURBOPFOR_SYMBOL(bitf1unpack64_44)
+#define bitf1unpack64_45 OM_TURBOPFOR_SYMBOL(bitf1unpack64_45)
+#define bitf1unpack64_46 OM_TURBOPFOR_SYMBOL(bitf1unpack64_46)
+#define bitf1unpack64_47 OM_TURBOPFOR_SYMBOL(bitf1unpack64_47)
+#define bitf1unpack64_48 OM_TURBOPFOR_SYMBOL(bitf1unpack64_48)
+#define bitf1unpack64_49 OM_TURBOPFOR_SYMBOL(bitf1unpack64_49)
+#define bitf1unpack64_5 OM_TURBOPFOR_SYMBOL(bitf1unpack64_5)
+#define bitf1unpack64_50 OM_TURBOPFOR_SYMBOL(bitf1unpack64_50)
+#define bitf1unpack64_51 OM_TURBOPFOR_SYMBOL(bitf1unpack64_51)
+#define bitf1unpack64_52 OM_TURBOPFOR_SYMBOL(bitf1unpack64_52)
+#define bitf1unpack64_53 OM_TURBOPFOR_SYMBOL(bitf1unpack64_53)
+#define bitf1unpack64_54 OM_TURBOPFOR_SYMBOL(bitf1unpack64_54)
+#define bitf1unpack64_55 OM_TURBOPFOR_SYMBOL(bitf1unpack64_55)
+#define bitf1unpack64_56 OM_TURBOPFOR_SYMBOL(bitf1unpack64_56)
+#define bitf1unpack64_57 OM_TURBOPFOR_SYMBOL(bitf1unpack64_57)
+#define bitf1unpack64_58 OM_TURBOPFOR_SYMBOL(bitf1unpack64_58)
+#define bitf1unpack64_59 OM_TURBOPFOR_SYMBOL(bitf1unpack64_59)
+#define bitf1unpack64_6 OM_TURBOPFOR_SYMBOL(bitf1unpack64_6)
+#define bitf1unpack64_60 OM_TURBOPFOR_SYMBOL(bitf1unpack64_60)
+#define bitf1unpack64_61 OM_TURBOPFOR_SYMBOL(bitf1unpack64_61)
+#define bitf1unpack64_62 OM_TURBOPFOR_SYMBOL(bitf1unpack64_62)
+#define bitf1unpack64_63 OM_TURBOPFOR_SYMBOL(bitf1unpack64_63)
+#define bitf1unpack64_64 OM_TURBOPFOR_SYMBOL(bitf1unpack64_64)
+#define bitf1unpack64_7 OM_TURBOPFOR_SYMBOL(bitf1unpack64_7)
+#define bitf1unpack64_8 OM_TURBOPFOR_SYMBOL(bitf1unpack64_8)
+#define bitf1unpack64_9 OM_TURBOPFOR_SYMBOL(bitf1unpack64_9)
+#define bitf1unpack8 OM_TURBOPFOR_SYMBOL(bitf1unpack8)
+#define bitf1unpack8_0 OM_TURBOPFOR_SYMBOL(bitf1unpack8_0)
+#define bitf1unpack8_1 OM_TURBOPFOR_SYMBOL(bitf1unpack8_1)
+#define bitf1unpack8_2 OM_TURBOPFOR_SYMBOL(bitf1unpack8_2)
+#define bitf1unpack8_3 OM_TURBOPFOR_SYMBOL(bitf1unpack8_3)
+#define bitf1unpack8_4 OM_TURBOPFOR_SYMBOL(bitf1unpack8_4)
+#define bitf1unpack8_5 OM_TURBOPFOR_SYMBOL(bitf1unpack8_5)
+#define bitf1unpack8_6 OM_TURBOPFOR_SYMBOL(bitf1unpack8_6)
+#define bitf1unpack8_7 OM_TURBOPFOR_SYMBOL(bitf1unpack8_7)
+#define bitf1unpack8_8 OM_TURBOPFOR_SYMBOL(bitf1unpack8_8)
+#define bitf1unpacka16 OM_TURBOPFOR_SYMBOL(bitf1unpacka16)
+#define bitf1unpacka32 OM_TURBOPFOR_SYMBOL(bitf1unpacka32)
+#define bitf1unpacka64 OM_TURBOPFOR_SYMBOL(bitf1unpacka64)
+#define bitf1unpacka8 OM_TURBOPFOR_SYMBOL(bitf1unpacka8)
+#define bitf32 OM_TURBOPFOR_SYMBOL(bitf32)
+#define bitf64 OM_TURBOPFOR_SYMBOL(bitf64)
+#define bitf8 OM_TURBOPFOR_SYMBOL(bitf8)
+#define bitfm16 OM_TURBOPFOR_SYMBOL(bitfm16)
+#define bitfm32 OM_TURBOPFOR_SYMBOL(bitfm32)
+#define bitfm64 OM_TURBOPFOR_SYMBOL(bitfm64)
+#define bitfm8 OM_TURBOPFOR_SYMBOL(bitfm8)
+#define bitfpack128v16 OM_TURBOPFOR_SYMBOL(bitfpack128v16)
+#define bitfpack128v32 OM_TURBOPFOR_SYMBOL(bitfpack128v32)
+#define bitfpack16 OM_TURBOPFOR_SYMBOL(bitfpack16)
+#define bitfpack16_0 OM_TURBOPFOR_SYMBOL(bitfpack16_0)
+#define bitfpack16_1 OM_TURBOPFOR_SYMBOL(bitfpack16_1)
+#define bitfpack16_10 OM_TURBOPFOR_SYMBOL(bitfpack16_10)
+#define bitfpack16_11 OM_TURBOPFOR_SYMBOL(bitfpack16_11)
+#define bitfpack16_12 OM_TURBOPFOR_SYMBOL(bitfpack16_12)
+#define bitfpack16_13 OM_TURBOPFOR_SYMBOL(bitfpack16_13)
+#define bitfpack16_14 OM_TURBOPFOR_SYMBOL(bitfpack16_14)
+#define bitfpack16_15 OM_TURBOPFOR_SYMBOL(bitfpack16_15)
+#define bitfpack16_16 OM_TURBOPFOR_SYMBOL(bitfpack16_16)
+#define bitfpack16_2 OM_TURBOPFOR_SYMBOL(bitfpack16_2)
+#define bitfpack16_3 OM_TURBOPFOR_SYMBOL(bitfpack16_3)
+#define bitfpack16_4 OM_TURBOPFOR_SYMBOL(bitfpack16_4)
+#define bitfpack16_5 OM_TURBOPFOR_SYMBOL(bitfpack16_5)
+#define bitfpack16_6 OM_TURBOPFOR_SYMBOL(bitfpack16_6)
+#define bitfpack16_7 OM_TURBOPFOR_SYMBOL(bitfpack16_7)
+#define bitfpack16_8 OM_TURBOPFOR_SYMBOL(bitfpack16_8)
+#define bitfpack16_9 OM_TURBOPFOR_SYMBOL(bitfpack16_9)
+#define bitfpack32 OM_TURBOPFOR_SYMBOL(bitfpack32)
+#define bitfpack32_0 OM_TURBOPFOR_SYMBOL(bitfpack32_0)
+#define bitfpack32_1 OM_TURBOPFOR_SYMBOL(bitfpack32_1)
+#define bitfpack32_10 OM_TURBOPFOR_SYMBOL(bitfpack32_10)
+#define bitfpack32_11 OM_TURBOPFOR_SYMBOL(bitfpack32_11)
+#define bitfpack32_12 OM_TURBOPFOR_SYMBOL(bitfpack32_12)
+#define bitfpack32_13 OM_TURBOPFOR_SYMBOL(bitfpack32_13)
+#define bitfpack32_14 OM_TURBOPFOR_SYMBOL(bitfpack32_14)
+#define bitfpack32_15 OM_TURBOPFOR_SYMBOL(bitfpack32_15)
+#define bitfpack32_16 OM_TURBOPFOR_SYMBOL(bitfpack32_16)
+#define bitfpack32_17 OM_TURBOPFOR_SYMBOL(bitfpack32_17)
+#define bitfpack32_18 OM_TURBOPFOR_SYMBOL(bitfpack32_18)
+#define bitfpack32_19 OM_TURBOPFOR_SYMBOL(bitfpack32_19)
+#define bitfpack32_2 OM_TURBOPFOR_SYMBOL(bitfpack32_2)
+#define bitfpack32_20 OM_TURBOPFOR_SYMBOL(bitfpack32_20)
+#define bitfpack32_21 OM_TURBOPFOR_SYMBOL(bitfpack32_21)
+#define bitfpack32_22 OM_TURBOPFOR_SYMBOL(bitfpack32_22)
+#define bitfpack32_23 OM_TURBOPFOR_SYMBOL(bitfpack32_23)
+#define bitfpack32_24 OM_TURBOPFOR_SYMBOL(bitfpack32_24)
+#define bitfpack32_25 OM_TURBOPFOR_SYMBOL(bitfpack32_25)
+#define bitfpack32_26 OM_TURBOPFOR_SYMBOL(bitfpack32_26)
+#define bitfpack32_27 OM_TURBOPFOR_SYMBOL(bitfpack32_27)
+#define bitfpack32_28 OM_TURBOPFOR_SYMBOL(bitfpack32_28)
+#define bitfpack32_29 OM_TURBOPFOR_SYMBOL(bitfpack32_29)
+#define bitfpack32_3 OM_TURBOPFOR_SYMBOL(bitfpack32_3)
+#define bitfpack32_30 OM_TURBOPFOR_SYMBOL(bitfpack32_30)
+#define bitfpack32_31 OM_TURBOPFOR_SYMBOL(bitfpack32_31)
+#define bitfpack32_32 OM_TURBOPFOR_SYMBOL(bitfpack32_32)
+#define bitfpack32_4 OM_TURBOPFOR_SYMBOL(bitfpack32_4)
+#define bitfpack32_5 OM_TURBOPFOR_SYMBOL(bitfpack32_5)
+#define bitfpack32_6 OM_TURBOPFOR_SYMBOL(bitfpack32_6)
+#define bitfpack32_7 OM_TURBOPFOR_SYMBOL(bitfpack32_7)
+#define bitfpack32_8 OM_TURBOPFOR_SYMBOL(bitfpack32_8)
+#define bitfpack32_9 OM_TURBOPFOR_SYMBOL(bitfpack32_9)
+#define bitfpack64 OM_TURBOPFOR_SYMBOL(bitfpack64)
+#define bitfpack64_0 OM_TURBOPFOR_SYMBOL(bitfpack64_0)
+#define bitfpack64_1 OM_TURBOPFOR_SYMBOL(bitfpack64_1)
+#define bitfpack64_10 OM_TURBOPFOR_SYMBOL(bitfpack64_10)
+#define bitfpack64_11 OM_TURBOPFOR_SYMBOL(bitfpack64_11)
+#define bitfpack64_12 OM_TURBOPFOR_SYMBOL(bitfpack64_12)
+#define bitfpack64_13 OM_TURBOPFOR_SYMBOL(bitfpack64_13)
+#define bitfpack64_14 OM_TURBOPFOR_SYMBOL(bitfpack64_14)
+#define bitfpack64_15 OM_TURBOPFOR_SYMBOL(bitfpack64_15)
+#define bitfpack64_16 OM_TURBOPFOR_SYMBOL(bitfpack64_16)
+#define bitfpack64_17 OM_TURBOPFOR_SYMBOL(bitfpack64_17)
+#define bitfpack64_18 OM_TURBOPFOR_SYMBOL(bitfpack64_18)
+#define bitfpack64_19 OM_TURBOPFOR_SYMBOL(bitfpack64_19)
+#define bitfpack64_2 OM_TURBOPFOR_SYMBOL(bitfpack64_2)
+#define bitfpack64_20 OM_TURBOPFOR_SYMBOL(bitfpack64_20)
+#define bitfpack64_21 OM_TURBOPFOR_SYMBOL(bitfpack64_21)
+#define bitfpack64_22 OM_TURBOPFOR_SYMBOL(bitfpack64_22)
+#define bitfpack64_23 OM_TURBOPFOR_SYMBOL(bitfpack64_23)
+#define bitfpack64_24 OM_TURBOPFOR_SYMBOL(bitfpack64_24)
+#define bitfpack64_25 OM_TURBOPFOR_SYMBOL(bitfpack64_25)
+#define bitfpack64_26 OM_TURBOPFOR_SYMBOL(bitfpack64_26)
+#define bitfpack64_27 OM_TURBOPFOR_SYMBOL(bitfpack64_27)
+#define bitfpack64_28 OM_TURBOPFOR_SYMBOL(bitfpack64_28)
+#define bitfpack64_29 OM_TURBOPFOR_SYMBOL(bitfpack64_29)
+#define bitfpack64_3 OM_TURBOPFOR_SYMBOL(bitfpack64_3)
+#define bitfpack64_30 OM_TURBOPFOR_SYMBOL(bitfpack64_30)
+#define bitfpack64_31 OM_TURBOPFOR_SYMBOL(bitfpack64_31)
+#define bitfpack64_32 OM_TURBOPFOR_SYMBOL(bitfpack64_32)
+#define bitfpack64_33 OM_TURBOPFOR_SYMBOL(bitfpack64_33)
+#define bitfpack64_34 OM_TURBOPFOR_SYMBOL(bitfpack64_34)
+#define bitfpack64_35 OM_TURBOPFOR_SYMBOL(bitfpack64_35)
+#define bitfpack64_36 OM_TURBOPFOR_SYMBOL(bitfpack64_36)
+#define bitfpack64_37 OM_TURBOPFOR_SYMBOL(bitfpack64_37)
+#define bitfpack64_38 OM_TURBOPFOR_SYMBOL(bitfpack64_38)
+#define bitfpack64_39 OM_TURBOPFOR_SYMBOL(bitfpack64_39)
+#define bitfpack64_4 OM_TURBOPFOR_SYMBOL(bitfpack64_4)
+#define bitfpack64_40 OM_TURBOPFOR_SYMBOL(bitfpack64_40)
+#define bitfpack64_41 OM_TURBOPFOR_SYMBOL(bitfpack64_41)
+#define bitfpack64_42 OM_TURBOPFOR_SYMBOL(bitfpack64_42)
+#define bitfpack64_43 OM_TURBOPFOR_SYMBOL(bitfpack64_43)
+#define bitfpack64_44 OM_TURBOPFOR_SYMBOL(bitfpack64_44)
+#define bitfpack64_45 OM_TURBOPFOR_SYMBOL(bitfpack64_45)
+#define bitfpack64_46 OM_TURBOPFOR_SYMBOL(bitfpack64_46)
+#define bitfpack64_47 OM_TURBOPFOR_SYMBOL(bitfpack64_47)
+#define bitfpack64_48 OM_TURBOPFOR_SYMBOL(bitfpack64_48)
+#define bitfpack64_49 OM_TURBOPFOR_SYMBOL(bitfpack64_49)
+#define bitfpack64_5 OM_TURBOPFOR_SYMBOL(bitfpack64_5)
+#define bitfpack64_50 OM_TURBOPFOR_SYMBOL(bitfpack64_50)
+#define bitfpack64_51 OM_TURBOPFOR_SYMBOL(bitfpack64_51)
+#define bitfpack64_52 OM_TURBOPFOR_SYMBOL(bitfpack64_52)
+#define bitfpack64_53 OM_TURBOPFOR_SYMBOL(bitfpack64_53)
+#define bitfpack64_54 OM_TURBOPFOR_SYMBOL(bitfpack64_54)
+#define bitfpack64_55 OM_TURBOPFOR_SYMBOL(bitfpack64_55)
+#define bitfpack64_56 OM_TURBOPFOR_SYMBOL(bitfpack64_56)
+#define bitfpack64_57 OM_TURBOPFOR_SYMBOL(bitfpack64_57)
+#define bitfpack64_58 OM_TURBOPFOR_SYMBOL(bitfpack64_58)
+#define bitfpack64_59 OM_TURBOPFOR_SYMBOL(bitfpack64_59)
+#define bitfpack64_6 OM_TURBOPFOR_SYMBOL(bitfpack64_6)
+#define bitfpack64_60 OM_TURBOPFOR_SYMBOL(bitfpack64_60)
+#define bitfpack64_61 OM_TURBOPFOR_SYMBOL(bitfpack64_61)
+#define bitfpack64_62 OM_TURBOPFOR_SYMBOL(bitfpack64_62)
+#define bitfpack64_63 OM_TURBOPFOR_SYMBOL(bitfpack64_63)
+#define bitfpack64_64 OM_TURBOPFOR_SYMBOL(bitfpack64_64)
+#define bitfpack64_7 OM_TURBOPFOR_SYMBOL(bitfpack64_7)
+#define bitfpack64_8 OM_TURBOPFOR_SYMBOL(bitfpack64_8)
+#define bitfpack64_9 OM_TURBOPFOR_SYMBOL(bitfpack64_9)
+#define bitfpack8 OM_TURBOPFOR_SYMBOL(bitfpack8)
+#define bitfpack8_0 OM_TURBOPFOR_SYMBOL(bitfpack8_0)
+#define bitfpack8_1 OM_TURBOPFOR_SYMBOL(bitfpack8_1)
+#define bitfpack8_2 OM_TURBOPFOR_SYMBOL(bitfpack8_2)
+#define bitfpack8_3 OM_TURBOPFOR_SYMBOL(bitfpack8_3)
+#define bitfpack8_4 OM_TURBOPFOR_SYMBOL(bitfpack8_4)
+#define bitfpack8_5 OM_TURBOPFOR_SYMBOL(bitfpack8_5)
+#define bitfpack8_6 OM_TURBOPFOR_SYMBOL(bitfpack8_6)
+#define bitfpack8_7 OM_TURBOPFOR_SYMBOL(bitfpack8_7)
+#define bitfpack8_8 OM_TURBOPFOR_SYMBOL(bitfpack8_8)
+#define bitfpacka16 OM_TURBOPFOR_SYMBOL(bitfpacka16)
+#define bitfpacka32 OM_TURBOPFOR_SYMBOL(bitfpacka32)
+#define bitfpacka64 OM_TURBOPFOR_SYMBOL(bitfpacka64)
+#define bitfpacka8 OM_TURBOPFOR_SYMBOL(bitfpacka8)
+#define bitfunpack128v16 OM_TURBOPFOR_SYMBOL(bitfunpack128v16)
+#define bitfunpack128v32 OM_TURBOPFOR_SYMBOL(bitfunpack128v32)
+#define bitfunpack16 OM_TURBOPFOR_SYMBOL(bitfunpack16)
+#define bitfunpack16_0 OM_TURBOPFOR_SYMBOL(bitfunpack16_0)
+#define bitfunpack16_1 OM_TURBOPFOR_SYMBOL(bitfunpack16_1)
+#define bitfunpack16_10 OM_TURBOPFOR_SYMBOL(bitfunpack16_10)
+#define bitfunpack16_11 OM_TURBOPFOR_SYMBOL(bitfunpack16_11)
+#define bitfunpack16_12 OM_TURBOPFOR_SYMBOL(bitfunpack16_12)
+#define bitfunpack16_13 OM_TURBOPFOR_SYMBOL(bitfunpack16_13)
+#define bitfunpack16_14 OM_TURBOPFOR_SYMBOL(bitfunpack16_14)
+#define bitfunpack16_15 OM_TURBOPFOR_SYMBOL(bitfunpack16_15)
+#define bitfunpack16_16 OM_TURBOPFOR_SYMBOL(bitfunpack16_16)
+#define bitfunpack16_2 OM_TURBOPFOR_SYMBOL(bitfunpack16_2)
+#define bitfunpack16_3 OM_TURBOPFOR_SYMBOL(bitfunpack16_3)
+#define bitfunpack16_4 OM_TURBOPFOR_SYMBOL(bitfunpack16_4)
+#define bitfunpack16_5 OM_TURBOPFOR_SYMBOL(bitfunpack16_5)
+#define bitfunpack16_6 OM_TURBOPFOR_SYMBOL(bitfunpack16_6)
+#define bitfunpack16_7 OM_TURBOPFOR_SYMBOL(bitfunpack16_7)
+#define bitfunpack16_8 OM_TURBOPFOR_SYMBOL(bitfunpack16_8)
+#define bitfunpack16_9 OM_TURBOPFOR_SYMBOL(bitfunpack16_9)
+#define bitfunpack32 OM_TURBOPFOR_SYMBOL(bitfunpack32)
+#define bitfunpack32_0 OM_TURBOPFOR_SYMBOL(bitfunpack32_0)
+#define bitfunpack32_1 OM_TURBOPFOR_SYMBOL(bitfunpack32_1)
+#define bitfunpack32_10 OM_TURBOPFOR_SYMBOL(bitfunpack32_10)
+#define bitfunpack32_11 OM_TURBOPFOR_SYMBOL(bitfunpack32_11)
+#define bitfunpack32_12 OM_TURBOPFOR_SYMBOL(bitfunpack32_12)
+#define bitfunpack32_13 OM_TURBOPFOR_SYMBOL(bitfunpack32_13)
+#define bitfunpack32_14 OM_TURBOPFOR_SYMBOL(bitfunpack32_14)
+#define bitfunpack32_15 OM_TURBOPFOR_SYMBOL(bitfunpack32_15)
+#define bitfunpack32_16 OM_TURBOPFOR_SYMBOL(bitfunpack32_16)
+#define bitfunpack32_17 OM_TURBOPFOR_SYMBOL(bitfunpack32_17)
+#define bitfunpack32_18 OM_TURBOPFOR_SYMBOL(bitfunpack32_18)
+#define bitfunpack32_19 OM_TURBOPFOR_SYMBOL(bitfunpack32_19)
+#define bitfunpack32_2 OM_TURBOPFOR_SYMBOL(bitfunpack32_2)
+#define bitfunpack32_20 OM_TURBOPFOR_SYMBOL(bitfunpack32_20)
+#define bitfunpack32_21 OM_TURBOPFOR_SYMBOL(bitfunpack32_21)
+#define bitfunpack32_22 OM_TURBOPFOR_SYMBOL(bitfunpack32_22)
+#define bitfunpack32_23 OM_TURBOPFOR_SYMBOL(bitfunpack32_23)
+#define bitfunpack32_24 OM_TURBOPFOR_SYMBOL(bitfunpack32_24)
+#define bitfunpack32_25 OM_TURBOPFOR_SYMBOL(bitfunpack32_25)
+#define bitfunpack32_26 OM_TURBOPFOR_SYMBOL(bitfunpack32_26)
+#define bitfunpack32_27 OM_TURBOPFOR_SYMBOL(bitfunpack32_27)
+#define bitfunpack32_28 OM_TURBOPFOR_SYMBOL(bitfunpack32_28)
+#define bitfunpack32_29 OM_TURBOPFOR_SYMBOL(bitfunpack32_29)
+#define bitfunpack32_3 OM_TURBOPFOR_SYMBOL(bitfunpack32_3)
+#define bitfunpack32_30 OM_TURBOPFOR_SYMBOL(bitfunpack32_30)
+#define bitfunpack32_31 OM_TURBOPFOR_SYMBOL(bitfunpack32_31)
+#define bitfunpack32_32 OM_TURBOPFOR_SYMBOL(bitfunpack32_32)
+#define bitfunpack32_4 OM_TURBOPFOR_SYMBOL(bitfunpack32_4)
+#define bitfunpack32_5 OM_TURBOPFOR_SYMBOL(bitfunpack32_5)
+#define bitfunpack32_6 OM_TURBOPFOR_SYMBOL(bitfunpack32_6)
+#define bitfunpack32_7 OM_TURBOPFOR_SYMBOL(bitfunpack32_7)
+#define bitfunpack32_8 OM_TURBOPFOR_SYMBOL(bitfunpack32_8)
+#define bitfunpack32_9 OM_TURBOPFOR_SYMBOL(bitfunpack32_9)
+#define bitfunpack64 OM_TURBOPFOR_SYMBOL(bitfunpack64)
+#define bitfunpack64_0 OM_TURBOPFOR_SYMBOL(bitfunpack64_0)
+#define bitfunpack64_1 OM_TURBOPFOR_SYMBOL(bitfunpack64_1)
+#define bitfunpack64_10 OM_TURBOPFOR_SYMBOL(bitfunpack64_10)
+#define bitfunpack64_11 OM_TURBOPFOR_SYMBOL(bitfunpack64_11)
+#define bitfunpack64_12 OM_TURBOPFOR_SYMBOL(bitfunpack64_12)
+#define bitfunpack64_13 OM_TURBOPFOR_SYMBOL(bitfunpack64_13)
+#define bitfunpack64_14 OM_TURBOPFOR_SYMBOL(bitfunpack64_14)
+#define bitfunpack64_15 OM_TURBOPFOR_SYMBOL(bitfunpack64_15)
+#define bitfunpack64_16 OM_TURBOPFOR_SYMBOL(bitfunpack64_16)
+#define bitfunpack64_17 OM_TURBOPFOR_SYMBOL(bitfunpack64_17)
+#define bitfunpack64_18 OM_TURBOPFOR_SYMBOL(bitfunpack64_18)
+#define bitfunpack64_19 OM_TURBOPFOR_SYMBOL(bitfunpack64_19)
+#define bitfunpack64_2 OM_TURBOPFOR_SYMBOL(bitfunpack64_2)
+#define bitfunpack64_20 OM_TURBOPFOR_SYMBOL(bitfunpack64_20)
+#define bitfunpack64_21 OM_TURBOPFOR_SYMBOL(bitfunpack64_21)
+#define bitfunpack64_22 OM_TURBOPFOR_SYMBOL(bitfunpack64_22)
+#define bitfunpack64_23 OM_TURBOPFOR_SYMBOL(bitfunpack64_23)
+#define bitfunpack64_24 OM_TURBOPFOR_SYMBOL(bitfunpack64_24)
+#define bitfunpack64_25 OM_TURBOPFOR_SYMBOL(bitfunpack64_25)
+#define bitfunpack64_26 OM_TURBOPFOR_SYMBOL(bitfunpack64_26)
+#define bitfunpack64_27 OM_TURBOPFOR_SYMBOL(bitfunpack64_27)
+#define bitfunpack64_28 OM_TURBOPFOR_SYMBOL(bitfunpack64_28)
+#define bitfunpack64_29 OM_TURBOPFOR_SYMBOL(bitfunpack64_29)
+#define bitfunpack64_3 OM_TURBOPFOR_SYMBOL(bitfunpack64_3)
+#define bitfunpack64_30 OM_TURBOPFOR_SYMBOL(bitfunpack64_30)
+#define bitfunpack64_31 OM_TURBOPFOR_SYMBOL(bitfunpack64_31)
+#define bitfunpack64_32 OM_TURBOPFOR_SYMBOL(bitfunpack64_32)
+#define bitfunpack64_33 OM_TURBOPFOR_SYMBOL(bitfunpack64_33)
+#define bitfunpack64_34 OM_TURBOPFOR_SYMBOL(bitfunpack64_34)
+#define bitfunpack64_35 OM_TURBOPFOR_SYMBOL(bitfunpack64_35)
+#define bitfunpack64_36 OM_TURBOPFOR_SYMBOL(bitfunpack64_36)
+#define bitfunpack64_37 OM_TURBOPFOR_SYMBOL(bitfunpack64_37)
+#define bitfunpack64_38 OM_TURBOPFOR_SYMBOL(bitfunpack64_38)
+#define bitfunpack64_39 OM_TURBOPFOR_SYMBOL(bitfunpack64_39)
+#define bitfunpack64_4 OM_TURBOPFOR_SYMBOL(bitfunpack64_4)
+#define bitfunpack64_40 OM_TURBOPFOR_SYMBOL(bitfunpack64_40)
+#define bitfunpack64_41 OM_TURBOPFOR_SYMBOL(bitfunpack64_41)
+#define bitfunpack64_42 OM_TURBOPFOR_SYMBOL(bitfunpack64_42)
+#define bitfunpack64_43 OM_TURBOPFOR_SYMBOL(bitfunpack64_43)
+#define bitfunpack64_44 OM_TURBOPFOR_SYMBOL(bitfunpack64_44)
+#define bitfunpack64_45 OM_TURBOPFOR_SYMBOL(bitfunpack64_45)
+#define bitfunpack64_46 OM_TURBOPFOR_SYMBOL(bitfunpack64_46)
+#define bitfunpack64_47 OM_TURBOPFOR_SYMBOL(bitfunpack64_47)
+#define bitfunpack64_48 OM_TURBOPFOR_SYMBOL(bitfunpack64_48)
+#define bitfunpack64_49 OM_TURBOPFOR_SYMBOL(bitfunpack64_49)
+#define bitfunpack64_5 OM_TURBOPFOR_SYMBOL(bitfunpack64_5)
+#define bitfunpack64_50 OM_TURBOPFOR_SYMBOL(bitfunpack64_50)
+#define bitfunpack64_51 OM_TURBOPFOR_SYMBOL(bitfunpack64_51)
+#define bitfunpack64_52 OM_TURBOPFOR_SYMBOL(bitfunpack64_52)
+#define bitfunpack64_53 OM_TURBOPFOR_SYMBOL(bitfunpack64_53)
+#define bitfunpack64_54 OM_TURBOPFOR_SYMBOL(bitfunpack64_54)
+#define bitfunpack64_55 OM_TURBOPFOR_SYMBOL(bitfunpack64_55)
+#define bitfunpack64_56 OM_TURBOPFOR_SYMBOL(bitfunpack64_56)
+#define bitfunpack64_57 OM_TURBOPFOR_SYMBOL(bitfunpack64_57)
+#define bitfunpack64_58 OM_TURBOPFOR_SYMBOL(bitfunpack64_58)
+#define bitfunpack64_59 OM_TURBOPFOR_SYMBOL(bitfunpack64_59)
+#define bitfunpack64_6 OM_TURBOPFOR_SYMBOL(bitfunpack64_6)
+#define bitfunpack64_60 OM_TURBOPFOR_SYMBOL(bitfunpack64_60)
+#define bitfunpack64_61 OM_TURBOPFOR_SYMBOL(bitfunpack64_61)
+#define bitfunpack64_62 OM_TURBOPFOR_SYMBOL(bitfunpack64_62)
+#define bitfunpack64_63 OM_TURBOPFOR_SYMBOL(bitfunpack64_63)
+#define bitfunpack64_64 OM_TURBOPFOR_SYMBOL(bitfunpack64_64)
+#define bitfunpack64_7 OM_TURBOPFOR_SYMBOL(bitfunpack64_7)
+#define bitfunpack64_8 OM_TURBOPFOR_SYMBOL(bitfunpack64_8)
+#define bitfunpack64_9 OM_TURBOPFOR_SYMBOL(bitfunpack64_9)
+#define bitfunpack8 OM_TURBOPFOR_SYMBOL(bitfunpack8)
+#define bitfunpack8_0 OM_TURBOPFOR_SYMBOL(bitfunpack8_0)
+#define bitfunpack8_1 OM_TURBOPFOR_SYMBOL(bitfunpack8_1)
+#define bitfunpack8_2 OM_TURBOPFOR_SYMBOL(bitfunpack8_2)
+#define bitfunpack8_3 OM_TURBOPFOR_SYMBOL(bitfunpack8_3)
+#define bitfunpack8_4 OM_TURBOPFOR_SYMBOL(bitfunpack8_4)
+#define bitfunpack8_5 OM_TURBOPFOR_SYMBOL(bitfunpack8_5)
+#define bitfunpack8_6 OM_TURBOPFOR_SYMBOL(bitfunpack8_6)
+#define bitfunpack8_7 OM_TURBOPFOR_SYMBOL(bitfunpack8_7)
+#define bitfunpack8_8 OM_TURBOPFOR_SYMBOL(bitfunpack8_8)
+#define bitfunpacka16 OM_TURBOPFOR_SYMBOL(bitfunpacka16)
+#define bitfunpacka32 OM_TURBOPFOR_SYMBOL(bitfunpacka32)
+#define bitfunpacka64 OM_TURBOPFOR_SYMBOL(bitfunpacka64)
+#define bitfunpacka8 OM_TURBOPFOR_SYMBOL(bitfunpacka8)
+#define bitnd1pack128v16 OM_TURBOPFOR_SYMBOL(bitnd1pack128v16)
+#define bitnd1pack128v32 OM_TURBOPFOR_SYMBOL(bitnd1pack128v32)
+#define bitnd1pack16 OM_TURBOPFOR_SYMBOL(bitnd1pack16)
+#define bitnd1pack32 OM_TURBOPFOR_SYMBOL(bitnd1pack32)
+#define bitnd1pack64 OM_TURBOPFOR_SYMBOL(bitnd1pack64)
+#define bitnd1pack8 OM_TURBOPFOR_SYMBOL(bitnd1pack8)
+#define bitnd1unpack128v16 OM_TURBOPFOR_SYMBOL(bitnd1unpack128v16)
+#define bitnd1unpack128v32 OM_TURBOPFOR_SYMBOL(bitnd1unpack128v32)
+#define bitnd1unpack16 OM_TURBOPFOR_SYMBOL(bitnd1unpack16)
+#define bitnd1unpack32 OM_TURBOPFOR_SYMBOL(bitnd1unpack32)
+#define bitnd1unpack64 OM_TURBOPFOR_SYMBOL(bitnd1unpack64)
+#define bitnd1unpack8 OM_TURBOPFOR_SYMBOL(bitnd1unpack8)
+#define bitndpack128v16 OM_TURBOPFOR_SYMBOL(bitndpack128v16)
+#define bitndpack128v32 OM_TURBOPFOR_SYMBOL(bitndpack128v32)
+#define bitndpack16 OM_TURBOPFOR_SYMBOL(bitndpack16)
+#define bitndpack32 OM_TURBOPFOR_SYMBOL(bitndpack32)
+#define bitndpack64 OM_TURBOPFOR_SYMBOL(bitndpack64)
+#define bitndpack8 OM_TURBOPFOR_SYMBOL(bitndpack8)
+#define bitndunpack128v16 OM_TURBOPFOR_SYMBOL(bitndunpack128v16)
+#define bitndunpack128v32 OM_TURBOPFOR_SYMBOL(bitndunpack128v32)
+#define bitndunpack16 OM_TURBOPFOR_SYMBOL(bitndunpack16)
+#define bitndunpack32 OM_TURBOPFOR_SYMBOL(bitndunpack32)
+#define bitndunpack64 OM_TURBOPFOR_SYMBOL(bitndunpack64)
+#define bitndunpack8 OM_TURBOPFOR_SYMBOL(bitndunpack8)
+#define bitnfpack128v16 OM_TURBOPFOR_SYMBOL(bitnfpack128v16)
+#define bitnfpack128v32 OM_TURBOPFOR_SYMBOL(bitnfpack128v32)
+#define bitnfpack16 OM_TURBOPFOR_SYMBOL(bitnfpack16)
+#define bitnfpack32 OM_TURBOPFOR_SYMBOL(bitnfpack32)
+#define bitnfpack64 OM_TURBOPFOR_SYMBOL(bitnfpack64)
+#define bitnfpack8 OM_TURBOPFOR_SYMBOL(bitnfpack8)
+#define bitnfunpack128v16 OM_TURBOPFOR_SYMBOL(bitnfunpack128v16)
+#define bitnfunpack128v32 OM_TURBOPFOR_SYMBOL(bitnfunpack128v32)
+#define bitnfunpack16 OM_TURBOPFOR_SYMBOL(bitnfunpack16)
+#define bitnfunpack32 OM_TURBOPFOR_SYMBOL(bitnfunpack32)
+#define bitnfunpack64 OM_TURBOPFOR_SYMBOL(bitnfunpack64)
+#define bitnfunpack8 OM_TURBOPFOR_SYMBOL(bitnfunpack8)
+#define bitnpack128v16 OM_TURBOPFOR_SYMBOL(bitnpack128v16)
+#define bitnpack128v32 OM_TURBOPFOR_SYMBOL(bitnpack128v32)
+#define bitnpack128v64 OM_TURBOPFOR_SYMBOL(bitnpack128v64)
+#define bitnpack16 OM_TURBOPFOR_SYMBOL(bitnpack16)
+#define bitnpack256w32 OM_TURBOPFOR_SYMBOL(bitnpack256w32)
+#define bitnpack32 OM_TURBOPFOR_SYMBOL(bitnpack32)
+#define bitnpack64 OM_TURBOPFOR_SYMBOL(bitnpack64)
+#define bitnpack8 OM_TURBOPFOR_SYMBOL(bitnpack8)
+#define bitns1pack128v16 OM_TURBOPFOR_SYMBOL(bitns1pack128v16)
+#define bitns1pack128v32 OM_TURBOPFOR_SYMBOL(bitns1pack128v32)
+#define bitns1unpack128v16 OM_TURBOPFOR_SYMBOL(bitns1unpack128v16)
+#define bitns1unpack128v32 OM_TURBOPFOR_SYMBOL(bitns1unpack128v32)
+#define bitnunpack128v16 OM_TURBOPFOR_SYMBOL(bitnunpack128v16)
+#define bitnunpack128v32 OM_TURBOPFOR_SYMBOL(bitnunpack128v32)
+#define bitnunpack128v64 OM_TURBOPFOR_SYMBOL(bitnunpack128v64)
+#define bitnunpack16 OM_TURBOPFOR_SYMBOL(bitnunpack16)
+#define bitnunpack256w32 OM_TURBOPFOR_SYMBOL(bitnunpack256w32)
+#define bitnunpack32 OM_TURBOPFOR_SYMBOL(bitnunpack32)
+#define bitnunpack64 OM_TURBOPFOR_SYMBOL(bitnunpack64)
+#define bitnunpack8 OM_TURBOPFOR_SYMBOL(bitnunpack8)
+#define bitnzpack128v16 OM_TURBOPFOR_SYMBOL(bitnzpack128v16)
+#define bitnzpack128v32 OM_TURBOPFOR_SYMBOL(bitnzpack128v32)
+#define bitnzpack16 OM_TURBOPFOR_SYMBOL(bitnzpack16)
+#define bitnzpack32 OM_TURBOPFOR_SYMBOL(bitnzpack32)
+#define bitnzpack64 OM_TURBOPFOR_SYMBOL(bitnzpack64)
+#define bitnzpack8 OM_TURBOPFOR_SYMBOL(bitnzpack8)
+#define bitnzunpack128v16 OM_TURBOPFOR_SYMBOL(bitnzunpack128v16)
+#define bitnzunpack128v32 OM_TURBOPFOR_SYMBOL(bitnzunpack128v32)
+#define bitnzunpack16 OM_TURBOPFOR_SYMBOL(bitnzunpack16)
+#define bitnzunpack32 OM_TURBOPFOR_SYMBOL(bitnzunpack32)
+#define bitnzunpack64 OM_TURBOPFOR_SYMBOL(bitnzunpack64)
+#define bitnzunpack8 OM_TURBOPFOR_SYMBOL(bitnzunpack8)
+#define bitpack128v16 OM_TURBOPFOR_SYMBOL(bitpack128v16)
+#define bitpack128v32 OM_TURBOPFOR_SYMBOL(bitpack128v32)
+#define bitpack128v64 OM_TURBOPFOR_SYMBOL(bitpack128v64)
+#define bitpack16 OM_TURBOPFOR_SYMBOL(bitpack16)
+#define bitpack16_0 OM_TURBOPFOR_SYMBOL(bitpack16_0)
+#define bitpack16_1 OM_TURBOPFOR_SYMBOL(bitpack16_1)
+#define bitpack16_10 OM_TURBOPFOR_SYMBOL(bitpack16_10)
+#define bitpack16_11 OM_TURBOPFOR_SYMBOL(bitpack16_11)
+#define bitpack16_12 OM_TURBOPFOR_SYMBOL(bitpack16_12)
+#define bitpack16_13 OM_TURBOPFOR_SYMBOL(bitpack16_13)
+#define bitpack16_14 OM_TURBOPFOR_SYMBOL(bitpack16_14)
+#define bitpack16_15 OM_TURBOPFOR_SYMBOL(bitpack16_15)
+#define bitpack16_16 OM_TURBOPFOR_SYMBOL(bitpack16_16)
+#define bitpack16_2 OM_TURBOPFOR_SYMBOL(bitpack16_2)
+#define bitpack16_3 OM_TURBOPFOR_SYMBOL(bitpack16_3)
+#define bitpack16_4 OM_TURBOPFOR_SYMBOL(bitpack16_4)
+#define bitpack16_5 OM_TURBOPFOR_SYMBOL(bitpack16_5)
+#define bitpack16_6 OM_TURBOPFOR_SYMBOL(bitpack16_6)
+#define bitpack16_7 OM_TURBOPFOR_SYMBOL(bitpack16_7)
+#define bitpack16_8 OM_TURBOPFOR_SYMBOL(bitpack16_8)
+#define bitpack16_9 OM_TURBOPFOR_SYMBOL(bitpack16_9)
+#define bitpack256w32 OM_TURBOPFOR_SYMBOL(bitpack256w32)
+#define bitpack32 OM_TURBOPFOR_SYMBOL(bitpack32)
+#define bitpack32_0 OM_TURBOPFOR_SYMBOL(bitpack32_0)
+#define bitpack32_1 OM_TURBOPFOR_SYMBOL(bitpack32_1)
+#define bitpack32_10 OM_TURBOPFOR_SYMBOL(bitpack32_10)
+#define bitpack32_11 OM_TURBOPFOR_SYMBOL(bitpack32_11)
+#define bitpack32_12 OM_TURBOPFOR_SYMBOL(bitpack32_12)
+#define bitpack32_13 OM_TURBOPFOR_SYMBOL(bitpack32_13)
+#define bitpack32_14 OM_TURBOPFOR_SYMBOL(bitpack32_14)
+#define bitpack32_15 OM_TURBOPFOR_SYMBOL(bitpack32_15)
+#define bitpack32_16 OM_TURBOPFOR_SYMBOL(bitpack32_16)
+#define bitpack32_17 OM_TURBOPFOR_SYMBOL(bitpack32_17)
+#define bitpack32_18 OM_TURBOPFOR_SYMBOL(bitpack32_18)
+#define bitpack32_19 OM_TURBOPFOR_SYMBOL(bitpack32_19)
+#define bitpack32_2 OM_TURBOPFOR_SYMBOL(bitpack32_2)
+#define bitpack32_20 OM_TURBOPFOR_SYMBOL(bitpack32_20)
+#define bitpack32_21 OM_TURBOPFOR_SYMBOL(bitpack32_21)
+#define bitpack32_22 OM_TURBOPFOR_SYMBOL(bitpack32_22)
+#define bitpack32_23 OM_TURBOPFOR_SYMBOL(bitpack32_23)
+#define bitpack32_24 OM_TURBOPFOR_SYMBOL(bitpack32_24)
+#define bitpack32_25 OM_TURBOPFOR_SYMBOL(bitpack32_25)
+#define bitpack32_26 OM_TURBOPFOR_SYMBOL(bitpack32_26)
+#define bitpack32_27 OM_TURBOPFOR_SYMBOL(bitpack32_27)
+#define bitpack32_28 OM_TURBOPFOR_SYMBOL(bitpack32_28)
+#define bitpack32_29 OM_TURBOPFOR_SYMBOL(bitpack32_29)
+#define bitpack32_3 OM_TURBOPFOR_SYMBOL(bitpack32_3)
+#define bitpack32_30 OM_TURBOPFOR_SYMBOL(bitpack32_30)
+#define bitpack32_31 OM_TURBOPFOR_SYMBOL(bitpack32_31)
+#define bitpack32_32 OM_TURBOPFOR_SYMBOL(bitpack32_32)
+#define bitpack32_4 OM_TURBOPFOR_SYMBOL(bitpack32_4)
+#define bitpack32_5 OM_TURBOPFOR_SYMBOL(bitpack32_5)
+#define bitpack32_6 OM_TURBOPFOR_SYMBOL(bitpack32_6)
+#define bitpack32_7 OM_TURBOPFOR_SYMBOL(bitpack32_7)
+#define bitpack32_8 OM_TURBOPFOR_SYMBOL(bitpack32_8)
+#define bitpack32_9 OM_TURBOPFOR_SYMBOL(bitpack32_9)
+#define bitpack64 OM_TURBOPFOR_SYMBOL(bitpack64)
+#define bitpack64_0 OM_TURBOPFOR_SYMBOL(bitpack64_0)
+#define bitpack64_1 OM_TURBOPFOR_SYMBOL(bitpack64_1)
+#define bitpack64_10 OM_TURBOPFOR_SYMBOL(bitpack64_10)
+#define bitpack64_11 OM_TURBOPFOR_SYMBOL(bitpack64_11)
+#define bitpack64_12 OM_TURBOPFOR_SYMBOL(bitpack64_12)
+#define bitpack64_13 OM_TURBOPFOR_SYMBOL(bitpack64_13)
+#define bitpack64_14 OM_TURBOPFOR_SYMBOL(bitpack64_14)
+#define bitpack64_15 OM_TURBOPFOR_SYMBOL(bitpack64_15)
+#define bitpack64_16 OM_TURBOPFOR_SYMBOL(bitpack64_16)
+#define bitpack64_17 OM_TURBOPFOR_SYMBOL(bitpack64_17)
+#define bitpack64_18 OM_TURBOPFOR_SYMBOL(bitpack64_18)
+#define bitpack64_19 OM_TURBOPFOR_SYMBOL(bitpack64_19)
+#define bitpack64_2 OM_TURBOPFOR_SYMBOL(bitpack64_2)
+#define bitpack64_20 OM_TURBOPFOR_SYMBOL(bitpack64_20)
+#define bitpack64_21 OM_TURBOPFOR_SYMBOL(bitpack64_21)
+#define bitpack64_22 OM_TURBOPFOR_SYMBOL(bitpack64_22)
+#define bitpack64_23 OM_TURBOPFOR_SYMBOL(bitpack64_23)
+#define bitpack64_24 OM_TURBOPFOR_SYMBOL(bitpack64_24)
+#define bitpack64_25 OM_TURBOPFOR_SYMBOL(bitpack64_25)
+#define bitpack64_26 OM_TURBOPFOR_SYMBOL(bitpack64_26)
+#define bitpack64_27 OM_TURBOPFOR_SYMBOL(bitpack64_27)
+#define bitpack64_28 OM_TURBOPFOR_SYMBOL(bitpack64_28)
+#define bitpack64_29 OM_TURBOPFOR_SYMBOL(bitpack64_29)
+#define bitpack64_3 OM_TURBOPFOR_SYMBOL(bitpack64_3)
+#define bitpack64_30 OM_TURBOPFOR_SYMBOL(bitpack64_30)
+#define bitpack64_31 OM_TURBOPFOR_SYMBOL(bitpack64_31)
+#define bitpack64_32 OM_TURBOPFOR_SYMBOL(bitpack64_32)
+#define bitpack64_33 OM_TURBOPFOR_SYMBOL(bitpack64_33)
+#define bitpack64_34 OM_TURBOPFOR_SYMBOL(bitpack64_34)
+#define bitpack64_35 OM_TURBOPFOR_SYMBOL(bitpack64_35)
+#define bitpack64_36 OM_TURBOPFOR_SYMBOL(bitpack64_36)
+#define bitpack64_37 OM_TURBOPFOR_SYMBOL(bitpack64_37)
+#define bitpack64_38 OM_TURBOPFOR_SYMBOL(bitpack64_38)
+#define bitpack64_39 OM_TURBOPFOR_SYMBOL(bitpack64_39)
+#define bitpack64_4 OM_TURBOPFOR_SYMBOL(bitpack64_4)
+#define bitpack64_40 OM_TURBOPFOR_SYMBOL(bitpack64_40)
+#define bitpack64_41 OM_TURBOPFOR_SYMBOL(bitpack64_41)
+#define bitpack64_42 OM_TURBOPFOR_SYMBOL(bitpack64_42)
+#define bitpack64_43 OM_TURBOPFOR_SYMBOL(bitpack64_43)
+#define bitpack64_44 OM_TURBOPFOR_SYMBOL(bitpack64_44)
+#define bitpack64_45 OM_TURBOPFOR_SYMBOL(bitpack64_45)
+#define bitpack64_46 OM_TURBOPFOR_SYMBOL(bitpack64_46)
+#define bitpack64_47 OM_TURBOPFOR_SYMBOL(bitpack64_47)
+#define bitpack64_48 OM_TURBOPFOR_SYMBOL(bitpack64_48)
+#define bitpack64_49 OM_TURBOPFOR_SYMBOL(bitpack64_49)
+#define bitpack64_5 OM_TURBOPFOR_SYMBOL(bitpack64_5)
+#define bitpack64_50 OM_TURBOPFOR_SYMBOL(bitpack64_50)
+#define bitpack64_51 OM_TURBOPFOR_SYMBOL(bitpack64_51)
+#define bitpack64_52 OM_TURBOPFOR_SYMBOL(bitpack64_52)
+#define bitpack64_53 OM_TURBOPFOR_SYMBOL(bitpack64_53)
+#define bitpack64_54 OM_TURBOPFOR_SYMBOL(bitpack64_54)
+#define bitpack64_55 OM_TURBOPFOR_SYMBOL(bitpack64_55)
+#define bitpack64_56 OM_TURBOPFOR_SYMBOL(bitpack64_56)
+#define bitpack64_57 OM_TURBOPFOR_SYMBOL(bitpack64_57)
+#define bitpack64_58 OM_TURBOPFOR_SYMBOL(bitpack64_58)
+#define bitpack64_59 OM_TURBOPFOR_SYMBOL(bitpack64_59)
+#define bitpack64_6 OM_TURBOPFOR_SYMBOL(bitpack64_6)
+#define bitpack64_60 OM_TURBOPFOR_SYMBOL(bitpack64_60)
+#define bitpack64_61 OM_TURBOPFOR_SYMBOL(bitpack64_61)
+#define bitpack64_62 OM_TURBOPFOR_SYMBOL(bitpack64_62)
+#define bitpack64_63 OM_TURBOPFOR_SYMBOL(bitpack64_63)
+#define bitpack64_64 OM_TURBOPFOR_SYMBOL(bitpack64_64)
+#define bitpack64_7 OM_TURBOPFOR_SYMBOL(bitpack64_7)
+#define bitpack64_8 OM_TURBOPFOR_SYMBOL(bitpack64_8)
+#define bitpack64_9 OM_TURBOPFOR_SYMBOL(bitpack64_9)
+#define bitpack8 OM_TURBOPFOR_SYMBOL(bitpack8)
+#define bitpack8_0 OM_TURBOPFOR_SYMBOL(bitpack8_0)
+#define bitpack8_1 OM_TURBOPFOR_SYMBOL(bitpack8_1)
+#define bitpack8_2 OM_TURBOPFOR_SYMBOL(bitpack8_2)
+#define bitpack8_3 OM_TURBOPFOR_SYMBOL(bitpack8_3)
+#define bitpack8_4 OM_TURBOPFOR_SYMBOL(bitpack8_4)
+#define bitpack8_5 OM_TURBOPFOR_SYMBOL(bitpack8_5)
+#define bitpack8_6 OM_TURBOPFOR_SYMBOL(bitpack8_6)
+#define bitpack8_7 OM_TURBOPFOR_SYMBOL(bitpack8_7)
+#define bitpack8_8 OM_TURBOPFOR_SYMBOL(bitpack8_8)
+#define bitpacka16 OM_TURBOPFOR_SYMBOL(bitpacka16)
+#define bitpacka32 OM_TURBOPFOR_SYMBOL(bitpacka32)
+#define bitpacka64 OM_TURBOPFOR_SYMBOL(bitpacka64)
+#define bitpacka8 OM_TURBOPFOR_SYMBOL(bitpacka8)
+#define bits128v16 OM_TURBOPFOR_SYMBOL(bits128v16)
+#define bits128v32 OM_TURBOPFOR_SYMBOL(bits128v32)
+#define bits1pack128v16 OM_TURBOPFOR_SYMBOL(bits1pack128v16)
+#define bits1pack128v32 OM_TURBOPFOR_SYMBOL(bits1pack128v32)
+#define bits1unpack128v16 OM_TURBOPFOR_SYMBOL(bits1unpack128v16)
+#define bits1unpack128v32 OM_TURBOPFOR_SYMBOL(bits1unpack128v32)
+#define bitunpack128v16 OM_TURBOPFOR_SYMBOL(bitunpack128v16)
+#define bitunpack128v32 OM_TURBOPFOR_SYMBOL(bitunpack128v32)
+#define bitunpack128v64 OM_TURBOPFOR_SYMBOL(bitunpack128v64)
+#define bitunpack16 OM_TURBOPFOR_SYMBOL(bitunpack16)
+#define bitunpack16_0 OM_TURBOPFOR_SYMBOL(bitunpack16_0)
+#define bitunpack16_1 OM_TURBOPFOR_SYMBOL(bitunpack16_1)
+#define bitunpack16_10 OM_TURBOPFOR_SYMBOL(bitunpack16_10)
+#define bitunpack16_11 OM_TURBOPFOR_SYMBOL(bitunpack16_11)
+#define bitunpack16_12 OM_TURBOPFOR_SYMBOL(bitunpack16_12)
+#define bitunpack16_13 OM_TURBOPFOR_SYMBOL(bitunpack16_13)
+#define bitunpack16_14 OM_TURBOPFOR_SYMBOL(bitunpack16_14)
+#define bitunpack16_15 OM_TURBOPFOR_SYMBOL(bitunpack16_15)
+#define bitunpack16_16 OM_TURBOPFOR_SYMBOL(bitunpack16_16)
+#define bitunpack16_2 OM_TURBOPFOR_SYMBOL(bitunpack16_2)
+#define bitunpack16_3 OM_TURBOPFOR_SYMBOL(bitunpack16_3)
+#define bitunpack16_4 OM_TURBOPFOR_SYMBOL(bitunpack16_4)
+#define bitunpack16_5 OM_TURBOPFOR_SYMBOL(bitunpack16_5)
+#define bitunpack16_6 OM_TURBOPFOR_SYMBOL(bitunpack16_6)
+#define bitunpack16_7 OM_TURBOPFOR_SYMBOL(bitunpack16_7)
+#define bitunpack16_8 OM_TURBOPFOR_SYMBOL(bitunpack16_8)
+#define bitunpack16_9 OM_TURBOPFOR_SYMBOL(bitunpack16_9)
+#define bitunpack256w32 OM_TURBOPFOR_SYMBOL(bitunpack256w32)
+#define bitunpack32 OM_TURBOPFOR_SYMBOL(bitunpack32)
+#define bitunpack32_0 OM_TURBOPFOR_SYMBOL(bitunpack32_0)
+#define bitunpack32_1 OM_TURBOPFOR_SYMBOL(bitunpack32_1)
+#define bitunpack32_10 OM_TURBOPFOR_SYMBOL(bitunpack32_10)
+#define bitunpack32_11 OM_TURBOPFOR_SYMBOL(bitunpack32_11)
+#define bitunpack32_12 OM_TURBOPFOR_SYMBOL(bitunpack32_12)
+#define bitunpack32_13 OM_TURBOPFOR_SYMBOL(bitunpack32_13)
+#define bitunpack32_14 OM_TURBOPFOR_SYMBOL(bitunpack32_14)
+#define bitunpack32_15 OM_TURBOPFOR_SYMBOL(bitunpack32_15)
+#define bitunpack32_16 OM_TURBOPFOR_SYMBOL(bitunpack32_16)
+#define bitunpack32_17 OM_TURBOPFOR_SYMBOL(bitunpack32_17)
+#define bitunpack32_18 OM_TURBOPFOR_SYMBOL(bitunpack32_18)
+#define bitunpack32_19 OM_TURBOPFOR_SYMBOL(bitunpack32_19)
+#define bitunpack32_2 OM_TURBOPFOR_SYMBOL(bitunpack32_2)
+#define bitunpack32_20 OM_TURBOPFOR_SYMBOL(bitunpack32_20)
+#define bitunpack32_21 OM_TURBOPFOR_SYMBOL(bitunpack32_21)
+#define bitunpack32_22 OM_TURBOPFOR_SYMBOL(bitunpack32_22)
+#define bitunpack32_23 OM_TURBOPFOR_SYMBOL(bitunpack32_23)
+#define bitunpack32_24 OM_TURBOPFOR_SYMBOL(bitunpack32_24)
+#define bitunpack32_25 OM_TURBOPFOR_SYMBOL(bitunpack32_25)
+#define bitunpack32_26 OM_TURBOPFOR_SYMBOL(bitunpack32_26)
+#define bitunpack32_27 OM_TURBOPFOR_SYMBOL(bitunpack32_27)
+#define bitunpack32_28 OM_TURBOPFOR_SYMBOL(bitunpack32_28)
+#define bitunpack32_29 OM_TURBOPFOR_SYMBOL(bitunpack32_29)
+#define bitunpack32_3 OM_TURBOPFOR_SYMBOL(bitunpack32_3)
+#define bitunpack32_30 OM_TURBOPFOR_SYMBOL(bitunpack32_30)
+#define bitunpack32_31 OM_TURBOPFOR_SYMBOL(bitunpack32_31)
+#define bitunpack32_32 OM_TURBOPFOR_SYMBOL(bitunpack32_32)
+#define bitunpack32_4 OM_TURBOPFOR_SYMBOL(bitunpack32_4)
+#define bitunpack32_5 OM_TURBOPFOR_SYMBOL(bitunpack32_5)
+#define bitunpack32_6 OM_TURBOPFOR_SYMBOL(bitunpack32_6)
+#define bitunpack32_7 OM_TURBOPFOR_SYMBOL(bitunpack32_7)
+#define bitunpack32_8 OM_TURBOPFOR_SYMBOL(bitunpack32_8)
+#define bitunpack32_9 OM_TURBOPFOR_SYMBOL(bitunpack32_9)
+#define bitunpack64 OM_TURBOPFOR_SYMBOL(bitunpack64)
+#define bitunpack64_0 OM_TURBOPFOR_SYMBOL(bitunpack64_0)
+#define bitunpack64_1 OM_TURBOPFOR_SYMBOL(bitunpack64_1)
+#define bitunpack64_10 OM_TURBOPFOR_SYMBOL(bitunpack64_10)
+#define bitunpack64_11 OM_TURBOPFOR_SYMBOL(bitunpack64_11)
+#define bitunpack64_12 OM_TURBOPFOR_SYMBOL(bitunpack64_12)
+#define bitunpack64_13 OM_TURBOPFOR_SYMBOL(bitunpack64_13)
+#define bitunpack64_14 OM_TURBOPFOR_SYMBOL(bitunpack64_14)
+#define bitunpack64_15 OM_TURBOPFOR_SYMBOL(bitunpack64_15)
+#define bitunpack64_16 OM_TURBOPFOR_SYMBOL(bitunpack64_16)
+#define bitunpack64_17 OM_TURBOPFOR_SYMBOL(bitunpack64_17)
+#define bitunpack64_18 OM_TURBOPFOR_SYMBOL(bitunpack64_18)
+#define bitunpack64_19 OM_TURBOPFOR_SYMBOL(bitunpack64_19)
+#define bitunpack64_2 OM_TURBOPFOR_SYMBOL(bitunpack64_2)
+#define bitunpack64_20 OM_TURBOPFOR_SYMBOL(bitunpack64_20)
+#define bitunpack64_21 OM_TURBOPFOR_SYMBOL(bitunpack64_21)
+#define bitunpack64_22 OM_TURBOPFOR_SYMBOL(bitunpack64_22)
+#define bitunpack64_23 OM_TURBOPFOR_SYMBOL(bitunpack64_23)
+#define bitunpack64_24 OM_TURBOPFOR_SYMBOL(bitunpack64_24)
+#define bitunpack64_25 OM_TURBOPFOR_SYMBOL(bitunpack64_25)
+#define bitunpack64_26 OM_TURBOPFOR_SYMBOL(bitunpack64_26)
+#define bitunpack64_27 OM_TURBOPFOR_SYMBOL(bitunpack64_27)
+#define bitunpack64_28 OM_TURBOPFOR_SYMBOL(bitunpack64_28)
+#define bitunpack64_29 OM_TURBOPFOR_SYMBOL(bitunpack64_29)
+#define bitunpack64_3 OM_TURBOPFOR_SYMBOL(bitunpack64_3)
+#define bitunpack64_30 OM_TURBOPFOR_SYMBOL(bitunpack64_30)
+#define bitunpack64_31 OM_TURBOPFOR_SYMBOL(bitunpack64_31)
+#define bitunpack64_32 OM_TURBOPFOR_SYMBOL(bitunpack64_32)
+#define bitunpack64_33 OM_TURBOPFOR_SYMBOL(bitunpack64_33)
+#define bitunpack64_34 OM_TURBOPFOR_SYMBOL(bitunpack64_34)
+#define bitunpack64_35 OM_TURBOPFOR_SYMBOL(bitunpack64_35)
+#define bitunpack64_36 OM_TURBOPFOR_SYMBOL(bitunpack64_36)
+#define bitunpack64_37 OM_TURBOPFOR_SYMBOL(bitunpack64_37)
+#define bitunpack64_38 OM_TURBOPFOR_SYMBOL(bitunpack64_38)
+#define bitunpack64_39 OM_TURBOPFOR_SYMBOL(bitunpack64_39)
+#define bitunpack64_4 OM_TURBOPFOR_SYMBOL(bitunpack64_4)
+#define bitunpack64_40 OM_TURBOPFOR_SYMBOL(bitunpack64_40)
+#define bitunpack64_41 OM_TURBOPFOR_SYMBOL(bitunpack64_41)
+#define bitunpack64_42 OM_TURBOPFOR_SYMBOL(bitunpack64_42)
+#define bitunpack64_43 OM_TURBOPFOR_SYMBOL(bitunpack64_43)
+#define bitunpack64_44 OM_TURBOPFOR_SYMBOL(bitunpack64_44)
+#define bitunpack64_45 OM_TURBOPFOR_SYMBOL(bitunpack64_45)
+#define bitunpack64_46 OM_TURBOPFOR_SYMBOL(bitunpack64_46)
+#define bitunpack64_47 OM_TURBOPFOR_SYMBOL(bitunpack64_47)
+#define bitunpack64_48 OM_TURBOPFOR_SYMBOL(bitunpack64_48)
+#define bitunpack64_49 OM_TURBOPFOR_SYMBOL(bitunpack64_49)
+#define bitunpack64_5 OM_TURBOPFOR_SYMBOL(bitunpack64_5)
+#define bitunpack64_50 OM_TURBOPFOR_SYMBOL(bitunpack64_50)
+#define bitunpack64_51 OM_TURBOPFOR_SYMBOL(bitunpack64_51)
+#define bitunpack64_52 OM_TURBOPFOR_SYMBOL(bitunpack64_52)
+#define bitunpack64_53 OM_TURBOPFOR_SYMBOL(bitunpack64_53)
+#define bitunpack64_54 OM_TURBOPFOR_SYMBOL(bitunpack64_54)
+#define bitunpack64_55 OM_TURBOPFOR_SYMBOL(bitunpack64_55)
+#define bitunpack64_56 OM_TURBOPFOR_SYMBOL(bitunpack64_56)
+#define bitunpack64_57 OM_TURBOPFOR_SYMBOL(bitunpack64_57)
+#define bitunpack64_58 OM_TURBOPFOR_SYMBOL(bitunpack64_58)
+#define bitunpack64_59 OM_TURBOPFOR_SYMBOL(bitunpack64_59)
+#define bitunpack64_6 OM_TURBOPFOR_SYMBOL(bitunpack64_6)
+#define bitunpack64_60 OM_TURBOPFOR_SYMBOL(bitunpack64_60)
+#define bitunpack64_61 OM_TURBOPFOR_SYMBOL(bitunpack64_61)
+#define bitunpack64_62 OM_TURBOPFOR_SYMBOL(bitunpack64_62)
+#define bitunpack64_63 OM_TURBOPFOR_SYMBOL(bitunpack64_63)
+#define bitunpack64_64 OM_TURBOPFOR_SYMBOL(bitunpack64_64)
+#define bitunpack64_7 OM_TURBOPFOR_SYMBOL(bitunpack64_7)
+#define bitunpack64_8 OM_TURBOPFOR_SYMBOL(bitunpack64_8)
+#define bitunpack64_9 OM_TURBOPFOR_SYMBOL(bitunpack64_9)
+#define bitunpack8 OM_TURBOPFOR_SYMBOL(bitunpack8)
+#define bitunpack8_0 OM_TURBOPFOR_SYMBOL(bitunpack8_0)
+#define bitunpack8_1 OM_TURBOPFOR_SYMBOL(bitunpack8_1)
+#define bitunpack8_2 OM_TURBOPFOR_SYMBOL(bitunpack8_2)
+#define bitunpack8_3 OM_TURBOPFOR_SYMBOL(bitunpack8_3)
+#define bitunpack8_4 OM_TURBOPFOR_SYMBOL(bitunpack8_4)
+#define bitunpack8_5 OM_TURBOPFOR_SYMBOL(bitunpack8_5)
+#define bitunpack8_6 OM_TURBOPFOR_SYMBOL(bitunpack8_6)
+#define bitunpack8_7 OM_TURBOPFOR_SYMBOL(bitunpack8_7)
+#define bitunpack8_8 OM_TURBOPFOR_SYMBOL(bitunpack8_8)
+#define bitunpacka16 OM_TURBOPFOR_SYMBOL(bitunpacka16)
+#define bitunpacka32 OM_TURBOPFOR_SYMBOL(bitunpacka32)
+#define bitunpacka64 OM_TURBOPFOR_SYMBOL(bitunpacka64)
+#define bitunpacka8 OM_TURBOPFOR_SYMBOL(bitunpacka8)
+#define bitxdec16 OM_TURBOPFOR_SYMBOL(bitxdec16)
+#define bitxdec32 OM_TURBOPFOR_SYMBOL(bitxdec32)
+#define bitxdec64 OM_TURBOPFOR_SYMBOL(bitxdec64)
+#define bitxdec8 OM_TURBOPFOR_SYMBOL(bitxdec8)
+#define bitxenc16 OM_TURBOPFOR_SYMBOL(bitxenc16)
+#define bitxenc32 OM_TURBOPFOR_SYMBOL(bitxenc32)
+#define bitxenc64 OM_TURBOPFOR_SYMBOL(bitxenc64)
+#define bitxenc8 OM_TURBOPFOR_SYMBOL(bitxenc8)
+#define bitz16 OM_TURBOPFOR_SYMBOL(bitz16)
+#define bitz32 OM_TURBOPFOR_SYMBOL(bitz32)
+#define bitz64 OM_TURBOPFOR_SYMBOL(bitz64)
+#define bitz8 OM_TURBOPFOR_SYMBOL(bitz8)
+#define bitzdec16 OM_TURBOPFOR_SYMBOL(bitzdec16)
+#define bitzdec32 OM_TURBOPFOR_SYMBOL(bitzdec32)
+#define bitzdec64 OM_TURBOPFOR_SYMBOL(bitzdec64)
+#define bitzdec8 OM_TURBOPFOR_SYMBOL(bitzdec8)
+#define bitzenc16 OM_TURBOPFOR_SYMBOL(bitzenc16)
+#define bitzenc32 OM_TURBOPFOR_SYMBOL(bitzenc32)
+#define bitzenc64 OM_TURBOPFOR_SYMBOL(bitzenc64)
+#define bitzenc8 OM_TURBOPFOR_SYMBOL(bitzenc8)
+#define bitzpack128v16 OM_TURBOPFOR_SYMBOL(bitzpack128v16)
+#define bitzpack128v32 OM_TURBOPFOR_SYMBOL(bitzpack128v32)
+#define bitzpack16 OM_TURBOPFOR_SYMBOL(bitzpack16)
+#define bitzpack16_0 OM_TURBOPFOR_SYMBOL(bitzpack16_0)
+#define bitzpack16_1 OM_TURBOPFOR_SYMBOL(bitzpack16_1)
+#define bitzpack16_10 OM_TURBOPFOR_SYMBOL(bitzpack16_10)
+#define bitzpack16_11 OM_TURBOPFOR_SYMBOL(bitzpack16_11)
+#define bitzpack16_12 OM_TURBOPFOR_SYMBOL(bitzpack16_12)
+#define bitzpack16_13 OM_TURBOPFOR_SYMBOL(bitzpack16_13)
+#define bitzpack16_14 OM_TURBOPFOR_SYMBOL(bitzpack16_14)
+#define bitzpack16_15 OM_TURBOPFOR_SYMBOL(bitzpack16_15)
+#define bitzpack16_16 OM_TURBOPFOR_SYMBOL(bitzpack16_16)
+#define bitzpack16_2 OM_TURBOPFOR_SYMBOL(bitzpack16_2)
+#define bitzpack16_3 OM_TURBOPFOR_SYMBOL(bitzpack16_3)
+#define bitzpack16_4 OM_TURBOPFOR_SYMBOL(bitzpack16_4)
+#define bitzpack16_5 OM_TURBOPFOR_SYMBOL(bitzpack16_5)
+#define bitzpack16_6 OM_TURBOPFOR_SYMBOL(bitzpack16_6)
+#define bitzpack16_7 OM_TURBOPFOR_SYMBOL(bitzpack16_7)
+#define bitzpack16_8 OM_TURBOPFOR_SYMBOL(bitzpack16_8)
+#define bitzpack16_9 OM_TURBOPFOR_SYMBOL(bitzpack16_9)
+#define bitzpack32 OM_TURBOPFOR_SYMBOL(bitzpack32)
+#define bitzpack32_0 OM_TURBOPFOR_SYMBOL(bitzpack32_0)
+#define bitzpack32_1 OM_TURBOPFOR_SYMBOL(bitzpack32_1)
+#define bitzpack32_10 OM_TURBOPFOR_SYMBOL(bitzpack32_10)
+#define bitzpack32_11 OM_TURBOPFOR_SYMBOL(bitzpack32_11)
+#define bitzpack32_12 OM_TURBOPFOR_SYMBOL(bitzpack32_12)
+#define bitzpack32_13 OM_TURBOPFOR_SYMBOL(bitzpack32_13)
+#define bitzpack32_14 OM_TURBOPFOR_SYMBOL(bitzpack32_14)
+#define bitzpack32_15 OM_TURBOPFOR_SYMBOL(bitzpack32_15)
+#define bitzpack32_16 OM_TURBOPFOR_SYMBOL(bitzpack32_16)
+#define bitzpack32_17 OM_TURBOPFOR_SYMBOL(bitzpack32_17)
+#define bitzpack32_18 OM_TURBOPFOR_SYMBOL(bitzpack32_18)
+#define bitzpack32_19 OM_TURBOPFOR_SYMBOL(bitzpack32_19)
+#define bitzpack32_2 OM_TURBOPFOR_SYMBOL(bitzpack32_2)
+#define bitzpack32_20 OM_TURBOPFOR_SYMBOL(bitzpack32_20)
+#define bitzpack32_21 OM_TURBOPFOR_SYMBOL(bitzpack32_21)
+#define bitzpack32_22 OM_TURBOPFOR_SYMBOL(bitzpack32_22)
+#define bitzpack32_23 OM_TURBOPFOR_SYMBOL(bitzpack32_23)
+#define bitzpack32_24 OM_TURBOPFOR_SYMBOL(bitzpack32_24)
+#define bitzpack32_25 OM_TURBOPFOR_SYMBOL(bitzpack32_25)
+#define bitzpack32_26 OM_TURBOPFOR_SYMBOL(bitzpack32_26)
+#define bitzpack32_27 OM_TURBOPFOR_SYMBOL(bitzpack32_27)
+#define bitzpack32_28 OM_TURBOPFOR_SYMBOL(bitzpack32_28)
+#define bitzpack32_29 OM_TURBOPFOR_SYMBOL(bitzpack32_29)
+#define bitzpack32_3 OM_TURBOPFOR_SYMBOL(bitzpack32_3)
+#define bitzpack32_30 OM_TURBOPFOR_SYMBOL(bitzpack32_30)
+#define bitzpack32_31 OM_TURBOPFOR_SYMBOL(bitzpack32_31)
+#define bitzpack32_32 OM_TURBOPFOR_SYMBOL(bitzpack32_32)
+#define bitzpack32_4 OM_TURBOPFOR_SYMBOL(bitzpack32_4)
+#define bitzpack32_5 OM_TURBOPFOR_SYMBOL(bitzpack32_5)
+#define bitzpack32_6 OM_TURBOPFOR_SYMBOL(bitzpack32_6)
+#define bitzpack32_7 OM_TURBOPFOR_SYMBOL(bitzpack32_7)
+#define bitzpack32_8 OM_TURBOPFOR_SYMBOL(bitzpack32_8)
+#define bitzpack32_9 OM_TURBOPFOR_SYMBOL(bitzpack32_9)
+#define bitzpack64 OM_TURBOPFOR_SYMBOL(bitzpack64)
+#define bitzpack64_0 OM_TURBOPFOR_SYMBOL(bitzpack64_0)
+#define bitzpack64_1 OM_TURBOPFOR_SYMBOL(bitzpack64_1)
+#define bitzpack64_10 OM_TURBOPFOR_SYMBOL(bitzpack64_10)
+#define bitzpack64_11 OM_TURBOPFOR_SYMBOL(bitzpack64_11)
+#define bitzpack64_12 OM_TURBOPFOR_SYMBOL(bitzpack64_12)
+#define bitzpack64_13 OM_TURBOPFOR_SYMBOL(bitzpack64_13)
+#define bitzpack64_14 OM_TURBOPFOR_SYMBOL(bitzpack64_14)
+#define bitzpack64_15 OM_TURBOPFOR_SYMBOL(bitzpack64_15)
+#define bitzpack64_16 OM_TURBOPFOR_SYMBOL(bitzpack64_16)
+#define bitzpack64_17 OM_TURBOPFOR_SYMBOL(bitzpack64_17)
+#define bitzpack64_18 OM_TURBOPFOR_SYMBOL(bitzpack64_18)
+#define bitzpack64_19 OM_TURBOPFOR_SYMBOL(bitzpack64_19)
+#define bitzpack64_2 OM_TURBOPFOR_SYMBOL(bitzpack64_2)
+#define bitzpack64_20 OM_TURBOPFOR_SYMBOL(bitzpack64_20)
+#define bitzpack64_21 OM_TURBOPFOR_SYMBOL(bitzpack64_21)
+#define bitzpack64_22 OM_TURBOPFOR_SYMBOL(bitzpack64_22)
+#define bitzpack64_23 OM_TURBOPFOR_SYMBOL(bitzpack64_23)
+#define bitzpack64_24 OM_TURBOPFOR_SYMBOL(bitzpack64_24)
+#define bitzpack64_25 OM_TURBOPFOR_SYMBOL(bitzpack64_25)
+#define bitzpack64_26 OM_TURBOPFOR_SYMBOL(bitzpack64_26)
+#define bitzpack64_27 OM_TURBOPFOR_SYMBOL(bitzpack64_27)
+#define bitzpack64_28 OM_TURBOPFOR_SYMBOL(bitzpack64_28)
+#define bitzpack64_29 OM_TURBOPFOR_SYMBOL(bitzpack64_29)
+#define bitzpack64_3 OM_TURBOPFOR_SYMBOL(bitzpack64_3)
+#define bitzpack64_30 OM_TURBOPFOR_SYMBOL(bitzpack64_30)
+#define bitzpack64_31 OM_TURBOPFOR_SYMBOL(bitzpack64_31)
+#define bitzpack64_32 OM_TURBOPFOR_SYMBOL(bitzpack64_32)
+#define bitzpack64_33 OM_TURBOPFOR_SYMBOL(bitzpack64_33)
+#define bitzpack64_34 OM_TURBOPFOR_SYMBOL(bitzpack64_34)
+#define bitzpack64_35 OM_TURBOPFOR_SYMBOL(bitzpack64_35)
+#define bitzpack64_36 OM_TURBOPFOR_SYMBOL(bitzpack64_36)
+#define bitzpack64_37 OM_TURBOPFOR_SYMBOL(bitzpack64_37)
+#define bitzpack64_38 OM_TURBOPFOR_SYMBOL(bitzpack64_38)
+#define bitzpack64_39 OM_TURBOPFOR_SYMBOL(bitzpack64_39)
+#define bitzpack64_4 OM_TURBOPFOR_SYMBOL(bitzpack64_4)
+#define bitzpack64_40 OM_TURBOPFOR_SYMBOL(bitzpack64_40)
+#define bitzpack64_41 OM_TURBOPFOR_SYMBOL(bitzpack64_41)
+#define bitzpack64_42 OM_TURBOPFOR_SYMBOL(bitzpack64_42)
+#define bitzpack64_43 OM_TURBOPFOR_SYMBOL(bitzpack64_43)
+#define bitzpack64_44 OM_TURBOPFOR_SYMBOL(bitzpack64_44)
+#define bitzpack64_45 OM_TURBOPFOR_SYMBOL(bitzpack64_45)
+#define bitzpack64_46 OM_TURBOPFOR_SYMBOL(bitzpack64_46)
+#define bitzpack64_47 OM_TURBOPFOR_SYMBOL(bitzpack64_47)
+#define bitzpack64_48 OM_TURBOPFOR_SYMBOL(bitzpack64_48)
+#define bitzpack64_49 OM_TURBOPFOR_SYMBOL(bitzpack64_49)
+#define bitzpack64_5 OM_TURBOPFOR_SYMBOL(bitzpack64_5)
+#define bitzpack64_50 OM_TURBOPFOR_SYMBOL(bitzpack64_50)
+#define bitzpack64_51 OM_TURBOPFOR_SYMBOL(bitzpack64_51)
+#define bitzpack64_52 OM_TURBOPFOR_SYMBOL(bitzpack64_52)
+#define bitzpack64_53 OM_TURBOPFOR_SYMBOL(bitzpack64_53)
+#define bitzpack64_54 OM_TURBOPFOR_SYMBOL(bitzpack64_54)
+#define bitzpack64_55 OM_TURBOPFOR_SYMBOL(bitzpack64_55)
+#define bitzpack64_56 OM_TURBOPFOR_SYMBOL(bitzpack64_56)
+#define bitzpack64_57 OM_TURBOPFOR_SYMBOL(bitzpack64_57)
+#define bitzpack64_58 OM_TURBOPFOR_SYMBOL(bitzpack64_58)
+#define bitzpack64_59 OM_TURBOPFOR_SYMBOL(bitzpack64_59)
+#define bitzpack64_6 OM_TURBOPFOR_SYMBOL(bitzpack64_6)
+#define bitzpack64_60 OM_TURBOPFOR_SYMBOL(bitzpack64_60)
+#define bitzpack64_61 OM_TURBOPFOR_SYMBOL(bitzpack64_61)
+#define bitzpack64_62 OM_TURBOPFOR_SYMBOL(bitzpack64_62)
+#define bitzpack64_63 OM_TURBOPFOR_SYMBOL(bitzpack64_63)
+#define bitzpack64_64 OM_TURBOPFOR_SYMBOL(bitzpack64_64)
+#define bitzpack64_7 OM_TURBOPFOR_SYMBOL(bitzpack64_7)
+#define bitzpack64_8 OM_TURBOPFOR_SYMBOL(bitzpack64_8)
+#define bitzpack64_9 OM_TURBOPFOR_SYMBOL(bitzpack64_9)
+#define bitzpack8 OM_TURBOPFOR_SYMBOL(bitzpack8)
+#define bitzpack8_0 OM_TURBOPFOR_SYMBOL(bitzpack8_0)
+#define bitzpack8_1 OM_TURBOPFOR_SYMBOL(bitzpack8_1)
+#define bitzpack8_2 OM_TURBOPFOR_SYMBOL(bitzpack8_2)
+#define bitzpack8_3 OM_TURBOPFOR_SYMBOL(bitzpack8_3)
+#define bitzpack8_4 OM_TURBOPFOR_SYMBOL(bitzpack8_4)
+#define bitzpack8_5 OM_TURBOPFOR_SYMBOL(bitzpack8_5)
+#define bitzpack8_6 OM_TURBOPFOR_SYMBOL(bitzpack8_6)
+#define bitzpack8_7 OM_TURBOPFOR_SYMBOL(bitzpack8_7)
+#define bitzpack8_8 OM_TURBOPFOR_SYMBOL(bitzpack8_8)
+#define bitzpacka16 OM_TURBOPFOR_SYMBOL(bitzpacka16)
+#define bitzpacka32 OM_TURBOPFOR_SYMBOL(bitzpacka32)
+#define bitzpacka64 OM_TURBOPFOR_SYMBOL(bitzpacka64)
+#define bitzpacka8 OM_TURBOPFOR_SYMBOL(bitzpacka8)
+#define bitzunpack128v16 OM_TURBOPFOR_SYMBOL(bitzunpack128v16)
+#define bitzunpack128v32 OM_TURBOPFOR_SYMBOL(bitzunpack128v32)
+#define bitzunpack16 OM_TURBOPFOR_SYMBOL(bitzunpack16)
+#define bitzunpack16_0 OM_TURBOPFOR_SYMBOL(bitzunpack16_0)
+#define bitzunpack16_1 OM_TURBOPFOR_SYMBOL(bitzunpack16_1)
+#define bitzunpack16_10 OM_TURBOPFOR_SYMBOL(bitzunpack16_10)
+#define bitzunpack16_11 OM_TURBOPFOR_SYMBOL(bitzunpack16_11)
+#define bitzunpack16_12 OM_TURBOPFOR_SYMBOL(bitzunpack16_12)
+#define bitzunpack16_13 OM_TURBOPFOR_SYMBOL(bitzunpack16_13)
+#define bitzunpack16_14 OM_TURBOPFOR_SYMBOL(bitzunpack16_14)
+#define bitzunpack16_15 OM_TURBOPFOR_SYMBOL(bitzunpack16_15)
+#define bitzunpack16_16 OM_TURBOPFOR_SYMBOL(bitzunpack16_16)
+#define bitzunpack16_2 OM_TURBOPFOR_SYMBOL(bitzunpack16_2)
+#define bitzunpack16_3 OM_TURBOPFOR_SYMBOL(bitzunpack16_3)
+#define bitzunpack16_4 OM_TURBOPFOR_SYMBOL(bitzunpack16_4)
+#define bitzunpack16_5 OM_TURBOPFOR_SYMBOL(bitzunpack16_5)
+#define bitzunpack16_6 OM_TURBOPFOR_SYMBOL(bitzunpack16_6)
+#define bitzunpack16_7 OM_TURBOPFOR_SYMBOL(bitzunpack16_7)
+#define bitzunpack16_8 OM_TURBOPFOR_SYMBOL(bitzunpack16_8)
+#define bitzunpack16_9 OM_TURBOPFOR_SYMBOL(bitzunpack16_9)
+#define bitzunpack32 OM_TURBOPFOR_SYMBOL(bitzunpack32)
+#define bitzunpack32_0 OM_TURBOPFOR_SYMBOL(bitzunpack32_0)
+#define bitzunpack32_1 OM_TURBOPFOR_SYMBOL(bitzunpack32_1)
+#define bitzunpack32_10 OM_TURBOPFOR_SYMBOL(bitzunpack32_10)
+#define bitzunpack32_11 OM_TURBOPFOR_SYMBOL(bitzunpack32_11)
+#define bitzunpack32_12 OM_TURBOPFOR_SYMBOL(bitzunpack32_12)
+#define bitzunpack32_13 OM_TURBOPFOR_SYMBOL(bitzunpack32_13)
+#define bitzunpack32_14 OM_TURBOPFOR_SYMBOL(bitzunpack32_14)
+#define bitzunpack32_15 OM_TURBOPFOR_SYMBOL(bitzunpack32_15)
+#define bitzunpack32_16 OM_TURBOPFOR_SYMBOL(bitzunpack32_16)
+#define bitzunpack32_17 OM_TURBOPFOR_SYMBOL(bitzunpack32_17)
+#define bitzunpack32_18 OM_TURBOPFOR_SYMBOL(bitzunpack32_18)
+#define bitzunpack32_19 OM_TURBOPFOR_SYMBOL(bitzunpack32_19)
+#define bitzunpack32_2 OM_TURBOPFOR_SYMBOL(bitzunpack32_2)
+#define bitzunpack32_20 OM_TURBOPFOR_SYMBOL(bitzunpack32_20)
+#define bitzunpack32_21 OM_TURBOPFOR_SYMBOL(bitzunpack32_21)
+#define bitzunpack32_22 OM_TURBOPFOR_SYMBOL(bitzunpack32_22)
+#define bitzunpack32_23 OM_TURBOPFOR_SYMBOL(bitzunpack32_23)
+#define bitzunpack32_24 OM_TURBOPFOR_SYMBOL(bitzunpack32_24)
+#define bitzunpack32_25 OM_TURBOPFOR_SYMBOL(bitzunpack32_25)
+#define bitzunpack32_26 OM_TURBOPFOR_SYMBOL(bitzunpack32_26)
+#define bitzunpack32_27 OM_TURBOPFOR_SYMBOL(bitzunpack32_27)
+#define bitzunpack32_28 OM_TURBOPFOR_SYMBOL(bitzunpack32_28)
+#define bitzunpack32_29 OM_TURBOPFOR_SYMBOL(bitzunpack32_29)
+#define bitzunpack32_3 OM_TURBOPFOR_SYMBOL(bitzunpack32_3)
+#define bitzunpack32_30 OM_TURBOPFOR_SYMBOL(bitzunpack32_30)
+#define bitzunpack32_31 OM_TURBOPFOR_SYMBOL(bitzunpack32_31)
+#define bitzunpack32_32 OM_TURBOPFOR_SYMBOL(bitzunpack32_32)
+#define bitzunpack32_4 OM_TURBOPFOR_SYMBOL(bitzunpack32_4)
+#define bitzunpack32_5 OM_TURBOPFOR_SYMBOL(bitzunpack32_5)
+#define bitzunpack32_6 OM_TURBOPFOR_SYMBOL(bitzunpack32_6)
+#define bitzunpack32_7 OM_TURBOPFOR_SYMBOL(bitzunpack32_7)
+#define bitzunpack32_8 OM_TURBOPFOR_SYMBOL(bitzunpack32_8)
+#define bitzunpack32_9 OM_TURBOPFOR_SYMBOL(bitzunpack32_9)
+#define bitzunpack64 OM_TURBOPFOR_SYMBOL(bitzunpack64)
+#define bitzunpack64_0 OM_TURBOPFOR_SYMBOL(bitzunpack64_0)
+#define bitzunpack64_1 OM_TURBOPFOR_SYMBOL(bitzunpack64_1)
+#define bitzunpack64_10 OM_TURBOPFOR_SYMBOL(bitzunpack64_10)
+#define bitzunpack64_11 OM_TURBOPFOR_SYMBOL(bitzunpack64_11)
+#define bitzunpack64_12 OM_TURBOPFOR_SYMBOL(bitzunpack64_12)
+#define bitzunpack64_13 OM_TURBOPFOR_SYMBOL(bitzunpack64_13)
+#define bitzunpack64_14 OM_TURBOPFOR_SYMBOL(bitzunpack64_14)
+#define bitzunpack64_15 OM_TURBOPFOR_SYMBOL(bitzunpack64_15)
+#define bitzunpack64_16 OM_TURBOPFOR_SYMBOL(bitzunpack64_16)
+#define bitzunpack64_17 OM_TURBOPFOR_SYMBOL(bitzunpack64_17)
+#define bitzunpack64_18 OM_TURBOPFOR_SYMBOL(bitzunpack64_18)
+#define bitzunpack64_19 OM_TURBOPFOR_SYMBOL(bitzunpack64_19)
+#define bitzunpack64_2 OM_TURBOPFOR_SYMBOL(bitzunpack64_2)
+#define bitzunpack64_20 OM_TURBOPFOR_SYMBOL(bitzunpack64_20)
+#define bitzunpack64_21 OM_TURBOPFOR_SYMBOL(bitzunpack64_21)
+#define bitzunpack64_22 OM_TURBOPFOR_SYMBOL(bitzunpack64_22)
+#define bitzunpack64_23 OM_TURBOPFOR_SYMBOL(bitzunpack64_23)
+#define bitzunpack64_24 OM_TURBOPFOR_SYMBOL(bitzunpack64_24)
+#define bitzunpack64_25 OM_TURBOPFOR_SYMBOL(bitzunpack64_25)
+#define bitzunpack64_26 OM_TURBOPFOR_SYMBOL(bitzunpack64_26)
+#define bitzunpack64_27 OM_TURBOPFOR_SYMBOL(bitzunpack64_27)
+#define bitzunpack64_28 OM_TURBOPFOR_SYMBOL(bitzunpack64_28)
+#define bitzunpack64_29 OM_TURBOPFOR_SYMBOL(bitzunpack64_29)
+#define bitzunpack64_3 OM_TURBOPFOR_SYMBOL(bitzunpack64_3)
+#define bitzunpack64_30 OM_TURBOPFOR_SYMBOL(bitzunpack64_30)
+#define bitzunpack64_31 OM_TURBOPFOR_SYMBOL(bitzunpack64_31)
+#define bitzunpack64_32 OM_TURBOPFOR_SYMBOL(bitzunpack64_32)
+#define bitzunpack64_33 OM_TURBOPFOR_SYMBOL(bitzunpack64_33)
+#define bitzunpack64_34 OM_TURBOPFOR_SYMBOL(bitzunpack64_34)
+#define bitzunpack64_35 OM_TURBOPFOR_SYMBOL(bitzunpack64_35)
+#define bitzunpack64_36 OM_TURBOPFOR_SYMBOL(bitzunpack64_36)
+#define bitzunpack64_37 OM_TURBOPFOR_SYMBOL(bitzunpack64_37)
+#define bitzunpack64_38 OM_TURBOPFOR_SYMBOL(bitzunpack64_38)
+#define bitzunpack64_39 OM_TURBOPFOR_SYMBOL(bitzunpack64_39)
+#define bitzunpack64_4 OM_TURBOPFOR_SYMBOL(bitzunpack64_4)
+#define bitzunpack64_40 OM_TURBOPFOR_SYMBOL(bitzunpack64_40)
+#define bitzunpack64_41 OM_TURBOPFOR_SYMBOL(bitzunpack64_41)
+#define bitzunpack64_42 OM_TURBOPFOR_SYMBOL(bitzunpack64_42)
+#define bitzunpack64_43 OM_TURBOPFOR_SYMBOL(bitzunpack64_43)
+#define bitzunpack64_44 OM_TURBOPFOR_SYMBOL(bitzunpack64_44)
+#define bitzunpack64_45 OM_TURBOPFOR_SYMBOL(bitzunpack64_45)
+#define bitzunpack64_46 OM_TURBOPFOR_SYMBOL(bitzunpack64_46)
+#define bitzunpack64_47 OM_TURBOPFOR_SYMBOL(bitzunpack64_47)
+#define bitzunpack64_48 OM_TURBOPFOR_SYMBOL(bitzunpack64_48)
+#define bitzunpack64_49 OM_TURBOPFOR_SYMBOL(bitzunpack64_49)
+#define bitzunpack64_5 OM_TURBOPFOR_SYMBOL(bitzunpack64_5)
+#define bitzunpack64_50 OM_TURBOPFOR_SYMBOL(bitzunpack64_50)
+#define bitzunpack64_51 OM_TURBOPFOR_SYMBOL(bitzunpack64_51)
+#define bitzunpack64_52 OM_TURBOPFOR_SYMBOL(bitzunpack64_52)
+#define bitzunpack64_53 OM_TURBOPFOR_SYMBOL(bitzunpack64_53)
+#define bitzunpack64_54 OM_TURBOPFOR_SYMBOL(bitzunpack64_54)
+#define bitzunpack64_55 OM_TURBOPFOR_SYMBOL(bitzunpack64_55)
+#define bitzunpack64_56 OM_TURBOPFOR_SYMBOL(bitzunpack64_56)
+#define bitzunpack64_57 OM_TURBOPFOR_SYMBOL(bitzunpack64_57)
+#define bitzunpack64_58 OM_TURBOPFOR_SYMBOL(bitzunpack64_58)
+#define bitzunpack64_59 OM_TURBOPFOR_SYMBOL(bitzunpack64_59)
+#define bitzunpack64_6 OM_TURBOPFOR_SYMBOL(bitzunpack64_6)
+#define bitzunpack64_60 OM_TURBOPFOR_SYMBOL(bitzunpack64_60)
+#define bitzunpack64_61 OM_TURBOPFOR_SYMBOL(bitzunpack64_61)
+#define bitzunpack64_62 OM_TURBOPFOR_SYMBOL(bitzunpack64_62)
+#define bitzunpack64_63 OM_TURBOPFOR_SYMBOL(bitzunpack64_63)
+#define bitzunpack64_64 OM_TURBOPFOR_SYMBOL(bitzunpack64_64)
+#define bitzunpack64_7 OM_TURBOPFOR_SYMBOL(bitzunpack64_7)
+#define bitzunpack64_8 OM_TURBOPFOR_SYMBOL(bitzunpack64_8)
+#define bitzunpack64_9 OM_TURBOPFOR_SYMBOL(bitzunpack64_9)
+#define bitzunpack8 OM_TURBOPFOR_SYMBOL(bitzunpack8)
+#define bitzunpack8_0 OM_TURBOPFOR_SYMBOL(bitzunpack8_0)
+#define bitzunpack8_1 OM_TURBOPFOR_SYMBOL(bitzunpack8_1)
+#define bitzunpack8_2 OM_TURBOPFOR_SYMBOL(bitzunpack8_2)
+#define bitzunpack8_3 OM_TURBOPFOR_SYMBOL(bitzunpack8_3)
+#define bitzunpack8_4 OM_TURBOPFOR_SYMBOL(bitzunpack8_4)
+#define bitzunpack8_5 OM_TURBOPFOR_SYMBOL(bitzunpack8_5)
+#define bitzunpack8_6 OM_TURBOPFOR_SYMBOL(bitzunpack8_6)
+#define bitzunpack8_7 OM_TURBOPFOR_SYMBOL(bitzunpack8_7)
+#define bitzunpack8_8 OM_TURBOPFOR_SYMBOL(bitzunpack8_8)
+#define bitzunpacka16 OM_TURBOPFOR_SYMBOL(bitzunpacka16)
+#define bitzunpacka32 OM_TURBOPFOR_SYMBOL(bitzunpacka32)
+#define bitzunpacka64 OM_TURBOPFOR_SYMBOL(bitzunpacka64)
+#define bitzunpacka8 OM_TURBOPFOR_SYMBOL(bitzunpacka8)
+#define bitzz16 OM_TURBOPFOR_SYMBOL(bitzz16)
+#define bitzz32 OM_TURBOPFOR_SYMBOL(bitzz32)
+#define bitzz64 OM_TURBOPFOR_SYMBOL(bitzz64)
+#define bitzz8 OM_TURBOPFOR_SYMBOL(bitzz8)
+#define bitzzdec16 OM_TURBOPFOR_SYMBOL(bitzzdec16)
+#define bitzzdec32 OM_TURBOPFOR_SYMBOL(bitzzdec32)
+#define bitzzdec64 OM_TURBOPFOR_SYMBOL(bitzzdec64)
+#define bitzzdec8 OM_TURBOPFOR_SYMBOL(bitzzdec8)
+#define bitzzenc16 OM_TURBOPFOR_SYMBOL(bitzzenc16)
+#define bitzzenc32 OM_TURBOPFOR_SYMBOL(bitzzenc32)
+#define bitzzenc64 OM_TURBOPFOR_SYMBOL(bitzzenc64)
+#define bitzzenc8 OM_TURBOPFOR_SYMBOL(bitzzenc8)
+#define bvzdec16 OM_TURBOPFOR_SYMBOL(bvzdec16)
+#define bvzdec32 OM_TURBOPFOR_SYMBOL(bvzdec32)
+#define bvzdec64 OM_TURBOPFOR_SYMBOL(bvzdec64)
+#define bvzdec8 OM_TURBOPFOR_SYMBOL(bvzdec8)
+#define bvzenc16 OM_TURBOPFOR_SYMBOL(bvzenc16)
+#define bvzenc32 OM_TURBOPFOR_SYMBOL(bvzenc32)
+#define bvzenc64 OM_TURBOPFOR_SYMBOL(bvzenc64)
+#define bvzenc8 OM_TURBOPFOR_SYMBOL(bvzenc8)
+#define bvzzdec16 OM_TURBOPFOR_SYMBOL(bvzzdec16)
+#define bvzzdec32 OM_TURBOPFOR_SYMBOL(bvzzdec32)
+#define bvzzdec64 OM_TURBOPFOR_SYMBOL(bvzzdec64)
+#define bvzzdec8 OM_TURBOPFOR_SYMBOL(bvzzdec8)
+#define bvzzenc16 OM_TURBOPFOR_SYMBOL(bvzzenc16)
+#define bvzzenc32 OM_TURBOPFOR_SYMBOL(bvzzenc32)
+#define bvzzenc64 OM_TURBOPFOR_SYMBOL(bvzzenc64)
+#define bvzzenc8 OM_TURBOPFOR_SYMBOL(bvzzenc8)
+#define fp2dfcmdec16 OM_TURBOPFOR_SYMBOL(fp2dfcmdec16)
+#define fp2dfcmdec32 OM_TURBOPFOR_SYMBOL(fp2dfcmdec32)
+#define fp2dfcmdec64 OM_TURBOPFOR_SYMBOL(fp2dfcmdec64)
+#define fp2dfcmdec8 OM_TURBOPFOR_SYMBOL(fp2dfcmdec8)
+#define fp2dfcmenc16 OM_TURBOPFOR_SYMBOL(fp2dfcmenc16)
+#define fp2dfcmenc32 OM_TURBOPFOR_SYMBOL(fp2dfcmenc32)
+#define fp2dfcmenc64 OM_TURBOPFOR_SYMBOL(fp2dfcmenc64)
+#define fp2dfcmenc8 OM_TURBOPFOR_SYMBOL(fp2dfcmenc8)
+#define fpdfcmdec16 OM_TURBOPFOR_SYMBOL(fpdfcmdec16)
+#define fpdfcmdec32 OM_TURBOPFOR_SYMBOL(fpdfcmdec32)
+#define fpdfcmdec64 OM_TURBOPFOR_SYMBOL(fpdfcmdec64)
+#define fpdfcmdec8 OM_TURBOPFOR_SYMBOL(fpdfcmdec8)
+#define fpdfcmenc16 OM_TURBOPFOR_SYMBOL(fpdfcmenc16)
+#define fpdfcmenc32 OM_TURBOPFOR_SYMBOL(fpdfcmenc32)
+#define fpdfcmenc64 OM_TURBOPFOR_SYMBOL(fpdfcmenc64)
+#define fpdfcmenc8 OM_TURBOPFOR_SYMBOL(fpdfcmenc8)
+#define fpfcmdec16 OM_TURBOPFOR_SYMBOL(fpfcmdec16)
+#define fpfcmdec32 OM_TURBOPFOR_SYMBOL(fpfcmdec32)
+#define fpfcmdec64 OM_TURBOPFOR_SYMBOL(fpfcmdec64)
+#define fpfcmdec8 OM_TURBOPFOR_SYMBOL(fpfcmdec8)
+#define fpfcmenc16 OM_TURBOPFOR_SYMBOL(fpfcmenc16)
+#define fpfcmenc32 OM_TURBOPFOR_SYMBOL(fpfcmenc32)
+#define fpfcmenc64 OM_TURBOPFOR_SYMBOL(fpfcmenc64)
+#define fpfcmenc8 OM_TURBOPFOR_SYMBOL(fpfcmenc8)
+#define fpgdec16 OM_TURBOPFOR_SYMBOL(fpgdec16)
+#define fpgdec32 OM_TURBOPFOR_SYMBOL(fpgdec32)
+#define fpgdec64 OM_TURBOPFOR_SYMBOL(fpgdec64)
+#define fpgdec8 OM_TURBOPFOR_SYMBOL(fpgdec8)
+#define fpgenc16 OM_TURBOPFOR_SYMBOL(fpgenc16)
+#define fpgenc32 OM_TURBOPFOR_SYMBOL(fpgenc32)
+#define fpgenc64 OM_TURBOPFOR_SYMBOL(fpgenc64)
+#define fpgenc8 OM_TURBOPFOR_SYMBOL(fpgenc8)
+#define fppad32 OM_TURBOPFOR_SYMBOL(fppad32)
+#define fppad64 OM_TURBOPFOR_SYMBOL(fppad64)
+#define fpxdec16 OM_TURBOPFOR_SYMBOL(fpxdec16)
+#define fpxdec32 OM_TURBOPFOR_SYMBOL(fpxdec32)
+#define fpxdec64 OM_TURBOPFOR_SYMBOL(fpxdec64)
+#define fpxdec8 OM_TURBOPFOR_SYMBOL(fpxdec8)
+#define fpxenc16 OM_TURBOPFOR_SYMBOL(fpxenc16)
+#define fpxenc32 OM_TURBOPFOR_SYMBOL(fpxenc32)
+#define fpxenc64 OM_TURBOPFOR_SYMBOL(fpxenc64)
+#define fpxenc8 OM_TURBOPFOR_SYMBOL(fpxenc8)
+#define p4d1dec128v16 OM_TURBOPFOR_SYMBOL(p4d1dec128v16)
+#define p4d1dec128v32 OM_TURBOPFOR_SYMBOL(p4d1dec128v32)
+#define p4d1dec16 OM_TURBOPFOR_SYMBOL(p4d1dec16)
+#define p4d1dec32 OM_TURBOPFOR_SYMBOL(p4d1dec32)
+#define p4d1dec64 OM_TURBOPFOR_SYMBOL(p4d1dec64)
+#define p4d1dec8 OM_TURBOPFOR_SYMBOL(p4d1dec8)
+#define p4d1enc128v16 OM_TURBOPFOR_SYMBOL(p4d1enc128v16)
+#define p4d1enc128v32 OM_TURBOPFOR_SYMBOL(p4d1enc128v32)
+#define p4d1enc16 OM_TURBOPFOR_SYMBOL(p4d1enc16)
+#define p4d1enc32 OM_TURBOPFOR_SYMBOL(p4d1enc32)
+#define p4d1enc64 OM_TURBOPFOR_SYMBOL(p4d1enc64)
+#define p4d1enc8 OM_TURBOPFOR_SYMBOL(p4d1enc8)
+#define p4ddec128v16 OM_TURBOPFOR_SYMBOL(p4ddec128v16)
+#define p4ddec128v32 OM_TURBOPFOR_SYMBOL(p4ddec128v32)
+#define p4ddec16 OM_TURBOPFOR_SYMBOL(p4ddec16)
+#define p4ddec32 OM_TURBOPFOR_SYMBOL(p4ddec32)
+#define p4ddec64 OM_TURBOPFOR_SYMBOL(p4ddec64)
+#define p4ddec8 OM_TURBOPFOR_SYMBOL(p4ddec8)
+#define p4dec128v16 OM_TURBOPFOR_SYMBOL(p4dec128v16)
+#define p4dec128v32 OM_TURBOPFOR_SYMBOL(p4dec128v32)
+#define p4dec128v64 OM_TURBOPFOR_SYMBOL(p4dec128v64)
+#define p4dec16 OM_TURBOPFOR_SYMBOL(p4dec16)
+#define p4dec256w32 OM_TURBOPFOR_SYMBOL(p4dec256w32)
+#define p4dec32 OM_TURBOPFOR_SYMBOL(p4dec32)
+#define p4dec64 OM_TURBOPFOR_SYMBOL(p4dec64)
+#define p4dec8 OM_TURBOPFOR_SYMBOL(p4dec8)
+#define p4denc128v16 OM_TURBOPFOR_SYMBOL(p4denc128v16)
+#define p4denc128v32 OM_TURBOPFOR_SYMBOL(p4denc128v32)
+#define p4denc16 OM_TURBOPFOR_SYMBOL(p4denc16)
+#define p4denc32 OM_TURBOPFOR_SYMBOL(p4denc32)
+#define p4denc64 OM_TURBOPFOR_SYMBOL(p4denc64)
+#define p4denc8 OM_TURBOPFOR_SYMBOL(p4denc8)
+#define p4enc128v16 OM_TURBOPFOR_SYMBOL(p4enc128v16)
+#define p4enc128v32 OM_TURBOPFOR_SYMBOL(p4enc128v32)
+#define p4enc128v64 OM_TURBOPFOR_SYMBOL(p4enc128v64)
+#define p4enc16 OM_TURBOPFOR_SYMBOL(p4enc16)
+#define p4enc32 OM_TURBOPFOR_SYMBOL(p4enc32)
+#define p4enc64 OM_TURBOPFOR_SYMBOL(p4enc64)
+#define p4enc8 OM_TURBOPFOR_SYMBOL(p4enc8)
+#define p4nd1dec128v16 OM_TURBOPFOR_SYMBOL(p4nd1dec128v16)
+#define p4nd1dec128v32 OM_TURBOPFOR_SYMBOL(p4nd1dec128v32)
+#define p4nd1dec16 OM_TURBOPFOR_SYMBOL(p4nd1dec16)
+#define p4nd1dec32 OM_TURBOPFOR_SYMBOL(p4nd1dec32)
+#define p4nd1dec64 OM_TURBOPFOR_SYMBOL(p4nd1dec64)
+#define p4nd1dec8 OM_TURBOPFOR_SYMBOL(p4nd1dec8)
+#define p4nd1enc128v16 OM_TURBOPFOR_SYMBOL(p4nd1enc128v16)
+#define p4nd1enc128v32 OM_TURBOPFOR_SYMBOL(p4nd1enc128v32)
+#define p4nd1enc16 OM_TURBOPFOR_SYMBOL(p4nd1enc16)
+#define p4nd1enc32 OM_TURBOPFOR_SYMBOL(p4nd1enc32)
+#define p4nd1enc64 OM_TURBOPFOR_SYMBOL(p4nd1enc64)
+#define p4nd1enc8 OM_TURBOPFOR_SYMBOL(p4nd1enc8)
+#define p4nddec128v16 OM_TURBOPFOR_SYMBOL(p4nddec128v16)
+#define p4nddec128v32 OM_TURBOPFOR_SYMBOL(p4nddec128v32)
+#define p4nddec16 OM_TURBOPFOR_SYMBOL(p4nddec16)
+#define p4nddec32 OM_TURBOPFOR_SYMBOL(p4nddec32)
+#define p4nddec64 OM_TURBOPFOR_SYMBOL(p4nddec64)
+#define p4nddec8 OM_TURBOPFOR_SYMBOL(p4nddec8)
+#define p4ndec128v16 OM_TURBOPFOR_SYMBOL(p4ndec128v16)
+#define p4ndec128v32 OM_TURBOPFOR_SYMBOL(p4ndec128v32)
+#define p4ndec128v64 OM_TURBOPFOR_SYMBOL(p4ndec128v64)
+#define p4ndec16 OM_TURBOPFOR_SYMBOL(p4ndec16)
+#define p4ndec256w32 OM_TURBOPFOR_SYMBOL(p4ndec256w32)
+#define p4ndec32 OM_TURBOPFOR_SYMBOL(p4ndec32)
+#define p4ndec64 OM_TURBOPFOR_SYMBOL(p4ndec64)
+#define p4ndec8 OM_TURBOPFOR_SYMBOL(p4ndec8)
+#define p4ndenc128v16 OM_TURBOPFOR_SYMBOL(p4ndenc128v16)
+#define p4ndenc128v32 OM_TURBOPFOR_SYMBOL(p4ndenc128v32)
+#define p4ndenc16 OM_TURBOPFOR_SYMBOL(p4ndenc16)
+#define p4ndenc32 OM_TURBOPFOR_SYMBOL(p4ndenc32)
+#define p4ndenc64 OM_TURBOPFOR_SYMBOL(p4ndenc64)
+#define p4ndenc8 OM_TURBOPFOR_SYMBOL(p4ndenc8)
+#define p4nenc128v16 OM_TURBOPFOR_SYMBOL(p4nenc128v16)
+#define p4nenc128v32 OM_TURBOPFOR_SYMBOL(p4nenc128v32)
+#define p4nenc128v64 OM_TURBOPFOR_SYMBOL(p4nenc128v64)
+#define p4nenc16 OM_TURBOPFOR_SYMBOL(p4nenc16)
+#define p4nenc32 OM_TURBOPFOR_SYMBOL(p4nenc32)
+#define p4nenc64 OM_TURBOPFOR_SYMBOL(p4nenc64)
+#define p4nenc8 OM_TURBOPFOR_SYMBOL(p4nenc8)
+#define p4nsdec16 OM_TURBOPFOR_SYMBOL(p4nsdec16)
+#define p4nsdec32 OM_TURBOPFOR_SYMBOL(p4nsdec32)
+#define p4nsdec64 OM_TURBOPFOR_SYMBOL(p4nsdec64)
+#define p4nsenc16 OM_TURBOPFOR_SYMBOL(p4nsenc16)
+#define p4nsenc32 OM_TURBOPFOR_SYMBOL(p4nsenc32)
+#define p4nsenc64 OM_TURBOPFOR_SYMBOL(p4nsenc64)
+#define p4nzdec128v16 OM_TURBOPFOR_SYMBOL(p4nzdec128v16)
+#define p4nzdec128v32 OM_TURBOPFOR_SYMBOL(p4nzdec128v32)
+#define p4nzdec16 OM_TURBOPFOR_SYMBOL(p4nzdec16)
+#define p4nzdec32 OM_TURBOPFOR_SYMBOL(p4nzdec32)
+#define p4nzdec64 OM_TURBOPFOR_SYMBOL(p4nzdec64)
+#define p4nzdec8 OM_TURBOPFOR_SYMBOL(p4nzdec8)
+#define p4nzenc128v16 OM_TURBOPFOR_SYMBOL(p4nzenc128v16)
+#define p4nzenc128v32 OM_TURBOPFOR_SYMBOL(p4nzenc128v32)
+#define p4nzenc16 OM_TURBOPFOR_SYMBOL(p4nzenc16)
+#define p4nzenc32 OM_TURBOPFOR_SYMBOL(p4nzenc32)
+#define p4nzenc64 OM_TURBOPFOR_SYMBOL(p4nzenc64)
+#define p4nzenc8 OM_TURBOPFOR_SYMBOL(p4nzenc8)
+#define p4nzzdec128v16 OM_TURBOPFOR_SYMBOL(p4nzzdec128v16)
+#define p4nzzdec128v32 OM_TURBOPFOR_SYMBOL(p4nzzdec128v32)
+#define p4nzzdec128v64 OM_TURBOPFOR_SYMBOL(p4nzzdec128v64)
+#define p4nzzdec128v8 OM_TURBOPFOR_SYMBOL(p4nzzdec128v8)
+#define p4nzzenc128v16 OM_TURBOPFOR_SYMBOL(p4nzzenc128v16)
+#define p4nzzenc128v32 OM_TURBOPFOR_SYMBOL(p4nzzenc128v32)
+#define p4nzzenc128v64 OM_TURBOPFOR_SYMBOL(p4nzzenc128v64)
+#define p4nzzenc128v8 OM_TURBOPFOR_SYMBOL(p4nzzenc128v8)
+#define p4sdec16 OM_TURBOPFOR_SYMBOL(p4sdec16)
+#define p4sdec32 OM_TURBOPFOR_SYMBOL(p4sdec32)
+#define p4sdec64 OM_TURBOPFOR_SYMBOL(p4sdec64)
+#define p4senc16 OM_TURBOPFOR_SYMBOL(p4senc16)
+#define p4senc32 OM_TURBOPFOR_SYMBOL(p4senc32)
+#define p4senc64 OM_TURBOPFOR_SYMBOL(p4senc64)
+#define p4zdec128v16 OM_TURBOPFOR_SYMBOL(p4zdec128v16)
+#define p4zdec128v32 OM_TURBOPFOR_SYMBOL(p4zdec128v32)
+#define p4zdec16 OM_TURBOPFOR_SYMBOL(p4zdec16)
+#define p4zdec32 OM_TURBOPFOR_SYMBOL(p4zdec32)
+#define p4zdec64 OM_TURBOPFOR_SYMBOL(p4zdec64)
+#define p4zdec8 OM_TURBOPFOR_SYMBOL(p4zdec8)
+#define p4zenc128v16 OM_TURBOPFOR_SYMBOL(p4zenc128v16)
+#define p4zenc128v32 OM_TURBOPFOR_SYMBOL(p4zenc128v32)
+#define p4zenc16 OM_TURBOPFOR_SYMBOL(p4zenc16)
+#define p4zenc32 OM_TURBOPFOR_SYMBOL(p4zenc32)
+#define p4zenc64 OM_TURBOPFOR_SYMBOL(p4zenc64)
+#define p4zenc8 OM_TURBOPFOR_SYMBOL(p4zenc8)
+#define vbd1dec16 OM_TURBOPFOR_SYMBOL(vbd1dec16)
+#define vbd1dec32 OM_TURBOPFOR_SYMBOL(vbd1dec32)
+#define vbd1dec64 OM_TURBOPFOR_SYMBOL(vbd1dec64)
+#define vbd1dec8 OM_TURBOPFOR_SYMBOL(vbd1dec8)
+#define vbd1enc16 OM_TURBOPFOR_SYMBOL(vbd1enc16)
+#define vbd1enc32 OM_TURBOPFOR_SYMBOL(vbd1enc32)
+#define vbd1enc64 OM_TURBOPFOR_SYMBOL(vbd1enc64)
+#define vbd1enc8 OM_TURBOPFOR_SYMBOL(vbd1enc8)
+#define vbd1getgeq16 OM_TURBOPFOR_SYMBOL(vbd1getgeq16)
+#define vbd1getgeq32 OM_TURBOPFOR_SYMBOL(vbd1getgeq32)
+#define vbd1getgeq64 OM_TURBOPFOR_SYMBOL(vbd1getgeq64)
+#define vbd1getgeq8 OM_TURBOPFOR_SYMBOL(vbd1getgeq8)
+#define vbd1getx16 OM_TURBOPFOR_SYMBOL(vbd1getx16)
+#define vbd1getx32 OM_TURBOPFOR_SYMBOL(vbd1getx32)
+#define vbd1getx64 OM_TURBOPFOR_SYMBOL(vbd1getx64)
+#define vbd1getx8 OM_TURBOPFOR_SYMBOL(vbd1getx8)
+#define vbdddec16 OM_TURBOPFOR_SYMBOL(vbdddec16)
+#define vbdddec32 OM_TURBOPFOR_SYMBOL(vbdddec32)
+#define vbdddec64 OM_TURBOPFOR_SYMBOL(vbdddec64)
+#define vbdddec8 OM_TURBOPFOR_SYMBOL(vbdddec8)
+#define vbddec16 OM_TURBOPFOR_SYMBOL(vbddec16)
+#define vbddec32 OM_TURBOPFOR_SYMBOL(vbddec32)
+#define vbddec64 OM_TURBOPFOR_SYMBOL(vbddec64)
+#define vbddec8 OM_TURBOPFOR_SYMBOL(vbddec8)
+#define vbddenc16 OM_TURBOPFOR_SYMBOL(vbddenc16)
+#define vbddenc32 OM_TURBOPFOR_SYMBOL(vbddenc32)
+#define vbddenc64 OM_TURBOPFOR_SYMBOL(vbddenc64)
+#define vbddenc8 OM_TURBOPFOR_SYMBOL(vbddenc8)
+#define vbdec16 OM_TURBOPFOR_SYMBOL(vbdec16)
+#define vbdec32 OM_TURBOPFOR_SYMBOL(vbdec32)
+#define vbdec64 OM_TURBOPFOR_SYMBOL(vbdec64)
+#define vbdec8 OM_TURBOPFOR_SYMBOL(vbdec8)
+#define vbdenc16 OM_TURBOPFOR_SYMBOL(vbdenc16)
+#define vbdenc32 OM_TURBOPFOR_SYMBOL(vbdenc32)
+#define vbdenc64 OM_TURBOPFOR_SYMBOL(vbdenc64)
+#define vbdenc8 OM_TURBOPFOR_SYMBOL(vbdenc8)
+#define vbdgetgeq16 OM_TURBOPFOR_SYMBOL(vbdgetgeq16)
+#define vbdgetgeq32 OM_TURBOPFOR_SYMBOL(vbdgetgeq32)
+#define vbdgetgeq64 OM_TURBOPFOR_SYMBOL(vbdgetgeq64)
+#define vbdgetgeq8 OM_TURBOPFOR_SYMBOL(vbdgetgeq8)
+#define vbdgetx16 OM_TURBOPFOR_SYMBOL(vbdgetx16)
+#define vbdgetx32 OM_TURBOPFOR_SYMBOL(vbdgetx32)
+#define vbdgetx64 OM_TURBOPFOR_SYMBOL(vbdgetx64)
+#define vbdgetx8 OM_TURBOPFOR_SYMBOL(vbdgetx8)
+#define vbenc16 OM_TURBOPFOR_SYMBOL(vbenc16)
+#define vbenc32 OM_TURBOPFOR_SYMBOL(vbenc32)
+#define vbenc64 OM_TURBOPFOR_SYMBOL(vbenc64)
+#define vbenc8 OM_TURBOPFOR_SYMBOL(vbenc8)
+#define vbgetx16 OM_TURBOPFOR_SYMBOL(vbgetx16)
+#define vbgetx32 OM_TURBOPFOR_SYMBOL(vbgetx32)
+#define vbgetx64 OM_TURBOPFOR_SYMBOL(vbgetx64)
+#define vbgetx8 OM_TURBOPFOR_SYMBOL(vbgetx8)
+#define vbxdec16 OM_TURBOPFOR_SYMBOL(vbxdec16)
+#define vbxdec32 OM_TURBOPFOR_SYMBOL(vbxdec32)
+#define vbxdec64 OM_TURBOPFOR_SYMBOL(vbxdec64)
+#define vbxdec8 OM_TURBOPFOR_SYMBOL(vbxdec8)
+#define vbxenc16 OM_TURBOPFOR_SYMBOL(vbxenc16)
+#define vbxenc32 OM_TURBOPFOR_SYMBOL(vbxenc32)
+#define vbxenc64 OM_TURBOPFOR_SYMBOL(vbxenc64)
+#define vbxenc8 OM_TURBOPFOR_SYMBOL(vbxenc8)
+#define vbxgeteq16 OM_TURBOPFOR_SYMBOL(vbxgeteq16)
+#define vbxgeteq32 OM_TURBOPFOR_SYMBOL(vbxgeteq32)
+#define vbxgeteq64 OM_TURBOPFOR_SYMBOL(vbxgeteq64)
+#define vbxgeteq8 OM_TURBOPFOR_SYMBOL(vbxgeteq8)
+#define vbxgetx16 OM_TURBOPFOR_SYMBOL(vbxgetx16)
+#define vbxgetx32 OM_TURBOPFOR_SYMBOL(vbxgetx32)
+#define vbxgetx64 OM_TURBOPFOR_SYMBOL(vbxgetx64)
+#define vbxgetx8 OM_TURBOPFOR_SYMBOL(vbxgetx8)
+#define vbzdec16 OM_TURBOPFOR_SYMBOL(vbzdec16)
+#define vbzdec32 OM_TURBOPFOR_SYMBOL(vbzdec32)
+#define vbzdec64 OM_TURBOPFOR_SYMBOL(vbzdec64)
+#define vbzdec8 OM_TURBOPFOR_SYMBOL(vbzdec8)
+#define vbzenc16 OM_TURBOPFOR_SYMBOL(vbzenc16)
+#define vbzenc32 OM_TURBOPFOR_SYMBOL(vbzenc32)
+#define vbzenc64 OM_TURBOPFOR_SYMBOL(vbzenc64)
+#define vbzenc8 OM_TURBOPFOR_SYMBOL(vbzenc8)
+#define vbzgeteq16 OM_TURBOPFOR_SYMBOL(vbzgeteq16)
+#define vbzgeteq32 OM_TURBOPFOR_SYMBOL(vbzgeteq32)
+#define vbzgeteq64 OM_TURBOPFOR_SYMBOL(vbzgeteq64)
+#define vbzgeteq8 OM_TURBOPFOR_SYMBOL(vbzgeteq8)
+#define vbzgetx16 OM_TURBOPFOR_SYMBOL(vbzgetx16)
+#define vbzgetx32 OM_TURBOPFOR_SYMBOL(vbzgetx32)
+#define vbzgetx64 OM_TURBOPFOR_SYMBOL(vbzgetx64)
+#define vbzgetx8 OM_TURBOPFOR_SYMBOL(vbzgetx8)
+
+#endif // TURBOPFOR_SYMBOLS_H
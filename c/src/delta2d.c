@@ -1,137 +1,289 @@
 #include "delta2d.h"
+#include "om_common.h"
+
+/*
+ Vectorized kernels
+
+ Only the row dimension carries a dependency. Rows are filtered with full vectors and a short scalar tail.
+ If the row length is a multiple of the vector width, the chunk is instead treated as one flat array where
+ element `i` is combined with element `i - length1`. Loads then exactly match earlier stores and narrow rows
+ like 24 time steps do not need a scalar tail per row.
+ Encoding runs backward and only reads values that are not encoded yet, therefore the flat version works for any row length.
+ The XOR filters are bitwise and therefore independent of the element width.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || defined(__GNUC__))
+#include <immintrin.h>
+#define DELTA2D_X86 1
+#define DELTA2D_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define DELTA2D_NEON 1
+#endif
+
+/// Generate decode and encode kernels for one element type and vector instruction set.
+/// `W` is the number of elements per vector, `OP`/`INV` combine two vectors for decoding and encoding.
+#define DELTA2D_KERNELS(NAME, ATTR, TYPE, W, VEC, LOAD, STORE, OP, INV, SCALAR_OP, SCALAR_INV) \
+ATTR static inline void delta2d_decode_rows_##NAME(const size_t length0, const size_t length1, TYPE* buffer) { \
+    for (size_t d0 = 1; d0 < length0; d0++) { \
+        TYPE* row = &buffer[d0 * length1]; \
+        const TYPE* previous = &buffer[(d0 - 1) * length1]; \
+        size_t d1 = 0; \
+        for (; d1 + W <= length1; d1 += W) { \
+            STORE(&row[d1], OP(LOAD(&row[d1]), LOAD(&previous[d1]))); \
+        } \
+        for (; d1 < length1; d1++) { \
+            row[d1] SCALAR_OP previous[d1]; \
+        } \
+    } \
+} \
+ATTR static inline void delta2d_decode_flat_##NAME(const size_t length, const size_t stride, TYPE* buffer) { \
+    for (size_t i = stride; i < length; i += W) { \
+        STORE(&buffer[i], OP(LOAD(&buffer[i]), LOAD(&buffer[i - stride]))); \
+    } \
+} \
+ATTR static inline void delta2d_encode_flat_##NAME(const size_t length, const size_t stride, TYPE* buffer) { \
+    size_t i = length; \
+    for (; i >= stride + W; ) { \
+        i -= W; \
+        STORE(&buffer[i], INV(LOAD(&buffer[i]), LOAD(&buffer[i - stride]))); \
+    } \
+    for (; i > stride; ) { \
+        i--; \
+        buffer[i] SCALAR_INV buffer[i - stride]; \
+    } \
+}
+
+/// Scalar versions. Used on unsupported CPUs and as reference.
+#define DELTA2D_SCALAR_LOAD(p) (*(p))
+#define DELTA2D_SCALAR_STORE(p, v) (*(p) = (v))
+#define DELTA2D_SCALAR_ADD(a, b) ((a) + (b))
+#define DELTA2D_SCALAR_SUB(a, b) ((a) - (b))
+#define DELTA2D_SCALAR_XOR(a, b) ((a) ^ (b))
+DELTA2D_KERNELS(8_scalar, , int8_t, 1, int8_t, DELTA2D_SCALAR_LOAD, DELTA2D_SCALAR_STORE, DELTA2D_SCALAR_ADD, DELTA2D_SCALAR_SUB, +=, -=)
+DELTA2D_KERNELS(16_scalar, , int16_t, 1, int16_t, DELTA2D_SCALAR_LOAD, DELTA2D_SCALAR_STORE, DELTA2D_SCALAR_ADD, DELTA2D_SCALAR_SUB, +=, -=)
+DELTA2D_KERNELS(32_scalar, , int32_t, 1, int32_t, DELTA2D_SCALAR_LOAD, DELTA2D_SCALAR_STORE, DELTA2D_SCALAR_ADD, DELTA2D_SCALAR_SUB, +=, -=)
+DELTA2D_KERNELS(64_scalar, , int64_t, 1, int64_t, DELTA2D_SCALAR_LOAD, DELTA2D_SCALAR_STORE, DELTA2D_SCALAR_ADD, DELTA2D_SCALAR_SUB, +=, -=)
+DELTA2D_KERNELS(xor_scalar, , int32_t, 1, int32_t, DELTA2D_SCALAR_LOAD, DELTA2D_SCALAR_STORE, DELTA2D_SCALAR_XOR, DELTA2D_SCALAR_XOR, ^=, ^=)
+DELTA2D_KERNELS(xor16_scalar, , int16_t, 1, int16_t, DELTA2D_SCALAR_LOAD, DELTA2D_SCALAR_STORE, DELTA2D_SCALAR_XOR, DELTA2D_SCALAR_XOR, ^=, ^=)
+
+#if DELTA2D_X86
+#define DELTA2D_LOAD_SSE(p) _mm_loadu_si128((const __m128i*)(p))
+#define DELTA2D_STORE_SSE(p, v) _mm_storeu_si128((__m128i*)(p), v)
+#define DELTA2D_LOAD_AVX2(p) _mm256_loadu_si256((const __m256i*)(p))
+#define DELTA2D_STORE_AVX2(p, v) _mm256_storeu_si256((__m256i*)(p), v)
+
+DELTA2D_KERNELS(8_sse2, , int8_t, 16, __m128i, DELTA2D_LOAD_SSE, DELTA2D_STORE_SSE, _mm_add_epi8, _mm_sub_epi8, +=, -=)
+DELTA2D_KERNELS(16_sse2, , int16_t, 8, __m128i, DELTA2D_LOAD_SSE, DELTA2D_STORE_SSE, _mm_add_epi16, _mm_sub_epi16, +=, -=)
+DELTA2D_KERNELS(32_sse2, , int32_t, 4, __m128i, DELTA2D_LOAD_SSE, DELTA2D_STORE_SSE, _mm_add_epi32, _mm_sub_epi32, +=, -=)
+DELTA2D_KERNELS(64_sse2, , int64_t, 2, __m128i, DELTA2D_LOAD_SSE, DELTA2D_STORE_SSE, _mm_add_epi64, _mm_sub_epi64, +=, -=)
+DELTA2D_KERNELS(xor_sse2, , int32_t, 4, __m128i, DELTA2D_LOAD_SSE, DELTA2D_STORE_SSE, _mm_xor_si128, _mm_xor_si128, ^=, ^=)
+DELTA2D_KERNELS(xor16_sse2, , int16_t, 8, __m128i, DELTA2D_LOAD_SSE, DELTA2D_STORE_SSE, _mm_xor_si128, _mm_xor_si128, ^=, ^=)
+
+DELTA2D_KERNELS(8_avx2, DELTA2D_TARGET_AVX2, int8_t, 32, __m256i, DELTA2D_LOAD_AVX2, DELTA2D_STORE_AVX2, _mm256_add_epi8, _mm256_sub_epi8, +=, -=)
+DELTA2D_KERNELS(16_avx2, DELTA2D_TARGET_AVX2, int16_t, 16, __m256i, DELTA2D_LOAD_AVX2, DELTA2D_STORE_AVX2, _mm256_add_epi16, _mm256_sub_epi16, +=, -=)
+DELTA2D_KERNELS(32_avx2, DELTA2D_TARGET_AVX2, int32_t, 8, __m256i, DELTA2D_LOAD_AVX2, DELTA2D_STORE_AVX2, _mm256_add_epi32, _mm256_sub_epi32, +=, -=)
+DELTA2D_KERNELS(64_avx2, DELTA2D_TARGET_AVX2, int64_t, 4, __m256i, DELTA2D_LOAD_AVX2, DELTA2D_STORE_AVX2, _mm256_add_epi64, _mm256_sub_epi64, +=, -=)
+DELTA2D_KERNELS(xor_avx2, DELTA2D_TARGET_AVX2, int32_t, 8, __m256i, DELTA2D_LOAD_AVX2, DELTA2D_STORE_AVX2, _mm256_xor_si256, _mm256_xor_si256, ^=, ^=)
+DELTA2D_KERNELS(xor16_avx2, DELTA2D_TARGET_AVX2, int16_t, 16, __m256i, DELTA2D_LOAD_AVX2, DELTA2D_STORE_AVX2, _mm256_xor_si256, _mm256_xor_si256, ^=, ^=)
+
+/// Pick the widest vector. The flat decoder requires the row length to be a multiple of the vector width.
+#define DELTA2D_DECODE(NAME, TYPE, W_SSE, W_AVX2) { \
+    const OmCpuIsa_t isa = om_common_cpu_isa(); \
+    if (isa == OM_CPU_ISA_AVX2 && length1 % W_AVX2 == 0) { \
+        delta2d_decode_flat_##NAME##_avx2(length0 * length1, length1, (TYPE*)chunkBuffer); \
+    } else if (isa != OM_CPU_ISA_SCALAR && length1 % W_SSE == 0) { \
+        delta2d_decode_flat_##NAME##_sse2(length0 * length1, length1, (TYPE*)chunkBuffer); \
+    } else if (isa == OM_CPU_ISA_AVX2 && length1 >= W_AVX2) { \
+        delta2d_decode_rows_##NAME##_avx2(length0, length1, (TYPE*)chunkBuffer); \
+    } else if (isa != OM_CPU_ISA_SCALAR && length1 >= W_SSE) { \
+        delta2d_decode_rows_##NAME##_sse2(length0, length1, (TYPE*)chunkBuffer); \
+    } else { \
+        delta2d_decode_rows_##NAME##_scalar(length0, length1, (TYPE*)chunkBuffer); \
+    } \
+}
+#define DELTA2D_ENCODE(NAME, TYPE, W_SSE, W_AVX2) { \
+    const OmCpuIsa_t isa = om_common_cpu_isa(); \
+    if (isa == OM_CPU_ISA_AVX2) { \
+        delta2d_encode_flat_##NAME##_avx2(length0 * length1, length1, (TYPE*)chunkBuffer); \
+    } else if (isa != OM_CPU_ISA_SCALAR) { \
+        delta2d_encode_flat_##NAME##_sse2(length0 * length1, length1, (TYPE*)chunkBuffer); \
+    } else { \
+        delta2d_encode_flat_##NAME##_scalar(length0 * length1, length1, (TYPE*)chunkBuffer); \
+    } \
+}
+#elif DELTA2D_NEON
+DELTA2D_KERNELS(8_neon, , int8_t, 16, int8x16_t, vld1q_s8, vst1q_s8, vaddq_s8, vsubq_s8, +=, -=)
+DELTA2D_KERNELS(16_neon, , int16_t, 8, int16x8_t, vld1q_s16, vst1q_s16, vaddq_s16, vsubq_s16, +=, -=)
+DELTA2D_KERNELS(32_neon, , int32_t, 4, int32x4_t, vld1q_s32, vst1q_s32, vaddq_s32, vsubq_s32, +=, -=)
+DELTA2D_KERNELS(64_neon, , int64_t, 2, int64x2_t, vld1q_s64, vst1q_s64, vaddq_s64, vsubq_s64, +=, -=)
+DELTA2D_KERNELS(xor_neon, , int32_t, 4, int32x4_t, vld1q_s32, vst1q_s32, veorq_s32, veorq_s32, ^=, ^=)
+DELTA2D_KERNELS(xor16_neon, , int16_t, 8, int16x8_t, vld1q_s16, vst1q_s16, veorq_s16, veorq_s16, ^=, ^=)
+
+#define DELTA2D_DECODE(NAME, TYPE, W_NEON, W_UNUSED) { \
+    const OmCpuIsa_t isa = om_common_cpu_isa(); \
+    if (isa == OM_CPU_ISA_NEON && length1 % W_NEON == 0) { \
+        delta2d_decode_flat_##NAME##_neon(length0 * length1, length1, (TYPE*)chunkBuffer); \
+    } else if (isa == OM_CPU_ISA_NEON && length1 >= W_NEON) { \
+        delta2d_decode_rows_##NAME##_neon(length0, length1, (TYPE*)chunkBuffer); \
+    } else { \
+        delta2d_decode_rows_##NAME##_scalar(length0, length1, (TYPE*)chunkBuffer); \
+    } \
+}
+#define DELTA2D_ENCODE(NAME, TYPE, W_NEON, W_UNUSED) { \
+    if (om_common_cpu_isa() == OM_CPU_ISA_NEON) { \
+        delta2d_encode_flat_##NAME##_neon(length0 * length1, length1, (TYPE*)chunkBuffer); \
+    } else { \
+        delta2d_encode_flat_##NAME##_scalar(length0 * length1, length1, (TYPE*)chunkBuffer); \
+    } \
+}
+#else
+#define DELTA2D_DECODE(NAME, TYPE, W_UNUSED1, W_UNUSED2) delta2d_decode_rows_##NAME##_scalar(length0, length1, (TYPE*)chunkBuffer);
+#define DELTA2D_ENCODE(NAME, TYPE, W_UNUSED1, W_UNUSED2) delta2d_encode_flat_##NAME##_scalar(length0 * length1, length1, (TYPE*)chunkBuffer);
+#endif
 
 void delta2d_decode8(const size_t length0, const size_t length1, int8_t* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    for (size_t d0 = 1; d0 < length0; d0++) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBuffer[d0*length1 + d1] += chunkBuffer[(d0-1)*length1 + d1];
-        }
-    }
+    DELTA2D_DECODE(8, int8_t, 16, 32)
 }
 
 void delta2d_encode8(const size_t length0, const size_t length1, int8_t* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    for (size_t d0 = length0-1; d0 >= 1; d0--) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBuffer[d0*length1 + d1] -= chunkBuffer[(d0-1)*length1 + d1];
-        }
-    }
+    DELTA2D_ENCODE(8, int8_t, 16, 32)
 }
 
 void delta2d_decode16(const size_t length0, const size_t length1, int16_t* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    for (size_t d0 = 1; d0 < length0; d0++) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBuffer[d0*length1 + d1] += chunkBuffer[(d0-1)*length1 + d1];
-        }
-    }
+    DELTA2D_DECODE(16, int16_t, 8, 16)
 }
 
 void delta2d_encode16(const size_t length0, const size_t length1, int16_t* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    for (size_t d0 = length0-1; d0 >= 1; d0--) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBuffer[d0*length1 + d1] -= chunkBuffer[(d0-1)*length1 + d1];
-        }
-    }
+    DELTA2D_ENCODE(16, int16_t, 8, 16)
 }
 
 void delta2d_decode32(const size_t length0, const size_t length1, int32_t* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    for (size_t d0 = 1; d0 < length0; d0++) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBuffer[d0*length1 + d1] += chunkBuffer[(d0-1)*length1 + d1];
-        }
-    }
+    DELTA2D_DECODE(32, int32_t, 4, 8)
 }
 
 void delta2d_encode32(const size_t length0, const size_t length1, int32_t* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    for (size_t d0 = length0-1; d0 >= 1; d0--) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBuffer[d0*length1 + d1] -= chunkBuffer[(d0-1)*length1 + d1];
-        }
-    }
+    DELTA2D_ENCODE(32, int32_t, 4, 8)
 }
 
 void delta2d_decode64(const size_t length0, const size_t length1, int64_t* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    for (size_t d0 = 1; d0 < length0; d0++) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBuffer[d0*length1 + d1] += chunkBuffer[(d0-1)*length1 + d1];
-        }
-    }
+    DELTA2D_DECODE(64, int64_t, 2, 4)
 }
 
 void delta2d_encode64(const size_t length0, const size_t length1, int64_t* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    for (size_t d0 = length0-1; d0 >= 1; d0--) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBuffer[d0*length1 + d1] -= chunkBuffer[(d0-1)*length1 + d1];
-        }
-    }
+    DELTA2D_ENCODE(64, int64_t, 2, 4)
 }
 
 void delta2d_decode_xor(const size_t length0, const size_t length1, float* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    int* chunkBufferInt = (int*)chunkBuffer;
-    for (size_t d0 = 1; d0 < length0; d0++) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBufferInt[d0*length1 + d1] ^= chunkBufferInt[(d0-1)*length1 + d1];
-        }
-    }
+    DELTA2D_DECODE(xor, int32_t, 4, 8)
 }
 
 void delta2d_encode_xor(const size_t length0, const size_t length1, float* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    int* chunkBufferInt = (int*)chunkBuffer;
-    for (size_t d0 = length0-1; d0 >= 1; d0--) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBufferInt[d0*length1 + d1] ^= chunkBufferInt[(d0-1)*length1 + d1];
-        }
-    }
+    DELTA2D_ENCODE(xor, int32_t, 4, 8)
 }
 
 void delta2d_decode_xor_double(const size_t length0, const size_t length1, double* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    int* chunkBufferInt = (int*)chunkBuffer;
-    for (size_t d0 = 1; d0 < length0; d0++) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBufferInt[d0*length1 + d1] ^= chunkBufferInt[(d0-1)*length1 + d1];
-        }
-    }
+    // Only the first half of the buffer is filtered as 32 bit integers. This is part of the file format and must be kept.
+    DELTA2D_DECODE(xor, int32_t, 4, 8)
 }
 
 void delta2d_encode_xor_double(const size_t length0, const size_t length1, double* chunkBuffer) {
     if (length0 <= 1) {
         return;
     }
-    int* chunkBufferInt = (int*)chunkBuffer;
-    for (size_t d0 = length0-1; d0 >= 1; d0--) {
-        for (size_t d1 = 0; d1 < length1; d1++) {
-            chunkBufferInt[d0*length1 + d1] ^= chunkBufferInt[(d0-1)*length1 + d1];
-        }
+    // Only the first half of the buffer is filtered as 32 bit integers. This is part of the file format and must be kept.
+    DELTA2D_ENCODE(xor, int32_t, 4, 8)
+}
+
+void delta2d_decode_xor_half(const size_t length0, const size_t length1, uint16_t* chunkBuffer) {
+    if (length0 <= 1) {
+        return;
+    }
+    DELTA2D_DECODE(xor16, int16_t, 8, 16)
+}
+
+void delta2d_encode_xor_half(const size_t length0, const size_t length1, uint16_t* chunkBuffer) {
+    if (length0 <= 1) {
+        return;
     }
+    DELTA2D_ENCODE(xor16, int16_t, 8, 16)
 }
+
+/// Map half precision or bfloat16 bit patterns to signed integers in the order of their values by flipping the magnitude bits of negative values.
+/// The mapping is its own inverse. Both types have the sign in the highest bit.
+static void delta2d_order_half(const size_t length, uint16_t* chunkBuffer) {
+    for (size_t i = 0; i < length; i++) {
+        const uint16_t value = chunkBuffer[i];
+        chunkBuffer[i] = value ^ ((value & 0x8000) ? 0x7FFF : 0);
+    }
+}
+
+void delta2d_decode_ordered_half(const size_t length0, const size_t length1, uint16_t* chunkBuffer) {
+    delta2d_decode16(length0, length1, (int16_t*)chunkBuffer);
+    delta2d_order_half(length0 * length1, chunkBuffer);
+}
+
+void delta2d_encode_ordered_half(const size_t length0, const size_t length1, uint16_t* chunkBuffer) {
+    delta2d_order_half(length0 * length1, chunkBuffer);
+    delta2d_encode16(length0, length1, (int16_t*)chunkBuffer);
+}
+
+/*
+ 3D Lorenzo predictor
+
+ Each value is predicted from its neighbours in the previous plane, row and column. The residual is the
+ difference along all three dimensions, which is computed as one difference pass per dimension. Plane and row
+ passes reuse the 2D delta kernels above. The difference along the fast dimension is left to the zigzag delta
+ coding of PFor, which also removes the sign. Decoding applies the inverse passes in reverse order.
+ */
+#define LORENZO3D(BITS) \
+void lorenzo3d_encode##BITS(const size_t length0, const size_t length1, const size_t length2, int##BITS##_t* chunkBuffer) { \
+    const size_t plane = length1 * length2; \
+    delta2d_encode##BITS(length0, plane, chunkBuffer); \
+    for (size_t p = 0; p < length0; p++) { \
+        delta2d_encode##BITS(length1, length2, &chunkBuffer[p * plane]); \
+    } \
+} \
+void lorenzo3d_decode##BITS(const size_t length0, const size_t length1, const size_t length2, int##BITS##_t* chunkBuffer) { \
+    const size_t plane = length1 * length2; \
+    for (size_t p = 0; p < length0; p++) { \
+        delta2d_decode##BITS(length1, length2, &chunkBuffer[p * plane]); \
+    } \
+    delta2d_decode##BITS(length0, plane, chunkBuffer); \
+}
+
+LORENZO3D(32)
+LORENZO3D(64)
@@ -0,0 +1,207 @@
+//
+//  om_chunk_cache.c
+//  OpenMeteoApi
+//
+
+#include <stdatomic.h>
+#include <string.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sched.h>
+#endif
+#include "om_chunk_cache.h"
+
+/// Spin lock on its own cache line to avoid false sharing between shards
+typedef struct {
+    _Alignas(64) atomic_flag flag;
+    /// Logical clock for least-recently-used eviction of all sets of this shard
+    uint64_t clock;
+} OmChunkCacheShard_t;
+_Static_assert(sizeof(OmChunkCacheShard_t) == 64, "A shard must occupy exactly one cache line");
+
+/// Metadata of one slot. `size` is 0 for empty slots.
+typedef struct {
+    uint64_t file_id;
+    uint64_t variable_id;
+    uint64_t chunk_index;
+    uint64_t size;
+    uint64_t last_used;
+} OmChunkCacheEntry_t;
+
+struct OmChunkCache {
+    OmChunkCacheShard_t shards[OM_CHUNK_CACHE_SHARDS];
+    atomic_uint_fast64_t hits;
+    atomic_uint_fast64_t misses;
+    atomic_uint_fast64_t inserts;
+    atomic_uint_fast64_t evictions;
+    uint64_t slot_size;
+    uint64_t set_count;
+    OmChunkCacheEntry_t* entries;
+    uint8_t* data;
+};
+
+/// Slot sizes are rounded to 8 bytes to keep slots aligned
+static inline uint64_t _om_chunk_cache_aligned_slot_size(uint64_t slot_size) {
+    return divide_rounded_up(slot_size, 8) * 8;
+}
+
+static inline uint64_t _om_chunk_cache_set_size(uint64_t slot_size) {
+    return OM_CHUNK_CACHE_WAYS * (sizeof(OmChunkCacheEntry_t) + _om_chunk_cache_aligned_slot_size(slot_size));
+}
+
+/// Shards are aligned to cache lines. The cache is placed at the first aligned address of the memory passed by the caller.
+#define OM_CHUNK_CACHE_ALIGNMENT 64
+
+uint64_t om_chunk_cache_min_memory_size(uint64_t slot_size) {
+    return OM_CHUNK_CACHE_ALIGNMENT - 1 + sizeof(OmChunkCache_t) + _om_chunk_cache_set_size(slot_size);
+}
+
+OmChunkCache_t* om_chunk_cache_init(void* memory, uint64_t memory_size, uint64_t slot_size) {
+    if (slot_size == 0 || memory_size < om_chunk_cache_min_memory_size(slot_size)) {
+        return NULL;
+    }
+    const uint64_t skip = (OM_CHUNK_CACHE_ALIGNMENT - (uintptr_t)memory % OM_CHUNK_CACHE_ALIGNMENT) % OM_CHUNK_CACHE_ALIGNMENT;
+    OmChunkCache_t* cache = (OmChunkCache_t*)((uint8_t*)memory + skip);
+    for (uint64_t i = 0; i < OM_CHUNK_CACHE_SHARDS; i++) {
+        atomic_flag_clear(&cache->shards[i].flag);
+        cache->shards[i].clock = 0;
+    }
+    atomic_init(&cache->hits, 0);
+    atomic_init(&cache->misses, 0);
+    atomic_init(&cache->inserts, 0);
+    atomic_init(&cache->evictions, 0);
+    cache->slot_size = _om_chunk_cache_aligned_slot_size(slot_size);
+    cache->set_count = (memory_size - skip - sizeof(OmChunkCache_t)) / _om_chunk_cache_set_size(slot_size);
+    cache->entries = (OmChunkCacheEntry_t*)((uint8_t*)cache + sizeof(OmChunkCache_t));
+    cache->data = (uint8_t*)(cache->entries + cache->set_count * OM_CHUNK_CACHE_WAYS);
+    memset(cache->entries, 0, cache->set_count * OM_CHUNK_CACHE_WAYS * sizeof(OmChunkCacheEntry_t));
+    return cache;
+}
+
+uint64_t om_chunk_cache_slot_size(const OmChunkCache_t* cache) {
+    return cache->slot_size;
+}
+
+/// Mix all key components. Neighbouring chunks of the same variable map to different sets.
+static inline uint64_t _om_chunk_cache_hash(uint64_t file_id, uint64_t variable_id, uint64_t chunk_index) {
+    uint64_t h = file_id * 0x9E3779B97F4A7C15ull ^ variable_id * 0xC2B2AE3D27D4EB4Full ^ chunk_index;
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBull;
+    h ^= h >> 31;
+    return h;
+}
+
+static inline void _om_chunk_cache_lock(OmChunkCacheShard_t* shard) {
+    uint64_t spins = 0;
+    while (atomic_flag_test_and_set_explicit(&shard->flag, memory_order_acquire)) {
+        // Locks are only held for one chunk copy. Yield if the owner was preempted, e.g. with more threads than cores.
+        if (++spins % 64 == 0) {
+#if defined(_WIN32)
+            SwitchToThread();
+#else
+            sched_yield();
+#endif
+        }
+    }
+}
+
+static inline void _om_chunk_cache_unlock(OmChunkCacheShard_t* shard) {
+    atomic_flag_clear_explicit(&shard->flag, memory_order_release);
+}
+
+static inline bool _om_chunk_cache_entry_matches(const OmChunkCacheEntry_t* entry, uint64_t file_id, uint64_t variable_id, uint64_t chunk_index) {
+    return entry->size > 0 && entry->chunk_index == chunk_index && entry->variable_id == variable_id && entry->file_id == file_id;
+}
+
+/// Set of a key. The lock shard is derived from the set.
+static inline uint64_t _om_chunk_cache_set(const OmChunkCache_t* cache, uint64_t file_id, uint64_t variable_id, uint64_t chunk_index) {
+    return _om_chunk_cache_hash(file_id, variable_id, chunk_index) % cache->set_count;
+}
+
+const void* om_chunk_cache_acquire(OmChunkCache_t* cache, uint64_t file_id, uint64_t variable_id, uint64_t chunk_index, uint64_t size) {
+    const uint64_t set = _om_chunk_cache_set(cache, file_id, variable_id, chunk_index);
+    OmChunkCacheShard_t* shard = &cache->shards[set % OM_CHUNK_CACHE_SHARDS];
+    OmChunkCacheEntry_t* entries = &cache->entries[set * OM_CHUNK_CACHE_WAYS];
+
+    _om_chunk_cache_lock(shard);
+    for (uint64_t way = 0; way < OM_CHUNK_CACHE_WAYS; way++) {
+        OmChunkCacheEntry_t* entry = &entries[way];
+        if (!_om_chunk_cache_entry_matches(entry, file_id, variable_id, chunk_index) || entry->size != size) {
+            continue;
+        }
+        entry->last_used = ++shard->clock;
+        // The shard stays locked, because the slot could be evicted by another thread
+        atomic_fetch_add_explicit(&cache->hits, 1, memory_order_relaxed);
+        return &cache->data[(set * OM_CHUNK_CACHE_WAYS + way) * cache->slot_size];
+    }
+    _om_chunk_cache_unlock(shard);
+    atomic_fetch_add_explicit(&cache->misses, 1, memory_order_relaxed);
+    return NULL;
+}
+
+void om_chunk_cache_release(OmChunkCache_t* cache, uint64_t file_id, uint64_t variable_id, uint64_t chunk_index) {
+    const uint64_t set = _om_chunk_cache_set(cache, file_id, variable_id, chunk_index);
+    _om_chunk_cache_unlock(&cache->shards[set % OM_CHUNK_CACHE_SHARDS]);
+}
+
+bool om_chunk_cache_get(OmChunkCache_t* cache, uint64_t file_id, uint64_t variable_id, uint64_t chunk_index, void* out, uint64_t size) {
+    const void* data = om_chunk_cache_acquire(cache, file_id, variable_id, chunk_index, size);
+    if (data == NULL) {
+        return false;
+    }
+    memcpy(out, data, size);
+    om_chunk_cache_release(cache, file_id, variable_id, chunk_index);
+    return true;
+}
+
+bool om_chunk_cache_put(OmChunkCache_t* cache, uint64_t file_id, uint64_t variable_id, uint64_t chunk_index, const void* data, uint64_t size) {
+    if (size == 0 || size > cache->slot_size) {
+        return false;
+    }
+    const uint64_t set = _om_chunk_cache_set(cache, file_id, variable_id, chunk_index);
+    OmChunkCacheShard_t* shard = &cache->shards[set % OM_CHUNK_CACHE_SHARDS];
+    OmChunkCacheEntry_t* entries = &cache->entries[set * OM_CHUNK_CACHE_WAYS];
+
+    _om_chunk_cache_lock(shard);
+    // Reuse the slot if another thread inserted the same chunk. Otherwise take an empty or the least recently used slot.
+    uint64_t victim = 0;
+    for (uint64_t way = 0; way < OM_CHUNK_CACHE_WAYS; way++) {
+        if (_om_chunk_cache_entry_matches(&entries[way], file_id, variable_id, chunk_index)) {
+            victim = way;
+            break;
+        }
+        if (entries[victim].size > 0 && (entries[way].size == 0 || entries[way].last_used < entries[victim].last_used)) {
+            victim = way;
+        }
+    }
+    OmChunkCacheEntry_t* entry = &entries[victim];
+    const bool evicted = entry->size > 0 && !_om_chunk_cache_entry_matches(entry, file_id, variable_id, chunk_index);
+    memcpy(&cache->data[(set * OM_CHUNK_CACHE_WAYS + victim) * cache->slot_size], data, size);
+    *entry = (OmChunkCacheEntry_t){
+        .file_id = file_id,
+        .variable_id = variable_id,
+        .chunk_index = chunk_index,
+        .size = size,
+        .last_used = ++shard->clock
+    };
+    _om_chunk_cache_unlock(shard);
+
+    atomic_fetch_add_explicit(&cache->inserts, 1, memory_order_relaxed);
+    if (evicted) {
+        atomic_fetch_add_explicit(&cache->evictions, 1, memory_order_relaxed);
+    }
+    return true;
+}
+
+OmChunkCacheStatistics_t om_chunk_cache_statistics(OmChunkCache_t* cache) {
+    OmChunkCacheStatistics_t statistics = {
+        .hits = atomic_load_explicit(&cache->hits, memory_order_relaxed),
+        .misses = atomic_load_explicit(&cache->misses, memory_order_relaxed),
+        .inserts = atomic_load_explicit(&cache->inserts, memory_order_relaxed),
+        .evictions = atomic_load_explicit(&cache->evictions, memory_order_relaxed),
+    };
+    return statistics;
+}
@@ -10,9 +10,24 @@
 #include "vp4.h"
 #include "fp.h"
 #include "conf.h"
+#include <stdatomic.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || defined(__GNUC__))
+// SSE4.1 and AVX2 kernels are compiled with target attributes and selected at runtime. AVX2 kernels also use F16C, which is part of x86-64-v3.
+#define OM_COMMON_X86_DISPATCH 1
+#define OM_COMMON_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define OM_COMMON_TARGET_AVX2 __attribute__((target("avx2,f16c")))
+#include <immintrin.h>
+#elif defined(__aarch64__)
+// NEON is part of the ARMv8-A baseline
+#define OM_COMMON_NEON 1
+#include <arm_neon.h>
+#endif
 #pragma clang diagnostic ignored "-Wunused-parameter"
 #pragma clang diagnostic warning "-Wbad-function-cast"
 #pragma clang diagnostic error "-Wswitch"
+// Keep `val * scale_factor + add_offset` as separate multiply and add so that scalar and SIMD kernels round identically
+#pragma STDC FP_CONTRACT OFF
 
 const char* om_error_string(OmError_t error) {
     switch (error) {
@@ -38,6 +53,22 @@ const char* om_error_string(OmError_t error) {
             return "Invalid read count dimensions";
         case ERROR_INVALID_CUBE_OFFSET:
             return "Invalid read cube offset dimensions";
+        case ERROR_IO_READ:
+            return "Failed to read file";
+        case ERROR_OUT_OF_MEMORY:
+            return "Memory allocation failed";
+        case ERROR_IO_WRITE:
+            return "Failed to write file";
+        case ERROR_INVALID_SCALE_FACTOR:
+            return "Invalid scale factor or offset for compression type";
+        case ERROR_INVALID_MANTISSA_BITS:
+            return "Invalid number of mantissa bits for compression or data type";
+        case ERROR_INVALID_STATE:
+            return "Operation is not allowed in the current state, e.g. writing to a finalised array";
+        case ERROR_VALUE_OUT_OF_RANGE:
+            return "Value is out of the integer range after scaling";
+        case ERROR_LUT_BLOCK_OFFSETS_REQUIRED:
+            return "Block offset table of the variable-length LUT is required, see om_decoder_lut_block_offsets_read";
     }
     return "";
 }
@@ -50,6 +81,8 @@ uint8_t om_get_bytes_per_element(OmDataType_t data_type, OmError_t* error) {
 
         case DATA_TYPE_INT16_ARRAY:
         case DATA_TYPE_UINT16_ARRAY:
+        case DATA_TYPE_FLOAT16_ARRAY:
+        case DATA_TYPE_BFLOAT16_ARRAY:
             return 2;
 
         case DATA_TYPE_INT32_ARRAY:
@@ -98,6 +131,15 @@ uint8_t om_get_bytes_per_element_compressed(OmDataType_t data_type, OmCompressio
             return 2;
 
         case COMPRESSION_FPX_XOR2D:
+            if (data_type != DATA_TYPE_FLOAT_ARRAY && data_type != DATA_TYPE_DOUBLE_ARRAY && data_type != DATA_TYPE_FLOAT16_ARRAY && data_type != DATA_TYPE_BFLOAT16_ARRAY) {
+                *error = ERROR_INVALID_DATA_TYPE;
+                break;
+            }
+            return om_get_bytes_per_element(data_type, error);
+        case COMPRESSION_FPX_FCM:
+        case COMPRESSION_FPX_DFCM:
+        case COMPRESSION_FPX_2DFCM:
+        case COMPRESSION_PFOR_LORENZO:
             if (data_type != DATA_TYPE_FLOAT_ARRAY && data_type != DATA_TYPE_DOUBLE_ARRAY) {
                 *error = ERROR_INVALID_DATA_TYPE;
                 break;
@@ -105,6 +147,13 @@ uint8_t om_get_bytes_per_element_compressed(OmDataType_t data_type, OmCompressio
             return om_get_bytes_per_element(data_type, error);
         case COMPRESSION_PFOR_DELTA2D:
             return om_get_bytes_per_element(data_type, error);
+        case COMPRESSION_PFOR_DOD:
+        case COMPRESSION_PFOR_DELTA2D_DOD:
+            if (data_type == DATA_TYPE_FLOAT16_ARRAY || data_type == DATA_TYPE_BFLOAT16_ARRAY) {
+                *error = ERROR_INVALID_DATA_TYPE;
+                break;
+            }
+            return om_get_bytes_per_element(data_type, error);
 
         default:
             *error = ERROR_INVALID_COMPRESSION_TYPE;
@@ -112,7 +161,7 @@ uint8_t om_get_bytes_per_element_compressed(OmDataType_t data_type, OmCompressio
     return om_get_bytes_per_element(data_type, error);
 }
 
-void om_common_copy_float_to_int16(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+static void _om_common_copy_float_to_int16_scalar(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
     for (uint64_t i = 0; i < length; ++i) {
         float val = ((float *)src)[i];
         if (isnan(val)) {
@@ -125,7 +174,7 @@ void om_common_copy_float_to_int16(uint64_t length, float scale_factor, float ad
     }
 }
 
-void om_common_copy_float_to_int32(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+static void _om_common_copy_float_to_int32_scalar(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
     for (uint64_t i = 0; i < length; ++i) {
         float val = ((float *)src)[i];
         if (isnan(val)) {
@@ -138,7 +187,7 @@ void om_common_copy_float_to_int32(uint64_t length, float scale_factor, float ad
     }
 }
 
-void om_common_copy_double_to_int64(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+static void _om_common_copy_double_to_int64_scalar(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
     for (uint64_t i = 0; i < length; ++i) {
         double val = ((double *)src)[i];
         if (isnan(val)) {
@@ -164,21 +213,21 @@ void om_common_copy_float_to_int16_log10(uint64_t length, float scale_factor, fl
     }
 }
 
-void om_common_copy_int16_to_float(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+static void _om_common_copy_int16_to_float_scalar(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
     for (uint64_t i = 0; i < length; ++i) {
         int16_t val = ((int16_t *)src)[i];
         ((float *)dst)[i] = (val == INT16_MAX) ? NAN : (float)val / scale_factor - add_offset;
     }
 }
 
-void om_common_copy_int32_to_float(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+static void _om_common_copy_int32_to_float_scalar(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
     for (uint64_t i = 0; i < length; ++i) {
         int32_t val = ((int32_t *)src)[i];
         ((float *)dst)[i] = (val == INT32_MAX) ? NAN : (float)val / scale_factor - add_offset;
     }
 }
 
-void om_common_copy_int64_to_double(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+static void _om_common_copy_int64_to_double_scalar(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
     for (uint64_t i = 0; i < length; ++i) {
         int64_t val = ((int64_t *)src)[i];
         ((double *)dst)[i] = (val == INT64_MAX) ? NAN : (double)val / (double)scale_factor - (double)add_offset;
@@ -192,6 +241,786 @@ void om_common_copy_int16_to_float_log10(uint64_t length, float scale_factor, fl
     }
 }
 
+static void _om_common_copy_float16_to_float_scalar(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    for (uint64_t i = 0; i < length; ++i) {
+        ((float *)dst)[i] = om_common_float16_to_float(((const uint16_t *)src)[i]);
+    }
+}
+
+static void _om_common_copy_bfloat16_to_float_scalar(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    for (uint64_t i = 0; i < length; ++i) {
+        ((float *)dst)[i] = om_common_bfloat16_to_float(((const uint16_t *)src)[i]);
+    }
+}
+
+static void _om_common_copy_float_to_float16_scalar(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    for (uint64_t i = 0; i < length; ++i) {
+        union { float f; uint32_t u; } value = {.f = ((const float *)src)[i]};
+        const uint16_t sign = (uint16_t)((value.u >> 16) & 0x8000);
+        const uint32_t abs = value.u & 0x7FFFFFFF;
+        uint16_t half;
+        if (abs > 0x7F800000) {
+            // NaN. Quiet and keep the upper payload bits.
+            half = (uint16_t)(0x7E00 | ((abs >> 13) & 0x3FF));
+        } else if (abs >= 0x477FF000) {
+            // 65520 and above round to infinity
+            half = 0x7C00;
+        } else if (abs >= 0x38800000) {
+            // Normal. Rebias the exponent from 127 to 15 and round the dropped 13 bits to nearest even.
+            const uint32_t rebiased = abs - 0x38000000;
+            half = (uint16_t)((rebiased + 0xFFF + ((rebiased >> 13) & 1)) >> 13);
+        } else {
+            // Subnormal or zero. Adding 0.5 aligns the result to the last mantissa bits and rounds to nearest even.
+            union { float f; uint32_t u; } aligned = {.u = abs};
+            aligned.f += 0.5f;
+            half = (uint16_t)(aligned.u - 0x3F000000);
+        }
+        ((uint16_t *)dst)[i] = sign | half;
+    }
+}
+
+static void _om_common_copy_float_to_bfloat16_scalar(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    for (uint64_t i = 0; i < length; ++i) {
+        const uint32_t u = ((const uint32_t *)src)[i];
+        if ((u & 0x7FFFFFFF) > 0x7F800000) {
+            // NaN. Quiet, otherwise truncating the payload could produce infinity.
+            ((uint16_t *)dst)[i] = (uint16_t)((u >> 16) | 0x40);
+            continue;
+        }
+        // Round the lower 16 bits to nearest even. Carries into the exponent and to infinity are correct.
+        ((uint16_t *)dst)[i] = (uint16_t)((u + 0x7FFF + ((u >> 16) & 1)) >> 16);
+    }
+}
+
+/// Round half away from zero like `roundf`. Vector rounding instructions only offer round half to even.
+#if OM_COMMON_X86_DISPATCH
+OM_COMMON_TARGET_SSE41 static inline __m128 _om_common_round_sse41(__m128 x) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 truncated = _mm_round_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const __m128 fraction = _mm_andnot_ps(signMask, _mm_sub_ps(x, truncated));
+    const __m128 roundUp = _mm_cmpge_ps(fraction, _mm_set1_ps(0.5f));
+    const __m128 one = _mm_or_ps(_mm_set1_ps(1.0f), _mm_and_ps(x, signMask));
+    return _mm_add_ps(truncated, _mm_and_ps(roundUp, one));
+}
+
+OM_COMMON_TARGET_AVX2 static inline __m256 _om_common_round_avx2(__m256 x) {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 truncated = _mm256_round_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const __m256 fraction = _mm256_andnot_ps(signMask, _mm256_sub_ps(x, truncated));
+    const __m256 roundUp = _mm256_cmp_ps(fraction, _mm256_set1_ps(0.5f), _CMP_GE_OQ);
+    const __m256 one = _mm256_or_ps(_mm256_set1_ps(1.0f), _mm256_and_ps(x, signMask));
+    return _mm256_add_ps(truncated, _mm256_and_ps(roundUp, one));
+}
+
+OM_COMMON_TARGET_SSE41 static void _om_common_copy_float_to_int16_sse41(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const float* s = src;
+    int16_t* d = dst;
+    const __m128 scale = _mm_set1_ps(scale_factor), offset = _mm_set1_ps(add_offset);
+    const __m128 lower = _mm_set1_ps(INT16_MIN), upper = _mm_set1_ps(INT16_MAX);
+    const __m128i missing = _mm_set1_epi32(INT16_MAX);
+    uint64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        __m128i packed[2];
+        for (int k = 0; k < 2; k++) {
+            const __m128 val = _mm_loadu_ps(&s[i + 4 * k]);
+            const __m128 isNan = _mm_cmpunord_ps(val, val);
+            const __m128 rounded = _om_common_round_sse41(_mm_add_ps(_mm_mul_ps(val, scale), offset));
+            // min/max return the second operand for NaN, which matches fminf/fmaxf
+            const __m128 clamped = _mm_max_ps(_mm_min_ps(rounded, upper), lower);
+            packed[k] = _mm_blendv_epi8(_mm_cvttps_epi32(clamped), missing, _mm_castps_si128(isNan));
+        }
+        _mm_storeu_si128((__m128i*)&d[i], _mm_packs_epi32(packed[0], packed[1]));
+    }
+    _om_common_copy_float_to_int16_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_AVX2 static void _om_common_copy_float_to_int16_avx2(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const float* s = src;
+    int16_t* d = dst;
+    const __m256 scale = _mm256_set1_ps(scale_factor), offset = _mm256_set1_ps(add_offset);
+    const __m256 lower = _mm256_set1_ps(INT16_MIN), upper = _mm256_set1_ps(INT16_MAX);
+    const __m256i missing = _mm256_set1_epi32(INT16_MAX);
+    uint64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m256 val = _mm256_loadu_ps(&s[i]);
+        const __m256 isNan = _mm256_cmp_ps(val, val, _CMP_UNORD_Q);
+        const __m256 rounded = _om_common_round_avx2(_mm256_add_ps(_mm256_mul_ps(val, scale), offset));
+        const __m256 clamped = _mm256_max_ps(_mm256_min_ps(rounded, upper), lower);
+        const __m256i ints = _mm256_blendv_epi8(_mm256_cvttps_epi32(clamped), missing, _mm256_castps_si256(isNan));
+        const __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(ints), _mm256_extracti128_si256(ints, 1));
+        _mm_storeu_si128((__m128i*)&d[i], packed);
+    }
+    _om_common_copy_float_to_int16_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_SSE41 static void _om_common_copy_float_to_int32_sse41(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const float* s = src;
+    int32_t* d = dst;
+    const __m128 scale = _mm_set1_ps(scale_factor), offset = _mm_set1_ps(add_offset);
+    const __m128 lower = _mm_set1_ps((float)INT32_MIN), upper = _mm_set1_ps((float)INT32_MAX);
+    const __m128i missing = _mm_set1_epi32(INT32_MAX);
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const __m128 val = _mm_loadu_ps(&s[i]);
+        const __m128 isNan = _mm_cmpunord_ps(val, val);
+        const __m128 rounded = _om_common_round_sse41(_mm_add_ps(_mm_mul_ps(val, scale), offset));
+        const __m128 clamped = _mm_max_ps(_mm_min_ps(rounded, upper), lower);
+        const __m128i ints = _mm_blendv_epi8(_mm_cvttps_epi32(clamped), missing, _mm_castps_si128(isNan));
+        _mm_storeu_si128((__m128i*)&d[i], ints);
+    }
+    _om_common_copy_float_to_int32_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_AVX2 static void _om_common_copy_float_to_int32_avx2(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const float* s = src;
+    int32_t* d = dst;
+    const __m256 scale = _mm256_set1_ps(scale_factor), offset = _mm256_set1_ps(add_offset);
+    const __m256 lower = _mm256_set1_ps((float)INT32_MIN), upper = _mm256_set1_ps((float)INT32_MAX);
+    const __m256i missing = _mm256_set1_epi32(INT32_MAX);
+    uint64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m256 val = _mm256_loadu_ps(&s[i]);
+        const __m256 isNan = _mm256_cmp_ps(val, val, _CMP_UNORD_Q);
+        const __m256 rounded = _om_common_round_avx2(_mm256_add_ps(_mm256_mul_ps(val, scale), offset));
+        const __m256 clamped = _mm256_max_ps(_mm256_min_ps(rounded, upper), lower);
+        const __m256i ints = _mm256_blendv_epi8(_mm256_cvttps_epi32(clamped), missing, _mm256_castps_si256(isNan));
+        _mm256_storeu_si256((__m256i*)&d[i], ints);
+    }
+    _om_common_copy_float_to_int32_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_SSE41 static void _om_common_copy_int16_to_float_sse41(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const int16_t* s = src;
+    float* d = dst;
+    const __m128 scale = _mm_set1_ps(scale_factor), offset = _mm_set1_ps(add_offset), nan = _mm_set1_ps(NAN);
+    const __m128i missing = _mm_set1_epi32(INT16_MAX);
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const __m128i val = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)&s[i]));
+        const __m128 isMissing = _mm_castsi128_ps(_mm_cmpeq_epi32(val, missing));
+        const __m128 scaled = _mm_sub_ps(_mm_div_ps(_mm_cvtepi32_ps(val), scale), offset);
+        _mm_storeu_ps(&d[i], _mm_blendv_ps(scaled, nan, isMissing));
+    }
+    _om_common_copy_int16_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_AVX2 static void _om_common_copy_int16_to_float_avx2(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const int16_t* s = src;
+    float* d = dst;
+    const __m256 scale = _mm256_set1_ps(scale_factor), offset = _mm256_set1_ps(add_offset), nan = _mm256_set1_ps(NAN);
+    const __m256i missing = _mm256_set1_epi32(INT16_MAX);
+    uint64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m256i val = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)&s[i]));
+        const __m256 isMissing = _mm256_castsi256_ps(_mm256_cmpeq_epi32(val, missing));
+        const __m256 scaled = _mm256_sub_ps(_mm256_div_ps(_mm256_cvtepi32_ps(val), scale), offset);
+        _mm256_storeu_ps(&d[i], _mm256_blendv_ps(scaled, nan, isMissing));
+    }
+    _om_common_copy_int16_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_SSE41 static void _om_common_copy_int32_to_float_sse41(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const int32_t* s = src;
+    float* d = dst;
+    const __m128 scale = _mm_set1_ps(scale_factor), offset = _mm_set1_ps(add_offset), nan = _mm_set1_ps(NAN);
+    const __m128i missing = _mm_set1_epi32(INT32_MAX);
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const __m128i val = _mm_loadu_si128((const __m128i*)&s[i]);
+        const __m128 isMissing = _mm_castsi128_ps(_mm_cmpeq_epi32(val, missing));
+        const __m128 scaled = _mm_sub_ps(_mm_div_ps(_mm_cvtepi32_ps(val), scale), offset);
+        _mm_storeu_ps(&d[i], _mm_blendv_ps(scaled, nan, isMissing));
+    }
+    _om_common_copy_int32_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_AVX2 static void _om_common_copy_int32_to_float_avx2(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const int32_t* s = src;
+    float* d = dst;
+    const __m256 scale = _mm256_set1_ps(scale_factor), offset = _mm256_set1_ps(add_offset), nan = _mm256_set1_ps(NAN);
+    const __m256i missing = _mm256_set1_epi32(INT32_MAX);
+    uint64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m256i val = _mm256_loadu_si256((const __m256i*)&s[i]);
+        const __m256 isMissing = _mm256_castsi256_ps(_mm256_cmpeq_epi32(val, missing));
+        const __m256 scaled = _mm256_sub_ps(_mm256_div_ps(_mm256_cvtepi32_ps(val), scale), offset);
+        _mm256_storeu_ps(&d[i], _mm256_blendv_ps(scaled, nan, isMissing));
+    }
+    _om_common_copy_int32_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+/// Half precision without F16C: Exponent and mantissa are shifted into a float and multiplied by 2^112, which rebiases normals and normalises subnormals exactly.
+/// Infinity and NaN get the float exponent afterwards.
+OM_COMMON_TARGET_SSE41 static void _om_common_copy_float16_to_float_sse41(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const uint16_t* s = src;
+    float* d = dst;
+    const __m128i magnitude = _mm_set1_epi32(0x7FFF), exponentMask = _mm_set1_epi32(0x7C00), mantissaMask = _mm_set1_epi32(0x3FF);
+    const __m128i infinity = _mm_set1_epi32(0x7F800000), quiet = _mm_set1_epi32(0x400000);
+    const __m128 rebias = _mm_castsi128_ps(_mm_set1_epi32(0x77800000));
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const __m128i h = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i*)&s[i]));
+        const __m128i scaled = _mm_castps_si128(_mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, magnitude), 13)), rebias));
+        const __m128i isSpecial = _mm_cmpeq_epi32(_mm_and_si128(h, exponentMask), exponentMask);
+        const __m128i nanBit = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(h, mantissaMask), _mm_setzero_si128()), quiet);
+        const __m128i sign = _mm_slli_epi32(_mm_srli_epi32(h, 15), 31);
+        const __m128i bits = _mm_or_si128(_mm_or_si128(scaled, sign), _mm_and_si128(isSpecial, _mm_or_si128(infinity, nanBit)));
+        _mm_storeu_ps(&d[i], _mm_castsi128_ps(bits));
+    }
+    _om_common_copy_float16_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_SSE41 static void _om_common_copy_bfloat16_to_float_sse41(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const uint16_t* s = src;
+    float* d = dst;
+    const __m128i zero = _mm_setzero_si128();
+    uint64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m128i h = _mm_loadu_si128((const __m128i*)&s[i]);
+        _mm_storeu_si128((__m128i*)&d[i], _mm_unpacklo_epi16(zero, h));
+        _mm_storeu_si128((__m128i*)&d[i + 4], _mm_unpackhi_epi16(zero, h));
+    }
+    _om_common_copy_bfloat16_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+/// Round 4 floats to bfloat16 in the lower half of each lane
+OM_COMMON_TARGET_SSE41 static inline __m128i _om_common_round_bfloat16_sse41(__m128i u) {
+    const __m128i upper = _mm_srli_epi32(u, 16);
+    const __m128i rounded = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(u, _mm_set1_epi32(0x7FFF)), _mm_and_si128(upper, _mm_set1_epi32(1))), 16);
+    const __m128i isNan = _mm_cmpgt_epi32(_mm_and_si128(u, _mm_set1_epi32(0x7FFFFFFF)), _mm_set1_epi32(0x7F800000));
+    return _mm_blendv_epi8(rounded, _mm_or_si128(upper, _mm_set1_epi32(0x40)), isNan);
+}
+
+OM_COMMON_TARGET_SSE41 static void _om_common_copy_float_to_bfloat16_sse41(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const float* s = src;
+    uint16_t* d = dst;
+    uint64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m128i lower = _om_common_round_bfloat16_sse41(_mm_loadu_si128((const __m128i*)&s[i]));
+        const __m128i upper = _om_common_round_bfloat16_sse41(_mm_loadu_si128((const __m128i*)&s[i + 4]));
+        _mm_storeu_si128((__m128i*)&d[i], _mm_packus_epi32(lower, upper));
+    }
+    _om_common_copy_float_to_bfloat16_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_AVX2 static void _om_common_copy_float16_to_float_avx2(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const uint16_t* s = src;
+    float* d = dst;
+    uint64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        _mm256_storeu_ps(&d[i], _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)&s[i])));
+    }
+    _om_common_copy_float16_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_AVX2 static void _om_common_copy_bfloat16_to_float_avx2(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const uint16_t* s = src;
+    float* d = dst;
+    uint64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m256i h = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)&s[i]));
+        _mm256_storeu_si256((__m256i*)&d[i], _mm256_slli_epi32(h, 16));
+    }
+    _om_common_copy_bfloat16_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_AVX2 static void _om_common_copy_float_to_float16_avx2(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const float* s = src;
+    uint16_t* d = dst;
+    uint64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(&s[i]), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128((__m128i*)&d[i], half);
+    }
+    _om_common_copy_float_to_float16_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+OM_COMMON_TARGET_AVX2 static void _om_common_copy_float_to_bfloat16_avx2(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const float* s = src;
+    uint16_t* d = dst;
+    const __m256i roundBias = _mm256_set1_epi32(0x7FFF), one = _mm256_set1_epi32(1), quiet = _mm256_set1_epi32(0x40);
+    const __m256i magnitude = _mm256_set1_epi32(0x7FFFFFFF), infinity = _mm256_set1_epi32(0x7F800000);
+    uint64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m256i u = _mm256_loadu_si256((const __m256i*)&s[i]);
+        const __m256i upper = _mm256_srli_epi32(u, 16);
+        const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(u, roundBias), _mm256_and_si256(upper, one)), 16);
+        const __m256i isNan = _mm256_cmpgt_epi32(_mm256_and_si256(u, magnitude), infinity);
+        const __m256i bf16 = _mm256_blendv_epi8(rounded, _mm256_or_si256(upper, quiet), isNan);
+        _mm_storeu_si128((__m128i*)&d[i], _mm_packus_epi32(_mm256_castsi256_si128(bf16), _mm256_extracti128_si256(bf16, 1)));
+    }
+    _om_common_copy_float_to_bfloat16_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+#endif // OM_COMMON_X86_DISPATCH
+
+#if OM_COMMON_NEON
+static void _om_common_copy_float_to_int16_neon(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const float* s = src;
+    int16_t* d = dst;
+    const float32x4_t scale = vdupq_n_f32(scale_factor), offset = vdupq_n_f32(add_offset);
+    const float32x4_t lower = vdupq_n_f32(INT16_MIN), upper = vdupq_n_f32(INT16_MAX);
+    const int16x4_t missing = vdup_n_s16(INT16_MAX);
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const float32x4_t val = vld1q_f32(&s[i]);
+        const uint32x4_t isNumber = vceqq_f32(val, val);
+        // vrndaq rounds half away from zero like roundf. minnm/maxnm ignore NaN like fminf/fmaxf
+        const float32x4_t rounded = vrndaq_f32(vaddq_f32(vmulq_f32(val, scale), offset));
+        const float32x4_t clamped = vmaxnmq_f32(vminnmq_f32(rounded, upper), lower);
+        const int16x4_t ints = vqmovn_s32(vcvtq_s32_f32(clamped));
+        vst1_s16(&d[i], vbsl_s16(vmovn_u32(isNumber), ints, missing));
+    }
+    _om_common_copy_float_to_int16_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+static void _om_common_copy_float_to_int32_neon(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const float* s = src;
+    int32_t* d = dst;
+    const float32x4_t scale = vdupq_n_f32(scale_factor), offset = vdupq_n_f32(add_offset);
+    const float32x4_t lower = vdupq_n_f32((float)INT32_MIN), upper = vdupq_n_f32((float)INT32_MAX);
+    const int32x4_t missing = vdupq_n_s32(INT32_MAX);
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const float32x4_t val = vld1q_f32(&s[i]);
+        const uint32x4_t isNumber = vceqq_f32(val, val);
+        const float32x4_t rounded = vrndaq_f32(vaddq_f32(vmulq_f32(val, scale), offset));
+        const float32x4_t clamped = vmaxnmq_f32(vminnmq_f32(rounded, upper), lower);
+        vst1q_s32(&d[i], vbslq_s32(isNumber, vcvtq_s32_f32(clamped), missing));
+    }
+    _om_common_copy_float_to_int32_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+static void _om_common_copy_double_to_int64_neon(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const double* s = src;
+    int64_t* d = dst;
+    const float64x2_t scale = vdupq_n_f64((double)scale_factor), offset = vdupq_n_f64((double)add_offset);
+    const float64x2_t lower = vdupq_n_f64((double)INT64_MIN), upper = vdupq_n_f64((double)INT64_MAX);
+    const int64x2_t missing = vdupq_n_s64(INT64_MAX);
+    uint64_t i = 0;
+    for (; i + 2 <= length; i += 2) {
+        const float64x2_t val = vld1q_f64(&s[i]);
+        const uint64x2_t isNumber = vceqq_f64(val, val);
+        const float64x2_t rounded = vrndaq_f64(vaddq_f64(vmulq_f64(val, scale), offset));
+        const float64x2_t clamped = vmaxnmq_f64(vminnmq_f64(rounded, upper), lower);
+        vst1q_s64(&d[i], vbslq_s64(isNumber, vcvtq_s64_f64(clamped), missing));
+    }
+    _om_common_copy_double_to_int64_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+static void _om_common_copy_int16_to_float_neon(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const int16_t* s = src;
+    float* d = dst;
+    const float32x4_t scale = vdupq_n_f32(scale_factor), offset = vdupq_n_f32(add_offset), nan = vdupq_n_f32(NAN);
+    const int32x4_t missing = vdupq_n_s32(INT16_MAX);
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const int32x4_t val = vmovl_s16(vld1_s16(&s[i]));
+        const float32x4_t scaled = vsubq_f32(vdivq_f32(vcvtq_f32_s32(val), scale), offset);
+        vst1q_f32(&d[i], vbslq_f32(vceqq_s32(val, missing), nan, scaled));
+    }
+    _om_common_copy_int16_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+static void _om_common_copy_int32_to_float_neon(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const int32_t* s = src;
+    float* d = dst;
+    const float32x4_t scale = vdupq_n_f32(scale_factor), offset = vdupq_n_f32(add_offset), nan = vdupq_n_f32(NAN);
+    const int32x4_t missing = vdupq_n_s32(INT32_MAX);
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const int32x4_t val = vld1q_s32(&s[i]);
+        const float32x4_t scaled = vsubq_f32(vdivq_f32(vcvtq_f32_s32(val), scale), offset);
+        vst1q_f32(&d[i], vbslq_f32(vceqq_s32(val, missing), nan, scaled));
+    }
+    _om_common_copy_int32_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+static void _om_common_copy_int64_to_double_neon(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const int64_t* s = src;
+    double* d = dst;
+    const float64x2_t scale = vdupq_n_f64((double)scale_factor), offset = vdupq_n_f64((double)add_offset), nan = vdupq_n_f64(NAN);
+    const int64x2_t missing = vdupq_n_s64(INT64_MAX);
+    uint64_t i = 0;
+    for (; i + 2 <= length; i += 2) {
+        const int64x2_t val = vld1q_s64(&s[i]);
+        const float64x2_t scaled = vsubq_f64(vdivq_f64(vcvtq_f64_s64(val), scale), offset);
+        vst1q_f64(&d[i], vbslq_f64(vceqq_s64(val, missing), nan, scaled));
+    }
+    _om_common_copy_int64_to_double_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+static void _om_common_copy_float16_to_float_neon(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const uint16_t* s = src;
+    float* d = dst;
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        vst1q_f32(&d[i], vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(&s[i]))));
+    }
+    _om_common_copy_float16_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+static void _om_common_copy_bfloat16_to_float_neon(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const uint16_t* s = src;
+    float* d = dst;
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        vst1q_u32((uint32_t*)&d[i], vshll_n_u16(vld1_u16(&s[i]), 16));
+    }
+    _om_common_copy_bfloat16_to_float_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+static void _om_common_copy_float_to_float16_neon(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const float* s = src;
+    uint16_t* d = dst;
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        vst1_u16(&d[i], vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(&s[i]))));
+    }
+    _om_common_copy_float_to_float16_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+
+static void _om_common_copy_float_to_bfloat16_neon(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    const float* s = src;
+    uint16_t* d = dst;
+    const uint32x4_t roundBias = vdupq_n_u32(0x7FFF), one = vdupq_n_u32(1);
+    const uint32x4_t magnitude = vdupq_n_u32(0x7FFFFFFF), infinity = vdupq_n_u32(0x7F800000);
+    const uint16x4_t quiet = vdup_n_u16(0x40);
+    uint64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const uint32x4_t u = vld1q_u32((const uint32_t*)&s[i]);
+        const uint16x4_t rounded = vshrn_n_u32(vaddq_u32(vaddq_u32(u, roundBias), vandq_u32(vshrq_n_u32(u, 16), one)), 16);
+        const uint16x4_t isNan = vmovn_u32(vcgtq_u32(vandq_u32(u, magnitude), infinity));
+        vst1_u16(&d[i], vbsl_u16(isNan, vorr_u16(vshrn_n_u32(u, 16), quiet), rounded));
+    }
+    _om_common_copy_float_to_bfloat16_scalar(length - i, scale_factor, add_offset, &s[i], &d[i]);
+}
+#endif // OM_COMMON_NEON
+
+/// Codecs of the regular build
+static const OmCodecs_t _om_common_codecs_baseline = {
+#if defined(__aarch64__)
+    OM_CPU_ISA_NEON,
+#elif defined(__SSE4_1__)
+    OM_CPU_ISA_SSE41,
+#else
+    OM_CPU_ISA_SCALAR,
+#endif
+    p4nzdec8, p4nddec8, p4nzdec128v16, p4nddec128v16, p4nzdec128v32, p4nddec128v32, p4nzdec64, p4nddec64,
+    p4nzenc8, p4ndenc8, p4nzenc128v16, p4ndenc128v16, p4nzenc128v32, p4ndenc128v32, p4nzenc64, p4ndenc64,
+    p4nzzdec128v8, p4nzzdec128v16, p4nzzdec128v32, p4nzzdec128v64,
+    p4nzzenc128v8, p4nzzenc128v16, p4nzzenc128v32, p4nzzenc128v64,
+    fpxdec16, fpxdec32, fpxdec64, fpxenc16, fpxenc32, fpxenc64,
+    fpfcmdec32, fpfcmdec64, fpfcmenc32, fpfcmenc64,
+    fpdfcmdec32, fpdfcmdec64, fpdfcmenc32, fpdfcmenc64,
+    fp2dfcmdec32, fp2dfcmdec64, fp2dfcmenc32, fp2dfcmenc64
+};
+
+#if OM_COMMON_X86_DISPATCH
+// Entry points of the AVX2 build of TurboPFor. See om_codec_avx2.h
+size_t om_avx2_p4nzdec8(unsigned char *__restrict in, size_t n, uint8_t *__restrict out);
+size_t om_avx2_p4nddec8(unsigned char *__restrict in, size_t n, uint8_t *__restrict out);
+size_t om_avx2_p4nzdec128v16(unsigned char *__restrict in, size_t n, uint16_t *__restrict out);
+size_t om_avx2_p4nddec128v16(unsigned char *__restrict in, size_t n, uint16_t *__restrict out);
+size_t om_avx2_p4nzdec128v32(unsigned char *__restrict in, size_t n, uint32_t *__restrict out);
+size_t om_avx2_p4nddec128v32(unsigned char *__restrict in, size_t n, uint32_t *__restrict out);
+size_t om_avx2_p4nzdec64(unsigned char *__restrict in, size_t n, uint64_t *__restrict out);
+size_t om_avx2_p4nddec64(unsigned char *__restrict in, size_t n, uint64_t *__restrict out);
+size_t om_avx2_p4nzenc8(uint8_t *__restrict in, size_t n, unsigned char *__restrict out);
+size_t om_avx2_p4ndenc8(uint8_t *__restrict in, size_t n, unsigned char *__restrict out);
+size_t om_avx2_p4nzenc128v16(uint16_t *__restrict in, size_t n, unsigned char *__restrict out);
+size_t om_avx2_p4ndenc128v16(uint16_t *__restrict in, size_t n, unsigned char *__restrict out);
+size_t om_avx2_p4nzenc128v32(uint32_t *__restrict in, size_t n, unsigned char *__restrict out);
+size_t om_avx2_p4ndenc128v32(uint32_t *__restrict in, size_t n, unsigned char *__restrict out);
+size_t om_avx2_p4nzenc64(uint64_t *__restrict in, size_t n, unsigned char *__restrict out);
+size_t om_avx2_p4ndenc64(uint64_t *__restrict in, size_t n, unsigned char *__restrict out);
+size_t om_avx2_p4nzzdec128v8(unsigned char *in, size_t n, uint8_t *out, uint8_t start);
+size_t om_avx2_p4nzzdec128v16(unsigned char *in, size_t n, uint16_t *out, uint16_t start);
+size_t om_avx2_p4nzzdec128v32(unsigned char *in, size_t n, uint32_t *out, uint32_t start);
+size_t om_avx2_p4nzzdec128v64(unsigned char *in, size_t n, uint64_t *out, uint64_t start);
+size_t om_avx2_p4nzzenc128v8(uint8_t *in, size_t n, unsigned char *out, uint8_t start);
+size_t om_avx2_p4nzzenc128v16(uint16_t *in, size_t n, unsigned char *out, uint16_t start);
+size_t om_avx2_p4nzzenc128v32(uint32_t *in, size_t n, unsigned char *out, uint32_t start);
+size_t om_avx2_p4nzzenc128v64(uint64_t *in, size_t n, unsigned char *out, uint64_t start);
+size_t om_avx2_fpxdec16(unsigned char *in, size_t n, uint16_t *out, uint16_t start);
+size_t om_avx2_fpxdec32(unsigned char *in, size_t n, uint32_t *out, uint32_t start);
+size_t om_avx2_fpxdec64(unsigned char *in, size_t n, uint64_t *out, uint64_t start);
+size_t om_avx2_fpxenc16(uint16_t *in, size_t n, unsigned char *out, uint16_t start);
+size_t om_avx2_fpxenc32(uint32_t *in, size_t n, unsigned char *out, uint32_t start);
+size_t om_avx2_fpxenc64(uint64_t *in, size_t n, unsigned char *out, uint64_t start);
+size_t om_avx2_fpfcmdec32(unsigned char *in, size_t n, uint32_t *out, uint32_t start);
+size_t om_avx2_fpfcmdec64(unsigned char *in, size_t n, uint64_t *out, uint64_t start);
+size_t om_avx2_fpfcmenc32(uint32_t *in, size_t n, unsigned char *out, uint32_t start);
+size_t om_avx2_fpfcmenc64(uint64_t *in, size_t n, unsigned char *out, uint64_t start);
+size_t om_avx2_fpdfcmdec32(unsigned char *in, size_t n, uint32_t *out, uint32_t start);
+size_t om_avx2_fpdfcmdec64(unsigned char *in, size_t n, uint64_t *out, uint64_t start);
+size_t om_avx2_fpdfcmenc32(uint32_t *in, size_t n, unsigned char *out, uint32_t start);
+size_t om_avx2_fpdfcmenc64(uint64_t *in, size_t n, unsigned char *out, uint64_t start);
+size_t om_avx2_fp2dfcmdec32(unsigned char *in, size_t n, uint32_t *out, uint32_t start);
+size_t om_avx2_fp2dfcmdec64(unsigned char *in, size_t n, uint64_t *out, uint64_t start);
+size_t om_avx2_fp2dfcmenc32(uint32_t *in, size_t n, unsigned char *out, uint32_t start);
+size_t om_avx2_fp2dfcmenc64(uint64_t *in, size_t n, unsigned char *out, uint64_t start);
+
+static const OmCodecs_t _om_common_codecs_avx2 = {
+    OM_CPU_ISA_AVX2,
+    om_avx2_p4nzdec8, om_avx2_p4nddec8, om_avx2_p4nzdec128v16, om_avx2_p4nddec128v16, om_avx2_p4nzdec128v32, om_avx2_p4nddec128v32, om_avx2_p4nzdec64, om_avx2_p4nddec64,
+    om_avx2_p4nzenc8, om_avx2_p4ndenc8, om_avx2_p4nzenc128v16, om_avx2_p4ndenc128v16, om_avx2_p4nzenc128v32, om_avx2_p4ndenc128v32, om_avx2_p4nzenc64, om_avx2_p4ndenc64,
+    om_avx2_p4nzzdec128v8, om_avx2_p4nzzdec128v16, om_avx2_p4nzzdec128v32, om_avx2_p4nzzdec128v64,
+    om_avx2_p4nzzenc128v8, om_avx2_p4nzzenc128v16, om_avx2_p4nzzenc128v32, om_avx2_p4nzzenc128v64,
+    om_avx2_fpxdec16, om_avx2_fpxdec32, om_avx2_fpxdec64, om_avx2_fpxenc16, om_avx2_fpxenc32, om_avx2_fpxenc64,
+    om_avx2_fpfcmdec32, om_avx2_fpfcmdec64, om_avx2_fpfcmenc32, om_avx2_fpfcmenc64,
+    om_avx2_fpdfcmdec32, om_avx2_fpdfcmdec64, om_avx2_fpdfcmenc32, om_avx2_fpdfcmenc64,
+    om_avx2_fp2dfcmdec32, om_avx2_fp2dfcmdec64, om_avx2_fp2dfcmenc32, om_avx2_fp2dfcmenc64
+};
+#endif
+
+/// Conversion kernels and codecs for one instruction set
+typedef struct {
+    OmCpuIsa_t isa;
+    const OmCodecs_t* codecs;
+    om_common_copy_function_t copy_float_to_int16;
+    om_common_copy_function_t copy_float_to_int32;
+    om_common_copy_function_t copy_double_to_int64;
+    om_common_copy_function_t copy_int16_to_float;
+    om_common_copy_function_t copy_int32_to_float;
+    om_common_copy_function_t copy_int64_to_double;
+    om_common_copy_function_t copy_float16_to_float;
+    om_common_copy_function_t copy_bfloat16_to_float;
+    om_common_copy_function_t copy_float_to_float16;
+    om_common_copy_function_t copy_float_to_bfloat16;
+} OmCommonKernels_t;
+
+static const OmCommonKernels_t _om_common_kernels_scalar = {
+    OM_CPU_ISA_SCALAR,
+    &_om_common_codecs_baseline,
+    _om_common_copy_float_to_int16_scalar,
+    _om_common_copy_float_to_int32_scalar,
+    _om_common_copy_double_to_int64_scalar,
+    _om_common_copy_int16_to_float_scalar,
+    _om_common_copy_int32_to_float_scalar,
+    _om_common_copy_int64_to_double_scalar,
+    _om_common_copy_float16_to_float_scalar,
+    _om_common_copy_bfloat16_to_float_scalar,
+    _om_common_copy_float_to_float16_scalar,
+    _om_common_copy_float_to_bfloat16_scalar
+};
+
+#if OM_COMMON_X86_DISPATCH
+// There is no int64/double conversion before AVX-512. The 64 bit kernels stay scalar.
+// F16C is not part of SSE4.1. Rounding float to half precision stays scalar.
+static const OmCommonKernels_t _om_common_kernels_sse41 = {
+    OM_CPU_ISA_SSE41,
+    &_om_common_codecs_baseline,
+    _om_common_copy_float_to_int16_sse41,
+    _om_common_copy_float_to_int32_sse41,
+    _om_common_copy_double_to_int64_scalar,
+    _om_common_copy_int16_to_float_sse41,
+    _om_common_copy_int32_to_float_sse41,
+    _om_common_copy_int64_to_double_scalar,
+    _om_common_copy_float16_to_float_sse41,
+    _om_common_copy_bfloat16_to_float_sse41,
+    _om_common_copy_float_to_float16_scalar,
+    _om_common_copy_float_to_bfloat16_sse41
+};
+
+static const OmCommonKernels_t _om_common_kernels_avx2 = {
+    OM_CPU_ISA_AVX2,
+    &_om_common_codecs_avx2,
+    _om_common_copy_float_to_int16_avx2,
+    _om_common_copy_float_to_int32_avx2,
+    _om_common_copy_double_to_int64_scalar,
+    _om_common_copy_int16_to_float_avx2,
+    _om_common_copy_int32_to_float_avx2,
+    _om_common_copy_int64_to_double_scalar,
+    _om_common_copy_float16_to_float_avx2,
+    _om_common_copy_bfloat16_to_float_avx2,
+    _om_common_copy_float_to_float16_avx2,
+    _om_common_copy_float_to_bfloat16_avx2
+};
+#endif
+
+#if OM_COMMON_NEON
+static const OmCommonKernels_t _om_common_kernels_neon = {
+    OM_CPU_ISA_NEON,
+    &_om_common_codecs_baseline,
+    _om_common_copy_float_to_int16_neon,
+    _om_common_copy_float_to_int32_neon,
+    _om_common_copy_double_to_int64_neon,
+    _om_common_copy_int16_to_float_neon,
+    _om_common_copy_int32_to_float_neon,
+    _om_common_copy_int64_to_double_neon,
+    _om_common_copy_float16_to_float_neon,
+    _om_common_copy_bfloat16_to_float_neon,
+    _om_common_copy_float_to_float16_neon,
+    _om_common_copy_float_to_bfloat16_neon
+};
+#endif
+
+/// Kernel table in use. Resolved on first use. Concurrent resolution stores the same table.
+static _Atomic(const OmCommonKernels_t*) _om_common_kernels = NULL;
+
+/// Return the kernel table for an instruction set or NULL if the CPU does not support it
+static const OmCommonKernels_t* _om_common_kernels_for_isa(OmCpuIsa_t isa) {
+    switch (isa) {
+        case OM_CPU_ISA_SCALAR:
+            return &_om_common_kernels_scalar;
+        case OM_CPU_ISA_SSE41:
+#if OM_COMMON_X86_DISPATCH
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse4.1") ? &_om_common_kernels_sse41 : NULL;
+#else
+            return NULL;
+#endif
+        case OM_CPU_ISA_AVX2:
+#if OM_COMMON_X86_DISPATCH
+            __builtin_cpu_init();
+            // The AVX2 build of TurboPFor also uses BMI1/2, LZCNT and POPCNT (x86-64-v3)
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi") && __builtin_cpu_supports("bmi2") &&
+                __builtin_cpu_supports("lzcnt") && __builtin_cpu_supports("popcnt") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c") ? &_om_common_kernels_avx2 : NULL;
+#else
+            return NULL;
+#endif
+        case OM_CPU_ISA_NEON:
+#if OM_COMMON_NEON
+            return &_om_common_kernels_neon;
+#else
+            return NULL;
+#endif
+    }
+    return NULL;
+}
+
+static inline const OmCommonKernels_t* _om_common_kernels_get(void) {
+    const OmCommonKernels_t* kernels = atomic_load_explicit(&_om_common_kernels, memory_order_acquire);
+    if (kernels != NULL) {
+        return kernels;
+    }
+    // Pick the best available instruction set
+    const OmCpuIsa_t preferred[] = {OM_CPU_ISA_AVX2, OM_CPU_ISA_NEON, OM_CPU_ISA_SSE41, OM_CPU_ISA_SCALAR};
+    for (uint64_t i = 0; i < sizeof(preferred) / sizeof(preferred[0]); i++) {
+        kernels = _om_common_kernels_for_isa(preferred[i]);
+        if (kernels != NULL) {
+            break;
+        }
+    }
+    atomic_store_explicit(&_om_common_kernels, kernels, memory_order_release);
+    return kernels;
+}
+
+OmCpuIsa_t om_common_cpu_isa(void) {
+    return _om_common_kernels_get()->isa;
+}
+
+const OmCodecs_t* om_common_codecs(void) {
+    return _om_common_kernels_get()->codecs;
+}
+
+bool om_common_set_cpu_isa(OmCpuIsa_t isa) {
+    const OmCommonKernels_t* kernels = _om_common_kernels_for_isa(isa);
+    if (kernels == NULL) {
+        return false;
+    }
+    atomic_store_explicit(&_om_common_kernels, kernels, memory_order_release);
+    return true;
+}
+
+const char* om_common_cpu_isa_string(OmCpuIsa_t isa) {
+    switch (isa) {
+        case OM_CPU_ISA_SCALAR:
+            return "scalar";
+        case OM_CPU_ISA_SSE41:
+            return "sse4.1";
+        case OM_CPU_ISA_AVX2:
+            return "avx2";
+        case OM_CPU_ISA_NEON:
+            return "neon";
+    }
+    return "";
+}
+
+void om_common_copy_float_to_int16(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    _om_common_kernels_get()->copy_float_to_int16(length, scale_factor, add_offset, src, dst);
+}
+
+void om_common_copy_float_to_int32(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    _om_common_kernels_get()->copy_float_to_int32(length, scale_factor, add_offset, src, dst);
+}
+
+void om_common_copy_double_to_int64(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    _om_common_kernels_get()->copy_double_to_int64(length, scale_factor, add_offset, src, dst);
+}
+
+bool om_common_copy_float_to_int32_checked(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    om_common_copy_float_to_int32(length, scale_factor, add_offset, src, dst);
+    // `(float)INT32_MAX` is 2^31. Floats close to 2^31 are integers, so rounding does not change the result of the comparison.
+    // The loop has no early exit to be vectorised.
+    const float* s = src;
+    bool valid = true;
+    for (uint64_t i = 0; i < length; ++i) {
+        const float scaled = s[i] * scale_factor + add_offset;
+        valid &= (s[i] != s[i]) | ((scaled >= (float)INT32_MIN) & (scaled < (float)INT32_MAX));
+    }
+    return valid;
+}
+
+bool om_common_copy_double_to_int64_checked(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    om_common_copy_double_to_int64(length, scale_factor, add_offset, src, dst);
+    const double* s = src;
+    bool valid = true;
+    for (uint64_t i = 0; i < length; ++i) {
+        const double scaled = s[i] * (double)scale_factor + (double)add_offset;
+        valid &= (s[i] != s[i]) | ((scaled >= (double)INT64_MIN) & (scaled < (double)INT64_MAX));
+    }
+    return valid;
+}
+
+void om_common_copy_int16_to_float(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    _om_common_kernels_get()->copy_int16_to_float(length, scale_factor, add_offset, src, dst);
+}
+
+void om_common_copy_int32_to_float(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    _om_common_kernels_get()->copy_int32_to_float(length, scale_factor, add_offset, src, dst);
+}
+
+void om_common_copy_int64_to_double(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    _om_common_kernels_get()->copy_int64_to_double(length, scale_factor, add_offset, src, dst);
+}
+
+void om_common_copy_float16_to_float(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    _om_common_kernels_get()->copy_float16_to_float(length, scale_factor, add_offset, src, dst);
+}
+
+void om_common_copy_bfloat16_to_float(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    _om_common_kernels_get()->copy_bfloat16_to_float(length, scale_factor, add_offset, src, dst);
+}
+
+void om_common_copy_float_to_float16(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    _om_common_kernels_get()->copy_float_to_float16(length, scale_factor, add_offset, src, dst);
+}
+
+void om_common_copy_float_to_bfloat16(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
+    _om_common_kernels_get()->copy_float_to_bfloat16(length, scale_factor, add_offset, src, dst);
+}
+
+void om_common_decode_delta2d_int16_to_float(uint64_t length0, uint64_t length1, float scale_factor, float add_offset, const int16_t* previous_row, int16_t* src, float* dst) {
+    for (uint64_t d0 = 0; d0 < length0; d0++) {
+        int16_t* row = &src[d0 * length1];
+        float* out = &dst[d0 * length1];
+        if (previous_row == NULL) {
+            for (uint64_t d1 = 0; d1 < length1; d1++) {
+                const int16_t val = row[d1];
+                out[d1] = (val == INT16_MAX) ? NAN : (float)val / scale_factor - add_offset;
+            }
+        } else {
+            for (uint64_t d1 = 0; d1 < length1; d1++) {
+                const int16_t val = row[d1] + previous_row[d1];
+                row[d1] = val;
+                out[d1] = (val == INT16_MAX) ? NAN : (float)val / scale_factor - add_offset;
+            }
+        }
+        previous_row = row;
+    }
+}
+
 void om_common_copy8(uint64_t length, float scale_factor, float add_offset, const void* src, void* dst) {
     for (uint64_t i = 0; i < length; ++i) {
         ((int8_t *)dst)[i] = ((int8_t *)src)[i];
@@ -216,18 +1045,39 @@ void om_common_copy64(uint64_t length, float scale_factor, float add_offset, con
     }
 }
 
+#define OM_COMMON_ROUND_MANTISSA(NAME, UINT, MANTISSA_BITS, EXPONENT_MASK) \
+void NAME(uint64_t length, uint8_t mantissa_bits, const void* src, void* dst) { \
+    const unsigned drop = MANTISSA_BITS - (unsigned)mantissa_bits; \
+    const UINT mask = ((UINT)1 << drop) - 1; \
+    const UINT half = ((UINT)1 << (drop - 1)) - 1; \
+    for (uint64_t i = 0; i < length; ++i) { \
+        const UINT u = ((const UINT *)src)[i]; \
+        if ((u & EXPONENT_MASK) == EXPONENT_MASK) { \
+            ((UINT *)dst)[i] = u; \
+            continue; \
+        } \
+        const UINT rounded = (u + half + ((u >> drop) & 1)) & ~mask; \
+        ((UINT *)dst)[i] = (rounded & EXPONENT_MASK) == EXPONENT_MASK ? (u & ~mask) : rounded; \
+    } \
+}
+
+OM_COMMON_ROUND_MANTISSA(om_common_copy_float_round_mantissa, uint32_t, 23, 0x7F800000u)
+OM_COMMON_ROUND_MANTISSA(om_common_copy_double_round_mantissa, uint64_t, 52, 0x7FF0000000000000ull)
+OM_COMMON_ROUND_MANTISSA(om_common_copy_float16_round_mantissa, uint16_t, 10, 0x7C00u)
+OM_COMMON_ROUND_MANTISSA(om_common_copy_bfloat16_round_mantissa, uint16_t, 7, 0x7F80u)
+
 uint64_t om_common_compress_fpxenc32(const void* src, uint64_t length, void* dst) {
-    return fpxenc32((uint32_t*)src, length, (unsigned char *)dst, 0);
+    return om_common_codecs()->fpxenc32((uint32_t*)src, length, (unsigned char *)dst, 0);
 }
 
 uint64_t om_common_compress_fpxenc64(const void* src, uint64_t length, void* dst) {
-    return fpxenc64((uint64_t*)src, length, (unsigned char *)dst, 0);
+    return om_common_codecs()->fpxenc64((uint64_t*)src, length, (unsigned char *)dst, 0);
 }
 
 uint64_t om_common_decompress_fpxdec32(const void* src, uint64_t length, void* dst) {
-    return fpxdec32((unsigned char *)src, length, (uint32_t *)dst, 0);
+    return om_common_codecs()->fpxdec32((unsigned char *)src, length, (uint32_t *)dst, 0);
 }
 
 uint64_t om_common_decompress_fpxdec64(const void* src, uint64_t length, void* dst) {
-    return fpxdec64((unsigned char *)src, length, (uint64_t *)dst, 0);
+    return om_common_codecs()->fpxdec64((unsigned char *)src, length, (uint64_t *)dst, 0);
 }
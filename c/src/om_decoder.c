@@ -6,11 +6,15 @@
 //
 
 #include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
 #include "vp4.h"
 #include "fp.h"
 #include "conf.h"
 #include "delta2d.h"
 #include "om_decoder.h"
+#include "om_thread_pool.h"
 
 #pragma clang diagnostic error "-Wswitch"
 
@@ -21,6 +25,89 @@ void om_decoder_init_data_read(OmDecoder_dataRead_t *data_read, const OmDecoder_
     data_read->chunkIndex.lowerBound = 0;
     data_read->chunkIndex.upperBound = 0;
     data_read->nextChunk = index_read->chunkIndex;
+    memcpy(data_read->nextChunkCoordinate, index_read->chunkCoordinate, sizeof(data_read->nextChunkCoordinate));
+}
+
+/// Compute the geometry of chunk `c0` along one dimension
+static OmReadPlanShape_t _om_read_plan_shape(const OmReadPlanDimension_t* dim, uint64_t dimension, uint64_t read_count, uint64_t c0) {
+    const uint64_t chunkGlobal0Start = c0 * dim->chunk;
+    const uint64_t chunkGlobal0End = min(chunkGlobal0Start + dim->chunk, dimension);
+    const uint64_t clampedGlobal0Start = max(chunkGlobal0Start, dim->read_offset);
+    const uint64_t clampedGlobal0End = min(chunkGlobal0End, dim->read_offset + read_count);
+    return (OmReadPlanShape_t){
+        .length = chunkGlobal0End - chunkGlobal0Start,
+        .read_start = clampedGlobal0Start - chunkGlobal0Start,
+        .read_count = clampedGlobal0End - clampedGlobal0Start
+    };
+}
+
+/// Precompute strides, chunk ranges and chunk shape classes for each dimension.
+/// Called by `om_decoder_init` after all decoder fields are set.
+static void _om_decoder_init_read_plan(OmDecoder_t* decoder) {
+    OmReadPlan_t* plan = &decoder->plan;
+    const uint64_t dimensions_count = decoder->dimensions_count;
+    if (dimensions_count == 0 || dimensions_count > OM_READ_PLAN_MAX_DIMENSIONS) {
+        plan->dimensions_count = 0;
+        return;
+    }
+    plan->dimensions_count = dimensions_count;
+    plan->linear_dimensions_count = 0;
+
+    uint64_t chunkStride = 1;
+    uint64_t cubeStride = 1;
+    uint64_t linearReadCount = 1;
+    bool linearRead = true;
+
+    for (uint64_t i_forward = 0; i_forward < dimensions_count; i_forward++) {
+        const uint64_t i = dimensions_count - i_forward - 1;
+        OmReadPlanDimension_t* dim = &plan->dimensions[i];
+        const uint64_t dimension = decoder->dimensions[i];
+        const uint64_t chunk = decoder->chunks[i];
+        const uint64_t read_offset = decoder->read_offset[i];
+        const uint64_t read_count = decoder->read_count[i];
+
+        dim->chunk = chunk;
+        dim->read_offset = read_offset;
+        dim->cube_offset = decoder->cube_offset == NULL ? 0 : decoder->cube_offset[i];
+        dim->cube_dimension = decoder->cube_dimensions == NULL ? read_count : decoder->cube_dimensions[i];
+        dim->cube_stride = cubeStride;
+        dim->chunk_count = divide_rounded_up(dimension, chunk);
+        dim->chunk_lower = read_offset / chunk;
+        dim->chunk_upper = divide_rounded_up(read_offset + read_count, chunk);
+        dim->chunk_stride = chunkStride;
+
+        // Same rules as in `_om_decoder_next_chunk_position`
+        if (i == dimensions_count - 1 && dimension != read_count) {
+            linearReadCount = dim->chunk_upper - dim->chunk_lower;
+            linearRead = false;
+        }
+        if (linearRead && dimension == read_count) {
+            linearReadCount *= dim->chunk_count;
+        } else {
+            linearRead = false;
+        }
+        dim->linear_chunk_count = linearReadCount;
+        if (linearRead || i == dimensions_count - 1) {
+            plan->linear_dimensions_count = i_forward + 1;
+        }
+
+        // Interior chunks are never truncated by the array edge. If there are no interior chunks, this entry is unused
+        dim->shape[OM_CHUNK_SHAPE_FIRST] = _om_read_plan_shape(dim, dimension, read_count, dim->chunk_lower);
+        dim->shape[OM_CHUNK_SHAPE_INTERIOR] = (OmReadPlanShape_t){.length = chunk, .read_start = 0, .read_count = chunk};
+        dim->shape[OM_CHUNK_SHAPE_LAST] = _om_read_plan_shape(dim, dimension, read_count, dim->chunk_upper - 1);
+
+        chunkStride *= dim->chunk_count;
+        cubeStride *= dim->cube_dimension;
+    }
+}
+
+/// Split a linear chunk index into chunk coordinates for each dimension
+static void _om_decoder_chunk_coordinate(const OmReadPlan_t* plan, uint64_t chunk_index, uint64_t* chunk_coordinate) {
+    for (uint64_t i_forward = 0; i_forward < plan->dimensions_count; i_forward++) {
+        const uint64_t i = plan->dimensions_count - i_forward - 1;
+        chunk_coordinate[i] = chunk_index % plan->dimensions[i].chunk_count;
+        chunk_index /= plan->dimensions[i].chunk_count;
+    }
 }
 
 OmError_t om_decoder_init(
@@ -40,6 +127,8 @@ OmError_t om_decoder_init(
     uint8_t data_type;
     uint8_t compression;
     uint64_t lut_size, lut_start, lut_chunk_length;
+    uint64_t statistics_offset = 0, statistics_size = 0;
+    OmLutEncoding_t lut_encoding = LUT_ENCODING_PFOR;
 
     switch (_om_variable_memory_layout(variable)) {
         case OM_MEMORY_LAYOUT_LEGACY: {
@@ -64,13 +153,18 @@ OmError_t om_decoder_init(
             const OmVariableArrayV3_t* metaV3 = (const OmVariableArrayV3_t*)variable;
             scalefactor = metaV3->scale_factor;
             add_offset = metaV3->add_offset;
-            data_type = metaV3->data_type;
-            compression = metaV3->compression_type;
+            data_type = om_variable_get_type(variable);
+            compression = om_variable_get_compression(variable);
+            lut_encoding = om_variable_get_lut_encoding(variable);
             lut_size = metaV3->lut_size;
             lut_start = metaV3->lut_offset;
             dimensions = om_variable_get_dimensions(variable).values;
             chunks = om_variable_get_chunks(variable).values;
             lut_chunk_length = 1;
+            if (!om_variable_get_chunk_statistics(variable, &statistics_offset, &statistics_size)) {
+                statistics_offset = 0;
+                statistics_size = 0;
+            }
             break;
         }
         case OM_MEMORY_LAYOUT_SCALAR:
@@ -101,9 +195,36 @@ OmError_t om_decoder_init(
     }
 
     // Correctly calculate number of chunks
+    uint64_t lut_chunk_element_count = 1;
+    uint64_t lut_block_offsets_start = 0;
     if (lut_chunk_length > 0) {
-        const uint64_t nLutChunks = divide_rounded_up(nChunks+1, LUT_CHUNK_COUNT);
-        lut_chunk_length = lut_size / nLutChunks;
+        switch (lut_encoding) {
+            case LUT_ENCODING_PFOR: {
+                const uint64_t nLutChunks = divide_rounded_up(nChunks+1, LUT_CHUNK_COUNT);
+                lut_chunk_length = lut_size / nLutChunks;
+                lut_chunk_element_count = LUT_CHUNK_COUNT;
+                break;
+            }
+            case LUT_ENCODING_FIXED_WIDTH:
+                // Each entry uses the same number of bytes, at most 8
+                lut_chunk_length = lut_size / (nChunks+1);
+                if (lut_chunk_length == 0 || lut_chunk_length > sizeof(uint64_t) || lut_chunk_length * (nChunks+1) != lut_size) {
+                    return ERROR_OUT_OF_BOUND_READ;
+                }
+                break;
+            case LUT_ENCODING_PFOR_VARIABLE: {
+                // The LUT ends with a table with the start and end of each block. Blocks may be interleaved with chunk data.
+                const uint64_t nLutChunks = divide_rounded_up(nChunks+1, LUT_CHUNK_COUNT);
+                const uint64_t blockOffsetsSize = nLutChunks * 2 * sizeof(uint64_t);
+                if (lut_size < blockOffsetsSize + nLutChunks) {
+                    return ERROR_OUT_OF_BOUND_READ;
+                }
+                lut_chunk_length = 1;
+                lut_chunk_element_count = LUT_CHUNK_COUNT;
+                lut_block_offsets_start = lut_start + lut_size - blockOffsetsSize;
+                break;
+            }
+        }
     }
 
     decoder->number_of_chunks = nChunks;
@@ -117,15 +238,33 @@ OmError_t om_decoder_init(
     decoder->cube_offset = cube_offset;
     decoder->cube_dimensions = cube_dimensions;
     decoder->lut_chunk_length = lut_chunk_length;
+    decoder->lut_chunk_element_count = lut_chunk_element_count;
+    decoder->lut_block_offsets_start = lut_block_offsets_start;
+    decoder->lut_block_offsets = NULL;
+    decoder->lut_block_offsets_first = 0;
     decoder->lut_start = lut_start;
     decoder->io_size_merge = io_size_merge;
     decoder->io_size_max = io_size_max;
+    decoder->io_request_ns = 0;
+    decoder->io_ns_per_byte = 0;
     decoder->data_type = data_type;
+    decoder->output_data_type = data_type;
     decoder->compression = compression;
+    decoder->chunk_cache = NULL;
+    decoder->chunk_cache_file_id = 0;
+    decoder->lut_cache = NULL;
+    decoder->statistics_offset = statistics_offset;
+    decoder->statistics_size = statistics_size;
+    decoder->predicate_statistics = NULL;
+    decoder->predicate_first_chunk = 0;
+    decoder->predicate_lower = -INFINITY;
+    decoder->predicate_upper = INFINITY;
+    decoder->constant_chunks = om_variable_has_constant_chunks(variable);
 
     OmError_t error = ERROR_OK;
     decoder->bytes_per_element = om_get_bytes_per_element(data_type, &error);
     decoder->bytes_per_element_compressed = om_get_bytes_per_element_compressed(data_type, compression, &error);
+    _om_decoder_init_read_plan(decoder);
     return error;
 }
 
@@ -142,47 +281,114 @@ ALWAYS_INLINE uint64_t om_decode_decompress(
         case COMPRESSION_PFOR_DELTA2D_INT16:
         case COMPRESSION_PFOR_DELTA2D_INT16_LOGARITHMIC:
             assert(data_type == DATA_TYPE_FLOAT_ARRAY && "Expecting float array");
-            result = p4nzdec128v16((unsigned char*)input, (size_t)count, (uint16_t*)output);
+            result = om_common_codecs()->p4nzdec128v16((unsigned char*)input, (size_t)count, (uint16_t*)output);
             break;
         case COMPRESSION_FPX_XOR2D:
-            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            assert((data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY || data_type == DATA_TYPE_FLOAT16_ARRAY || data_type == DATA_TYPE_BFLOAT16_ARRAY) && "Expecting floating point array");
             if (data_type == DATA_TYPE_FLOAT_ARRAY) {
                 result = om_common_decompress_fpxdec32((unsigned char*)input, (size_t)count, (float*)output);
             } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
                 result = om_common_decompress_fpxdec64((unsigned char*)input, (size_t)count, (double*)output);
+            } else {
+                result = om_common_codecs()->fpxdec16((unsigned char*)input, (size_t)count, (uint16_t*)output, 0);
+            }
+            break;
+        case COMPRESSION_FPX_FCM:
+            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            if (data_type == DATA_TYPE_FLOAT_ARRAY) {
+                result = om_common_codecs()->fpfcmdec32((unsigned char*)input, (size_t)count, (uint32_t*)output, 0);
+            } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
+                result = om_common_codecs()->fpfcmdec64((unsigned char*)input, (size_t)count, (uint64_t*)output, 0);
+            }
+            break;
+        case COMPRESSION_FPX_DFCM:
+            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            if (data_type == DATA_TYPE_FLOAT_ARRAY) {
+                result = om_common_codecs()->fpdfcmdec32((unsigned char*)input, (size_t)count, (uint32_t*)output, 0);
+            } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
+                result = om_common_codecs()->fpdfcmdec64((unsigned char*)input, (size_t)count, (uint64_t*)output, 0);
+            }
+            break;
+        case COMPRESSION_FPX_2DFCM:
+            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            if (data_type == DATA_TYPE_FLOAT_ARRAY) {
+                result = om_common_codecs()->fp2dfcmdec32((unsigned char*)input, (size_t)count, (uint32_t*)output, 0);
+            } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
+                result = om_common_codecs()->fp2dfcmdec64((unsigned char*)input, (size_t)count, (uint64_t*)output, 0);
             }
             break;
+        case COMPRESSION_PFOR_LORENZO:
         case COMPRESSION_PFOR_DELTA2D:
             switch (data_type) {
                 case DATA_TYPE_INT8_ARRAY:
-                    result = p4nzdec8((unsigned char*)input, (size_t)count, (uint8_t*)output);
+                    result = om_common_codecs()->p4nzdec8((unsigned char*)input, (size_t)count, (uint8_t*)output);
                     break;
                 case DATA_TYPE_UINT8_ARRAY:
-                    result = p4nddec8((unsigned char*)input, (size_t)count, (uint8_t*)output);
+                    result = om_common_codecs()->p4nddec8((unsigned char*)input, (size_t)count, (uint8_t*)output);
                     break;
                 case DATA_TYPE_INT16_ARRAY:
-                    result = p4nzdec128v16((unsigned char*)input, (size_t)count, (uint16_t*)output);
+                case DATA_TYPE_FLOAT16_ARRAY:
+                case DATA_TYPE_BFLOAT16_ARRAY:
+                    result = om_common_codecs()->p4nzdec128v16((unsigned char*)input, (size_t)count, (uint16_t*)output);
                     break;
                 case DATA_TYPE_UINT16_ARRAY:
-                    result = p4nddec128v16((unsigned char*)input, (size_t)count, (uint16_t*)output);
+                    result = om_common_codecs()->p4nddec128v16((unsigned char*)input, (size_t)count, (uint16_t*)output);
                     break;
                 case DATA_TYPE_INT32_ARRAY:
-                    result = p4nzdec128v32((unsigned char*)input, (size_t)count, (uint32_t*)output);
+                    result = om_common_codecs()->p4nzdec128v32((unsigned char*)input, (size_t)count, (uint32_t*)output);
                     break;
                 case DATA_TYPE_UINT32_ARRAY:
-                    result = p4nddec128v32((unsigned char*)input, (size_t)count, (uint32_t*)output);
+                    result = om_common_codecs()->p4nddec128v32((unsigned char*)input, (size_t)count, (uint32_t*)output);
                     break;
                 case DATA_TYPE_INT64_ARRAY:
-                    result = p4nzdec64((unsigned char*)input, (size_t)count, (uint64_t*)output);
+                    result = om_common_codecs()->p4nzdec64((unsigned char*)input, (size_t)count, (uint64_t*)output);
                     break;
                 case DATA_TYPE_UINT64_ARRAY:
-                    result = p4nddec64((unsigned char*)input, (size_t)count, (uint64_t*)output);
+                    result = om_common_codecs()->p4nddec64((unsigned char*)input, (size_t)count, (uint64_t*)output);
+                    break;
+                case DATA_TYPE_FLOAT_ARRAY:
+                    result = om_common_codecs()->p4nzdec128v32((unsigned char*)input, (size_t)count, (uint32_t*)output);
+                    break;
+                case DATA_TYPE_DOUBLE_ARRAY:
+                    result = om_common_codecs()->p4nzdec64((unsigned char*)input, (size_t)count, (uint64_t*)output);
+                    break;
+                case DATA_TYPE_NONE:
+                case DATA_TYPE_STRING:
+                case DATA_TYPE_STRING_ARRAY:
+                case DATA_TYPE_INT8:
+                case DATA_TYPE_UINT8:
+                case DATA_TYPE_INT16:
+                case DATA_TYPE_UINT16:
+                case DATA_TYPE_INT32:
+                case DATA_TYPE_UINT32:
+                case DATA_TYPE_INT64:
+                case DATA_TYPE_UINT64:
+                case DATA_TYPE_FLOAT:
+                case DATA_TYPE_DOUBLE:
+                    break;
+            }
+            break;
+
+        case COMPRESSION_PFOR_DOD:
+        case COMPRESSION_PFOR_DELTA2D_DOD:
+            switch (data_type) {
+                case DATA_TYPE_INT8_ARRAY:
+                case DATA_TYPE_UINT8_ARRAY:
+                    result = om_common_codecs()->p4nzzdec128v8((unsigned char*)input, (size_t)count, (uint8_t*)output, 0);
+                    break;
+                case DATA_TYPE_INT16_ARRAY:
+                case DATA_TYPE_UINT16_ARRAY:
+                    result = om_common_codecs()->p4nzzdec128v16((unsigned char*)input, (size_t)count, (uint16_t*)output, 0);
                     break;
+                case DATA_TYPE_INT32_ARRAY:
+                case DATA_TYPE_UINT32_ARRAY:
                 case DATA_TYPE_FLOAT_ARRAY:
-                    result = p4nzdec128v32((unsigned char*)input, (size_t)count, (uint32_t*)output);
+                    result = om_common_codecs()->p4nzzdec128v32((unsigned char*)input, (size_t)count, (uint32_t*)output, 0);
                     break;
+                case DATA_TYPE_INT64_ARRAY:
+                case DATA_TYPE_UINT64_ARRAY:
                 case DATA_TYPE_DOUBLE_ARRAY:
-                    result = p4nzdec64((unsigned char*)input, (size_t)count, (uint64_t*)output);
+                    result = om_common_codecs()->p4nzzdec128v64((unsigned char*)input, (size_t)count, (uint64_t*)output, 0);
                     break;
                 case DATA_TYPE_NONE:
                 case DATA_TYPE_STRING:
@@ -197,6 +403,8 @@ ALWAYS_INLINE uint64_t om_decode_decompress(
                 case DATA_TYPE_UINT64:
                 case DATA_TYPE_FLOAT:
                 case DATA_TYPE_DOUBLE:
+                case DATA_TYPE_FLOAT16_ARRAY:
+                case DATA_TYPE_BFLOAT16_ARRAY:
                     break;
             }
             break;
@@ -213,6 +421,7 @@ ALWAYS_INLINE void om_decode_filter(
     OmCompression_t compression_type,
     void* data,
     uint64_t length_in_chunk,
+    uint64_t length_plane,
     uint64_t length_last
 ) {
     switch (compression_type) {
@@ -222,14 +431,31 @@ ALWAYS_INLINE void om_decode_filter(
             delta2d_decode16((size_t)(length_in_chunk / length_last), (size_t)length_last, (int16_t*)data);
             break;
         case COMPRESSION_FPX_XOR2D:
-            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            assert((data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY || data_type == DATA_TYPE_FLOAT16_ARRAY || data_type == DATA_TYPE_BFLOAT16_ARRAY) && "Expecting floating point array");
             if (data_type == DATA_TYPE_FLOAT_ARRAY) {
                 delta2d_decode_xor((size_t)(length_in_chunk / length_last), (size_t)length_last, (float*)data);
             } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
                 delta2d_decode_xor_double((size_t)(length_in_chunk / length_last), (size_t)length_last, (double*)data);
+            } else {
+                delta2d_decode_xor_half((size_t)(length_in_chunk / length_last), (size_t)length_last, (uint16_t*)data);
+            }
+            break;
+        case COMPRESSION_FPX_FCM:
+        case COMPRESSION_FPX_DFCM:
+        case COMPRESSION_FPX_2DFCM:
+            break;
+        case COMPRESSION_PFOR_DOD:
+            break;
+        case COMPRESSION_PFOR_LORENZO:
+            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            if (data_type == DATA_TYPE_FLOAT_ARRAY) {
+                lorenzo3d_decode32((size_t)(length_in_chunk / length_plane), (size_t)(length_plane / length_last), (size_t)length_last, (int32_t*)data);
+            } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
+                lorenzo3d_decode64((size_t)(length_in_chunk / length_plane), (size_t)(length_plane / length_last), (size_t)length_last, (int64_t*)data);
             }
             break;
         case COMPRESSION_PFOR_DELTA2D:
+        case COMPRESSION_PFOR_DELTA2D_DOD:
             switch (data_type) {
                 case DATA_TYPE_INT8_ARRAY:
                 case DATA_TYPE_UINT8_ARRAY:
@@ -239,6 +465,10 @@ ALWAYS_INLINE void om_decode_filter(
                 case DATA_TYPE_UINT16_ARRAY:
                     delta2d_decode16((size_t)(length_in_chunk / length_last), (size_t)length_last, (int16_t*)data);
                     break;
+                case DATA_TYPE_FLOAT16_ARRAY:
+                case DATA_TYPE_BFLOAT16_ARRAY:
+                    delta2d_decode_ordered_half((size_t)(length_in_chunk / length_last), (size_t)length_last, (uint16_t*)data);
+                    break;
                 case DATA_TYPE_INT32_ARRAY:
                 case DATA_TYPE_UINT32_ARRAY:
                 case DATA_TYPE_FLOAT_ARRAY:
@@ -259,8 +489,20 @@ ALWAYS_INLINE void om_decode_filter(
     }
 }
 
+/// Copy half precision values or convert them to float
+ALWAYS_INLINE void om_decode_copy_half(OmDataType_t data_type, OmDataType_t output_data_type, uint64_t count, const void* input, void* output) {
+    if (output_data_type != DATA_TYPE_FLOAT_ARRAY) {
+        om_common_copy16(count, 1, 0, input, output);
+    } else if (data_type == DATA_TYPE_FLOAT16_ARRAY) {
+        om_common_copy_float16_to_float(count, 1, 0, input, output);
+    } else {
+        om_common_copy_bfloat16_to_float(count, 1, 0, input, output);
+    }
+}
+
 ALWAYS_INLINE void om_decode_copy(
     OmDataType_t data_type,
+    OmDataType_t output_data_type,
     OmCompression_t compression_type,
     uint64_t count,
     float scale_factor,
@@ -280,15 +522,23 @@ ALWAYS_INLINE void om_decode_copy(
             break;
 
         case COMPRESSION_FPX_XOR2D:
-            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+        case COMPRESSION_FPX_FCM:
+        case COMPRESSION_FPX_DFCM:
+        case COMPRESSION_FPX_2DFCM:
+            assert((data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY || data_type == DATA_TYPE_FLOAT16_ARRAY || data_type == DATA_TYPE_BFLOAT16_ARRAY) && "Expecting floating point array");
             if (data_type == DATA_TYPE_FLOAT_ARRAY) {
                 om_common_copy32(count, scale_factor, add_offset, input, output);
             } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
                 om_common_copy64(count, scale_factor, add_offset, input, output);
+            } else {
+                om_decode_copy_half(data_type, output_data_type, count, input, output);
             }
             break;
 
+        case COMPRESSION_PFOR_LORENZO:
         case COMPRESSION_PFOR_DELTA2D:
+        case COMPRESSION_PFOR_DOD:
+        case COMPRESSION_PFOR_DELTA2D_DOD:
             switch (data_type) {
                 case DATA_TYPE_INT8_ARRAY:
                 case DATA_TYPE_UINT8_ARRAY:
@@ -312,6 +562,10 @@ ALWAYS_INLINE void om_decode_copy(
                 case DATA_TYPE_DOUBLE_ARRAY:
                     om_common_copy_int64_to_double(count, scale_factor, add_offset, input, output);
                     break;
+                case DATA_TYPE_FLOAT16_ARRAY:
+                case DATA_TYPE_BFLOAT16_ARRAY:
+                    om_decode_copy_half(data_type, output_data_type, count, input, output);
+                    break;
                 default:
                     break;
             }
@@ -359,6 +613,13 @@ void om_decoder_init_index_read(const OmDecoder_t* decoder, OmDecoder_indexRead_
     index_read->chunkIndex.upperBound = 0;
     index_read->nextChunk.lowerBound = chunkStart;
     index_read->nextChunk.upperBound = chunkEnd;
+
+    // Chunk coordinates of the last chunk of the first linear run. All later runs are advanced from there without integer division.
+    memset(index_read->chunkCoordinate, 0, sizeof(index_read->chunkCoordinate));
+    memset(index_read->nextChunkCoordinate, 0, sizeof(index_read->nextChunkCoordinate));
+    if (decoder->plan.dimensions_count > 0 && chunkEnd > chunkStart) {
+        _om_decoder_chunk_coordinate(&decoder->plan, chunkEnd - 1, index_read->nextChunkCoordinate);
+    }
 }
 
 uint64_t om_decoder_read_buffer_size(const OmDecoder_t* decoder) {
@@ -369,7 +630,33 @@ uint64_t om_decoder_read_buffer_size(const OmDecoder_t* decoder) {
     return chunkLength * decoder->bytes_per_element;
 }
 
-bool _om_decoder_next_chunk_position(const OmDecoder_t *decoder, OmRange_t *chunk_index) {
+/// Move `chunk_index` to the next linear run of chunks. `chunk_index->lowerBound` must be the last chunk of the current run.
+/// With a read plan, `chunk_coordinate` holds the chunk coordinates of this chunk and is advanced to the last chunk of the next run.
+bool _om_decoder_next_chunk_position(const OmDecoder_t *decoder, OmRange_t *chunk_index, uint64_t* chunk_coordinate) {
+    const OmReadPlan_t* plan = &decoder->plan;
+    if (plan->dimensions_count > 0) {
+        // Advance the chunk coordinate by one. A dimension that reaches its upper chunk restarts at its lower chunk and carries into the next slower dimension.
+        for (uint64_t i_forward = 0; i_forward < plan->dimensions_count; i_forward++) {
+            const uint64_t i = plan->dimensions_count - i_forward - 1;
+            const OmReadPlanDimension_t* dim = &plan->dimensions[i];
+
+            chunk_index->lowerBound += dim->chunk_stride;
+            chunk_coordinate[i] += 1;
+            if (chunk_coordinate[i] != dim->chunk_upper) {
+                chunk_index->upperBound = chunk_index->lowerBound + dim->linear_chunk_count;
+                // The run covers all linear dimensions entirely
+                for (uint64_t j = plan->dimensions_count - plan->linear_dimensions_count; j < plan->dimensions_count; j++) {
+                    chunk_coordinate[j] = plan->dimensions[j].chunk_upper - 1;
+                }
+                return true;
+            }
+            chunk_index->lowerBound -= (dim->chunk_upper - dim->chunk_lower) * dim->chunk_stride;
+            chunk_coordinate[i] = dim->chunk_lower;
+        }
+        chunk_index->upperBound = chunk_index->lowerBound;
+        return false;
+    }
+
     uint64_t rollingMultiply = 1;
 
     // Number of consecutive chunks that can be read linearly.
@@ -436,18 +723,146 @@ bool _om_decoder_next_chunk_position(const OmDecoder_t *decoder, OmRange_t *chun
     return true;
 }
 
+/// Check if a read of `read_size` bytes has to be split before the next chunk. `gap` is the number of unused bytes before the next chunk
+/// and `increment` the number of bytes the read would grow. Without an IO cost model, `increment` is compared to `io_size_merge`.
+static inline bool _om_decoder_split_io(const OmDecoder_t* decoder, uint64_t read_size, uint64_t gap, uint64_t increment) {
+    if (read_size > decoder->io_size_max) {
+        return true;
+    }
+    if (decoder->io_request_ns > 0) {
+        // Reading the gap costs its transfer time. A separate request costs one more, partly overlapping, latency.
+        return (double)gap * decoder->io_ns_per_byte > decoder->io_request_ns;
+    }
+    return increment > decoder->io_size_merge;
+}
+
+/// First and last chunk that intersect the read
+static void _om_decoder_read_chunk_bounds(const OmDecoder_t* decoder, uint64_t* first, uint64_t* last) {
+    uint64_t lower = 0;
+    uint64_t upper = 0;
+    for (uint64_t i = 0; i < decoder->dimensions_count; i++) {
+        const uint64_t chunk = decoder->chunks[i];
+        const uint64_t nChunksInThisDimension = divide_rounded_up(decoder->dimensions[i], chunk);
+        lower = lower * nChunksInThisDimension + decoder->read_offset[i] / chunk;
+        upper = upper * nChunksInThisDimension + (decoder->read_offset[i] + decoder->read_count[i] - 1) / chunk;
+    }
+    *first = lower;
+    *last = upper;
+}
+
+/// Start and end of block `block` of a variable-length LUT relative to the LUT start. `block_offsets` contains the block offset table starting at block 0 of the data.
+static inline void _om_decoder_lut_block_range(const uint8_t* block_offsets, uint64_t block, uint64_t* start, uint64_t* end) {
+    const uint8_t* entry = block_offsets + block * 2 * sizeof(uint64_t);
+    uint64_t blockStart = 0, blockEnd = 0;
+    for (uint64_t j = 0; j < sizeof(uint64_t); j++) {
+        blockStart |= (uint64_t)entry[j] << (j * 8);
+        blockEnd |= (uint64_t)entry[sizeof(uint64_t) + j] << (j * 8);
+    }
+    *start = blockStart;
+    *end = blockEnd;
+}
+
+/// First and last LUT block of the read. Chunk `c` needs LUT entries `c` and `c+1`.
+static inline void _om_decoder_read_lut_blocks(const OmDecoder_t* decoder, uint64_t* first_block, uint64_t* last_block) {
+    uint64_t first, last;
+    _om_decoder_read_chunk_bounds(decoder, &first, &last);
+    *first_block = first / LUT_CHUNK_COUNT;
+    *last_block = (last + 1) / LUT_CHUNK_COUNT;
+}
+
+/// True if LUT blocks from `first_block` to `last_block` are resident in the LUT cache
+static inline bool _om_decoder_lut_blocks_resident(const OmDecoder_t* decoder, uint64_t first_block, uint64_t last_block) {
+    if (decoder->lut_cache == NULL) {
+        return false;
+    }
+    for (uint64_t block = first_block; block <= last_block; block++) {
+        if (om_lut_cache_get_block(decoder->lut_cache, block) == NULL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// `om_decoder_next_index_read` for `LUT_ENCODING_PFOR_VARIABLE`. Blocks are merged by their position from the block offset table, because blocks
+/// written by streaming writers are separated by chunk data. Without the table, one index read without data covers the rest of the read.
+static bool _om_decoder_next_index_read_variable(const OmDecoder_t* decoder, OmDecoder_indexRead_t* index_read) {
+    uint64_t chunkIndex = index_read->nextChunk.lowerBound;
+    const uint64_t firstBlock = chunkIndex / LUT_CHUNK_COUNT;
+
+    if (decoder->lut_block_offsets == NULL) {
+        uint64_t first, last;
+        _om_decoder_read_chunk_bounds(decoder, &first, &last);
+        index_read->offset = decoder->lut_start;
+        index_read->count = 0;
+        index_read->indexRange.upperBound = last + 1;
+        index_read->nextChunk.lowerBound = index_read->nextChunk.upperBound;
+        return true;
+    }
+
+    const uint8_t* blockOffsets = decoder->lut_block_offsets;
+    const uint64_t tableFirst = decoder->lut_block_offsets_first;
+    uint64_t lastBlock = (chunkIndex + 1) / LUT_CHUNK_COUNT;
+    uint64_t readStart, readEnd, unused;
+    _om_decoder_lut_block_range(blockOffsets, firstBlock - tableFirst, &readStart, &unused);
+    _om_decoder_lut_block_range(blockOffsets, lastBlock - tableFirst, &unused, &readEnd);
+
+    while (1) {
+        if (index_read->nextChunk.lowerBound + 1 >= index_read->nextChunk.upperBound) {
+            if (!_om_decoder_next_chunk_position(decoder, &index_read->nextChunk, index_read->nextChunkCoordinate)) {
+                break;
+            }
+        } else if (index_read->nextChunk.lowerBound + 2 < (lastBlock + 1) * LUT_CHUNK_COUNT) {
+            // All chunks whose LUT entries are in blocks of the read are added at once
+            index_read->nextChunk.lowerBound = min(index_read->nextChunk.upperBound - 1, (lastBlock + 1) * LUT_CHUNK_COUNT - 2);
+            chunkIndex = index_read->nextChunk.lowerBound;
+            continue;
+        } else {
+            index_read->nextChunk.lowerBound += 1;
+        }
+
+        const uint64_t nextLastBlock = (index_read->nextChunk.lowerBound + 1) / LUT_CHUNK_COUNT;
+        if (nextLastBlock > lastBlock) {
+            // Unused bytes between the end of the read and the first new block are part of the gap
+            uint64_t nextStart, nextEnd;
+            _om_decoder_lut_block_range(blockOffsets, max(index_read->nextChunk.lowerBound / LUT_CHUNK_COUNT, lastBlock + 1) - tableFirst, &nextStart, &unused);
+            _om_decoder_lut_block_range(blockOffsets, nextLastBlock - tableFirst, &unused, &nextEnd);
+            const uint64_t gap = nextStart > readEnd ? nextStart - readEnd : 0;
+            if (_om_decoder_split_io(decoder, nextEnd - readStart, gap, nextEnd - readEnd)) {
+                break;
+            }
+            readEnd = nextEnd;
+            lastBlock = nextLastBlock;
+        }
+        chunkIndex = index_read->nextChunk.lowerBound;
+    }
+
+    index_read->offset = decoder->lut_start + readStart;
+    index_read->count = readEnd - readStart;
+    index_read->indexRange.upperBound = chunkIndex + 1;
+    if (_om_decoder_lut_blocks_resident(decoder, firstBlock, lastBlock)) {
+        index_read->offset = decoder->lut_start;
+        index_read->count = 0;
+    }
+    return true;
+}
+
 bool om_decoder_next_index_read(const OmDecoder_t* decoder, OmDecoder_indexRead_t* index_read) {
     if (index_read->nextChunk.lowerBound >= index_read->nextChunk.upperBound) {
         return false;
     }
 
     index_read->chunkIndex = index_read->nextChunk;
+    memcpy(index_read->chunkCoordinate, index_read->nextChunkCoordinate, sizeof(index_read->chunkCoordinate));
     index_read->indexRange.lowerBound = index_read->nextChunk.lowerBound;
 
+    if (decoder->lut_block_offsets_start != 0) {
+        return _om_decoder_next_index_read_variable(decoder, index_read);
+    }
+
     uint64_t chunkIndex = index_read->nextChunk.lowerBound;
 
-    const bool isV3LUT = decoder->lut_chunk_length > 1;
-    const uint64_t lut_chunk_element_count = isV3LUT ? LUT_CHUNK_COUNT : 1;
+    const bool isV3LUT = decoder->lut_chunk_length > 0;
+    const uint64_t lut_chunk_element_count = decoder->lut_chunk_element_count;
     const uint64_t lut_chunk_length = isV3LUT ? decoder->lut_chunk_length : sizeof(uint64_t);
     const uint64_t io_size_max = decoder->io_size_max;
 
@@ -462,17 +877,19 @@ bool om_decoder_next_index_read(const OmDecoder_t* decoder, OmDecoder_indexRead_
         const uint64_t nextIncrement = max(1, min(maxRead-1, nextChunkCount - 1));
 
         if (index_read->nextChunk.lowerBound + nextIncrement >= index_read->nextChunk.upperBound) {
-            if (!_om_decoder_next_chunk_position(decoder, &index_read->nextChunk)) {
+            if (!_om_decoder_next_chunk_position(decoder, &index_read->nextChunk, index_read->nextChunkCoordinate)) {
                 break;
             }
             const uint64_t readEndNext = (index_read->nextChunk.lowerBound + endAlignOffset) / lut_chunk_element_count * lut_chunk_length;
             const uint64_t readStartNext = readEndNext - lut_chunk_length;
             const uint64_t readEndPrevious = chunkIndex / lut_chunk_element_count * lut_chunk_length;
 
-            if (readEndNext - readStart > io_size_max) {
-                break;
-            }
-            if (readStartNext - readEndPrevious > decoder->io_size_merge) {
+            // Unused index bytes between the end of the current read and the LUT entries of the next chunk
+            const uint64_t readEndCurrent = ((chunkIndex + endAlignOffset) / lut_chunk_element_count + 1) * lut_chunk_length;
+            const uint64_t readStartEntries = (index_read->nextChunk.lowerBound - (isV3LUT ? 0 : 1)) / lut_chunk_element_count * lut_chunk_length;
+            const uint64_t gap = readStartEntries > readEndCurrent ? readStartEntries - readEndCurrent : 0;
+
+            if (_om_decoder_split_io(decoder, readEndNext - readStart, gap, readStartNext - readEndPrevious)) {
                 break;
             }
         } else {
@@ -494,149 +911,407 @@ bool om_decoder_next_index_read(const OmDecoder_t* decoder, OmDecoder_indexRead_
     index_read->offset = decoder->lut_start + readStart;
     index_read->count = readEnd - readStart;
     index_read->indexRange.upperBound = chunkIndex + 1;
+
+    // No index data is required if all LUT blocks including the end of the last chunk are resident
+    if (_om_decoder_lut_blocks_resident(decoder, index_read->indexRange.lowerBound / LUT_CHUNK_COUNT, (chunkIndex + 1) / LUT_CHUNK_COUNT)) {
+        index_read->offset = decoder->lut_start;
+        index_read->count = 0;
+    }
     return true;
 }
 
-bool om_decoder_next_data_read(const OmDecoder_t *decoder, OmDecoder_dataRead_t* data_read, const void* index_data, uint64_t index_data_size, OmError_t* error) {
-    if (data_read->nextChunk.lowerBound >= data_read->nextChunk.upperBound) {
-        return false;
+bool om_decoder_next_index_reads(const OmDecoder_t* decoder, OmDecoder_indexRead_t* index_read, OmDecoder_indexRead_t* index_reads, uint64_t index_reads_capacity, uint64_t* index_reads_count) {
+    uint64_t count = 0;
+    while (count < index_reads_capacity && om_decoder_next_index_read(decoder, index_read)) {
+        index_reads[count++] = *index_read;
     }
+    *index_reads_count = count;
+    return count > 0;
+}
 
-    uint64_t chunkIndex = data_read->nextChunk.lowerBound;
-    data_read->chunkIndex.lowerBound = chunkIndex;
-
-    const uint64_t number_of_chunks = decoder->number_of_chunks;
-
-    // Version 1 case
-    if (decoder->lut_chunk_length == 0) {
-        // index is a flat Int64 array
-        const uint64_t* data = (const uint64_t*)index_data;
-
-        const bool isOffset0 = (data_read->indexRange.lowerBound == 0);
-        const uint64_t startOffset = isOffset0 ? 1 : 0;
+OmError_t om_decoder_set_output_data_type(OmDecoder_t* decoder, OmDataType_t output_data_type) {
+    const bool half = decoder->data_type == DATA_TYPE_FLOAT16_ARRAY || decoder->data_type == DATA_TYPE_BFLOAT16_ARRAY;
+    if (output_data_type != decoder->data_type && !(half && output_data_type == DATA_TYPE_FLOAT_ARRAY)) {
+        return ERROR_INVALID_DATA_TYPE;
+    }
+    OmError_t error = ERROR_OK;
+    decoder->output_data_type = output_data_type;
+    decoder->bytes_per_element = om_get_bytes_per_element(output_data_type, &error);
+    return error;
+}
 
+void om_decoder_set_chunk_cache(OmDecoder_t* decoder, OmChunkCache_t* cache, uint64_t file_id) {
+    decoder->chunk_cache = cache;
+    decoder->chunk_cache_file_id = file_id;
+}
 
-        uint64_t readPos = chunkIndex - data_read->indexRange.lowerBound - startOffset;
-        //printf("chunkIndex %llu lowerBound %llu readPos %llu \n", chunkIndex, data_read->indexRange.lowerBound, readPos);
-        if (!isOffset0 && (readPos + 1) * sizeof(int64_t) > index_data_size) {
-            (*error) = ERROR_OUT_OF_BOUND_READ;
-            return false;
-        }
+bool om_decoder_set_lut_cache(OmDecoder_t* decoder, OmLutCache_t* cache) {
+    // Only PFor compressed LUT blocks with 64 entries are cached
+    if (decoder->lut_chunk_element_count != LUT_CHUNK_COUNT || !_om_lut_cache_matches(cache, decoder->lut_start, decoder->number_of_chunks)) {
+        return false;
+    }
+    decoder->lut_cache = cache;
+    return true;
+}
 
-        const uint64_t startPos = isOffset0 && chunkIndex == 0 ? 0 : data[readPos];
-        uint64_t endPos = startPos;
+void om_decoder_set_io_cost_model(OmDecoder_t* decoder, const OmIoCostModel_t* model) {
+    decoder->io_request_ns = om_io_cost_model_request_time(model);
+    decoder->io_ns_per_byte = 1.0 / model->bytes_per_ns;
+    decoder->io_size_max = om_io_cost_model_max_size(model);
+}
 
-        // Loop to the next chunk until the end is reached
-        while (true) {
-            readPos = data_read->nextChunk.lowerBound - data_read->indexRange.lowerBound - startOffset + 1;
-            if ((readPos + 1) * sizeof(int64_t) > index_data_size) {
-                (*error) = ERROR_OUT_OF_BOUND_READ;
-                return false;
-            }
-            const uint64_t dataEndPos = data[readPos];
+uint64_t om_decoder_count_read_chunks(const OmDecoder_t* decoder) {
+    uint64_t count = 1;
+    for (uint64_t i = 0; i < decoder->dimensions_count; i++) {
+        const uint64_t chunk = decoder->chunks[i];
+        count *= divide_rounded_up(decoder->read_offset[i] + decoder->read_count[i], chunk) - decoder->read_offset[i] / chunk;
+    }
+    return count;
+}
 
-            // Merge and split IO requests, ensuring at least one IO request is sent
-            if (startPos != endPos && (dataEndPos - startPos > decoder->io_size_max || dataEndPos - endPos > decoder->io_size_merge)) {
-                break;
-            }
-            endPos = dataEndPos;
-            chunkIndex = data_read->nextChunk.lowerBound;
+bool om_decoder_statistics_read(const OmDecoder_t* decoder, uint64_t* offset, uint64_t* count) {
+    if (decoder->statistics_size == 0) {
+        return false;
+    }
+    uint64_t first, last;
+    _om_decoder_read_chunk_bounds(decoder, &first, &last);
+    *offset = decoder->statistics_offset + first * sizeof(OmChunkStatistics_t);
+    *count = (last - first + 1) * sizeof(OmChunkStatistics_t);
+    return true;
+}
 
-            if (data_read->nextChunk.lowerBound + 1 >= data_read->nextChunk.upperBound) {
-                if (!_om_decoder_next_chunk_position(decoder, &data_read->nextChunk)) {
-                    // No next chunk, finish processing the current one and stop
-                    break;
-                }
-            } else {
-                data_read->nextChunk.lowerBound += 1;
-            }
+/// Advance to the next chunk that intersects the read. Returns false after the last chunk.
+static inline bool _om_decoder_next_read_chunk(const OmDecoder_t* decoder, OmRange_t* chunk, uint64_t* chunk_coordinate) {
+    if (chunk->lowerBound + 1 >= chunk->upperBound) {
+        return _om_decoder_next_chunk_position(decoder, chunk, chunk_coordinate);
+    }
+    chunk->lowerBound += 1;
+    return true;
+}
 
-            if (data_read->nextChunk.lowerBound >= data_read->indexRange.upperBound) {
-                data_read->nextChunk.lowerBound = 0;
-                data_read->nextChunk.upperBound = 0;
-                break;
-            }
+bool om_decoder_get_chunk_statistics(const OmDecoder_t* decoder, const void* statistics_data, uint64_t statistics_data_size, OmChunkStatistics_t* statistics, uint64_t* chunk_indices, OmError_t* error) {
+    uint64_t first, last;
+    _om_decoder_read_chunk_bounds(decoder, &first, &last);
+    if (statistics_data_size != (last - first + 1) * sizeof(OmChunkStatistics_t)) {
+        (*error) = ERROR_OUT_OF_BOUND_READ;
+        return false;
+    }
+    OmDecoder_indexRead_t index_read;
+    om_decoder_init_index_read(decoder, &index_read);
+    OmRange_t chunk = index_read.nextChunk;
+    uint64_t count = 0;
+    do {
+        // Statistics data may not be aligned
+        memcpy(&statistics[count], (const uint8_t*)statistics_data + (chunk.lowerBound - first) * sizeof(OmChunkStatistics_t), sizeof(OmChunkStatistics_t));
+        if (chunk_indices != NULL) {
+            chunk_indices[count] = chunk.lowerBound;
         }
+        count++;
+    } while (_om_decoder_next_read_chunk(decoder, &chunk, index_read.nextChunkCoordinate));
+    return true;
+}
 
-        // Old files do not compress LUT and data is after LUT
-        // V1 header size
-        const uint64_t om_header_v1_length = sizeof(OmHeaderV1_t);
-        const uint64_t dataStart = om_header_v1_length + number_of_chunks * sizeof(int64_t);
+bool om_decoder_set_predicate(OmDecoder_t* decoder, const void* statistics_data, uint64_t statistics_data_size, double lower, double upper) {
+    uint64_t first, last;
+    _om_decoder_read_chunk_bounds(decoder, &first, &last);
+    if (decoder->statistics_size == 0 || statistics_data_size != (last - first + 1) * sizeof(OmChunkStatistics_t)) {
+        return false;
+    }
+    decoder->predicate_statistics = (const uint8_t*)statistics_data;
+    decoder->predicate_first_chunk = first;
+    decoder->predicate_lower = lower;
+    decoder->predicate_upper = upper;
+    return true;
+}
 
-        data_read->offset = startPos + dataStart;
-        data_read->count = endPos - startPos;
-        data_read->chunkIndex.upperBound = chunkIndex + 1;
+/// True if a chunk that intersects the read may contain values that match the predicate. Chunks with only missing values never match.
+static inline bool _om_decoder_chunk_selected(const OmDecoder_t* decoder, uint64_t chunk_index) {
+    if (decoder->predicate_statistics == NULL) {
         return true;
     }
+    OmChunkStatistics_t statistics;
+    memcpy(&statistics, decoder->predicate_statistics + (chunk_index - decoder->predicate_first_chunk) * sizeof(OmChunkStatistics_t), sizeof(OmChunkStatistics_t));
+    return statistics.max >= decoder->predicate_lower && statistics.min <= decoder->predicate_upper;
+}
 
-    uint8_t* indexDataPtr = (uint8_t*)index_data;
-
-    uint64_t uncompressedLut[LUT_CHUNK_COUNT] = {0};
+bool om_decoder_lut_block_offsets_read(const OmDecoder_t* decoder, uint64_t* offset, uint64_t* count) {
+    if (decoder->lut_block_offsets_start == 0) {
+        return false;
+    }
+    uint64_t firstBlock, lastBlock;
+    _om_decoder_read_lut_blocks(decoder, &firstBlock, &lastBlock);
+    if (_om_decoder_lut_blocks_resident(decoder, firstBlock, lastBlock)) {
+        return false;
+    }
+    *offset = decoder->lut_block_offsets_start + firstBlock * 2 * sizeof(uint64_t);
+    *count = (lastBlock - firstBlock + 1) * 2 * sizeof(uint64_t);
+    return true;
+}
 
-    // Which LUT chunk is currently loaded into `uncompressedLut`
-    uint64_t lutChunk = chunkIndex / LUT_CHUNK_COUNT;
+bool om_decoder_set_lut_block_offsets(OmDecoder_t* decoder, const void* block_offsets_data, uint64_t block_offsets_data_size) {
+    if (decoder->lut_block_offsets_start == 0) {
+        return false;
+    }
+    uint64_t firstBlock, lastBlock;
+    _om_decoder_read_lut_blocks(decoder, &firstBlock, &lastBlock);
+    const uint64_t blockCount = lastBlock - firstBlock + 1;
+    if (block_offsets_data_size != blockCount * 2 * sizeof(uint64_t)) {
+        return false;
+    }
+    // Blocks are increasing and located before the table. Index reads rely on this to compute their range.
+    const uint64_t tableStart = decoder->lut_block_offsets_start - decoder->lut_start;
+    uint64_t previousEnd = 0;
+    for (uint64_t i = 0; i < blockCount; i++) {
+        uint64_t start, end;
+        _om_decoder_lut_block_range((const uint8_t*)block_offsets_data, i, &start, &end);
+        if (start < previousEnd || start >= end || end > tableStart) {
+            return false;
+        }
+        previousEnd = end;
+    }
+    decoder->lut_block_offsets = (const uint8_t*)block_offsets_data;
+    decoder->lut_block_offsets_first = firstBlock;
+    return true;
+}
 
+/// Decompress a single LUT chunk from index data into `uncompressed_lut` and point `lut` to it. Fixed width LUT chunks contain only one entry.
+/// Index data starts with LUT chunk `first_lut_chunk`. If the LUT chunk is resident in the LUT cache, `lut` points to the cache and index data is not used.
+static inline bool _om_decoder_load_lut_chunk(const OmDecoder_t *decoder, const uint8_t* index_data, uint64_t index_data_size, uint64_t first_lut_chunk, uint64_t lut_chunk, uint64_t* uncompressed_lut, const uint64_t** lut, OmError_t* error) {
+    if (decoder->lut_cache != NULL) {
+        const uint64_t* cached = om_lut_cache_get_block(decoder->lut_cache, lut_chunk);
+        if (cached != NULL) {
+            *lut = cached;
+            return true;
+        }
+    }
+    *lut = uncompressed_lut;
     const uint64_t lutChunkLength = decoder->lut_chunk_length;
+    const size_t lutChunkElementCount = min((lut_chunk + 1) * LUT_CHUNK_COUNT, decoder->number_of_chunks+1) - lut_chunk * LUT_CHUNK_COUNT;
+    if (decoder->lut_block_offsets_start != 0) {
+        // Variable-length blocks are located with the block offset table. Index data starts with the first block of the index read.
+        if (decoder->lut_block_offsets == NULL) {
+            (*error) = ERROR_LUT_BLOCK_OFFSETS_REQUIRED;
+            return false;
+        }
+        uint64_t indexStart, start, end, unused;
+        _om_decoder_lut_block_range(decoder->lut_block_offsets, first_lut_chunk - decoder->lut_block_offsets_first, &indexStart, &unused);
+        _om_decoder_lut_block_range(decoder->lut_block_offsets, lut_chunk - decoder->lut_block_offsets_first, &start, &end);
+        if (start < indexStart || end - indexStart > index_data_size || lutChunkElementCount > LUT_CHUNK_COUNT) {
+            (*error) = ERROR_OUT_OF_BOUND_READ;
+            return false;
+        }
+        om_common_codecs()->p4nddec64((unsigned char*)index_data + start - indexStart, lutChunkElementCount, uncompressed_lut);
+        if (decoder->lut_cache != NULL) {
+            om_lut_cache_put_block(decoder->lut_cache, lut_chunk, uncompressed_lut);
+        }
+        return true;
+    }
+    const uint64_t start = (lut_chunk - first_lut_chunk) * lutChunkLength;
+    if (start + lutChunkLength > index_data_size) {
+        (*error) = ERROR_OUT_OF_BOUND_READ;
+        return false;
+    }
+    if (decoder->lut_chunk_element_count == 1) {
+        uint64_t entry = 0;
+        for (uint64_t i = 0; i < lutChunkLength; i++) {
+            entry |= (uint64_t)index_data[start + i] << (i * 8);
+        }
+        uncompressed_lut[0] = entry;
+        return true;
+    }
+    if (lutChunkElementCount > LUT_CHUNK_COUNT) {
+        (*error) = ERROR_OUT_OF_BOUND_READ;
+        return false;
+    }
+    om_common_codecs()->p4nddec64((unsigned char*)index_data + start, lutChunkElementCount, uncompressed_lut);
+    if (decoder->lut_cache != NULL) {
+        om_lut_cache_put_block(decoder->lut_cache, lut_chunk, uncompressed_lut);
+    }
+    return true;
+}
 
-    // Offset byte in LUT relative to the index range
-    const uint64_t lutOffset = data_read->indexRange.lowerBound / LUT_CHUNK_COUNT * lutChunkLength;
+/// Move `data_read->nextChunk` to the next chunk of the index read that matches the predicate. Returns false if the index read has no more chunks.
+static bool _om_decoder_advance_data_read(const OmDecoder_t* decoder, OmDecoder_dataRead_t* data_read) {
+    do {
+        if (!_om_decoder_next_read_chunk(decoder, &data_read->nextChunk, data_read->nextChunkCoordinate)) {
+            return false;
+        }
+        if (data_read->nextChunk.lowerBound >= data_read->indexRange.upperBound) {
+            data_read->nextChunk.lowerBound = 0;
+            data_read->nextChunk.upperBound = 0;
+            return false;
+        }
+    } while (!_om_decoder_chunk_selected(decoder, data_read->nextChunk.lowerBound));
+    return true;
+}
 
-    // Uncompress the first LUT index chunk and check the length
-    {
-        const size_t thisLutChunkElementCount = min((lutChunk + 1) * LUT_CHUNK_COUNT, number_of_chunks+1) - lutChunk * LUT_CHUNK_COUNT;
-        const uint64_t start = lutChunk * lutChunkLength - lutOffset;
-        if (start + lutChunkLength > index_data_size || thisLutChunkElementCount > LUT_CHUNK_COUNT) {
+/// Walk the LUT to find the next data read. If `chunk_offsets` is set, the start and end offsets of all chunks that intersect the read are recorded and the data read is limited to `chunk_offsets_capacity` offsets.
+static bool _om_decoder_next_data_read(const OmDecoder_t *decoder, OmDecoder_dataRead_t* data_read, const void* index_data, uint64_t index_data_size, uint64_t* chunk_offsets, uint64_t chunk_offsets_capacity, uint64_t* chunk_offsets_count, OmError_t* error) {
+    if (data_read->nextChunk.lowerBound >= data_read->nextChunk.upperBound) {
+        return false;
+    }
+    // Chunks that cannot match the predicate are skipped like chunks that do not intersect the read
+    if (!_om_decoder_chunk_selected(decoder, data_read->nextChunk.lowerBound) && !_om_decoder_advance_data_read(decoder, data_read)) {
+        return false;
+    }
+
+    uint64_t chunkIndex = data_read->nextChunk.lowerBound;
+    data_read->chunkIndex.lowerBound = chunkIndex;
+
+    const uint64_t number_of_chunks = decoder->number_of_chunks;
+
+    // Offsets are relative to the start of the data read. Chunks are separated by one additional offset if non-intersecting chunks are skipped.
+    uint64_t offsetCount = 0;
+
+    // Version 1 case
+    if (decoder->lut_chunk_length == 0) {
+        // index is a flat Int64 array
+        const uint64_t* data = (const uint64_t*)index_data;
+
+        const bool isOffset0 = (data_read->indexRange.lowerBound == 0);
+        const uint64_t startOffset = isOffset0 ? 1 : 0;
+
+
+        uint64_t readPos = chunkIndex - data_read->indexRange.lowerBound - startOffset;
+        //printf("chunkIndex %llu lowerBound %llu readPos %llu \n", chunkIndex, data_read->indexRange.lowerBound, readPos);
+        if (!isOffset0 && (readPos + 1) * sizeof(int64_t) > index_data_size) {
             (*error) = ERROR_OUT_OF_BOUND_READ;
             return false;
         }
 
-        // Decompress LUT chunk
-        p4nddec64(indexDataPtr + start, thisLutChunkElementCount, uncompressedLut);
+        const uint64_t startPos = isOffset0 && chunkIndex == 0 ? 0 : data[readPos];
+        uint64_t endPos = startPos;
+        if (chunk_offsets != NULL) {
+            chunk_offsets[offsetCount++] = 0;
+        }
+
+        // Loop to the next chunk until the end is reached
+        while (true) {
+            readPos = data_read->nextChunk.lowerBound - data_read->indexRange.lowerBound - startOffset + 1;
+            if ((readPos + 1) * sizeof(int64_t) > index_data_size) {
+                (*error) = ERROR_OUT_OF_BOUND_READ;
+                return false;
+            }
+            const uint64_t dataEndPos = data[readPos];
+
+            // Chunks between the previous and this chunk do not intersect the read
+            const bool skipped = data_read->nextChunk.lowerBound != chunkIndex && data_read->nextChunk.lowerBound != chunkIndex + 1;
+            const uint64_t dataStartPos = skipped ? data[readPos - 1] : endPos;
+
+            // Merge and split IO requests, ensuring at least one IO request is sent
+            if (startPos != endPos && _om_decoder_split_io(decoder, dataEndPos - startPos, dataStartPos - endPos, dataEndPos - endPos)) {
+                break;
+            }
+            if (chunk_offsets != NULL) {
+                if (offsetCount + 1 + skipped > chunk_offsets_capacity) {
+                    break;
+                }
+                if (skipped) {
+                    chunk_offsets[offsetCount++] = dataStartPos - startPos;
+                }
+                chunk_offsets[offsetCount++] = dataEndPos - startPos;
+            }
+            endPos = dataEndPos;
+            chunkIndex = data_read->nextChunk.lowerBound;
+
+            if (!_om_decoder_advance_data_read(decoder, data_read)) {
+                // No next chunk, finish processing the current one and stop
+                break;
+            }
+        }
+
+        // Old files do not compress LUT and data is after LUT
+        // V1 header size
+        const uint64_t om_header_v1_length = sizeof(OmHeaderV1_t);
+        const uint64_t dataStart = om_header_v1_length + number_of_chunks * sizeof(int64_t);
+
+        data_read->offset = startPos + dataStart;
+        data_read->count = endPos - startPos;
+        data_read->chunkIndex.upperBound = chunkIndex + 1;
+        if (chunk_offsets_count != NULL) {
+            *chunk_offsets_count = offsetCount;
+        }
+        return true;
+    }
+
+    const uint8_t* indexDataPtr = (const uint8_t*)index_data;
+
+    uint64_t uncompressedLut[LUT_CHUNK_COUNT] = {0};
+
+    // Entries of the current LUT chunk. Either `uncompressedLut` or a block of the LUT cache.
+    const uint64_t* lut = uncompressedLut;
+
+    // 64 for PFor compressed LUTs, 1 for fixed width LUTs
+    const uint64_t lutChunkElementCount = decoder->lut_chunk_element_count;
+
+    // Which LUT chunk is currently loaded into `lut`
+    uint64_t lutChunk = chunkIndex / lutChunkElementCount;
+
+    // First LUT chunk in index data
+    const uint64_t firstLutChunk = data_read->indexRange.lowerBound / lutChunkElementCount;
+
+    // Uncompress the first LUT index chunk and check the length
+    if (!_om_decoder_load_lut_chunk(decoder, indexDataPtr, index_data_size, firstLutChunk, lutChunk, uncompressedLut, &lut, error)) {
+        return false;
     }
 
     // Index data relative to start index
-    const uint64_t startPos = uncompressedLut[chunkIndex % LUT_CHUNK_COUNT];
+    const uint64_t startPos = lut[chunkIndex % lutChunkElementCount];
     uint64_t endPos = startPos;
+    if (chunk_offsets != NULL) {
+        chunk_offsets[offsetCount++] = 0;
+    }
 
     // Loop to the next chunk until the end is reached
     while (true) {
-        const uint64_t nextLutChunk = (data_read->nextChunk.lowerBound + 1) / LUT_CHUNK_COUNT;
+        // Without chunk offsets, chunks are decoded back to back and a LUT block after chunk `64k+63` cannot be skipped
+        if (startPos != endPos && chunk_offsets == NULL && decoder->lut_block_offsets_start != 0 && data_read->nextChunk.lowerBound / LUT_CHUNK_COUNT != data_read->chunkIndex.lowerBound / LUT_CHUNK_COUNT) {
+            break;
+        }
+        // Chunks between the previous and this chunk do not intersect the read. The start of this chunk is needed for chunk offsets and the IO cost model.
+        const bool skipped = data_read->nextChunk.lowerBound != chunkIndex && data_read->nextChunk.lowerBound != chunkIndex + 1;
+        uint64_t dataStartPos = endPos;
+        if (skipped && (chunk_offsets != NULL || decoder->io_request_ns > 0)) {
+            const uint64_t startLutChunk = data_read->nextChunk.lowerBound / lutChunkElementCount;
+            if (startLutChunk != lutChunk) {
+                if (!_om_decoder_load_lut_chunk(decoder, indexDataPtr, index_data_size, firstLutChunk, startLutChunk, uncompressedLut, &lut, error)) {
+                    return false;
+                }
+                lutChunk = startLutChunk;
+            }
+            dataStartPos = lut[data_read->nextChunk.lowerBound % lutChunkElementCount];
+        }
+
+        const uint64_t nextLutChunk = (data_read->nextChunk.lowerBound + 1) / lutChunkElementCount;
 
         // Maybe the next LUT chunk needs to be uncompressed
         if (nextLutChunk != lutChunk) {
-            const size_t nextLutChunkElementCount = min((nextLutChunk + 1) * LUT_CHUNK_COUNT, number_of_chunks+1) - nextLutChunk * LUT_CHUNK_COUNT;
-            const uint64_t start = nextLutChunk * lutChunkLength - lutOffset;
-            if (start + lutChunkLength > index_data_size || nextLutChunkElementCount > LUT_CHUNK_COUNT) {
-                (*error) = ERROR_OUT_OF_BOUND_READ;
+            if (!_om_decoder_load_lut_chunk(decoder, indexDataPtr, index_data_size, firstLutChunk, nextLutChunk, uncompressedLut, &lut, error)) {
                 return false;
             }
-
-            // Decompress LUT chunk
-            p4nddec64(indexDataPtr + start, nextLutChunkElementCount, uncompressedLut);
             lutChunk = nextLutChunk;
         }
 
-        const uint64_t dataEndPos = uncompressedLut[(data_read->nextChunk.lowerBound + 1) % LUT_CHUNK_COUNT];
+        const uint64_t dataEndPos = lut[(data_read->nextChunk.lowerBound + 1) % lutChunkElementCount];
 
         // Merge and split IO requests, ensuring at least one IO request is sent
-        if (startPos != endPos && (dataEndPos - startPos > decoder->io_size_max || dataEndPos - endPos > decoder->io_size_merge)) {
+        if (startPos != endPos && _om_decoder_split_io(decoder, dataEndPos - startPos, dataStartPos - endPos, dataEndPos - endPos)) {
             break;
         }
-        endPos = dataEndPos;
-        chunkIndex = data_read->nextChunk.lowerBound;
-
-        if (chunkIndex + 1 >= data_read->nextChunk.upperBound) {
-            if (!_om_decoder_next_chunk_position(decoder, &data_read->nextChunk)) {
-                // No next chunk, finish processing the current one and stop
+        if (chunk_offsets != NULL) {
+            if (offsetCount + 1 + skipped > chunk_offsets_capacity) {
                 break;
             }
-        } else {
-            data_read->nextChunk.lowerBound += 1;
+            if (skipped) {
+                chunk_offsets[offsetCount++] = dataStartPos - startPos;
+            }
+            chunk_offsets[offsetCount++] = dataEndPos - startPos;
         }
+        endPos = dataEndPos;
+        chunkIndex = data_read->nextChunk.lowerBound;
 
-        if (data_read->nextChunk.lowerBound >= data_read->indexRange.upperBound) {
-            data_read->nextChunk.lowerBound = 0;
-            data_read->nextChunk.upperBound = 0;
+        if (!_om_decoder_advance_data_read(decoder, data_read)) {
+            // No next chunk, finish processing the current one and stop
             break;
         }
     }
@@ -644,16 +1319,83 @@ bool om_decoder_next_data_read(const OmDecoder_t *decoder, OmDecoder_dataRead_t*
     data_read->offset = (uint64_t)startPos;
     data_read->count = (uint64_t)endPos - (uint64_t)startPos;
     data_read->chunkIndex.upperBound = chunkIndex + 1;
+    if (chunk_offsets_count != NULL) {
+        *chunk_offsets_count = offsetCount;
+    }
     return true;
 }
 
+bool om_decoder_next_data_read(const OmDecoder_t *decoder, OmDecoder_dataRead_t* data_read, const void* index_data, uint64_t index_data_size, OmError_t* error) {
+    return _om_decoder_next_data_read(decoder, data_read, index_data, index_data_size, NULL, 0, NULL, error);
+}
+
+bool om_decoder_next_data_read_with_offsets(const OmDecoder_t *decoder, OmDecoder_dataRead_t* data_read, const void* index_data, uint64_t index_data_size, uint64_t* chunk_offsets, uint64_t chunk_offsets_capacity, uint64_t* chunk_offsets_count, OmError_t* error) {
+    assert(chunk_offsets_capacity >= 2 && "At least the start and end offset of one chunk are required");
+    return _om_decoder_next_data_read(decoder, data_read, index_data, index_data_size, chunk_offsets, chunk_offsets_capacity, chunk_offsets_count, error);
+}
+
+void om_decoder_data_reads_capacity(const OmDecoder_indexRead_t* index_read, uint64_t* data_reads_capacity, uint64_t* chunk_offsets_capacity) {
+    // Each data read covers at least one chunk and adds one start offset. Each chunk adds at most an end offset and the start offset after skipped chunks.
+    const uint64_t chunkCount = index_read->indexRange.upperBound - index_read->indexRange.lowerBound;
+    *data_reads_capacity = chunkCount;
+    *chunk_offsets_capacity = max(2, 3 * chunkCount);
+}
+
+bool om_decoder_next_data_reads(const OmDecoder_t *decoder, OmDecoder_dataRead_t* data_read, const void* index_data, uint64_t index_data_size, OmDecoder_dataReadRequest_t* data_reads, uint64_t data_reads_capacity, uint64_t* data_reads_count, uint64_t* chunk_offsets, uint64_t chunk_offsets_capacity, uint64_t* chunk_offsets_count, OmError_t* error) {
+    assert(chunk_offsets_capacity >= 2 && "At least the start and end offset of one chunk are required");
+    uint64_t count = 0;
+    uint64_t offsetsCount = 0;
+    // Every data read needs at least 2 chunk offsets
+    while (count < data_reads_capacity && chunk_offsets_capacity - offsetsCount >= 2) {
+        uint64_t readOffsetsCount = 0;
+        if (!_om_decoder_next_data_read(decoder, data_read, index_data, index_data_size, &chunk_offsets[offsetsCount], chunk_offsets_capacity - offsetsCount, &readOffsetsCount, error)) {
+            break;
+        }
+        data_reads[count++] = (OmDecoder_dataReadRequest_t){
+            .offset = data_read->offset,
+            .count = data_read->count,
+            .chunkIndex = data_read->chunkIndex,
+            .chunkOffsetsStart = offsetsCount,
+            .chunkOffsetsCount = readOffsetsCount
+        };
+        offsetsCount += readOffsetsCount;
+    }
+    *data_reads_count = count;
+    *chunk_offsets_count = offsetsCount;
+    return count > 0 && *error == ERROR_OK;
+}
+
+/// Repeat a value of `size` bytes `count` times. Values with identical bytes, e.g. zero, are filled with `memset`. Others are doubled with `memcpy`.
+static void _om_decoder_broadcast(void* dst, const void* value, uint64_t size, uint64_t count) {
+    if (count == 0) {
+        return;
+    }
+    const uint8_t* bytes = (const uint8_t*)value;
+    bool uniform = true;
+    for (uint64_t i = 1; i < size; i++) {
+        uniform &= bytes[i] == bytes[0];
+    }
+    if (uniform) {
+        memset(dst, bytes[0], count * size);
+        return;
+    }
+    memcpy(dst, value, size);
+    uint64_t filled = 1;
+    while (filled < count) {
+        const uint64_t n = min(filled, count - filled);
+        memcpy((uint8_t*)dst + filled * size, dst, n * size);
+        filled += n;
+    }
+}
+
 // Internal function to decode a single chunk.
 uint64_t _om_decoder_decode_chunk(
     const OmDecoder_t *decoder,
     uint64_t chunkIndex,
     const void *data,
     void *into,
-    void *chunk_buffer
+    void *chunk_buffer,
+    const void* constant
 ) {
     uint64_t rollingMultiply = 1;
     uint64_t rollingMultiplyChunkLength = 1;
@@ -664,6 +1406,7 @@ uint64_t _om_decoder_decode_chunk(
     int64_t linearReadCount = 1;
     bool linearRead = true;
     int64_t lengthLast = 0;
+    uint64_t lengthPlane = 1;
     bool no_data = false;
 
     const uint64_t dimensions_count = decoder->dimensions_count;
@@ -697,6 +1440,9 @@ uint64_t _om_decoder_decode_chunk(
         if (i == dimensions_count - 1) {
             lengthLast = length0;
         }
+        if (i_forward < 2) {
+            lengthPlane *= length0;
+        }
 
         const uint64_t d0 = clampedLocal0Start;
         const uint64_t t0 = chunkGlobal0Start - read_offset + d0;
@@ -727,26 +1473,36 @@ uint64_t _om_decoder_decode_chunk(
 
     const uint64_t lengthInChunk = rollingMultiplyChunkLength;
 
-    const uint64_t uncompressedBytes = om_decode_decompress(
-        decoder->data_type,
-        decoder->compression,
-        data,
-        lengthInChunk,
-        chunk_buffer
-    );
+    // Constant chunks are not compressed and not filtered. The size of the chunk is known by the caller.
+    uint64_t uncompressedBytes = 0;
+    if (constant != NULL) {
+        if (no_data) {
+            return 0;
+        }
+        _om_decoder_broadcast(chunk_buffer, constant, decoder->bytes_per_element_compressed, lengthInChunk);
+    } else {
+        uncompressedBytes = om_decode_decompress(
+            decoder->data_type,
+            decoder->compression,
+            data,
+            lengthInChunk,
+            chunk_buffer
+        );
 
-    if (no_data) {
-        return uncompressedBytes;
-    }
+        if (no_data) {
+            return uncompressedBytes;
+        }
 
-    // Perform 2D decoding
-    om_decode_filter(decoder->data_type, decoder->compression, chunk_buffer, lengthInChunk, lengthLast);
+        // Perform 2D decoding
+        om_decode_filter(decoder->data_type, decoder->compression, chunk_buffer, lengthInChunk, lengthPlane, lengthLast);
+    }
 
     // Copy data from the chunk buffer to the output buffer.
     while (true) {
         // Copy values from chunk buffer into output buffer
         om_decode_copy(
             decoder->data_type,
+            decoder->output_data_type,
             decoder->compression,
             linearReadCount,
             decoder->scale_factor,
@@ -820,8 +1576,533 @@ uint64_t _om_decoder_decode_chunk(
     return uncompressedBytes;
 }
 
+/// Geometry of a single chunk derived from the read plan
+typedef struct {
+    /// True if the chunk does not intersect the read
+    bool no_data;
+
+    /// True if every element of the chunk is read
+    bool fully_covered;
+
+    /// Number of elements in this chunk, in its two fastest dimensions and in its fast dimension
+    uint64_t length_in_chunk;
+    uint64_t length_plane;
+    uint64_t length_last;
+
+    /// Number of elements that can be copied linearly in one run
+    uint64_t run_length;
+
+    /// Copy runs are repeated over the dimensions `[0, run_dimensions)`
+    uint64_t run_dimensions;
+
+    /// Position of the first element to copy in the chunk buffer and the target cube
+    uint64_t chunk_start;
+    uint64_t cube_start;
+
+    /// One past the last element to copy in the chunk buffer
+    uint64_t chunk_end;
+
+    /// Shape class and element stride inside the chunk buffer for each dimension
+    const OmReadPlanShape_t* shape[OM_READ_PLAN_MAX_DIMENSIONS];
+    uint64_t chunk_stride[OM_READ_PLAN_MAX_DIMENSIONS];
+} OmChunkGeometry_t;
+
+/// Derive the geometry of a chunk from its coordinates. Only additions and multiplications are required.
+static void _om_decoder_chunk_geometry(const OmDecoder_t *decoder, const uint64_t* chunk_coordinate, OmChunkGeometry_t* geometry) {
+    const OmReadPlan_t* plan = &decoder->plan;
+    const uint64_t dimensions_count = plan->dimensions_count;
+
+    uint64_t chunkStride = 1;
+    uint64_t runLength = 1;
+    bool linearRead = true;
+
+    geometry->no_data = false;
+    geometry->fully_covered = true;
+    geometry->run_dimensions = dimensions_count;
+    geometry->chunk_start = 0;
+    geometry->cube_start = 0;
+    geometry->chunk_end = 1;
+
+    for (uint64_t i_forward = 0; i_forward < dimensions_count; i_forward++) {
+        const uint64_t i = dimensions_count - i_forward - 1;
+        const OmReadPlanDimension_t* dim = &plan->dimensions[i];
+        const uint64_t c0 = chunk_coordinate[i];
+        const uint64_t length0 = c0 + 1 == dim->chunk_count ? decoder->dimensions[i] - c0 * dim->chunk : dim->chunk;
+
+        if (i == dimensions_count - 1) {
+            geometry->length_last = length0;
+            geometry->length_plane = length0;
+        } else if (i == dimensions_count - 2) {
+            geometry->length_plane *= length0;
+        }
+
+        if (c0 < dim->chunk_lower || c0 >= dim->chunk_upper) {
+            geometry->no_data = true;
+            geometry->fully_covered = false;
+        } else {
+            const OmChunkShape_t shapeClass = c0 == dim->chunk_lower ? OM_CHUNK_SHAPE_FIRST : c0 + 1 == dim->chunk_upper ? OM_CHUNK_SHAPE_LAST : OM_CHUNK_SHAPE_INTERIOR;
+            const OmReadPlanShape_t* shape = &dim->shape[shapeClass];
+
+            geometry->shape[i] = shape;
+            geometry->chunk_stride[i] = chunkStride;
+            geometry->fully_covered &= shape->read_count == length0;
+            geometry->chunk_start += shape->read_start * chunkStride;
+            geometry->chunk_end += (shape->read_start + shape->read_count - 1) * chunkStride;
+            geometry->cube_start += (c0 * dim->chunk + shape->read_start - dim->read_offset + dim->cube_offset) * dim->cube_stride;
+
+            if (linearRead) {
+                // Runs continue into the next slower dimension if this dimension is entirely read and contiguous in the target cube
+                runLength *= shape->read_count;
+                geometry->run_dimensions = i;
+                linearRead = shape->read_count == length0 && dim->cube_dimension == length0;
+            }
+        }
+        chunkStride *= length0;
+    }
+    geometry->length_in_chunk = chunkStride;
+    geometry->run_length = runLength;
+}
+
+/// Advance `d` and `q` to the next copy run of a chunk. Overflowing dimensions are rolled back and carry to the next slower dimension.
+/// Returns false once all runs have been visited.
+static inline bool _om_decoder_next_run(const OmDecoder_t *decoder, const OmChunkGeometry_t* geometry, uint64_t* position, uint64_t* d, uint64_t* q) {
+    const OmReadPlan_t* plan = &decoder->plan;
+    uint64_t i = geometry->run_dimensions;
+    while (i > 0) {
+        i--;
+        const uint64_t readCount = geometry->shape[i]->read_count;
+        *d += geometry->chunk_stride[i];
+        *q += plan->dimensions[i].cube_stride;
+        if (++position[i] < readCount) {
+            return true;
+        }
+        position[i] = 0;
+        *d -= readCount * geometry->chunk_stride[i];
+        *q -= readCount * plan->dimensions[i].cube_stride;
+    }
+    return false;
+}
+
+/// Copy all runs of a decompressed and filtered chunk into the target cube
+static void _om_decoder_copy_chunk(const OmDecoder_t *decoder, const OmChunkGeometry_t* geometry, const void* chunk_buffer, void* into) {
+    uint64_t position[OM_READ_PLAN_MAX_DIMENSIONS] = {0};
+    uint64_t d = geometry->chunk_start; // Read coordinate.
+    uint64_t q = geometry->cube_start; // Write coordinate.
+
+    do {
+        om_decode_copy(
+            decoder->data_type,
+            decoder->output_data_type,
+            decoder->compression,
+            geometry->run_length,
+            decoder->scale_factor,
+            decoder->add_offset,
+            (const uint8_t*)chunk_buffer + d * decoder->bytes_per_element_compressed,
+            (uint8_t*)into + q * decoder->bytes_per_element
+        );
+    } while (_om_decoder_next_run(decoder, geometry, position, &d, &q));
+}
+
+// MARK: Reductions
+
+/// Accumulate `length` values of a row converted to double with `CONVERT` into the output elements `o, o + stride, ...`. A stride of 0 accumulates all values into one element.
+#define OM_REDUCTION_ACCUMULATE(NAME, TYPE, CONVERT) \
+static void _om_reduction_accumulate_##NAME(OmReduction_t* reduction, const TYPE* row, uint64_t length, uint64_t o, uint64_t stride) { \
+    double* values = reduction->values; \
+    uint64_t* counts = reduction->counts; \
+    if (stride == 0) { \
+        /* Accumulate in registers and store once */ \
+        double acc = values[o]; \
+        uint64_t count = 0; \
+        switch (reduction->op) { \
+            case OM_REDUCE_MIN: \
+                for (uint64_t j = 0; j < length; j++) { \
+                    const double v = CONVERT(row[j]); \
+                    if (v == v) { acc = v < acc ? v : acc; count++; } \
+                } \
+                break; \
+            case OM_REDUCE_MAX: \
+                for (uint64_t j = 0; j < length; j++) { \
+                    const double v = CONVERT(row[j]); \
+                    if (v == v) { acc = v > acc ? v : acc; count++; } \
+                } \
+                break; \
+            default: \
+                for (uint64_t j = 0; j < length; j++) { \
+                    const double v = CONVERT(row[j]); \
+                    if (v == v) { acc += v; count++; } \
+                } \
+                break; \
+        } \
+        values[o] = acc; \
+        counts[o] += count; \
+        return; \
+    } \
+    switch (reduction->op) { \
+        case OM_REDUCE_MIN: \
+            for (uint64_t j = 0; j < length; j++, o += stride) { \
+                const double v = CONVERT(row[j]); \
+                if (v == v) { values[o] = v < values[o] ? v : values[o]; counts[o]++; } \
+            } \
+            break; \
+        case OM_REDUCE_MAX: \
+            for (uint64_t j = 0; j < length; j++, o += stride) { \
+                const double v = CONVERT(row[j]); \
+                if (v == v) { values[o] = v > values[o] ? v : values[o]; counts[o]++; } \
+            } \
+            break; \
+        default: \
+            for (uint64_t j = 0; j < length; j++, o += stride) { \
+                const double v = CONVERT(row[j]); \
+                if (v == v) { values[o] += v; counts[o]++; } \
+            } \
+            break; \
+    } \
+}
+
+OM_REDUCTION_ACCUMULATE(int8, int8_t, (double))
+OM_REDUCTION_ACCUMULATE(uint8, uint8_t, (double))
+OM_REDUCTION_ACCUMULATE(int16, int16_t, (double))
+OM_REDUCTION_ACCUMULATE(uint16, uint16_t, (double))
+OM_REDUCTION_ACCUMULATE(int32, int32_t, (double))
+OM_REDUCTION_ACCUMULATE(uint32, uint32_t, (double))
+OM_REDUCTION_ACCUMULATE(int64, int64_t, (double))
+OM_REDUCTION_ACCUMULATE(uint64, uint64_t, (double))
+OM_REDUCTION_ACCUMULATE(float, float, (double))
+OM_REDUCTION_ACCUMULATE(double, double, (double))
+OM_REDUCTION_ACCUMULATE(float16, uint16_t, om_common_float16_to_float)
+OM_REDUCTION_ACCUMULATE(bfloat16, uint16_t, om_common_bfloat16_to_float)
+
+/// Accumulate a row of decoded values of the decoder output data type
+static inline void _om_reduction_accumulate(OmReduction_t* reduction, OmDataType_t data_type, const void* row, uint64_t length, uint64_t o, uint64_t stride) {
+    switch (data_type) {
+        case DATA_TYPE_INT8_ARRAY: _om_reduction_accumulate_int8(reduction, (const int8_t*)row, length, o, stride); break;
+        case DATA_TYPE_UINT8_ARRAY: _om_reduction_accumulate_uint8(reduction, (const uint8_t*)row, length, o, stride); break;
+        case DATA_TYPE_INT16_ARRAY: _om_reduction_accumulate_int16(reduction, (const int16_t*)row, length, o, stride); break;
+        case DATA_TYPE_UINT16_ARRAY: _om_reduction_accumulate_uint16(reduction, (const uint16_t*)row, length, o, stride); break;
+        case DATA_TYPE_INT32_ARRAY: _om_reduction_accumulate_int32(reduction, (const int32_t*)row, length, o, stride); break;
+        case DATA_TYPE_UINT32_ARRAY: _om_reduction_accumulate_uint32(reduction, (const uint32_t*)row, length, o, stride); break;
+        case DATA_TYPE_INT64_ARRAY: _om_reduction_accumulate_int64(reduction, (const int64_t*)row, length, o, stride); break;
+        case DATA_TYPE_UINT64_ARRAY: _om_reduction_accumulate_uint64(reduction, (const uint64_t*)row, length, o, stride); break;
+        case DATA_TYPE_FLOAT_ARRAY: _om_reduction_accumulate_float(reduction, (const float*)row, length, o, stride); break;
+        case DATA_TYPE_DOUBLE_ARRAY: _om_reduction_accumulate_double(reduction, (const double*)row, length, o, stride); break;
+        case DATA_TYPE_FLOAT16_ARRAY: _om_reduction_accumulate_float16(reduction, (const uint16_t*)row, length, o, stride); break;
+        case DATA_TYPE_BFLOAT16_ARRAY: _om_reduction_accumulate_bfloat16(reduction, (const uint16_t*)row, length, o, stride); break;
+        default: break;
+    }
+}
+
+/// Convert each row of the fast dimension of a decompressed and filtered chunk into `row_buffer` and accumulate it into the reduction
+static void _om_decoder_reduce_chunk(const OmDecoder_t *decoder, const OmChunkGeometry_t* geometry, const uint64_t* chunk_coordinate, const void* chunk_buffer, void* row_buffer, OmReduction_t* reduction) {
+    const OmReadPlan_t* plan = &decoder->plan;
+    const uint64_t last = plan->dimensions_count - 1;
+    const uint64_t rowLength = geometry->shape[last]->read_count;
+
+    uint64_t o = 0; // Output coordinate.
+    for (uint64_t i = 0; i < plan->dimensions_count; i++) {
+        const OmReadPlanDimension_t* dim = &plan->dimensions[i];
+        o += (chunk_coordinate[i] * dim->chunk + geometry->shape[i]->read_start - dim->read_offset) * reduction->output_stride[i];
+    }
+    uint64_t position[OM_READ_PLAN_MAX_DIMENSIONS] = {0};
+    uint64_t d = geometry->chunk_start; // Read coordinate.
+
+    while (true) {
+        om_decode_copy(
+            decoder->data_type,
+            decoder->output_data_type,
+            decoder->compression,
+            rowLength,
+            decoder->scale_factor,
+            decoder->add_offset,
+            (const uint8_t*)chunk_buffer + d * decoder->bytes_per_element_compressed,
+            row_buffer
+        );
+        _om_reduction_accumulate(reduction, decoder->output_data_type, row_buffer, rowLength, o, reduction->output_stride[last]);
+
+        // Advance to the next row. Overflowing dimensions are rolled back and carry to the next slower dimension.
+        uint64_t i = last;
+        while (true) {
+            if (i == 0) {
+                return;
+            }
+            i--;
+            const uint64_t readCount = geometry->shape[i]->read_count;
+            d += geometry->chunk_stride[i];
+            o += reduction->output_stride[i];
+            if (++position[i] < readCount) {
+                break;
+            }
+            position[i] = 0;
+            d -= readCount * geometry->chunk_stride[i];
+            o -= readCount * reduction->output_stride[i];
+        }
+    }
+}
+
+/// Row buffer of a reduction behind the chunk buffer
+static inline void* _om_decoder_reduce_row_buffer(const OmDecoder_t *decoder, void* chunk_buffer) {
+    return (uint8_t*)chunk_buffer + om_decoder_read_buffer_size(decoder);
+}
+
+/// Copy a decoded chunk into the target cube or accumulate it into `reduction` if not NULL
+static inline void _om_decoder_output_chunk(const OmDecoder_t *decoder, const OmChunkGeometry_t* geometry, const uint64_t* chunk_coordinate, const void* decoded, void* into, void* chunk_buffer, OmReduction_t* reduction) {
+    if (reduction != NULL) {
+        _om_decoder_reduce_chunk(decoder, geometry, chunk_coordinate, decoded, _om_decoder_reduce_row_buffer(decoder, chunk_buffer), reduction);
+    } else {
+        _om_decoder_copy_chunk(decoder, geometry, decoded, into);
+    }
+}
+
+/// Emit a constant chunk without decompression. `value` is the stored element before scaling. The value is converted once and broadcast into each run of the
+/// target cube. Reductions broadcast the stored value into the chunk buffer and accumulate it like a decoded chunk.
+static void _om_decoder_fill_constant_chunk(const OmDecoder_t *decoder, const uint64_t* chunk_coordinate, const void* value, void* into, void* chunk_buffer, OmReduction_t* reduction) {
+    OmChunkGeometry_t geometry;
+    _om_decoder_chunk_geometry(decoder, chunk_coordinate, &geometry);
+    if (geometry.no_data) {
+        return;
+    }
+    if (reduction != NULL) {
+        _om_decoder_broadcast(chunk_buffer, value, decoder->bytes_per_element_compressed, geometry.length_in_chunk);
+        _om_decoder_reduce_chunk(decoder, &geometry, chunk_coordinate, chunk_buffer, _om_decoder_reduce_row_buffer(decoder, chunk_buffer), reduction);
+        return;
+    }
+    // The value in file data is not aligned
+    uint64_t stored = 0;
+    uint64_t decoded = 0;
+    memcpy(&stored, value, decoder->bytes_per_element_compressed);
+    om_decode_copy(decoder->data_type, decoder->output_data_type, decoder->compression, 1, decoder->scale_factor, decoder->add_offset, &stored, &decoded);
+
+    uint64_t position[OM_READ_PLAN_MAX_DIMENSIONS] = {0};
+    uint64_t d = geometry.chunk_start; // Read coordinate. Only tracked to advance runs.
+    uint64_t q = geometry.cube_start; // Write coordinate.
+    do {
+        _om_decoder_broadcast((uint8_t*)into + q * decoder->bytes_per_element, &decoded, decoder->bytes_per_element, geometry.run_length);
+    } while (_om_decoder_next_run(decoder, &geometry, position, &d, &q));
+}
+
+/// Undo the 2D delta coding and scale a fully read COMPRESSION_PFOR_DELTA2D_INT16 chunk in a single pass.
+/// Runs cover whole rows and are visited in chunk order, therefore the previous row is always decoded already.
+static void _om_decoder_filter_copy_chunk_int16(const OmDecoder_t *decoder, const OmChunkGeometry_t* geometry, int16_t* chunk_buffer, float* into) {
+    uint64_t position[OM_READ_PLAN_MAX_DIMENSIONS] = {0};
+    uint64_t d = 0; // Read coordinate. A fully read chunk starts at 0.
+    uint64_t q = geometry->cube_start; // Write coordinate.
+    const uint64_t length1 = geometry->length_last;
+    const uint64_t rowsPerRun = geometry->run_length / length1;
+
+    do {
+        om_common_decode_delta2d_int16_to_float(
+            rowsPerRun,
+            length1,
+            decoder->scale_factor,
+            decoder->add_offset,
+            d == 0 ? NULL : &chunk_buffer[d - length1],
+            &chunk_buffer[d],
+            &into[q]
+        );
+    } while (_om_decoder_next_run(decoder, geometry, position, &d, &q));
+}
+
+/// Number of leading elements to decompress to obtain the first `count` elements of a chunk with `length` elements.
+/// PFOR delta codecs store `leading` values (the first value) followed by blocks of 128 deltas. Delta-of-delta codecs start with a block directly.
+/// Each block continues from the last value of the previous block, therefore decoding can stop after any block, but no block can be skipped.
+/// Returns `length` if the trailing partial block is needed as well.
+static inline uint64_t _om_decoder_pfor_prefix_length(uint64_t count, uint64_t length, uint64_t leading) {
+    const uint64_t blockLength = 128;
+    const uint64_t blocks = divide_rounded_up(count - leading, blockLength);
+    if (blocks > (length - leading) / blockLength) {
+        return length;
+    }
+    return leading + blocks * blockLength;
+}
+
+/// Decode a single chunk using the precomputed read plan.
+/// If `compressed_size` is known, only the leading PFOR blocks and rows up to the last element read are decoded. In this case `compressed_size` is returned unless the decoded blocks exceed it.
+static uint64_t _om_decoder_decode_chunk_planned(
+    const OmDecoder_t *decoder,
+    const uint64_t* chunk_coordinate,
+    const void *data,
+    uint64_t compressed_size,
+    void *into,
+    void *chunk_buffer,
+    OmReduction_t* reduction
+) {
+    OmChunkGeometry_t geometry;
+    _om_decoder_chunk_geometry(decoder, chunk_coordinate, &geometry);
+
+    const bool pfor = decoder->compression == COMPRESSION_PFOR_DELTA2D_INT16 || decoder->compression == COMPRESSION_PFOR_DELTA2D_INT16_LOGARITHMIC || decoder->compression == COMPRESSION_PFOR_DELTA2D || decoder->compression == COMPRESSION_PFOR_DOD || decoder->compression == COMPRESSION_PFOR_DELTA2D_DOD;
+    if (compressed_size > 0 && !geometry.no_data && pfor) {
+        // 2D delta decoding requires all rows up to the last row that is read
+        const uint64_t filterLength = divide_rounded_up(geometry.chunk_end, geometry.length_last) * geometry.length_last;
+        const bool dod = decoder->compression == COMPRESSION_PFOR_DOD || decoder->compression == COMPRESSION_PFOR_DELTA2D_DOD;
+        const uint64_t decompressLength = _om_decoder_pfor_prefix_length(filterLength, geometry.length_in_chunk, dod ? 0 : 1);
+        if (decompressLength < geometry.length_in_chunk) {
+            const uint64_t decompressedBytes = om_decode_decompress(
+                decoder->data_type,
+                decoder->compression,
+                data,
+                decompressLength,
+                chunk_buffer
+            );
+            om_decode_filter(decoder->data_type, decoder->compression, chunk_buffer, filterLength, geometry.length_plane, geometry.length_last);
+            _om_decoder_output_chunk(decoder, &geometry, chunk_coordinate, chunk_buffer, into, chunk_buffer, reduction);
+            return decompressedBytes > compressed_size ? decompressedBytes : compressed_size;
+        }
+    }
+
+    const uint64_t uncompressedBytes = om_decode_decompress(
+        decoder->data_type,
+        decoder->compression,
+        data,
+        geometry.length_in_chunk,
+        chunk_buffer
+    );
+
+    if (geometry.no_data) {
+        return uncompressedBytes;
+    }
+
+    if (reduction == NULL && geometry.fully_covered && decoder->compression == COMPRESSION_PFOR_DELTA2D_INT16 && decoder->data_type == DATA_TYPE_FLOAT_ARRAY) {
+        // Fused 2D decoding and scaling while rows are still in L1 cache
+        _om_decoder_filter_copy_chunk_int16(decoder, &geometry, (int16_t*)chunk_buffer, (float*)into);
+        return uncompressedBytes;
+    }
+
+    // Perform 2D decoding
+    om_decode_filter(decoder->data_type, decoder->compression, chunk_buffer, geometry.length_in_chunk, geometry.length_plane, geometry.length_last);
+
+    _om_decoder_output_chunk(decoder, &geometry, chunk_coordinate, chunk_buffer, into, chunk_buffer, reduction);
+    return uncompressedBytes;
+}
+
+/// Decode a single chunk through the chunk cache. On a cache hit, only the copy into the target cube is performed.
+/// On a miss, the entire chunk is decompressed and filtered, so it can be stored for later reads.
+static uint64_t _om_decoder_decode_chunk_cached(
+    const OmDecoder_t *decoder,
+    uint64_t chunk_index,
+    const uint64_t* chunk_coordinate,
+    const void *data,
+    uint64_t compressed_size,
+    void *into,
+    void *chunk_buffer,
+    OmReduction_t* reduction
+) {
+    OmChunkGeometry_t geometry;
+    _om_decoder_chunk_geometry(decoder, chunk_coordinate, &geometry);
+    const uint64_t filteredSize = geometry.length_in_chunk * decoder->bytes_per_element_compressed;
+
+    const void* cached = om_chunk_cache_acquire(decoder->chunk_cache, decoder->chunk_cache_file_id, decoder->lut_start, chunk_index, filteredSize);
+    if (cached != NULL) {
+        _om_decoder_output_chunk(decoder, &geometry, chunk_coordinate, cached, into, chunk_buffer, reduction);
+        om_chunk_cache_release(decoder->chunk_cache, decoder->chunk_cache_file_id, decoder->lut_start, chunk_index);
+        return compressed_size;
+    }
+
+    const uint64_t uncompressedBytes = om_decode_decompress(
+        decoder->data_type,
+        decoder->compression,
+        data,
+        geometry.length_in_chunk,
+        chunk_buffer
+    );
+    om_decode_filter(decoder->data_type, decoder->compression, chunk_buffer, geometry.length_in_chunk, geometry.length_plane, geometry.length_last);
+    om_chunk_cache_put(decoder->chunk_cache, decoder->chunk_cache_file_id, decoder->lut_start, chunk_index, chunk_buffer, filteredSize);
+    _om_decoder_output_chunk(decoder, &geometry, chunk_coordinate, chunk_buffer, into, chunk_buffer, reduction);
+    return uncompressedBytes;
+}
+
+/// Advance chunk coordinates to the next linear chunk index
+static void _om_decoder_chunk_coordinate_increment(const OmReadPlan_t* plan, uint64_t* chunk_coordinate) {
+    for (uint64_t i_forward = 0; i_forward < plan->dimensions_count; i_forward++) {
+        const uint64_t i = plan->dimensions_count - i_forward - 1;
+        if (++chunk_coordinate[i] < plan->dimensions[i].chunk_count) {
+            return;
+        }
+        chunk_coordinate[i] = 0;
+    }
+}
+
+/// True if a chunk intersects the read. Uses chunk coordinates from the read plan.
+static inline bool _om_decoder_chunk_intersects_planned(const OmReadPlan_t* plan, const uint64_t* chunk_coordinate) {
+    for (uint64_t i = 0; i < plan->dimensions_count; i++) {
+        if (chunk_coordinate[i] < plan->dimensions[i].chunk_lower || chunk_coordinate[i] >= plan->dimensions[i].chunk_upper) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// True if a chunk intersects the read. Generic code path for arrays without read plan.
+static bool _om_decoder_chunk_intersects(const OmDecoder_t *decoder, uint64_t chunk_index) {
+    for (uint64_t i_forward = 0; i_forward < decoder->dimensions_count; i_forward++) {
+        const uint64_t i = decoder->dimensions_count - i_forward - 1;
+        const uint64_t chunk = decoder->chunks[i];
+        const uint64_t nChunksInThisDimension = divide_rounded_up(decoder->dimensions[i], chunk);
+        const uint64_t c0 = chunk_index % nChunksInThisDimension;
+        chunk_index /= nChunksInThisDimension;
+        if (c0 < decoder->read_offset[i] / chunk || c0 >= divide_rounded_up(decoder->read_offset[i] + decoder->read_count[i], chunk)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Decode a single chunk with the read plan, through the chunk cache or with the generic code path. `data_size` bytes of `data` are accessible.
+/// `compressed_size` is the size of the chunk or 0 if unknown. If the array has constant chunks, the `OmChunkHeader_t` is handled here.
+/// Returns the number of bytes of the chunk. The result is larger than `data_size` if the data is truncated.
+static uint64_t _om_decoder_decode_chunk_with_header(
+    const OmDecoder_t *decoder,
+    uint64_t chunk_index,
+    const uint64_t* chunk_coordinate,
+    const uint8_t *data,
+    uint64_t data_size,
+    uint64_t compressed_size,
+    void *into,
+    void *chunk_buffer,
+    OmReduction_t* reduction
+) {
+    const bool usePlan = decoder->plan.dimensions_count > 0;
+    uint64_t headerLength = 0;
+    if (decoder->constant_chunks) {
+        if (data[0] == OM_CHUNK_HEADER_CONSTANT) {
+            const uint64_t size = 1 + decoder->bytes_per_element_compressed;
+            if (size > data_size) {
+                return size;
+            }
+            if (usePlan) {
+                _om_decoder_fill_constant_chunk(decoder, chunk_coordinate, &data[1], into, chunk_buffer, reduction);
+            } else {
+                _om_decoder_decode_chunk(decoder, chunk_index, NULL, into, chunk_buffer, &data[1]);
+            }
+            return size;
+        }
+        headerLength = 1;
+        data += 1;
+        compressed_size -= compressed_size > 0 ? 1 : 0;
+    }
+    if (usePlan && decoder->chunk_cache != NULL && compressed_size > 0) {
+        return headerLength + _om_decoder_decode_chunk_cached(decoder, chunk_index, chunk_coordinate, data, compressed_size, into, chunk_buffer, reduction);
+    }
+    if (usePlan) {
+        return headerLength + _om_decoder_decode_chunk_planned(decoder, chunk_coordinate, data, compressed_size, into, chunk_buffer, reduction);
+    }
+    return headerLength + _om_decoder_decode_chunk(decoder, chunk_index, data, into, chunk_buffer, NULL);
+}
+
+/// Streaming writers store a block of a `LUT_ENCODING_PFOR_VARIABLE` LUT after chunk `64k+63`. The block is part of the range of this chunk in the LUT.
+static inline bool _om_decoder_chunk_followed_by_lut_block(const OmDecoder_t *decoder, uint64_t chunk_index) {
+    return decoder->lut_block_offsets_start != 0 && chunk_index % LUT_CHUNK_COUNT == LUT_CHUNK_COUNT - 1;
+}
+
 bool om_decoder_decode_chunks(const OmDecoder_t *decoder, OmRange_t chunk, const void *data, uint64_t data_size, void *into, void *chunkBuffer, OmError_t *error) {
     uint64_t pos = 0;
+    const bool usePlan = decoder->plan.dimensions_count > 0;
+
+    // Chunk coordinates are derived once and then incremented for each chunk
+    uint64_t chunkCoordinate[OM_READ_PLAN_MAX_DIMENSIONS];
+    if (usePlan) {
+        _om_decoder_chunk_coordinate(&decoder->plan, chunk.lowerBound, chunkCoordinate);
+    }
+
     // printf("chunkIndex.lowerBound %lu %lu\n",chunk.lowerBound,chunk.upperBound);
     for (uint64_t chunkNum = chunk.lowerBound; chunkNum < chunk.upperBound; ++chunkNum) {
         // printf("chunkIndex %lu pos=%lu dataCount=%lu \n",chunkNum, pos, data_size);
@@ -832,14 +2113,478 @@ bool om_decoder_decode_chunks(const OmDecoder_t *decoder, OmRange_t chunk, const
         if (*error != ERROR_OK) {
             return false;
         }
-        uint64_t uncompressedBytes = _om_decoder_decode_chunk(decoder, chunkNum, (const uint8_t *)data + pos, into, chunkBuffer);
+        const uint64_t uncompressedBytes = _om_decoder_decode_chunk_with_header(decoder, chunkNum, chunkCoordinate, (const uint8_t *)data + pos, data_size - pos, 0, into, chunkBuffer, NULL);
+        if (usePlan) {
+            _om_decoder_chunk_coordinate_increment(&decoder->plan, chunkCoordinate);
+        }
         pos += uncompressedBytes;
     }
     // printf("%lu %lu \n", pos, data_size);
 
-    if (pos != data_size) {
+    if (pos > data_size || (pos < data_size && !_om_decoder_chunk_followed_by_lut_block(decoder, chunk.upperBound - 1))) {
         (*error) = ERROR_DEFLATED_SIZE_MISMATCH;
         return false;
     }
     return pos;
 }
+
+/// Decode chunks into `into` or accumulate them into `reduction` if not NULL. Reductions require a read plan.
+static bool _om_decoder_decode_chunks_with_offsets(const OmDecoder_t *decoder, OmRange_t chunk, const void *data, uint64_t data_size, const uint64_t* chunk_offsets, uint64_t chunk_offsets_count, void *into, void *chunkBuffer, OmReduction_t* reduction, OmError_t *error) {
+    const bool usePlan = decoder->plan.dimensions_count > 0;
+
+    // Chunk coordinates are derived once and then incremented for each chunk
+    uint64_t chunkCoordinate[OM_READ_PLAN_MAX_DIMENSIONS];
+    if (usePlan) {
+        _om_decoder_chunk_coordinate(&decoder->plan, chunk.lowerBound, chunkCoordinate);
+    }
+
+    // Position in `chunk_offsets` of the start offset of the next chunk
+    uint64_t o = 0;
+    bool previousSkipped = false;
+
+    for (uint64_t chunkNum = chunk.lowerBound; chunkNum < chunk.upperBound; ++chunkNum) {
+        if (*error != ERROR_OK) {
+            return false;
+        }
+        const bool intersects = usePlan ? _om_decoder_chunk_intersects_planned(&decoder->plan, chunkCoordinate) : _om_decoder_chunk_intersects(decoder, chunkNum);
+        if (!intersects || !_om_decoder_chunk_selected(decoder, chunkNum)) {
+            // A sequence of non-intersecting chunks is skipped without decompression. It is represented by one additional offset.
+            if (!previousSkipped) {
+                o += 1;
+                previousSkipped = true;
+            }
+            if (usePlan) {
+                _om_decoder_chunk_coordinate_increment(&decoder->plan, chunkCoordinate);
+            }
+            continue;
+        }
+        previousSkipped = false;
+
+        if (o + 1 >= chunk_offsets_count || chunk_offsets[o] >= data_size || chunk_offsets[o + 1] > data_size || chunk_offsets[o] > chunk_offsets[o + 1]) {
+            (*error) = ERROR_DEFLATED_SIZE_MISMATCH;
+            return false;
+        }
+        const uint64_t start = chunk_offsets[o];
+        const uint64_t compressedSize = chunk_offsets[o + 1] - start;
+        const uint64_t uncompressedBytes = _om_decoder_decode_chunk_with_header(decoder, chunkNum, chunkCoordinate, (const uint8_t *)data + start, compressedSize, compressedSize, into, chunkBuffer, reduction);
+        if (usePlan) {
+            _om_decoder_chunk_coordinate_increment(&decoder->plan, chunkCoordinate);
+        }
+        if (uncompressedBytes > compressedSize || (uncompressedBytes < compressedSize && !_om_decoder_chunk_followed_by_lut_block(decoder, chunkNum))) {
+            (*error) = ERROR_DEFLATED_SIZE_MISMATCH;
+            return false;
+        }
+        o += 1;
+    }
+
+    if (o + 1 != chunk_offsets_count || chunk_offsets[o] != data_size) {
+        (*error) = ERROR_DEFLATED_SIZE_MISMATCH;
+        return false;
+    }
+    return true;
+}
+
+bool om_decoder_decode_chunks_with_offsets(const OmDecoder_t *decoder, OmRange_t chunk, const void *data, uint64_t data_size, const uint64_t* chunk_offsets, uint64_t chunk_offsets_count, void *into, void *chunkBuffer, OmError_t *error) {
+    return _om_decoder_decode_chunks_with_offsets(decoder, chunk, data, data_size, chunk_offsets, chunk_offsets_count, into, chunkBuffer, NULL, error);
+}
+
+bool om_decoder_reduce_chunks_with_offsets(const OmDecoder_t *decoder, OmReduction_t* reduction, OmRange_t chunk, const void *data, uint64_t data_size, const uint64_t* chunk_offsets, uint64_t chunk_offsets_count, void *chunkBuffer, OmError_t *error) {
+    if (decoder->plan.dimensions_count == 0) {
+        (*error) = ERROR_INVALID_DIMENSIONS;
+        return false;
+    }
+    return _om_decoder_decode_chunks_with_offsets(decoder, chunk, data, data_size, chunk_offsets, chunk_offsets_count, NULL, chunkBuffer, reduction, error);
+}
+
+/// Set all accumulators to the neutral element of the operator
+static void _om_reduction_reset(OmReduction_t* reduction) {
+    const double initial = reduction->op == OM_REDUCE_MIN ? INFINITY : reduction->op == OM_REDUCE_MAX ? -INFINITY : 0;
+    for (uint64_t i = 0; i < reduction->count; i++) {
+        reduction->values[i] = initial;
+        reduction->counts[i] = 0;
+    }
+}
+
+uint64_t om_decoder_reduction_count(const OmDecoder_t* decoder, const bool* reduce_dimensions) {
+    uint64_t count = 1;
+    for (uint64_t i = 0; i < decoder->dimensions_count; i++) {
+        count *= reduce_dimensions[i] ? 1 : decoder->read_count[i];
+    }
+    return count;
+}
+
+OmError_t om_decoder_reduction_init(const OmDecoder_t* decoder, OmReduction_t* reduction, OmReduceOperator_t op, const bool* reduce_dimensions, double* values, uint64_t* counts) {
+    if (decoder->plan.dimensions_count == 0) {
+        return ERROR_INVALID_DIMENSIONS;
+    }
+    reduction->op = op;
+    reduction->values = values;
+    reduction->counts = counts;
+    uint64_t stride = 1;
+    for (uint64_t i_forward = 0; i_forward < decoder->dimensions_count; i_forward++) {
+        const uint64_t i = decoder->dimensions_count - i_forward - 1;
+        reduction->output_stride[i] = reduce_dimensions[i] ? 0 : stride;
+        stride *= reduce_dimensions[i] ? 1 : decoder->read_count[i];
+    }
+    reduction->count = stride;
+
+    _om_reduction_reset(reduction);
+    return ERROR_OK;
+}
+
+void om_decoder_reduction_merge(OmReduction_t* reduction, const OmReduction_t* other) {
+    for (uint64_t i = 0; i < reduction->count; i++) {
+        switch (reduction->op) {
+            case OM_REDUCE_MIN:
+                reduction->values[i] = min(reduction->values[i], other->values[i]);
+                break;
+            case OM_REDUCE_MAX:
+                reduction->values[i] = max(reduction->values[i], other->values[i]);
+                break;
+            default:
+                reduction->values[i] += other->values[i];
+                break;
+        }
+        reduction->counts[i] += other->counts[i];
+    }
+}
+
+void om_decoder_reduction_finalise(const OmReduction_t* reduction, double* into) {
+    for (uint64_t i = 0; i < reduction->count; i++) {
+        const uint64_t count = reduction->counts[i];
+        switch (reduction->op) {
+            case OM_REDUCE_SUM:
+                into[i] = reduction->values[i];
+                break;
+            case OM_REDUCE_MEAN:
+                into[i] = count == 0 ? NAN : reduction->values[i] / (double)count;
+                break;
+            case OM_REDUCE_MIN:
+            case OM_REDUCE_MAX:
+                into[i] = count == 0 ? NAN : reduction->values[i];
+                break;
+            case OM_REDUCE_COUNT:
+                into[i] = (double)count;
+                break;
+        }
+    }
+}
+
+uint64_t om_decoder_reduce_buffer_size(const OmDecoder_t* decoder) {
+    return om_decoder_read_buffer_size(decoder) + decoder->chunks[decoder->dimensions_count - 1] * decoder->bytes_per_element;
+}
+
+
+// MARK: Parallel decoding
+
+/// Index read with the data reads and chunk offsets planned from its index data
+typedef struct {
+    OmDecoder_indexRead_t read;
+    OmDecoder_dataReadRequest_t* data_reads;
+    uint64_t data_reads_count;
+    uint64_t* chunk_offsets;
+} OmDecoderParallelIndexRead_t;
+
+/// Data read and the index read it belongs to
+typedef struct {
+    const OmDecoder_dataReadRequest_t* request;
+    const uint64_t* chunk_offsets;
+} OmDecoderParallelDataRead_t;
+
+/// Buffers owned by a single worker
+typedef struct {
+    uint8_t* read_buffer;
+    uint64_t read_buffer_size;
+    uint8_t* chunk_buffer;
+    /// Partial reduction of this worker. NULL if not reducing or not yet allocated.
+    OmReduction_t* reduction;
+    uint8_t padding[64 - 2 * sizeof(uint8_t*) - sizeof(uint64_t) - sizeof(OmReduction_t*)];
+} OmDecoderParallelWorker_t;
+
+typedef struct {
+    const OmDecoder_t* decoder;
+    OmDecoder_readCallback_t read;
+    void* context;
+    void* into;
+    /// Accumulate into per-worker partial reductions instead of writing into `into`. NULL to decode.
+    OmReduction_t* reduction;
+    OmDecoderParallelIndexRead_t* index_reads;
+    OmDecoderParallelDataRead_t* data_reads;
+    OmDecoderParallelWorker_t* workers;
+    OmWorkQueue_t queue;
+    atomic_int error;
+} OmDecoderParallelJob_t;
+
+/// Store the first error of concurrent workers
+static inline void _om_decoder_parallel_set_error(OmDecoderParallelJob_t* job, OmError_t error) {
+    int expected = ERROR_OK;
+    atomic_compare_exchange_strong(&job->error, &expected, (int)error);
+}
+
+/// Read `count` bytes using the read buffer of a worker. Returns NULL and sets the job error on failure.
+static const void* _om_decoder_parallel_read(OmDecoderParallelJob_t* job, uint32_t worker, uint64_t offset, uint64_t count) {
+    OmDecoderParallelWorker_t* state = &job->workers[worker];
+    if (state->read_buffer_size < count) {
+        free(state->read_buffer);
+        // Grow geometrically to avoid an allocation for each slightly larger read
+        state->read_buffer_size = max(count, state->read_buffer_size * 2);
+        state->read_buffer = malloc(state->read_buffer_size);
+        if (state->read_buffer == NULL) {
+            state->read_buffer_size = 0;
+            _om_decoder_parallel_set_error(job, ERROR_OUT_OF_MEMORY);
+            return NULL;
+        }
+    }
+    const void* data = job->read(job->context, offset, count, state->read_buffer);
+    if (data == NULL) {
+        _om_decoder_parallel_set_error(job, ERROR_IO_READ);
+    }
+    return data;
+}
+
+/// Read index data and plan all data reads of an index read
+static void _om_decoder_parallel_index_job(void* context, uint32_t worker) {
+    OmDecoderParallelJob_t* job = (OmDecoderParallelJob_t*)context;
+    uint64_t task;
+    while (atomic_load_explicit(&job->error, memory_order_relaxed) == ERROR_OK && om_work_queue_next(&job->queue, worker, &task)) {
+        OmDecoderParallelIndexRead_t* indexRead = &job->index_reads[task];
+        OmError_t error = ERROR_OK;
+        // Index reads resolved by the LUT cache do not need index data
+        const void* indexData = NULL;
+        if (indexRead->read.count > 0) {
+            indexData = _om_decoder_parallel_read(job, worker, indexRead->read.offset, indexRead->read.count);
+            if (indexData == NULL) {
+                return;
+            }
+        }
+        uint64_t readsCapacity, offsetsCapacity;
+        om_decoder_data_reads_capacity(&indexRead->read, &readsCapacity, &offsetsCapacity);
+        indexRead->data_reads = malloc(max(readsCapacity, (uint64_t)1) * sizeof(OmDecoder_dataReadRequest_t));
+        indexRead->chunk_offsets = malloc(offsetsCapacity * sizeof(uint64_t));
+        if (indexRead->data_reads == NULL || indexRead->chunk_offsets == NULL) {
+            _om_decoder_parallel_set_error(job, ERROR_OUT_OF_MEMORY);
+            return;
+        }
+        OmDecoder_dataRead_t dataRead;
+        om_decoder_init_data_read(&dataRead, &indexRead->read);
+        uint64_t offsetsCount = 0;
+        om_decoder_next_data_reads(job->decoder, &dataRead, indexData, indexRead->read.count, indexRead->data_reads, readsCapacity, &indexRead->data_reads_count, indexRead->chunk_offsets, offsetsCapacity, &offsetsCount, &error);
+        if (error != ERROR_OK) {
+            _om_decoder_parallel_set_error(job, error);
+            return;
+        }
+    }
+}
+
+/// Allocate empty accumulators with the operator and output shape of `reduction`. Returns NULL if memory could not be allocated.
+static OmReduction_t* _om_reduction_create_partial(const OmReduction_t* reduction) {
+    OmReduction_t* partial = malloc(sizeof(OmReduction_t));
+    if (partial == NULL) {
+        return NULL;
+    }
+    *partial = *reduction;
+    partial->values = malloc(max(reduction->count, (uint64_t)1) * sizeof(double));
+    partial->counts = malloc(max(reduction->count, (uint64_t)1) * sizeof(uint64_t));
+    if (partial->values == NULL || partial->counts == NULL) {
+        free(partial->values);
+        free(partial->counts);
+        free(partial);
+        return NULL;
+    }
+    _om_reduction_reset(partial);
+    return partial;
+}
+
+/// Read and decode data reads into the output cube or the partial reduction of the worker
+static void _om_decoder_parallel_data_job(void* context, uint32_t worker) {
+    OmDecoderParallelJob_t* job = (OmDecoderParallelJob_t*)context;
+    uint64_t task;
+    while (atomic_load_explicit(&job->error, memory_order_relaxed) == ERROR_OK && om_work_queue_next(&job->queue, worker, &task)) {
+        OmDecoderParallelWorker_t* state = &job->workers[worker];
+        if (state->chunk_buffer == NULL) {
+            state->chunk_buffer = malloc(job->reduction == NULL ? om_decoder_read_buffer_size(job->decoder) : om_decoder_reduce_buffer_size(job->decoder));
+            if (state->chunk_buffer == NULL) {
+                _om_decoder_parallel_set_error(job, ERROR_OUT_OF_MEMORY);
+                return;
+            }
+        }
+        if (job->reduction != NULL && state->reduction == NULL) {
+            state->reduction = _om_reduction_create_partial(job->reduction);
+            if (state->reduction == NULL) {
+                _om_decoder_parallel_set_error(job, ERROR_OUT_OF_MEMORY);
+                return;
+            }
+        }
+        const OmDecoder_dataReadRequest_t* request = job->data_reads[task].request;
+        const void* data = _om_decoder_parallel_read(job, worker, request->offset, request->count);
+        if (data == NULL) {
+            return;
+        }
+        OmError_t error = ERROR_OK;
+        if (!_om_decoder_decode_chunks_with_offsets(job->decoder, request->chunkIndex, data, request->count, job->data_reads[task].chunk_offsets, request->chunkOffsetsCount, job->into, state->chunk_buffer, state->reduction, &error)) {
+            _om_decoder_parallel_set_error(job, error);
+            return;
+        }
+    }
+}
+
+/// Run `job` on all workers of `pool` or only on the calling thread if `pool` is NULL
+static void _om_decoder_parallel_run(OmThreadPool_t* pool, OmThreadPoolJob_t job, OmDecoderParallelJob_t* context) {
+    if (pool == NULL) {
+        job(context, 0);
+        return;
+    }
+    om_thread_pool_run(pool, job, context);
+}
+
+/// Decode all chunks into `into` or accumulate them into `reduction` if not NULL
+static bool _om_decoder_parallel(const OmDecoder_t* decoder, OmDecoder_readCallback_t read, void* context, OmThreadPool_t* pool, void* into, OmReduction_t* reduction, OmError_t* error) {
+    // Variable-length LUT blocks are located with the block offset table, which is read once for all index reads
+    OmDecoder_t variableLutDecoder;
+    uint8_t* blockOffsetsBuffer = NULL;
+    uint64_t blockOffsetsOffset, blockOffsetsCount;
+    if (decoder->lut_block_offsets == NULL && om_decoder_lut_block_offsets_read(decoder, &blockOffsetsOffset, &blockOffsetsCount)) {
+        blockOffsetsBuffer = malloc(blockOffsetsCount);
+        if (blockOffsetsBuffer == NULL) {
+            (*error) = ERROR_OUT_OF_MEMORY;
+            return false;
+        }
+        const void* blockOffsets = read(context, blockOffsetsOffset, blockOffsetsCount, blockOffsetsBuffer);
+        variableLutDecoder = *decoder;
+        if (blockOffsets == NULL || !om_decoder_set_lut_block_offsets(&variableLutDecoder, blockOffsets, blockOffsetsCount)) {
+            free(blockOffsetsBuffer);
+            (*error) = blockOffsets == NULL ? ERROR_IO_READ : ERROR_OUT_OF_BOUND_READ;
+            return false;
+        }
+        decoder = &variableLutDecoder;
+    }
+
+    OmDecoderParallelJob_t job = {
+        .decoder = decoder,
+        .read = read,
+        .context = context,
+        .into = into,
+        .reduction = reduction,
+        .index_reads = NULL,
+        .data_reads = NULL,
+        .workers = NULL,
+        .queue = { .ranges = NULL, .memory = NULL, .workers = 0 }
+    };
+    atomic_init(&job.error, ERROR_OK);
+    const uint32_t workers = pool == NULL ? 1 : om_thread_pool_threads(pool);
+    uint64_t indexReadsCount = 0;
+
+    // Collect all index reads
+    uint64_t indexReadsCapacity = 0;
+    OmDecoder_indexRead_t indexRead;
+    om_decoder_init_index_read(decoder, &indexRead);
+    while (true) {
+        if (indexReadsCount == indexReadsCapacity) {
+            indexReadsCapacity = max((uint64_t)64, indexReadsCapacity * 2);
+            OmDecoderParallelIndexRead_t* resized = realloc(job.index_reads, indexReadsCapacity * sizeof(OmDecoderParallelIndexRead_t));
+            if (resized == NULL) {
+                _om_decoder_parallel_set_error(&job, ERROR_OUT_OF_MEMORY);
+                goto cleanup;
+            }
+            job.index_reads = resized;
+        }
+        OmDecoder_indexRead_t batch[64];
+        uint64_t batchCount = 0;
+        if (!om_decoder_next_index_reads(decoder, &indexRead, batch, min((uint64_t)64, indexReadsCapacity - indexReadsCount), &batchCount)) {
+            break;
+        }
+        for (uint64_t i = 0; i < batchCount; i++) {
+            job.index_reads[indexReadsCount++] = (OmDecoderParallelIndexRead_t){ .read = batch[i], .data_reads = NULL, .data_reads_count = 0, .chunk_offsets = NULL };
+        }
+    }
+    if (indexReadsCount == 0) {
+        goto cleanup;
+    }
+
+    // Workers allocate buffers once they take their first task. Idle workers of a large pool cost no memory.
+    job.workers = calloc(workers, sizeof(OmDecoderParallelWorker_t));
+    if (job.workers == NULL) {
+        _om_decoder_parallel_set_error(&job, ERROR_OUT_OF_MEMORY);
+        goto cleanup;
+    }
+
+    // Read index data and plan data reads
+    if (!om_work_queue_init(&job.queue, indexReadsCount, workers)) {
+        _om_decoder_parallel_set_error(&job, ERROR_OUT_OF_MEMORY);
+        goto cleanup;
+    }
+    _om_decoder_parallel_run(pool, _om_decoder_parallel_index_job, &job);
+    om_work_queue_destroy(&job.queue);
+    if (atomic_load(&job.error) != ERROR_OK) {
+        goto cleanup;
+    }
+
+    // Flatten data reads in file order, so that each worker reads a contiguous region of the file
+    uint64_t dataReadsCount = 0;
+    for (uint64_t i = 0; i < indexReadsCount; i++) {
+        dataReadsCount += job.index_reads[i].data_reads_count;
+    }
+    job.data_reads = malloc(max(dataReadsCount, (uint64_t)1) * sizeof(OmDecoderParallelDataRead_t));
+    if (job.data_reads == NULL) {
+        _om_decoder_parallel_set_error(&job, ERROR_OUT_OF_MEMORY);
+        goto cleanup;
+    }
+    uint64_t d = 0;
+    for (uint64_t i = 0; i < indexReadsCount; i++) {
+        for (uint64_t j = 0; j < job.index_reads[i].data_reads_count; j++) {
+            const OmDecoder_dataReadRequest_t* request = &job.index_reads[i].data_reads[j];
+            job.data_reads[d++] = (OmDecoderParallelDataRead_t){ .request = request, .chunk_offsets = &job.index_reads[i].chunk_offsets[request->chunkOffsetsStart] };
+        }
+    }
+
+    // Read and decode
+    if (!om_work_queue_init(&job.queue, dataReadsCount, workers)) {
+        _om_decoder_parallel_set_error(&job, ERROR_OUT_OF_MEMORY);
+        goto cleanup;
+    }
+    _om_decoder_parallel_run(pool, _om_decoder_parallel_data_job, &job);
+    om_work_queue_destroy(&job.queue);
+
+cleanup:
+    if (job.workers != NULL) {
+        for (uint32_t i = 0; i < workers; i++) {
+            free(job.workers[i].read_buffer);
+            free(job.workers[i].chunk_buffer);
+            if (job.workers[i].reduction != NULL) {
+                // Partial results of a failed read are discarded
+                if (atomic_load(&job.error) == ERROR_OK) {
+                    om_decoder_reduction_merge(reduction, job.workers[i].reduction);
+                }
+                free(job.workers[i].reduction->values);
+                free(job.workers[i].reduction->counts);
+                free(job.workers[i].reduction);
+            }
+        }
+        free(job.workers);
+    }
+    for (uint64_t i = 0; i < indexReadsCount; i++) {
+        free(job.index_reads[i].data_reads);
+        free(job.index_reads[i].chunk_offsets);
+    }
+    free(job.index_reads);
+    free(job.data_reads);
+    free(blockOffsetsBuffer);
+    const OmError_t jobError = (OmError_t)atomic_load(&job.error);
+    if (jobError != ERROR_OK) {
+        (*error) = jobError;
+        return false;
+    }
+    return true;
+}
+
+bool om_decoder_decode_parallel(const OmDecoder_t* decoder, OmDecoder_readCallback_t read, void* context, OmThreadPool_t* pool, void* into, OmError_t* error) {
+    return _om_decoder_parallel(decoder, read, context, pool, into, NULL, error);
+}
+
+bool om_decoder_reduce_parallel(const OmDecoder_t* decoder, OmDecoder_readCallback_t read, void* context, OmThreadPool_t* pool, OmReduction_t* reduction, OmError_t* error) {
+    if (decoder->plan.dimensions_count == 0) {
+        (*error) = ERROR_INVALID_DIMENSIONS;
+        return false;
+    }
+    return _om_decoder_parallel(decoder, read, context, pool, NULL, reduction, error);
+}
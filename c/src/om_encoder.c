@@ -7,6 +7,10 @@
 
 #include "om_encoder.h"
 #include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "om_thread_pool.h"
 #include "vp4.h"
 #include "fp.h"
 #include "delta2d.h"
@@ -14,6 +18,20 @@
 
 #pragma clang diagnostic error "-Wswitch"
 
+/// Number of stored mantissa bits of a floating point array type
+static uint32_t _om_encoder_mantissa_width(OmDataType_t data_type) {
+    switch (data_type) {
+        case DATA_TYPE_DOUBLE_ARRAY:
+            return 52;
+        case DATA_TYPE_FLOAT16_ARRAY:
+            return 10;
+        case DATA_TYPE_BFLOAT16_ARRAY:
+            return 7;
+        default:
+            return 23;
+    }
+}
+
 OmError_t om_encoder_init(
     OmEncoder_t* encoder,
     float scale_factor,
@@ -39,15 +57,33 @@ OmError_t om_encoder_init(
     encoder->chunks = chunks;
     encoder->dimension_count = dimension_count;
     encoder->data_type = data_type;
+    encoder->input_data_type = data_type;
     encoder->compression = compression;
+    encoder->constant_chunks = false;
+    encoder->mantissa_bits = 0;
 
     OmError_t error = ERROR_OK;
     encoder->bytes_per_element = om_get_bytes_per_element(data_type, &error);
     encoder->bytes_per_element_compressed = om_get_bytes_per_element_compressed(data_type, compression, &error);
 
+    if (compression == COMPRESSION_PFOR_LORENZO) {
+        // The error bound only holds if scaling is exact
+        int exponent;
+        if (!(scale_factor > 0) || isinf(scale_factor) || frexpf(scale_factor, &exponent) != 0.5f || add_offset != 0) {
+            return ERROR_INVALID_SCALE_FACTOR;
+        }
+    }
+
     return error;
 }
 
+float om_encoder_error_bound_scale_factor(double max_error) {
+    // Smallest power of two with `0.5 / scale_factor <= max_error`
+    int exponent;
+    const double mantissa = frexp(0.5 / max_error, &exponent);
+    return ldexpf(1, mantissa == 0.5 ? exponent - 1 : exponent);
+}
+
 ALWAYS_INLINE uint64_t om_encode_compress(
     OmDataType_t data_type,
     OmCompression_t compression_type,
@@ -62,49 +98,79 @@ ALWAYS_INLINE uint64_t om_encode_compress(
         case COMPRESSION_PFOR_DELTA2D_INT16_LOGARITHMIC:
             // The initializer should have ensured that the data type is float
             assert(data_type == DATA_TYPE_FLOAT_ARRAY && "Expecting float array");
-            result = p4nzenc128v16((uint16_t*)input, (size_t)count, (unsigned char*)output);
+            result = om_common_codecs()->p4nzenc128v16((uint16_t*)input, (size_t)count, (unsigned char*)output);
             break;
 
         case COMPRESSION_FPX_XOR2D:
-            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            assert((data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY || data_type == DATA_TYPE_FLOAT16_ARRAY || data_type == DATA_TYPE_BFLOAT16_ARRAY) && "Expecting floating point array");
             if (data_type == DATA_TYPE_FLOAT_ARRAY) {
                 result = om_common_compress_fpxenc32((float*)input, (size_t)count, (unsigned char*)output);
             } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
                 result = om_common_compress_fpxenc64((double*)input, (size_t)count, (unsigned char*)output);
+            } else if (data_type == DATA_TYPE_FLOAT16_ARRAY || data_type == DATA_TYPE_BFLOAT16_ARRAY) {
+                result = om_common_codecs()->fpxenc16((uint16_t*)input, (size_t)count, (unsigned char*)output, 0);
+            }
+            break;
+
+        case COMPRESSION_FPX_FCM:
+            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            if (data_type == DATA_TYPE_FLOAT_ARRAY) {
+                result = om_common_codecs()->fpfcmenc32((uint32_t*)input, (size_t)count, (unsigned char*)output, 0);
+            } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
+                result = om_common_codecs()->fpfcmenc64((uint64_t*)input, (size_t)count, (unsigned char*)output, 0);
+            }
+            break;
+        case COMPRESSION_FPX_DFCM:
+            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            if (data_type == DATA_TYPE_FLOAT_ARRAY) {
+                result = om_common_codecs()->fpdfcmenc32((uint32_t*)input, (size_t)count, (unsigned char*)output, 0);
+            } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
+                result = om_common_codecs()->fpdfcmenc64((uint64_t*)input, (size_t)count, (unsigned char*)output, 0);
+            }
+            break;
+        case COMPRESSION_FPX_2DFCM:
+            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            if (data_type == DATA_TYPE_FLOAT_ARRAY) {
+                result = om_common_codecs()->fp2dfcmenc32((uint32_t*)input, (size_t)count, (unsigned char*)output, 0);
+            } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
+                result = om_common_codecs()->fp2dfcmenc64((uint64_t*)input, (size_t)count, (unsigned char*)output, 0);
             }
             break;
 
+        case COMPRESSION_PFOR_LORENZO:
         case COMPRESSION_PFOR_DELTA2D:
             switch (data_type) {
                 case DATA_TYPE_INT8_ARRAY:
-                    result = p4nzenc8((uint8_t*)input, (size_t)count, (unsigned char*)output);
+                    result = om_common_codecs()->p4nzenc8((uint8_t*)input, (size_t)count, (unsigned char*)output);
                     break;
                 case DATA_TYPE_UINT8_ARRAY:
-                    result = p4ndenc8((uint8_t*)input, (size_t)count, (unsigned char*)output);
+                    result = om_common_codecs()->p4ndenc8((uint8_t*)input, (size_t)count, (unsigned char*)output);
                     break;
                 case DATA_TYPE_INT16_ARRAY:
-                    result = p4nzenc128v16((uint16_t*)input, (size_t)count, (unsigned char*)output);
+                case DATA_TYPE_FLOAT16_ARRAY:
+                case DATA_TYPE_BFLOAT16_ARRAY:
+                    result = om_common_codecs()->p4nzenc128v16((uint16_t*)input, (size_t)count, (unsigned char*)output);
                     break;
                 case DATA_TYPE_UINT16_ARRAY:
-                    result = p4ndenc128v16((uint16_t*)input, (size_t)count, (unsigned char*)output);
+                    result = om_common_codecs()->p4ndenc128v16((uint16_t*)input, (size_t)count, (unsigned char*)output);
                     break;
                 case DATA_TYPE_INT32_ARRAY:
-                    result = p4nzenc128v32((uint32_t*)input, (size_t)count, (unsigned char*)output);
+                    result = om_common_codecs()->p4nzenc128v32((uint32_t*)input, (size_t)count, (unsigned char*)output);
                     break;
                 case DATA_TYPE_UINT32_ARRAY:
-                    result = p4ndenc128v32((uint32_t*)input, (size_t)count, (unsigned char*)output);
+                    result = om_common_codecs()->p4ndenc128v32((uint32_t*)input, (size_t)count, (unsigned char*)output);
                     break;
                 case DATA_TYPE_INT64_ARRAY:
-                    result = p4nzenc64((uint64_t*)input, (size_t)count, (unsigned char*)output);
+                    result = om_common_codecs()->p4nzenc64((uint64_t*)input, (size_t)count, (unsigned char*)output);
                     break;
                 case DATA_TYPE_UINT64_ARRAY:
-                    result = p4ndenc64((uint64_t*)input, (size_t)count, (unsigned char*)output);
+                    result = om_common_codecs()->p4ndenc64((uint64_t*)input, (size_t)count, (unsigned char*)output);
                     break;
                 case DATA_TYPE_FLOAT_ARRAY:
-                    result = p4nzenc128v32((uint32_t*)input, (size_t)count, (unsigned char*)output);
+                    result = om_common_codecs()->p4nzenc128v32((uint32_t*)input, (size_t)count, (unsigned char*)output);
                     break;
                 case DATA_TYPE_DOUBLE_ARRAY:
-                    result = p4nzenc64((uint64_t*)input, (size_t)count, (unsigned char*)output);
+                    result = om_common_codecs()->p4nzenc64((uint64_t*)input, (size_t)count, (unsigned char*)output);
                     break;
                 case DATA_TYPE_NONE:
                 case DATA_TYPE_STRING:
@@ -123,6 +189,51 @@ ALWAYS_INLINE uint64_t om_encode_compress(
             }
             break;
 
+        case COMPRESSION_PFOR_DOD:
+        case COMPRESSION_PFOR_DELTA2D_DOD:
+            // Signed and unsigned integers wrap around, so both use the zigzag delta-of-delta coder
+            // The predictor is not reset per row. The first value of a row is predicted from the end of the previous row and usually
+            // becomes one PFor exception. Coding rows separately adds block headers and calls per row. For smooth series, one
+            // sequence is 2-11% smaller and up to 2 times faster with rows of 24 values. Only exactly linear rows, e.g. time
+            // counters, are smaller per row. See `swift run -c release OmFileFormatBenchmarks deltaOfDelta`.
+            switch (data_type) {
+                case DATA_TYPE_INT8_ARRAY:
+                case DATA_TYPE_UINT8_ARRAY:
+                    result = om_common_codecs()->p4nzzenc128v8((uint8_t*)input, (size_t)count, (unsigned char*)output, 0);
+                    break;
+                case DATA_TYPE_INT16_ARRAY:
+                case DATA_TYPE_UINT16_ARRAY:
+                    result = om_common_codecs()->p4nzzenc128v16((uint16_t*)input, (size_t)count, (unsigned char*)output, 0);
+                    break;
+                case DATA_TYPE_INT32_ARRAY:
+                case DATA_TYPE_UINT32_ARRAY:
+                case DATA_TYPE_FLOAT_ARRAY:
+                    result = om_common_codecs()->p4nzzenc128v32((uint32_t*)input, (size_t)count, (unsigned char*)output, 0);
+                    break;
+                case DATA_TYPE_INT64_ARRAY:
+                case DATA_TYPE_UINT64_ARRAY:
+                case DATA_TYPE_DOUBLE_ARRAY:
+                    result = om_common_codecs()->p4nzzenc128v64((uint64_t*)input, (size_t)count, (unsigned char*)output, 0);
+                    break;
+                case DATA_TYPE_NONE:
+                case DATA_TYPE_STRING:
+                case DATA_TYPE_STRING_ARRAY:
+                case DATA_TYPE_INT8:
+                case DATA_TYPE_UINT8:
+                case DATA_TYPE_INT16:
+                case DATA_TYPE_UINT16:
+                case DATA_TYPE_INT32:
+                case DATA_TYPE_UINT32:
+                case DATA_TYPE_INT64:
+                case DATA_TYPE_UINT64:
+                case DATA_TYPE_FLOAT:
+                case DATA_TYPE_DOUBLE:
+                case DATA_TYPE_FLOAT16_ARRAY:
+                case DATA_TYPE_BFLOAT16_ARRAY:
+                    break;
+            }
+            break;
+
         case COMPRESSION_NONE:
             break;
     }
@@ -135,6 +246,7 @@ ALWAYS_INLINE void om_encode_filter(
     OmCompression_t compression_type,
     void* data,
     uint64_t length_in_chunk,
+    uint64_t length_plane,
     uint64_t length_last
 ) {
     switch (compression_type) {
@@ -146,15 +258,37 @@ ALWAYS_INLINE void om_encode_filter(
             break;
 
         case COMPRESSION_FPX_XOR2D:
-            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            assert((data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY || data_type == DATA_TYPE_FLOAT16_ARRAY || data_type == DATA_TYPE_BFLOAT16_ARRAY) && "Expecting floating point array");
             if (data_type == DATA_TYPE_FLOAT_ARRAY) {
                 delta2d_encode_xor((size_t)(length_in_chunk / length_last), (size_t)length_last, (float*)data);
             } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
                 delta2d_encode_xor_double((size_t)(length_in_chunk / length_last), (size_t)length_last, (double*)data);
+            } else if (data_type == DATA_TYPE_FLOAT16_ARRAY || data_type == DATA_TYPE_BFLOAT16_ARRAY) {
+                delta2d_encode_xor_half((size_t)(length_in_chunk / length_last), (size_t)length_last, (uint16_t*)data);
+            }
+            break;
+
+        case COMPRESSION_FPX_FCM:
+        case COMPRESSION_FPX_DFCM:
+        case COMPRESSION_FPX_2DFCM:
+            // Predictors operate on the raw value sequence
+            break;
+
+        case COMPRESSION_PFOR_DOD:
+            // Delta-of-delta along the last dimension is applied by the compressor
+            break;
+
+        case COMPRESSION_PFOR_LORENZO:
+            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            if (data_type == DATA_TYPE_FLOAT_ARRAY) {
+                lorenzo3d_encode32((size_t)(length_in_chunk / length_plane), (size_t)(length_plane / length_last), (size_t)length_last, (int32_t*)data);
+            } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
+                lorenzo3d_encode64((size_t)(length_in_chunk / length_plane), (size_t)(length_plane / length_last), (size_t)length_last, (int64_t*)data);
             }
             break;
 
         case COMPRESSION_PFOR_DELTA2D:
+        case COMPRESSION_PFOR_DELTA2D_DOD:
             switch (data_type) {
                 case DATA_TYPE_INT8_ARRAY:
                 case DATA_TYPE_UINT8_ARRAY:
@@ -164,6 +298,10 @@ ALWAYS_INLINE void om_encode_filter(
                 case DATA_TYPE_UINT16_ARRAY:
                     delta2d_encode16((size_t)(length_in_chunk / length_last), (size_t)length_last, (int16_t*)data);
                     break;
+                case DATA_TYPE_FLOAT16_ARRAY:
+                case DATA_TYPE_BFLOAT16_ARRAY:
+                    delta2d_encode_ordered_half((size_t)(length_in_chunk / length_last), (size_t)length_last, (uint16_t*)data);
+                    break;
                 case DATA_TYPE_INT32_ARRAY:
                 case DATA_TYPE_UINT32_ARRAY:
                 case DATA_TYPE_FLOAT_ARRAY:
@@ -183,12 +321,26 @@ ALWAYS_INLINE void om_encode_filter(
     }
 }
 
-ALWAYS_INLINE void om_encode_copy(
+/// Copy half precision values or convert them from float
+ALWAYS_INLINE void om_encode_copy_half(OmDataType_t data_type, OmDataType_t input_data_type, uint64_t count, const void* input, void* output) {
+    if (input_data_type != DATA_TYPE_FLOAT_ARRAY) {
+        om_common_copy16(count, 1, 0, input, output);
+    } else if (data_type == DATA_TYPE_FLOAT16_ARRAY) {
+        om_common_copy_float_to_float16(count, 1, 0, input, output);
+    } else {
+        om_common_copy_float_to_bfloat16(count, 1, 0, input, output);
+    }
+}
+
+/// Copy and convert values into the chunk buffer. Returns false if values of `COMPRESSION_PFOR_LORENZO` are out of the integer range after scaling.
+ALWAYS_INLINE bool om_encode_copy(
     OmDataType_t data_type,
+    OmDataType_t input_data_type,
     OmCompression_t compression_type,
     uint64_t count,
     float scale_factor,
     float add_offset,
+    uint8_t mantissa_bits,
     const void* input,
     void* output
 ) {
@@ -204,6 +356,34 @@ ALWAYS_INLINE void om_encode_copy(
             break;
 
         case COMPRESSION_FPX_XOR2D:
+            assert((data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY || data_type == DATA_TYPE_FLOAT16_ARRAY || data_type == DATA_TYPE_BFLOAT16_ARRAY) && "Expecting floating point array");
+            // With `mantissa_bits` of 0 values are copied lossless
+            if (data_type == DATA_TYPE_FLOAT_ARRAY) {
+                if (mantissa_bits == 0) {
+                    om_common_copy32(count, scale_factor, add_offset, input, output);
+                } else {
+                    om_common_copy_float_round_mantissa(count, mantissa_bits, input, output);
+                }
+            } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
+                if (mantissa_bits == 0) {
+                    om_common_copy64(count, scale_factor, add_offset, input, output);
+                } else {
+                    om_common_copy_double_round_mantissa(count, mantissa_bits, input, output);
+                }
+            } else if (data_type == DATA_TYPE_FLOAT16_ARRAY || data_type == DATA_TYPE_BFLOAT16_ARRAY) {
+                om_encode_copy_half(data_type, input_data_type, count, input, output);
+                // Rounding works in place
+                if (mantissa_bits != 0 && data_type == DATA_TYPE_FLOAT16_ARRAY) {
+                    om_common_copy_float16_round_mantissa(count, mantissa_bits, output, output);
+                } else if (mantissa_bits != 0) {
+                    om_common_copy_bfloat16_round_mantissa(count, mantissa_bits, output, output);
+                }
+            }
+            break;
+
+        case COMPRESSION_FPX_FCM:
+        case COMPRESSION_FPX_DFCM:
+        case COMPRESSION_FPX_2DFCM:
             assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
             if (data_type == DATA_TYPE_FLOAT_ARRAY) {
                 om_common_copy32(count, scale_factor, add_offset, input, output);
@@ -212,7 +392,19 @@ ALWAYS_INLINE void om_encode_copy(
             }
             break;
 
+        case COMPRESSION_PFOR_LORENZO:
+            assert(data_type == DATA_TYPE_FLOAT_ARRAY || data_type == DATA_TYPE_DOUBLE_ARRAY && "Expecting float or double array");
+            // Clamped values would exceed the error bound and the largest integer would be decoded as NaN
+            if (data_type == DATA_TYPE_FLOAT_ARRAY) {
+                return om_common_copy_float_to_int32_checked(count, scale_factor, add_offset, input, output);
+            } else if (data_type == DATA_TYPE_DOUBLE_ARRAY) {
+                return om_common_copy_double_to_int64_checked(count, scale_factor, add_offset, input, output);
+            }
+            break;
+
         case COMPRESSION_PFOR_DELTA2D:
+        case COMPRESSION_PFOR_DOD:
+        case COMPRESSION_PFOR_DELTA2D_DOD:
             switch (data_type) {
                 case DATA_TYPE_INT8_ARRAY:
                 case DATA_TYPE_UINT8_ARRAY:
@@ -236,6 +428,10 @@ ALWAYS_INLINE void om_encode_copy(
                 case DATA_TYPE_DOUBLE_ARRAY:
                     om_common_copy_double_to_int64(count, scale_factor, add_offset, input, output);
                     break;
+                case DATA_TYPE_FLOAT16_ARRAY:
+                case DATA_TYPE_BFLOAT16_ARRAY:
+                    om_encode_copy_half(data_type, input_data_type, count, input, output);
+                    break;
                 default:
                 break;
             }
@@ -244,6 +440,202 @@ ALWAYS_INLINE void om_encode_copy(
         case COMPRESSION_NONE:
             break;
     }
+    return true;
+}
+
+
+// MARK: Chunk statistics
+
+/// Minimum, maximum and sum of integers in a chunk buffer. Values equal to `missing` are counted as NaN. Types without a missing value pass a value that cannot occur.
+#define OM_ENCODER_STATISTICS_INTEGER(name, type, type_min, type_max, missing, check_missing) \
+static void name(const void* data, uint64_t count, OmChunkStatistics_t* statistics) { \
+    const type* values = (const type*)data; \
+    type lower = type_max; \
+    type upper = type_min; \
+    double sum = 0; \
+    uint64_t valid = 0; \
+    for (uint64_t i = 0; i < count; i++) { \
+        const type value = values[i]; \
+        if (check_missing && value == missing) { \
+            continue; \
+        } \
+        lower = value < lower ? value : lower; \
+        upper = value > upper ? value : upper; \
+        sum += (double)value; \
+        valid++; \
+    } \
+    statistics->min = valid > 0 ? (double)lower : NAN; \
+    statistics->max = valid > 0 ? (double)upper : NAN; \
+    statistics->sum = sum; \
+    statistics->nan_count = count - valid; \
+}
+
+OM_ENCODER_STATISTICS_INTEGER(_om_encoder_statistics_int8, int8_t, INT8_MIN, INT8_MAX, 0, false)
+OM_ENCODER_STATISTICS_INTEGER(_om_encoder_statistics_uint8, uint8_t, 0, UINT8_MAX, 0, false)
+OM_ENCODER_STATISTICS_INTEGER(_om_encoder_statistics_int16, int16_t, INT16_MIN, INT16_MAX, 0, false)
+OM_ENCODER_STATISTICS_INTEGER(_om_encoder_statistics_uint16, uint16_t, 0, UINT16_MAX, 0, false)
+OM_ENCODER_STATISTICS_INTEGER(_om_encoder_statistics_int32, int32_t, INT32_MIN, INT32_MAX, 0, false)
+OM_ENCODER_STATISTICS_INTEGER(_om_encoder_statistics_uint32, uint32_t, 0, UINT32_MAX, 0, false)
+OM_ENCODER_STATISTICS_INTEGER(_om_encoder_statistics_int64, int64_t, INT64_MIN, INT64_MAX, 0, false)
+OM_ENCODER_STATISTICS_INTEGER(_om_encoder_statistics_uint64, uint64_t, 0, UINT64_MAX, 0, false)
+/// Scaled floats store NaN as the maximum integer
+OM_ENCODER_STATISTICS_INTEGER(_om_encoder_statistics_int16_missing, int16_t, INT16_MIN, INT16_MAX, INT16_MAX, true)
+OM_ENCODER_STATISTICS_INTEGER(_om_encoder_statistics_int32_missing, int32_t, INT32_MIN, INT32_MAX, INT32_MAX, true)
+OM_ENCODER_STATISTICS_INTEGER(_om_encoder_statistics_int64_missing, int64_t, INT64_MIN, INT64_MAX, INT64_MAX, true)
+
+/// Minimum, maximum and sum of floating point values in a chunk buffer. Stored values are converted to `type` with `convert`.
+#define OM_ENCODER_STATISTICS_FLOAT(name, type, stored, convert) \
+static void name(const void* data, uint64_t count, OmChunkStatistics_t* statistics) { \
+    const stored* values = (const stored*)data; \
+    type lower = INFINITY; \
+    type upper = -INFINITY; \
+    double sum = 0; \
+    uint64_t valid = 0; \
+    for (uint64_t i = 0; i < count; i++) { \
+        const type value = convert(values[i]); \
+        if (value != value) { \
+            continue; \
+        } \
+        lower = value < lower ? value : lower; \
+        upper = value > upper ? value : upper; \
+        sum += (double)value; \
+        valid++; \
+    } \
+    statistics->min = valid > 0 ? (double)lower : NAN; \
+    statistics->max = valid > 0 ? (double)upper : NAN; \
+    statistics->sum = sum; \
+    statistics->nan_count = count - valid; \
+}
+
+OM_ENCODER_STATISTICS_FLOAT(_om_encoder_statistics_float, float, float, (float))
+OM_ENCODER_STATISTICS_FLOAT(_om_encoder_statistics_double, double, double, (double))
+OM_ENCODER_STATISTICS_FLOAT(_om_encoder_statistics_float16, float, uint16_t, om_common_float16_to_float)
+OM_ENCODER_STATISTICS_FLOAT(_om_encoder_statistics_bfloat16, float, uint16_t, om_common_bfloat16_to_float)
+
+/// Convert the quantised minimum and maximum with the same function the decoder uses, so that predicates on statistics match decoded values exactly
+static void _om_encoder_statistics_scale(OmChunkStatistics_t* statistics, om_common_copy_function_t decode, uint64_t quantised_size, float scale_factor, float add_offset) {
+    if (statistics->min != statistics->min) {
+        // All values are missing
+        return;
+    }
+    // Quantised values of scaled floats are exact in double
+    union { int16_t i16[2]; int32_t i32[2]; int64_t i64[2]; } quantised;
+    union { float f32[2]; double f64[2]; } decoded;
+    if (quantised_size == sizeof(int16_t)) {
+        quantised.i16[0] = (int16_t)statistics->min;
+        quantised.i16[1] = (int16_t)statistics->max;
+    } else if (quantised_size == sizeof(int32_t)) {
+        quantised.i32[0] = (int32_t)statistics->min;
+        quantised.i32[1] = (int32_t)statistics->max;
+    } else {
+        quantised.i64[0] = (int64_t)statistics->min;
+        quantised.i64[1] = (int64_t)statistics->max;
+    }
+    decode(2, scale_factor, add_offset, &quantised, &decoded);
+    const double lower = quantised_size == sizeof(int64_t) ? decoded.f64[0] : decoded.f32[0];
+    const double upper = quantised_size == sizeof(int64_t) ? decoded.f64[1] : decoded.f32[1];
+    // A negative scale factor reverses the order
+    statistics->min = min(lower, upper);
+    statistics->max = max(lower, upper);
+}
+
+/// Compute statistics of a chunk from the quantised values in `chunkBuffer` before filtering
+static void _om_encoder_chunk_statistics(const OmEncoder_t* encoder, const void* chunkBuffer, uint64_t count, OmChunkStatistics_t* statistics) {
+    const float scale_factor = encoder->scale_factor;
+    const float add_offset = encoder->add_offset;
+    switch ((OmCompression_t)encoder->compression) {
+        case COMPRESSION_PFOR_DELTA2D_INT16: {
+            _om_encoder_statistics_int16_missing(chunkBuffer, count, statistics);
+            // Decoded values are `value / scale_factor - add_offset`
+            statistics->sum = statistics->sum / scale_factor - (double)(count - statistics->nan_count) * add_offset;
+            _om_encoder_statistics_scale(statistics, om_common_copy_int16_to_float, sizeof(int16_t), scale_factor, add_offset);
+            return;
+        }
+        case COMPRESSION_PFOR_DELTA2D_INT16_LOGARITHMIC: {
+            _om_encoder_statistics_int16_missing(chunkBuffer, count, statistics);
+            // The sum of logarithmic values requires each value to be decoded
+            const int16_t* values = (const int16_t*)chunkBuffer;
+            double sum = 0;
+            for (uint64_t i = 0; i < count; i++) {
+                if (values[i] != INT16_MAX) {
+                    sum += powf(10, (float)values[i] / scale_factor) - 1;
+                }
+            }
+            statistics->sum = sum;
+            _om_encoder_statistics_scale(statistics, om_common_copy_int16_to_float_log10, sizeof(int16_t), scale_factor, add_offset);
+            return;
+        }
+        case COMPRESSION_FPX_XOR2D:
+        case COMPRESSION_FPX_FCM:
+        case COMPRESSION_FPX_DFCM:
+        case COMPRESSION_FPX_2DFCM:
+            if (encoder->data_type == DATA_TYPE_FLOAT_ARRAY) {
+                _om_encoder_statistics_float(chunkBuffer, count, statistics);
+            } else if (encoder->data_type == DATA_TYPE_FLOAT16_ARRAY) {
+                _om_encoder_statistics_float16(chunkBuffer, count, statistics);
+            } else if (encoder->data_type == DATA_TYPE_BFLOAT16_ARRAY) {
+                _om_encoder_statistics_bfloat16(chunkBuffer, count, statistics);
+            } else {
+                _om_encoder_statistics_double(chunkBuffer, count, statistics);
+            }
+            return;
+        case COMPRESSION_PFOR_LORENZO:
+        case COMPRESSION_PFOR_DELTA2D:
+        case COMPRESSION_PFOR_DOD:
+        case COMPRESSION_PFOR_DELTA2D_DOD:
+            switch ((OmDataType_t)encoder->data_type) {
+                case DATA_TYPE_INT8_ARRAY:
+                    _om_encoder_statistics_int8(chunkBuffer, count, statistics);
+                    return;
+                case DATA_TYPE_UINT8_ARRAY:
+                    _om_encoder_statistics_uint8(chunkBuffer, count, statistics);
+                    return;
+                case DATA_TYPE_INT16_ARRAY:
+                    _om_encoder_statistics_int16(chunkBuffer, count, statistics);
+                    return;
+                case DATA_TYPE_UINT16_ARRAY:
+                    _om_encoder_statistics_uint16(chunkBuffer, count, statistics);
+                    return;
+                case DATA_TYPE_INT32_ARRAY:
+                    _om_encoder_statistics_int32(chunkBuffer, count, statistics);
+                    return;
+                case DATA_TYPE_UINT32_ARRAY:
+                    _om_encoder_statistics_uint32(chunkBuffer, count, statistics);
+                    return;
+                case DATA_TYPE_INT64_ARRAY:
+                    _om_encoder_statistics_int64(chunkBuffer, count, statistics);
+                    return;
+                case DATA_TYPE_UINT64_ARRAY:
+                    _om_encoder_statistics_uint64(chunkBuffer, count, statistics);
+                    return;
+                case DATA_TYPE_FLOAT_ARRAY:
+                    _om_encoder_statistics_int32_missing(chunkBuffer, count, statistics);
+                    statistics->sum = statistics->sum / scale_factor - (double)(count - statistics->nan_count) * add_offset;
+                    _om_encoder_statistics_scale(statistics, om_common_copy_int32_to_float, sizeof(int32_t), scale_factor, add_offset);
+                    return;
+                case DATA_TYPE_DOUBLE_ARRAY:
+                    _om_encoder_statistics_int64_missing(chunkBuffer, count, statistics);
+                    statistics->sum = statistics->sum / (double)scale_factor - (double)(count - statistics->nan_count) * (double)add_offset;
+                    _om_encoder_statistics_scale(statistics, om_common_copy_int64_to_double, sizeof(int64_t), scale_factor, add_offset);
+                    return;
+                case DATA_TYPE_FLOAT16_ARRAY:
+                    _om_encoder_statistics_float16(chunkBuffer, count, statistics);
+                    return;
+                case DATA_TYPE_BFLOAT16_ARRAY:
+                    _om_encoder_statistics_bfloat16(chunkBuffer, count, statistics);
+                    return;
+                default:
+                    break;
+            }
+            break;
+        case COMPRESSION_NONE:
+            break;
+    }
+    // Unknown range. Predicates never skip this chunk.
+    statistics->min = -INFINITY;
+    statistics->max = INFINITY;
+    statistics->sum = NAN;
+    statistics->nan_count = 0;
 }
 
 uint64_t om_encoder_count_chunks(const OmEncoder_t* encoder) {
@@ -275,8 +667,10 @@ uint64_t om_encoder_compressed_chunk_buffer_size(const OmEncoder_t* encoder) {
     for (uint64_t i = 0; i < encoder->dimension_count; i++) {
         chunkLength *= encoder->chunks[i];
     }
-    // P4NENC256_BOUND. Compressor may write 32 integers more
-    return (chunkLength + 255) /256 + (chunkLength + 32) * encoder->bytes_per_element_compressed;
+    // Incompressible blocks of 128 values grow by up to two header bytes, e.g. the shift byte of float predictors and the PFor header
+    const uint64_t blockHeaders = divide_rounded_up(chunkLength, 128) * 2;
+    // P4NENC256_BOUND. Compressor may write 32 integers more. One additional byte for the header of constant chunks.
+    return (chunkLength + 255) /256 + (chunkLength + 32) * encoder->bytes_per_element_compressed + blockHeaders + (encoder->constant_chunks ? 1 : 0);
 }
 
 uint64_t om_encoder_lut_buffer_size(const uint64_t* lookUpTable, uint64_t lookUpTableCount) {
@@ -286,7 +680,7 @@ uint64_t om_encoder_lut_buffer_size(const uint64_t* lookUpTable, uint64_t lookUp
     for (uint64_t i = 0; i < nLutChunks; i++) {
         const uint64_t rangeStart = i * LUT_CHUNK_COUNT;
         const uint64_t rangeEnd = min(rangeStart + LUT_CHUNK_COUNT, lookUpTableCount);
-        const uint64_t len = p4ndenc64((uint64_t*)&lookUpTable[rangeStart], rangeEnd - rangeStart, (unsigned char *)buffer);
+        const uint64_t len = om_common_codecs()->p4ndenc64((uint64_t*)&lookUpTable[rangeStart], rangeEnd - rangeStart, (unsigned char *)buffer);
         if (len > maxLength) maxLength = len;
     }
     // Compression function can write 32 integers more
@@ -301,7 +695,7 @@ uint64_t om_encoder_compress_lut(const uint64_t* lookUpTable, uint64_t lookUpTab
     for (uint64_t i = 0; i < nLutChunks; i++) {
         const uint64_t rangeStart = i * LUT_CHUNK_COUNT;
         const uint64_t rangeEnd = min(rangeStart + LUT_CHUNK_COUNT, lookUpTableCount);
-        const uint64_t len = p4ndenc64((uint64_t*)&lookUpTable[rangeStart], rangeEnd - rangeStart, &out[i * lutChunkLength]);
+        const uint64_t len = om_common_codecs()->p4ndenc64((uint64_t*)&lookUpTable[rangeStart], rangeEnd - rangeStart, &out[i * lutChunkLength]);
         for (uint64_t j = i * lutChunkLength + len; j < (i+1) * lutChunkLength; j++) {
             out[j] = 0; // fill remaining space with 0
         }
@@ -309,7 +703,167 @@ uint64_t om_encoder_compress_lut(const uint64_t* lookUpTable, uint64_t lookUpTab
     return lutSize;
 }
 
-uint64_t om_encoder_compress_chunk(
+/// Number of bytes for each offset in a fixed width LUT. Offsets are increasing, so the last one is the largest.
+static uint64_t _om_encoder_lut_fixed_width_entry_size(const uint64_t* lookUpTable, uint64_t lookUpTableCount) {
+    const uint64_t last = lookUpTable[lookUpTableCount - 1];
+    uint64_t entrySize = 1;
+    while (entrySize < sizeof(uint64_t) && (last >> (entrySize * 8)) != 0) {
+        entrySize++;
+    }
+    return entrySize;
+}
+
+uint64_t om_encoder_lut_block_buffer_size(void) {
+    // Compression function can write 32 integers more
+    return 1 + (LUT_CHUNK_COUNT + 32) * sizeof(uint64_t);
+}
+
+uint64_t om_encoder_compress_lut_block(const uint64_t* lookUpTable, uint64_t lookUpTableCount, uint8_t* out, uint64_t size_of_compressed_block) {
+    assert(lookUpTableCount > 0 && lookUpTableCount <= LUT_CHUNK_COUNT && "LUT block must contain 1 to 64 entries");
+    assert(size_of_compressed_block >= om_encoder_lut_block_buffer_size() && "LUT block buffer too small");
+    return om_common_codecs()->p4ndenc64((uint64_t*)lookUpTable, lookUpTableCount, out);
+}
+
+uint64_t om_encoder_lut_block_offsets_size(uint64_t block_count) {
+    return block_count * 2 * sizeof(uint64_t);
+}
+
+uint64_t om_encoder_write_lut_block_offsets(const uint64_t* block_ranges, uint64_t block_count, uint8_t* out, uint64_t size_of_block_offsets) {
+    const uint64_t size = om_encoder_lut_block_offsets_size(block_count);
+    assert(size <= size_of_block_offsets && "Block offset buffer too small");
+    for (uint64_t i = 0; i < block_count * 2; i++) {
+        for (uint64_t j = 0; j < sizeof(uint64_t); j++) {
+            out[i * sizeof(uint64_t) + j] = (uint8_t)(block_ranges[i] >> (j * 8));
+        }
+    }
+    return size;
+}
+
+uint64_t om_encoder_lut_buffer_size_with_encoding(const uint64_t* lookUpTable, uint64_t lookUpTableCount, OmLutEncoding_t lut_encoding) {
+    switch (lut_encoding) {
+        case LUT_ENCODING_PFOR:
+            return om_encoder_lut_buffer_size(lookUpTable, lookUpTableCount);
+        case LUT_ENCODING_FIXED_WIDTH:
+            return lookUpTableCount * _om_encoder_lut_fixed_width_entry_size(lookUpTable, lookUpTableCount);
+        case LUT_ENCODING_PFOR_VARIABLE: {
+            const uint64_t nLutChunks = divide_rounded_up(lookUpTableCount, LUT_CHUNK_COUNT);
+            return nLutChunks * om_encoder_lut_block_buffer_size() + om_encoder_lut_block_offsets_size(nLutChunks);
+        }
+    }
+    return 0;
+}
+
+uint64_t om_encoder_compress_lut_with_encoding(const uint64_t* lookUpTable, uint64_t lookUpTableCount, OmLutEncoding_t lut_encoding, uint8_t* out, uint64_t size_of_compressed_lut) {
+    switch (lut_encoding) {
+        case LUT_ENCODING_PFOR:
+            return om_encoder_compress_lut(lookUpTable, lookUpTableCount, out, size_of_compressed_lut);
+        case LUT_ENCODING_FIXED_WIDTH: {
+            const uint64_t entrySize = _om_encoder_lut_fixed_width_entry_size(lookUpTable, lookUpTableCount);
+            assert(lookUpTableCount * entrySize <= size_of_compressed_lut && "LUT buffer too small");
+            for (uint64_t i = 0; i < lookUpTableCount; i++) {
+                for (uint64_t j = 0; j < entrySize; j++) {
+                    out[i * entrySize + j] = (uint8_t)(lookUpTable[i] >> (j * 8));
+                }
+            }
+            return lookUpTableCount * entrySize;
+        }
+        case LUT_ENCODING_PFOR_VARIABLE: {
+            // Blocks are stored back to back. Streaming writers interleave them with chunk data, which readers locate with the same table.
+            const uint64_t nLutChunks = divide_rounded_up(lookUpTableCount, LUT_CHUNK_COUNT);
+            const uint64_t blockBufferSize = om_encoder_lut_block_buffer_size();
+            const uint64_t offsetsSize = om_encoder_lut_block_offsets_size(nLutChunks);
+            assert(nLutChunks * blockBufferSize + offsetsSize <= size_of_compressed_lut && "LUT buffer too small");
+            uint64_t blockOffset = 0;
+            for (uint64_t i = 0; i < nLutChunks; i++) {
+                const uint64_t rangeStart = i * LUT_CHUNK_COUNT;
+                const uint64_t rangeEnd = min(rangeStart + LUT_CHUNK_COUNT, lookUpTableCount);
+                const uint64_t blockEnd = blockOffset + om_encoder_compress_lut_block(&lookUpTable[rangeStart], rangeEnd - rangeStart, &out[blockOffset], blockBufferSize);
+                // Block ranges are collected at the end of the buffer, which block buffers never reach, and moved behind the last block afterwards
+                for (uint64_t j = 0; j < sizeof(uint64_t); j++) {
+                    out[size_of_compressed_lut - offsetsSize + i * 2 * sizeof(uint64_t) + j] = (uint8_t)(blockOffset >> (j * 8));
+                    out[size_of_compressed_lut - offsetsSize + (i * 2 + 1) * sizeof(uint64_t) + j] = (uint8_t)(blockEnd >> (j * 8));
+                }
+                blockOffset = blockEnd;
+            }
+            memmove(&out[blockOffset], &out[size_of_compressed_lut - offsetsSize], offsetsSize);
+            return blockOffset + offsetsSize;
+        }
+    }
+    return 0;
+}
+
+
+// MARK: Constant chunks
+
+/// True if all `count` elements of `type` are bitwise identical to the first element. Blocks of 64 elements are compared without branches, so that compilers
+/// vectorise them. The scan stops after the first block with a different element.
+#define OM_ENCODER_IS_CONSTANT(name, type) \
+static bool name(const void* data, uint64_t count) { \
+    const type* values = (const type*)data; \
+    const type first = values[0]; \
+    uint64_t i = 0; \
+    for (; i + 64 <= count; i += 64) { \
+        type difference = 0; \
+        for (uint64_t j = 0; j < 64; j++) { \
+            difference |= values[i + j] ^ first; \
+        } \
+        if (difference != 0) { \
+            return false; \
+        } \
+    } \
+    type difference = 0; \
+    for (; i < count; i++) { \
+        difference |= values[i] ^ first; \
+    } \
+    return difference == 0; \
+}
+
+OM_ENCODER_IS_CONSTANT(_om_encoder_is_constant8, uint8_t)
+OM_ENCODER_IS_CONSTANT(_om_encoder_is_constant16, uint16_t)
+OM_ENCODER_IS_CONSTANT(_om_encoder_is_constant32, uint32_t)
+OM_ENCODER_IS_CONSTANT(_om_encoder_is_constant64, uint64_t)
+
+/// True if all elements of a chunk buffer before filtering are identical
+static bool _om_encoder_chunk_is_constant(const OmEncoder_t* encoder, const void* chunk_buffer, uint64_t count) {
+    switch (encoder->bytes_per_element_compressed) {
+        case 1: return _om_encoder_is_constant8(chunk_buffer, count);
+        case 2: return _om_encoder_is_constant16(chunk_buffer, count);
+        case 4: return _om_encoder_is_constant32(chunk_buffer, count);
+        case 8: return _om_encoder_is_constant64(chunk_buffer, count);
+        default: return false;
+    }
+}
+
+uint8_t om_encoder_mantissa_bits(OmDataType_t data_type, uint8_t significant_digits) {
+    const uint32_t bits = (uint32_t)ceil(significant_digits * log2(10.0));
+    const uint32_t mantissa_bits = _om_encoder_mantissa_width(data_type);
+    return bits >= 1 && bits < mantissa_bits ? (uint8_t)bits : 0;
+}
+
+OmError_t om_encoder_set_mantissa_bits(OmEncoder_t* encoder, uint8_t mantissa_bits) {
+    if (mantissa_bits != 0 && (encoder->compression != COMPRESSION_FPX_XOR2D || mantissa_bits >= _om_encoder_mantissa_width(encoder->data_type))) {
+        return ERROR_INVALID_MANTISSA_BITS;
+    }
+    encoder->mantissa_bits = mantissa_bits;
+    return ERROR_OK;
+}
+
+OmError_t om_encoder_set_input_data_type(OmEncoder_t* encoder, OmDataType_t input_data_type) {
+    const bool half = encoder->data_type == DATA_TYPE_FLOAT16_ARRAY || encoder->data_type == DATA_TYPE_BFLOAT16_ARRAY;
+    if (input_data_type != encoder->data_type && !(half && input_data_type == DATA_TYPE_FLOAT_ARRAY)) {
+        return ERROR_INVALID_DATA_TYPE;
+    }
+    OmError_t error = ERROR_OK;
+    encoder->input_data_type = input_data_type;
+    encoder->bytes_per_element = om_get_bytes_per_element(input_data_type, &error);
+    return error;
+}
+
+void om_encoder_set_constant_chunks(OmEncoder_t* encoder, bool constant_chunks) {
+    encoder->constant_chunks = constant_chunks;
+}
+
+static inline uint64_t _om_encoder_compress_chunk(
     const OmEncoder_t* encoder,
     const void* array,
     const uint64_t* arrayDimensions,
@@ -318,7 +872,9 @@ uint64_t om_encoder_compress_chunk(
     uint64_t chunkIndex,
     uint64_t chunkIndexOffsetInThisArray,
     uint8_t* out,
-    uint8_t* chunkBuffer
+    uint8_t* chunkBuffer,
+    OmChunkStatistics_t* statistics,
+    OmError_t* error
 ) {
 
     const uint64_t dimension_count = encoder->dimension_count;
@@ -336,6 +892,7 @@ uint64_t om_encoder_compress_chunk(
     uint64_t linearReadCount = 1;
     bool linearRead = true;
     uint64_t lengthLast = 0;
+    uint64_t lengthPlane = 1;
 
     for (uint64_t i_forward = 0; i_forward < dimension_count; i_forward++) {
         const uint64_t i = dimension_count - i_forward - 1;
@@ -350,6 +907,9 @@ uint64_t om_encoder_compress_chunk(
         if (i == dimension_count - 1) {
             lengthLast = length0;
         }
+        if (i_forward < 2) {
+            lengthPlane *= length0;
+        }
 
         readCoordinate += rollingMultiplyTargetCube * (c0Offset * encoder->chunks[i] + arrayOffset[i]);
         assert(length0 <= arrayCount[i]);
@@ -376,15 +936,21 @@ uint64_t om_encoder_compress_chunk(
         assert(readCoordinate + linearReadCount <= arrayTotalCount);
         assert(writeCoordinate + linearReadCount <= lengthInChunk);
 
-        om_encode_copy(
+        const bool valid = om_encode_copy(
             encoder->data_type,
+            encoder->input_data_type,
             encoder->compression,
             linearReadCount,
             encoder->scale_factor,
             encoder->add_offset,
+            encoder->mantissa_bits,
             &array[encoder->bytes_per_element * readCoordinate],
             &chunkBuffer[encoder->bytes_per_element_compressed * writeCoordinate]
         );
+        if (!valid) {
+            (*error) = ERROR_VALUE_OUT_OF_RANGE;
+            return 0;
+        }
 
         readCoordinate += linearReadCount - 1;
         writeCoordinate += linearReadCount - 1;
@@ -419,10 +985,156 @@ uint64_t om_encoder_compress_chunk(
             rollingMultiplyTargetCube *= arrayDimensions[i];
 
             if (i == 0) {
-                om_encode_filter(encoder->data_type, encoder->compression, chunkBuffer, lengthInChunk, lengthLast);
-                uint64_t compressed_length = om_encode_compress(encoder->data_type, encoder->compression, chunkBuffer, lengthInChunk, out);
-                return compressed_length;
+                if (statistics != NULL) {
+                    _om_encoder_chunk_statistics(encoder, chunkBuffer, lengthInChunk, statistics);
+                }
+                uint64_t header_length = 0;
+                if (encoder->constant_chunks) {
+                    if (_om_encoder_chunk_is_constant(encoder, chunkBuffer, lengthInChunk)) {
+                        // Store the first value instead of filtering and compressing
+                        out[0] = OM_CHUNK_HEADER_CONSTANT;
+                        memcpy(&out[1], chunkBuffer, encoder->bytes_per_element_compressed);
+                        return 1 + encoder->bytes_per_element_compressed;
+                    }
+                    out[0] = OM_CHUNK_HEADER_COMPRESSED;
+                    header_length = 1;
+                }
+                om_encode_filter(encoder->data_type, encoder->compression, chunkBuffer, lengthInChunk, lengthPlane, lengthLast);
+                uint64_t compressed_length = om_encode_compress(encoder->data_type, encoder->compression, chunkBuffer, lengthInChunk, &out[header_length]);
+                return header_length + compressed_length;
             }
         }
     }
 }
+
+uint64_t om_encoder_compress_chunk(const OmEncoder_t* encoder, const void* array, const uint64_t* arrayDimensions, const uint64_t* arrayOffset, const uint64_t* arrayCount, uint64_t chunkIndex, uint64_t chunkIndexOffsetInThisArray, uint8_t* out, uint8_t* chunkBuffer) {
+    OmError_t error = ERROR_OK;
+    return _om_encoder_compress_chunk(encoder, array, arrayDimensions, arrayOffset, arrayCount, chunkIndex, chunkIndexOffsetInThisArray, out, chunkBuffer, NULL, &error);
+}
+
+uint64_t om_encoder_compress_chunk_with_statistics(const OmEncoder_t* encoder, const void* array, const uint64_t* arrayDimensions, const uint64_t* arrayOffset, const uint64_t* arrayCount, uint64_t chunkIndex, uint64_t chunkIndexOffsetInThisArray, uint8_t* out, uint8_t* chunkBuffer, OmChunkStatistics_t* statistics, OmError_t* error) {
+    return _om_encoder_compress_chunk(encoder, array, arrayDimensions, arrayOffset, arrayCount, chunkIndex, chunkIndexOffsetInThisArray, out, chunkBuffer, statistics, error);
+}
+
+
+// MARK: Parallel compression
+
+/// Default number of chunks in flight per thread if no window is given
+#define OM_ENCODER_PARALLEL_CHUNKS_PER_THREAD 16
+
+struct OmEncoderParallel {
+    OmEncoder_t encoder;
+    OmThreadPool_t* pool;
+    uint64_t window;
+    /// Output slot size. Rounded up to 64 bytes to avoid false sharing between workers.
+    uint64_t slot_size;
+    uint64_t chunk_buffer_size;
+    /// One chunk buffer per worker
+    uint8_t* chunk_buffers;
+    /// One output slot per chunk in the window
+    uint8_t* compressed;
+    uint64_t* compressed_sizes;
+
+    /// Arguments of the current call to `om_encoder_parallel_compress_chunks`
+    OmWorkQueue_t queue;
+    const void* array;
+    const uint64_t* array_dimensions;
+    const uint64_t* array_offset;
+    const uint64_t* array_count;
+    uint64_t chunk_index;
+    uint64_t chunk_index_offset;
+    OmChunkStatistics_t* statistics;
+};
+
+OmEncoderParallel_t* om_encoder_parallel_create(const OmEncoder_t* encoder, uint32_t threads, uint64_t window) {
+    OmEncoderParallel_t* parallel = calloc(1, sizeof(OmEncoderParallel_t));
+    if (parallel == NULL) {
+        return NULL;
+    }
+    parallel->encoder = *encoder;
+    parallel->pool = om_thread_pool_create(max(threads, 1u));
+    if (parallel->pool == NULL) {
+        free(parallel);
+        return NULL;
+    }
+    const uint32_t workers = om_thread_pool_threads(parallel->pool);
+    parallel->window = window > 0 ? window : (uint64_t)workers * OM_ENCODER_PARALLEL_CHUNKS_PER_THREAD;
+    parallel->slot_size = (om_encoder_compressed_chunk_buffer_size(encoder) + 63) / 64 * 64;
+    parallel->chunk_buffer_size = (om_encoder_chunk_buffer_size(encoder) + 63) / 64 * 64;
+    parallel->chunk_buffers = malloc(parallel->chunk_buffer_size * workers);
+    parallel->compressed = malloc(parallel->slot_size * parallel->window);
+    parallel->compressed_sizes = malloc(parallel->window * sizeof(uint64_t));
+    if (parallel->chunk_buffers == NULL || parallel->compressed == NULL || parallel->compressed_sizes == NULL) {
+        om_encoder_parallel_destroy(parallel);
+        return NULL;
+    }
+    return parallel;
+}
+
+void om_encoder_parallel_destroy(OmEncoderParallel_t* parallel) {
+    om_thread_pool_destroy(parallel->pool);
+    free(parallel->chunk_buffers);
+    free(parallel->compressed);
+    free(parallel->compressed_sizes);
+    free(parallel);
+}
+
+uint64_t om_encoder_parallel_window(const OmEncoderParallel_t* parallel) {
+    return parallel->window;
+}
+
+static void _om_encoder_parallel_job(void* context, uint32_t worker) {
+    OmEncoderParallel_t* parallel = (OmEncoderParallel_t*)context;
+    uint8_t* chunkBuffer = parallel->chunk_buffers + worker * parallel->chunk_buffer_size;
+    // Failed chunks have a size of 0 and are reported after all workers finished
+    OmError_t error = ERROR_OK;
+    uint64_t task;
+    while (om_work_queue_next(&parallel->queue, worker, &task)) {
+        // Bit packing combines bits with existing output. Slots are reused and must be zero like the buffer of the serial writer.
+        uint8_t* out = parallel->compressed + task * parallel->slot_size;
+        memset(out, 0, parallel->slot_size);
+        parallel->compressed_sizes[task] = _om_encoder_compress_chunk(
+            &parallel->encoder,
+            parallel->array,
+            parallel->array_dimensions,
+            parallel->array_offset,
+            parallel->array_count,
+            parallel->chunk_index + task,
+            parallel->chunk_index_offset + task,
+            out,
+            chunkBuffer,
+            parallel->statistics == NULL ? NULL : &parallel->statistics[task],
+            &error
+        );
+    }
+}
+
+bool om_encoder_parallel_compress_chunks(OmEncoderParallel_t* parallel, const void* array, const uint64_t* arrayDimensions, const uint64_t* arrayOffset, const uint64_t* arrayCount, uint64_t chunkIndex, uint64_t chunkIndexOffsetInThisArray, uint64_t chunk_count, OmChunkStatistics_t* statistics, OmError_t* error) {
+    assert(chunk_count <= parallel->window && "Number of chunks exceeds the window");
+    if (!om_work_queue_init(&parallel->queue, chunk_count, om_thread_pool_threads(parallel->pool))) {
+        (*error) = ERROR_OUT_OF_MEMORY;
+        return false;
+    }
+    parallel->array = array;
+    parallel->array_dimensions = arrayDimensions;
+    parallel->array_offset = arrayOffset;
+    parallel->array_count = arrayCount;
+    parallel->chunk_index = chunkIndex;
+    parallel->chunk_index_offset = chunkIndexOffsetInThisArray;
+    parallel->statistics = statistics;
+    om_thread_pool_run(parallel->pool, _om_encoder_parallel_job, parallel);
+    om_work_queue_destroy(&parallel->queue);
+    for (uint64_t i = 0; i < chunk_count; i++) {
+        if (parallel->compressed_sizes[i] == 0) {
+            (*error) = ERROR_VALUE_OUT_OF_RANGE;
+            return false;
+        }
+    }
+    return true;
+}
+
+const uint8_t* om_encoder_parallel_chunk(const OmEncoderParallel_t* parallel, uint64_t index, uint64_t* size) {
+    assert(index < parallel->window && "Chunk index exceeds the window");
+    (*size) = parallel->compressed_sizes[index];
+    return parallel->compressed + index * parallel->slot_size;
+}
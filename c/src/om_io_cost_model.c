@@ -0,0 +1,72 @@
+//
+//  om_io_cost_model.c
+//  OpenMeteoApi
+//
+
+#include "om_io_cost_model.h"
+
+/// Lower bounds to keep the model usable after noisy observations, e.g. for data served from the page cache
+#define OM_IO_COST_MODEL_MIN_LATENCY_NS 100.0
+#define OM_IO_COST_MODEL_MIN_BYTES_PER_NS 0.001
+
+/// Minimum size of a split read in bytes
+#define OM_IO_COST_MODEL_MIN_MAX_SIZE 4096
+
+void om_io_cost_model_init(OmIoCostModel_t* model, double latency_ns, double bytes_per_ns, double concurrency) {
+    model->latency_ns = latency_ns > OM_IO_COST_MODEL_MIN_LATENCY_NS ? latency_ns : OM_IO_COST_MODEL_MIN_LATENCY_NS;
+    model->bytes_per_ns = bytes_per_ns > OM_IO_COST_MODEL_MIN_BYTES_PER_NS ? bytes_per_ns : OM_IO_COST_MODEL_MIN_BYTES_PER_NS;
+    model->concurrency = concurrency > 1 ? concurrency : 1;
+    model->sum_weight = 0;
+    model->sum_bytes = 0;
+    model->sum_time = 0;
+    model->sum_bytes_squared = 0;
+    model->sum_bytes_time = 0;
+}
+
+void om_io_cost_model_observe(OmIoCostModel_t* model, uint64_t bytes, double duration_ns) {
+    if (!(duration_ns > 0)) {
+        return;
+    }
+    const double decay = 1.0 - 1.0 / OM_IO_COST_MODEL_WINDOW;
+    const double x = (double)bytes;
+    model->sum_weight = model->sum_weight * decay + 1;
+    model->sum_bytes = model->sum_bytes * decay + x;
+    model->sum_time = model->sum_time * decay + duration_ns;
+    model->sum_bytes_squared = model->sum_bytes_squared * decay + x * x;
+    model->sum_bytes_time = model->sum_bytes_time * decay + x * duration_ns;
+
+    const double meanBytes = model->sum_bytes / model->sum_weight;
+    const double meanTime = model->sum_time / model->sum_weight;
+    const double varianceBytes = model->sum_bytes_squared / model->sum_weight - meanBytes * meanBytes;
+    const double covariance = model->sum_bytes_time / model->sum_weight - meanBytes * meanTime;
+
+    // Bandwidth can only be separated from latency if request sizes vary. Require a coefficient of variation of at least 10%.
+    if (model->sum_weight >= 4 && varianceBytes > 0.01 * meanBytes * meanBytes && covariance > 0) {
+        const double nsPerByte = covariance / varianceBytes;
+        const double latency = meanTime - nsPerByte * meanBytes;
+        if (latency > 0) {
+            model->bytes_per_ns = max(1.0 / nsPerByte, OM_IO_COST_MODEL_MIN_BYTES_PER_NS);
+            model->latency_ns = max(latency, OM_IO_COST_MODEL_MIN_LATENCY_NS);
+            return;
+        }
+    }
+    // Keep bandwidth and attribute the remaining time to latency
+    model->latency_ns = max(meanTime - meanBytes / model->bytes_per_ns, OM_IO_COST_MODEL_MIN_LATENCY_NS);
+}
+
+double om_io_cost_model_read_time(const OmIoCostModel_t* model, uint64_t bytes) {
+    return model->latency_ns + (double)bytes / model->bytes_per_ns;
+}
+
+double om_io_cost_model_request_time(const OmIoCostModel_t* model) {
+    return model->latency_ns / model->concurrency;
+}
+
+uint64_t om_io_cost_model_merge_gap(const OmIoCostModel_t* model) {
+    return (uint64_t)(om_io_cost_model_request_time(model) * model->bytes_per_ns);
+}
+
+uint64_t om_io_cost_model_max_size(const OmIoCostModel_t* model) {
+    const uint64_t size = (uint64_t)(OM_IO_COST_MODEL_MAX_TRANSFER_LATENCY_RATIO * model->latency_ns * model->bytes_per_ns);
+    return max(size, (uint64_t)OM_IO_COST_MODEL_MIN_MAX_SIZE);
+}
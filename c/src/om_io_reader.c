@@ -0,0 +1,829 @@
+//
+//  om_io_reader.c
+//  OpenMeteoApi
+//
+
+#include "om_io_reader.h"
+#include "om_thread_pool.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <errno.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/io_uring.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#define OM_IO_URING_AVAILABLE 1
+#endif
+
+/// Number of submission queue entries. Limits the number of requests in flight.
+#define OM_IO_URING_ENTRIES 256
+
+/// Largest read of a single submission queue entry. The length of an entry is 32 bit.
+#define OM_IO_URING_MAX_READ (1u << 30)
+
+/// Number of consecutive `EAGAIN` or `EBUSY` results of `io_uring_enter` without a completion before a batch fails
+#define OM_IO_URING_RETRIES 1000
+
+/// A single read of a batch. If `destination` is NULL, data is read into a backend buffer and passed to the completion callback.
+typedef struct {
+    uint64_t offset;
+    uint64_t count;
+    uint8_t* destination;
+
+    /// Decoder and data read for data requests
+    uint64_t decoder;
+    OmRange_t chunkIndex;
+    const uint64_t* chunkOffsets;
+    uint64_t chunkOffsetsCount;
+
+    /// Buffer used by the io_uring backend while the request is in flight
+    uint8_t* buffer;
+    bool bufferAllocated;
+} OmIoRequest_t;
+
+/// Called for each completed request with the data that was read. `worker` identifies the calling thread from 0 to `threads-1`.
+typedef bool (*OmIoCompletion_t)(void* context, const OmIoRequest_t* request, const uint8_t* data, uint32_t worker, OmError_t* error);
+
+#if defined(OM_IO_URING_AVAILABLE)
+typedef struct {
+    int fd;
+    unsigned* sq_head;
+    unsigned* sq_tail;
+    unsigned* sq_mask;
+    unsigned* sq_array;
+    unsigned sq_entries;
+    struct io_uring_sqe* sqes;
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned* cq_mask;
+    struct io_uring_cqe* cqes;
+    void* sq_ring;
+    size_t sq_ring_size;
+    void* cq_ring;
+    size_t cq_ring_size;
+    size_t sqes_size;
+    /// True if the buffer of the reader was registered and `IORING_OP_READ_FIXED` can be used
+    bool buffer_registered;
+} OmIoUring_t;
+#endif
+
+struct OmIoReader {
+    int fd;
+    OmIoBackend_t backend;
+    uint8_t* buffer;
+    uint64_t buffer_size;
+    OmThreadPool_t* pool;
+#if defined(OM_IO_URING_AVAILABLE)
+    OmIoUring_t ring;
+#endif
+};
+
+/// Blocking read of the entire range. Returns false on IO errors or if the file is too short.
+static bool _om_io_pread(int fd, uint8_t* destination, uint64_t count, uint64_t offset) {
+    while (count > 0) {
+        const ssize_t n = pread(fd, destination, count, (off_t)offset);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        destination += n;
+        offset += (uint64_t)n;
+        count -= (uint64_t)n;
+    }
+    return true;
+}
+
+/// Store the first error of concurrent workers
+static inline void _om_io_set_error(atomic_int* shared, OmError_t error) {
+    int expected = ERROR_OK;
+    atomic_compare_exchange_strong(shared, &expected, (int)error);
+}
+
+
+// MARK: pread backend
+
+typedef struct {
+    OmIoReader_t* reader;
+    OmIoRequest_t* requests;
+    uint64_t count;
+    atomic_uint_fast64_t next;
+    atomic_int error;
+    OmIoCompletion_t completion;
+    void* completion_context;
+} OmIoPreadJob_t;
+
+static void _om_io_pread_job(void* context, uint32_t worker) {
+    OmIoPreadJob_t* job = (OmIoPreadJob_t*)context;
+    // Each worker reads into its own part of the reader buffer. Larger requests are allocated.
+    const uint64_t bufferSize = job->reader->buffer_size / om_thread_pool_threads(job->reader->pool);
+    uint8_t* buffer = job->reader->buffer + worker * bufferSize;
+    while (atomic_load_explicit(&job->error, memory_order_relaxed) == ERROR_OK) {
+        const uint64_t i = atomic_fetch_add_explicit(&job->next, 1, memory_order_relaxed);
+        if (i >= job->count) {
+            break;
+        }
+        const OmIoRequest_t* request = &job->requests[i];
+        uint8_t* destination = request->destination;
+        const bool allocated = destination == NULL && request->count > bufferSize;
+        if (destination == NULL) {
+            destination = allocated ? malloc(request->count) : buffer;
+        }
+        OmError_t error = ERROR_OK;
+        if (destination == NULL) {
+            error = ERROR_OUT_OF_MEMORY;
+        } else if (!_om_io_pread(job->reader->fd, destination, request->count, request->offset)) {
+            error = ERROR_IO_READ;
+        } else if (job->completion != NULL) {
+            job->completion(job->completion_context, request, destination, worker, &error);
+        }
+        if (allocated) {
+            free(destination);
+        }
+        if (error != ERROR_OK) {
+            _om_io_set_error(&job->error, error);
+        }
+    }
+}
+
+static bool _om_io_pread_execute(OmIoReader_t* reader, OmIoRequest_t* requests, uint64_t count, OmIoCompletion_t completion, void* context, OmError_t* error) {
+    OmIoPreadJob_t job = {
+        .reader = reader,
+        .requests = requests,
+        .count = count,
+        .completion = completion,
+        .completion_context = context
+    };
+    atomic_init(&job.next, 0);
+    atomic_init(&job.error, ERROR_OK);
+    om_thread_pool_run(reader->pool, _om_io_pread_job, &job);
+    const OmError_t jobError = (OmError_t)atomic_load(&job.error);
+    if (jobError != ERROR_OK) {
+        (*error) = jobError;
+        return false;
+    }
+    return true;
+}
+
+
+// MARK: io_uring backend
+
+#if defined(OM_IO_URING_AVAILABLE)
+static bool _om_io_uring_init(OmIoUring_t* ring, uint8_t* buffer, uint64_t buffer_size) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    memset(ring, 0, sizeof(OmIoUring_t));
+    ring->fd = (int)syscall(__NR_io_uring_setup, OM_IO_URING_ENTRIES, &params);
+    if (ring->fd < 0) {
+        return false;
+    }
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->sq_ring_size = max(ring->sq_ring_size, ring->cq_ring_size);
+        ring->cq_ring_size = 0;
+    }
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED) {
+        close(ring->fd);
+        return false;
+    }
+    ring->cq_ring = ring->sq_ring;
+    if (ring->cq_ring_size > 0) {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED) {
+            munmap(ring->sq_ring, ring->sq_ring_size);
+            close(ring->fd);
+            return false;
+        }
+    }
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        if (ring->cq_ring_size > 0) {
+            munmap(ring->cq_ring, ring->cq_ring_size);
+        }
+        munmap(ring->sq_ring, ring->sq_ring_size);
+        close(ring->fd);
+        return false;
+    }
+    uint8_t* sq = (uint8_t*)ring->sq_ring;
+    uint8_t* cq = (uint8_t*)ring->cq_ring;
+    ring->sq_head = (unsigned*)(sq + params.sq_off.head);
+    ring->sq_tail = (unsigned*)(sq + params.sq_off.tail);
+    ring->sq_mask = (unsigned*)(sq + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned*)(sq + params.sq_off.array);
+    ring->sq_entries = params.sq_entries;
+    ring->cq_head = (unsigned*)(cq + params.cq_off.head);
+    ring->cq_tail = (unsigned*)(cq + params.cq_off.tail);
+    ring->cq_mask = (unsigned*)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+
+    // Registered buffers avoid mapping pages for each read. Registration may fail if the memlock limit is too low.
+    struct iovec iov = { .iov_base = buffer, .iov_len = buffer_size };
+    ring->buffer_registered = syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS, &iov, 1) == 0;
+    return true;
+}
+
+static void _om_io_uring_destroy(OmIoUring_t* ring) {
+    munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ring_size > 0) {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    munmap(ring->sq_ring, ring->sq_ring_size);
+    close(ring->fd);
+}
+
+/// Submit queued entries and wait for at least `wait` completions. Returns 0 or the error number.
+/// On errors, the kernel may not have consumed all entries. Entries between `sq_head` and `sq_tail` are still queued.
+static int _om_io_uring_enter(OmIoUring_t* ring, unsigned submit, unsigned wait) {
+    while (true) {
+        const int ret = (int)syscall(__NR_io_uring_enter, ring->fd, submit, wait, wait > 0 ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+        if (ret >= 0) {
+            return 0;
+        }
+        if (errno != EINTR) {
+            return errno;
+        }
+    }
+}
+
+/// Remove entries that the kernel has not consumed from the submission queue and release their buffers. Returns the number of removed entries.
+static unsigned _om_io_uring_withdraw(OmIoUring_t* ring, OmIoRequest_t* requests) {
+    const unsigned head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    const unsigned tail = *ring->sq_tail;
+    for (unsigned i = head; i != tail; i++) {
+        OmIoRequest_t* request = &requests[ring->sqes[ring->sq_array[i & *ring->sq_mask]].user_data];
+        if (request->bufferAllocated) {
+            free(request->buffer);
+        }
+    }
+    __atomic_store_n(ring->sq_tail, head, __ATOMIC_RELEASE);
+    return tail - head;
+}
+
+/// State shared between worker 0, which owns the ring, and the workers that decode completed reads
+typedef struct {
+    OmIoReader_t* reader;
+    OmIoRequest_t* requests;
+    uint64_t count;
+    OmIoCompletion_t completion;
+    void* completion_context;
+    atomic_int error;
+
+    /// Indices of completed requests in completion order. Appended by worker 0 and taken by all workers.
+    uint64_t* ready;
+    uint64_t ready_count;
+    uint64_t ready_taken;
+    /// Number of taken requests whose completion has returned
+    uint64_t ready_done;
+    /// Set once worker 0 has collected all completions
+    bool finished;
+    pthread_mutex_t mutex;
+    pthread_cond_t available;
+    pthread_cond_t done;
+} OmIoUringJob_t;
+
+/// Take the next completed request and pass it to the completion callback. Returns false if no request is ready.
+/// If `wait` is set, waits for a request until worker 0 has finished.
+static bool _om_io_uring_complete_next(OmIoUringJob_t* job, uint32_t worker, bool wait) {
+    pthread_mutex_lock(&job->mutex);
+    while (wait && job->ready_taken == job->ready_count && !job->finished) {
+        pthread_cond_wait(&job->available, &job->mutex);
+    }
+    if (job->ready_taken == job->ready_count) {
+        pthread_mutex_unlock(&job->mutex);
+        return false;
+    }
+    OmIoRequest_t* request = &job->requests[job->ready[job->ready_taken++]];
+    pthread_mutex_unlock(&job->mutex);
+
+    // After an error, remaining reads are only released
+    if (atomic_load_explicit(&job->error, memory_order_relaxed) == ERROR_OK) {
+        OmError_t error = ERROR_OK;
+        job->completion(job->completion_context, request, request->buffer, worker, &error);
+        if (error != ERROR_OK) {
+            _om_io_set_error(&job->error, error);
+        }
+    }
+    if (request->bufferAllocated) {
+        free(request->buffer);
+    }
+
+    pthread_mutex_lock(&job->mutex);
+    job->ready_done++;
+    pthread_cond_broadcast(&job->done);
+    pthread_mutex_unlock(&job->mutex);
+    return true;
+}
+
+/// Complete all requests that are ready and wait until completions taken by other workers have returned
+static void _om_io_uring_complete_all(OmIoUringJob_t* job, uint32_t worker) {
+    while (_om_io_uring_complete_next(job, worker, false)) { }
+    pthread_mutex_lock(&job->mutex);
+    while (job->ready_done < job->ready_count) {
+        pthread_cond_wait(&job->done, &job->mutex);
+    }
+    pthread_mutex_unlock(&job->mutex);
+}
+
+/// Submit all requests and collect their completions on worker 0. Completed reads are queued and decoded by all workers.
+static void _om_io_uring_submit(OmIoUringJob_t* job) {
+    OmIoReader_t* reader = job->reader;
+    OmIoRequest_t* requests = job->requests;
+    const uint64_t count = job->count;
+    OmIoUring_t* ring = &reader->ring;
+    // Without other workers, completions are processed as soon as they arrive
+    const bool single = om_thread_pool_threads(reader->pool) == 1;
+    uint64_t next = 0;
+    uint64_t inflight = 0;
+    // Data requests are placed one after another into the buffer. Space is reused once all requests in flight have completed and were decoded.
+    uint64_t bufferUsed = 0;
+    bool bufferFull = false;
+    OmError_t result = ERROR_OK;
+    unsigned retries = 0;
+
+    while (next < count || inflight > 0) {
+        if (result == ERROR_OK) {
+            result = (OmError_t)atomic_load_explicit(&job->error, memory_order_relaxed);
+        }
+        unsigned tail = *ring->sq_tail;
+        while (result == ERROR_OK && next < count && inflight < ring->sq_entries) {
+            OmIoRequest_t* request = &requests[next];
+            bool fixed = false;
+            request->bufferAllocated = false;
+            if (request->destination != NULL) {
+                request->buffer = request->destination;
+            } else if (request->count <= reader->buffer_size) {
+                if (bufferUsed + request->count > reader->buffer_size) {
+                    // Wait until the buffer is free again
+                    bufferFull = true;
+                    break;
+                }
+                request->buffer = reader->buffer + bufferUsed;
+                bufferUsed += request->count;
+                fixed = ring->buffer_registered;
+            } else {
+                request->buffer = malloc(request->count);
+                if (request->buffer == NULL) {
+                    result = ERROR_OUT_OF_MEMORY;
+                    break;
+                }
+                request->bufferAllocated = true;
+            }
+            const unsigned index = tail & *ring->sq_mask;
+            struct io_uring_sqe* sqe = &ring->sqes[index];
+            memset(sqe, 0, sizeof(struct io_uring_sqe));
+            sqe->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+            sqe->fd = reader->fd;
+            sqe->off = request->offset;
+            sqe->addr = (uint64_t)(uintptr_t)request->buffer;
+            // Larger requests are split. The remaining bytes are read like a short read.
+            sqe->len = (uint32_t)min(request->count, (uint64_t)OM_IO_URING_MAX_READ);
+            sqe->buf_index = 0;
+            sqe->user_data = next;
+            ring->sq_array[index] = index;
+            tail++;
+            next++;
+            inflight++;
+        }
+        __atomic_store_n(ring->sq_tail, tail, __ATOMIC_RELEASE);
+
+        if (inflight == 0) {
+            break;
+        }
+        // Entries that were not consumed by a previous call are submitted again
+        const unsigned queued = tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+        int enterError = _om_io_uring_enter(ring, queued, 1);
+        if ((enterError == EAGAIN || enterError == EBUSY) && retries < OM_IO_URING_RETRIES) {
+            // The kernel is out of resources or the completion queue is full. Entries that were not consumed stay queued and are
+            // submitted again after completions of submitted reads were collected.
+            retries++;
+            const unsigned pending = tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+            enterError = inflight > pending ? _om_io_uring_enter(ring, 0, 1) : 0;
+            if (enterError == EAGAIN || enterError == EBUSY || inflight == pending) {
+                sched_yield();
+                enterError = 0;
+            }
+        }
+        if (enterError != 0) {
+            // Entries that were never submitted would not complete and are removed. Submitted reads are collected before returning.
+            result = ERROR_IO_READ;
+            inflight -= _om_io_uring_withdraw(ring, requests);
+        }
+
+        unsigned head = *ring->cq_head;
+        const unsigned cqTail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        bool queuedCompletions = false;
+        while (head != cqTail) {
+            const struct io_uring_cqe* cqe = &ring->cqes[head & *ring->cq_mask];
+            OmIoRequest_t* request = &requests[cqe->user_data];
+            int res = cqe->res;
+            head++;
+            inflight--;
+            retries = 0;
+            if (res == -EINVAL || res == -EOPNOTSUPP) {
+                // The kernel or file system does not support this read. It is read again with pread.
+                res = 0;
+            }
+            // Short reads are completed synchronously
+            if (result == ERROR_OK && (res < 0 || !_om_io_pread(reader->fd, request->buffer + res, request->count - (uint64_t)res, request->offset + (uint64_t)res))) {
+                result = ERROR_IO_READ;
+            }
+            if (result == ERROR_OK && job->completion != NULL) {
+                pthread_mutex_lock(&job->mutex);
+                job->ready[job->ready_count++] = cqe->user_data;
+                pthread_mutex_unlock(&job->mutex);
+                queuedCompletions = true;
+            } else if (request->bufferAllocated) {
+                free(request->buffer);
+            }
+        }
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+        if (queuedCompletions) {
+            pthread_cond_broadcast(&job->available);
+        }
+        if (single) {
+            _om_io_uring_complete_all(job, 0);
+        }
+        if (inflight == 0 && bufferFull) {
+            // The buffer is reused once all reads in it were decoded
+            _om_io_uring_complete_all(job, 0);
+            bufferUsed = 0;
+            bufferFull = false;
+        }
+        if (result != ERROR_OK && inflight == 0) {
+            break;
+        }
+    }
+    if (result != ERROR_OK) {
+        _om_io_set_error(&job->error, result);
+    }
+}
+
+static void _om_io_uring_job(void* context, uint32_t worker) {
+    OmIoUringJob_t* job = (OmIoUringJob_t*)context;
+    if (worker == 0) {
+        _om_io_uring_submit(job);
+        pthread_mutex_lock(&job->mutex);
+        job->finished = true;
+        pthread_cond_broadcast(&job->available);
+        pthread_mutex_unlock(&job->mutex);
+        _om_io_uring_complete_all(job, 0);
+        return;
+    }
+    while (_om_io_uring_complete_next(job, worker, true)) { }
+}
+
+static bool _om_io_uring_execute(OmIoReader_t* reader, OmIoRequest_t* requests, uint64_t count, OmIoCompletion_t completion, void* context, OmError_t* error) {
+    OmIoUringJob_t job = {
+        .reader = reader,
+        .requests = requests,
+        .count = count,
+        .completion = completion,
+        .completion_context = context,
+        .ready = completion == NULL ? NULL : malloc(count * sizeof(uint64_t))
+    };
+    if (completion != NULL && job.ready == NULL) {
+        (*error) = ERROR_OUT_OF_MEMORY;
+        return false;
+    }
+    atomic_init(&job.error, ERROR_OK);
+    pthread_mutex_init(&job.mutex, NULL);
+    pthread_cond_init(&job.available, NULL);
+    pthread_cond_init(&job.done, NULL);
+    om_thread_pool_run(reader->pool, _om_io_uring_job, &job);
+    pthread_cond_destroy(&job.done);
+    pthread_cond_destroy(&job.available);
+    pthread_mutex_destroy(&job.mutex);
+    free(job.ready);
+    const OmError_t jobError = (OmError_t)atomic_load(&job.error);
+    if (jobError != ERROR_OK) {
+        (*error) = jobError;
+        return false;
+    }
+    return true;
+}
+#endif
+
+
+// MARK: Reader
+
+OmIoReader_t* om_io_reader_create(int fd, OmIoBackend_t backend, uint64_t buffer_size, uint32_t threads) {
+    OmIoReader_t* reader = calloc(1, sizeof(OmIoReader_t));
+    if (reader == NULL) {
+        return NULL;
+    }
+    reader->fd = fd;
+    reader->buffer_size = max(buffer_size, (uint64_t)4096);
+    reader->buffer = malloc(reader->buffer_size);
+    if (reader->buffer == NULL) {
+        free(reader);
+        return NULL;
+    }
+    reader->backend = OM_IO_BACKEND_PREAD;
+#if defined(OM_IO_URING_AVAILABLE)
+    if (backend == OM_IO_BACKEND_IO_URING && _om_io_uring_init(&reader->ring, reader->buffer, reader->buffer_size)) {
+        reader->backend = OM_IO_BACKEND_IO_URING;
+    }
+#else
+    (void)backend;
+#endif
+    reader->pool = om_thread_pool_create(threads);
+    if (reader->pool == NULL) {
+        om_io_reader_destroy(reader);
+        return NULL;
+    }
+    return reader;
+}
+
+void om_io_reader_destroy(OmIoReader_t* reader) {
+    if (reader->pool != NULL) {
+        om_thread_pool_destroy(reader->pool);
+    }
+#if defined(OM_IO_URING_AVAILABLE)
+    if (reader->backend == OM_IO_BACKEND_IO_URING) {
+        _om_io_uring_destroy(&reader->ring);
+    }
+#endif
+    free(reader->buffer);
+    free(reader);
+}
+
+OmIoBackend_t om_io_reader_backend(const OmIoReader_t* reader) {
+    return reader->backend;
+}
+
+static bool _om_io_execute(OmIoReader_t* reader, OmIoRequest_t* requests, uint64_t count, OmIoCompletion_t completion, void* context, OmError_t* error) {
+    if (count == 0) {
+        return true;
+    }
+    switch (reader->backend) {
+        case OM_IO_BACKEND_IO_URING:
+#if defined(OM_IO_URING_AVAILABLE)
+            return _om_io_uring_execute(reader, requests, count, completion, context, error);
+#endif
+        case OM_IO_BACKEND_PREAD:
+            return _om_io_pread_execute(reader, requests, count, completion, context, error);
+    }
+    return false;
+}
+
+typedef struct {
+    const OmDecoder_t* const* decoders;
+    void* const* into;
+    uint8_t* chunk_buffers;
+    uint64_t chunk_buffer_size;
+} OmIoDecodeContext_t;
+
+static bool _om_io_decode_completion(void* context, const OmIoRequest_t* request, const uint8_t* data, uint32_t worker, OmError_t* error) {
+    const OmIoDecodeContext_t* decode = (const OmIoDecodeContext_t*)context;
+    return om_decoder_decode_chunks_with_offsets(
+        decode->decoders[request->decoder],
+        request->chunkIndex,
+        data,
+        request->count,
+        request->chunkOffsets,
+        request->chunkOffsetsCount,
+        decode->into[request->decoder],
+        decode->chunk_buffers + worker * decode->chunk_buffer_size,
+        error
+    );
+}
+
+/// Index read of a decoder and the index data after it was read
+typedef struct {
+    uint64_t decoder;
+    OmDecoder_indexRead_t read;
+    uint8_t* data;
+} OmIoIndexRead_t;
+
+bool om_io_reader_decode(OmIoReader_t* reader, const OmDecoder_t* const* decoders, void* const* into, uint64_t decoder_count, OmError_t* error) {
+    bool success = false;
+    OmIoIndexRead_t* indexReads = NULL;
+    OmIoRequest_t* requests = NULL;
+    uint8_t* indexData = NULL;
+    uint64_t* chunkOffsets = NULL;
+    OmDecoder_dataReadRequest_t* dataReads = NULL;
+    OmDecoder_t* variableLutDecoders = NULL;
+    const OmDecoder_t** activeDecoders = NULL;
+    uint8_t* blockOffsets = NULL;
+    OmIoDecodeContext_t decode = { .decoders = decoders, .into = into, .chunk_buffers = NULL, .chunk_buffer_size = 0 };
+
+    // Variable-length LUTs need the block offset table of the read before index reads are planned. Tables of all decoders are read in one batch
+    // and set on copies of the decoders.
+    activeDecoders = malloc(max(decoder_count, (uint64_t)1) * sizeof(const OmDecoder_t*));
+    variableLutDecoders = malloc(max(decoder_count, (uint64_t)1) * sizeof(OmDecoder_t));
+    requests = malloc(max(decoder_count, (uint64_t)1) * sizeof(OmIoRequest_t));
+    if (activeDecoders == NULL || variableLutDecoders == NULL || requests == NULL) {
+        (*error) = ERROR_OUT_OF_MEMORY;
+        goto cleanup;
+    }
+    uint64_t blockOffsetsRequests = 0;
+    uint64_t blockOffsetsSize = 0;
+    for (uint64_t d = 0; d < decoder_count; d++) {
+        activeDecoders[d] = decoders[d];
+        uint64_t offset, count;
+        if (decoders[d]->lut_block_offsets == NULL && om_decoder_lut_block_offsets_read(decoders[d], &offset, &count)) {
+            requests[blockOffsetsRequests++] = (OmIoRequest_t){ .offset = offset, .count = count, .destination = NULL, .decoder = d };
+            blockOffsetsSize += count;
+        }
+    }
+    if (blockOffsetsRequests > 0) {
+        blockOffsets = malloc(blockOffsetsSize);
+        if (blockOffsets == NULL) {
+            (*error) = ERROR_OUT_OF_MEMORY;
+            goto cleanup;
+        }
+        uint64_t position = 0;
+        for (uint64_t r = 0; r < blockOffsetsRequests; r++) {
+            requests[r].destination = blockOffsets + position;
+            position += requests[r].count;
+        }
+        if (!_om_io_execute(reader, requests, blockOffsetsRequests, NULL, NULL, error)) {
+            goto cleanup;
+        }
+        for (uint64_t r = 0; r < blockOffsetsRequests; r++) {
+            const uint64_t d = requests[r].decoder;
+            variableLutDecoders[d] = *decoders[d];
+            if (!om_decoder_set_lut_block_offsets(&variableLutDecoders[d], requests[r].destination, requests[r].count)) {
+                (*error) = ERROR_OUT_OF_BOUND_READ;
+                goto cleanup;
+            }
+            activeDecoders[d] = &variableLutDecoders[d];
+        }
+    }
+    decode.decoders = activeDecoders;
+    decoders = activeDecoders;
+    free(requests);
+    requests = NULL;
+
+    // Collect all index reads of all decoders
+    uint64_t indexReadsCount = 0;
+    uint64_t indexReadsCapacity = 0;
+    for (uint64_t d = 0; d < decoder_count; d++) {
+        OmDecoder_indexRead_t indexRead;
+        om_decoder_init_index_read(decoders[d], &indexRead);
+        while (true) {
+            if (indexReadsCount == indexReadsCapacity) {
+                indexReadsCapacity = max((uint64_t)64, indexReadsCapacity * 2);
+                OmIoIndexRead_t* resized = realloc(indexReads, indexReadsCapacity * sizeof(OmIoIndexRead_t));
+                if (resized == NULL) {
+                    (*error) = ERROR_OUT_OF_MEMORY;
+                    goto cleanup;
+                }
+                indexReads = resized;
+            }
+            OmDecoder_indexRead_t batch[64];
+            uint64_t batchCount = 0;
+            if (!om_decoder_next_index_reads(decoders[d], &indexRead, batch, min((uint64_t)64, indexReadsCapacity - indexReadsCount), &batchCount)) {
+                break;
+            }
+            for (uint64_t i = 0; i < batchCount; i++) {
+                indexReads[indexReadsCount++] = (OmIoIndexRead_t){ .decoder = d, .read = batch[i], .data = NULL };
+            }
+        }
+        decode.chunk_buffer_size = max(decode.chunk_buffer_size, om_decoder_read_buffer_size(decoders[d]));
+    }
+    requests = malloc(max(indexReadsCount, (uint64_t)1) * sizeof(OmIoRequest_t));
+    if (requests == NULL) {
+        (*error) = ERROR_OUT_OF_MEMORY;
+        goto cleanup;
+    }
+
+    // Read the index data of all index reads in one batch. Index reads resolved by the LUT cache do not need data.
+    uint64_t requestCount = 0;
+    uint64_t indexDataSize = 0;
+    for (uint64_t i = 0; i < indexReadsCount; i++) {
+        if (indexReads[i].read.count > 0) {
+            indexDataSize += indexReads[i].read.count;
+            requestCount++;
+        }
+    }
+    if (requestCount > 0) {
+        indexData = malloc(indexDataSize);
+        if (indexData == NULL) {
+            (*error) = ERROR_OUT_OF_MEMORY;
+            goto cleanup;
+        }
+        uint64_t r = 0;
+        uint64_t position = 0;
+        for (uint64_t i = 0; i < indexReadsCount; i++) {
+            if (indexReads[i].read.count > 0) {
+                indexReads[i].data = indexData + position;
+                requests[r++] = (OmIoRequest_t){ .offset = indexReads[i].read.offset, .count = indexReads[i].read.count, .destination = indexData + position };
+                position += indexReads[i].read.count;
+            }
+        }
+        if (!_om_io_execute(reader, requests, requestCount, NULL, NULL, error)) {
+            goto cleanup;
+        }
+    }
+
+    // Collect all data reads. Buffers are sized to get all data reads of an index read with a single call.
+    uint64_t dataReadsCapacity = 0;
+    uint64_t chunkOffsetsCapacity = 0;
+    uint64_t maxDataReads = 1;
+    for (uint64_t i = 0; i < indexReadsCount; i++) {
+        uint64_t reads, offsets;
+        om_decoder_data_reads_capacity(&indexReads[i].read, &reads, &offsets);
+        dataReadsCapacity += reads;
+        chunkOffsetsCapacity += offsets;
+        maxDataReads = max(maxDataReads, reads);
+    }
+    free(requests);
+    requests = malloc(max(dataReadsCapacity, (uint64_t)1) * sizeof(OmIoRequest_t));
+    chunkOffsets = malloc(max(chunkOffsetsCapacity, (uint64_t)1) * sizeof(uint64_t));
+    dataReads = malloc(maxDataReads * sizeof(OmDecoder_dataReadRequest_t));
+    if (requests == NULL || chunkOffsets == NULL || dataReads == NULL) {
+        (*error) = ERROR_OUT_OF_MEMORY;
+        goto cleanup;
+    }
+    uint64_t dataReadsCount = 0;
+    uint64_t chunkOffsetsCount = 0;
+    for (uint64_t i = 0; i < indexReadsCount; i++) {
+        uint64_t reads, offsets;
+        om_decoder_data_reads_capacity(&indexReads[i].read, &reads, &offsets);
+        OmDecoder_dataRead_t dataRead;
+        om_decoder_init_data_read(&dataRead, &indexReads[i].read);
+        uint64_t count = 0;
+        uint64_t offsetsCount = 0;
+        (*error) = ERROR_OK;
+        om_decoder_next_data_reads(decoders[indexReads[i].decoder], &dataRead, indexReads[i].data, indexReads[i].read.count, dataReads, reads, &count, &chunkOffsets[chunkOffsetsCount], offsets, &offsetsCount, error);
+        if ((*error) != ERROR_OK) {
+            goto cleanup;
+        }
+        for (uint64_t j = 0; j < count; j++) {
+            requests[dataReadsCount++] = (OmIoRequest_t){
+                .offset = dataReads[j].offset,
+                .count = dataReads[j].count,
+                .destination = NULL,
+                .decoder = indexReads[i].decoder,
+                .chunkIndex = dataReads[j].chunkIndex,
+                .chunkOffsets = &chunkOffsets[chunkOffsetsCount + dataReads[j].chunkOffsetsStart],
+                .chunkOffsetsCount = dataReads[j].chunkOffsetsCount
+            };
+        }
+        chunkOffsetsCount += offsetsCount;
+    }
+
+    // Read and decode all data
+    decode.chunk_buffers = malloc(decode.chunk_buffer_size * om_thread_pool_threads(reader->pool));
+    if (decode.chunk_buffers == NULL) {
+        (*error) = ERROR_OUT_OF_MEMORY;
+        goto cleanup;
+    }
+    success = _om_io_execute(reader, requests, dataReadsCount, _om_io_decode_completion, &decode, error);
+
+cleanup:
+    free(decode.chunk_buffers);
+    free(dataReads);
+    free(chunkOffsets);
+    free(indexData);
+    free(requests);
+    free(indexReads);
+    free(blockOffsets);
+    free(variableLutDecoders);
+    free(activeDecoders);
+    return success;
+}
+
+#else
+
+OmIoReader_t* om_io_reader_create(int fd, OmIoBackend_t backend, uint64_t buffer_size, uint32_t threads) {
+    (void)fd;
+    (void)backend;
+    (void)buffer_size;
+    (void)threads;
+    return NULL;
+}
+
+void om_io_reader_destroy(OmIoReader_t* reader) {
+    (void)reader;
+}
+
+OmIoBackend_t om_io_reader_backend(const OmIoReader_t* reader) {
+    (void)reader;
+    return OM_IO_BACKEND_PREAD;
+}
+
+bool om_io_reader_decode(OmIoReader_t* reader, const OmDecoder_t* const* decoders, void* const* into, uint64_t decoder_count, OmError_t* error) {
+    (void)reader;
+    (void)decoders;
+    (void)into;
+    (void)decoder_count;
+    (*error) = ERROR_IO_READ;
+    return false;
+}
+
+#endif
@@ -0,0 +1,164 @@
+//
+//  om_lut_cache.c
+//  OpenMeteoApi
+//
+
+#include <stdatomic.h>
+#include <string.h>
+#include "om_lut_cache.h"
+
+/// State of a LUT block in the cache
+enum {
+    LUT_BLOCK_EMPTY = 0,
+    LUT_BLOCK_FILLING = 1,
+    LUT_BLOCK_RESIDENT = 2,
+};
+
+struct OmLutCache {
+    uint64_t lut_offset;
+    uint64_t lut_size;
+    uint64_t number_of_chunks;
+    uint64_t block_count;
+    OmLutEncoding_t lut_encoding;
+    atomic_uint_fast64_t resident_block_count;
+    /// One state per block followed by `LUT_CHUNK_COUNT` entries per block
+    atomic_uchar* states;
+    uint64_t* entries;
+};
+
+/// Number of chunks of a V3 array. Returns 0 for all other variables, because only V3 arrays use compressed LUT blocks.
+static uint64_t _om_lut_cache_number_of_chunks(const OmVariable_t* variable) {
+    if (_om_variable_memory_layout(variable) != OM_MEMORY_LAYOUT_ARRAY) {
+        return 0;
+    }
+    switch (om_variable_get_lut_encoding(variable)) {
+        case LUT_ENCODING_PFOR:
+        case LUT_ENCODING_PFOR_VARIABLE:
+            break;
+        case LUT_ENCODING_FIXED_WIDTH:
+            return 0;
+    }
+    const OmDimensions_t dimensions = om_variable_get_dimensions(variable);
+    const OmDimensions_t chunks = om_variable_get_chunks(variable);
+    uint64_t nChunks = 1;
+    for (uint64_t i = 0; i < dimensions.count; i++) {
+        if (chunks.values[i] == 0) {
+            return 0;
+        }
+        nChunks *= divide_rounded_up(dimensions.values[i], chunks.values[i]);
+    }
+    return nChunks;
+}
+
+/// Offset of the entries relative to the start of the cache memory
+static inline uint64_t _om_lut_cache_entries_offset(uint64_t block_count) {
+    return sizeof(OmLutCache_t) + divide_rounded_up(block_count * sizeof(atomic_uchar), 8) * 8;
+}
+
+uint64_t om_lut_cache_memory_size(const OmVariable_t* variable) {
+    const uint64_t nChunks = _om_lut_cache_number_of_chunks(variable);
+    if (nChunks == 0) {
+        return 0;
+    }
+    const uint64_t blockCount = divide_rounded_up(nChunks + 1, LUT_CHUNK_COUNT);
+    return _om_lut_cache_entries_offset(blockCount) + blockCount * LUT_CHUNK_COUNT * sizeof(uint64_t);
+}
+
+OmLutCache_t* om_lut_cache_init(void* memory, uint64_t memory_size, const OmVariable_t* variable) {
+    const uint64_t memorySize = om_lut_cache_memory_size(variable);
+    if (memorySize == 0 || memory_size < memorySize) {
+        return NULL;
+    }
+    const OmVariableArrayV3_t* meta = (const OmVariableArrayV3_t*)variable;
+    OmLutCache_t* cache = (OmLutCache_t*)memory;
+    cache->lut_offset = meta->lut_offset;
+    cache->lut_size = meta->lut_size;
+    cache->number_of_chunks = _om_lut_cache_number_of_chunks(variable);
+    cache->block_count = divide_rounded_up(cache->number_of_chunks + 1, LUT_CHUNK_COUNT);
+    cache->lut_encoding = om_variable_get_lut_encoding(variable);
+    atomic_init(&cache->resident_block_count, 0);
+    cache->states = (atomic_uchar*)((uint8_t*)memory + sizeof(OmLutCache_t));
+    cache->entries = (uint64_t*)((uint8_t*)memory + _om_lut_cache_entries_offset(cache->block_count));
+    for (uint64_t i = 0; i < cache->block_count; i++) {
+        atomic_init(&cache->states[i], LUT_BLOCK_EMPTY);
+    }
+    return cache;
+}
+
+void om_lut_cache_get_lut_range(const OmLutCache_t* cache, uint64_t* lut_offset, uint64_t* lut_size) {
+    *lut_offset = cache->lut_offset;
+    *lut_size = cache->lut_size;
+}
+
+bool om_lut_cache_load(OmLutCache_t* cache, const void* lut_data, uint64_t lut_data_size, OmError_t* error) {
+    const uint8_t* data = (const uint8_t*)lut_data;
+    if (lut_data_size < cache->lut_size) {
+        (*error) = ERROR_OUT_OF_BOUND_READ;
+        return false;
+    }
+    uint64_t entries[LUT_CHUNK_COUNT];
+    const uint64_t blockLength = cache->lut_size / cache->block_count;
+    // Variable-length blocks are located with the table of block start and end positions at the end of the LUT
+    const uint64_t tableSize = cache->block_count * 2 * sizeof(uint64_t);
+    if (cache->lut_encoding == LUT_ENCODING_PFOR_VARIABLE && cache->lut_size < tableSize) {
+        (*error) = ERROR_OUT_OF_BOUND_READ;
+        return false;
+    }
+    const uint64_t tableStart = cache->lut_size - min(cache->lut_size, tableSize);
+    for (uint64_t block = 0; block < cache->block_count; block++) {
+        const uint64_t count = min(LUT_CHUNK_COUNT, cache->number_of_chunks + 1 - block * LUT_CHUNK_COUNT);
+        switch (cache->lut_encoding) {
+            case LUT_ENCODING_PFOR:
+                om_common_codecs()->p4nddec64((unsigned char*)data + block * blockLength, count, entries);
+                break;
+            case LUT_ENCODING_PFOR_VARIABLE: {
+                uint64_t start = 0, end = 0;
+                for (uint64_t j = 0; j < sizeof(uint64_t); j++) {
+                    start |= (uint64_t)data[tableStart + block * 2 * sizeof(uint64_t) + j] << (j * 8);
+                    end |= (uint64_t)data[tableStart + (block * 2 + 1) * sizeof(uint64_t) + j] << (j * 8);
+                }
+                if (start >= end || end > tableStart) {
+                    (*error) = ERROR_OUT_OF_BOUND_READ;
+                    return false;
+                }
+                om_common_codecs()->p4nddec64((unsigned char*)data + start, count, entries);
+                break;
+            }
+            case LUT_ENCODING_FIXED_WIDTH:
+                (*error) = ERROR_OUT_OF_BOUND_READ;
+                return false;
+        }
+        om_lut_cache_put_block(cache, block, entries);
+    }
+    return true;
+}
+
+uint64_t om_lut_cache_resident_block_count(OmLutCache_t* cache) {
+    return atomic_load_explicit(&cache->resident_block_count, memory_order_relaxed);
+}
+
+const uint64_t* om_lut_cache_get_block(const OmLutCache_t* cache, uint64_t block) {
+    if (block >= cache->block_count || atomic_load_explicit(&cache->states[block], memory_order_acquire) != LUT_BLOCK_RESIDENT) {
+        return NULL;
+    }
+    return &cache->entries[block * LUT_CHUNK_COUNT];
+}
+
+void om_lut_cache_put_block(OmLutCache_t* cache, uint64_t block, const uint64_t* entries) {
+    if (block >= cache->block_count) {
+        return;
+    }
+    // Only one thread fills a block. Blocks are never removed, so readers do not need a lock.
+    unsigned char expected = LUT_BLOCK_EMPTY;
+    if (!atomic_compare_exchange_strong_explicit(&cache->states[block], &expected, LUT_BLOCK_FILLING, memory_order_acquire, memory_order_relaxed)) {
+        return;
+    }
+    const uint64_t count = min(LUT_CHUNK_COUNT, cache->number_of_chunks + 1 - block * LUT_CHUNK_COUNT);
+    memcpy(&cache->entries[block * LUT_CHUNK_COUNT], entries, count * sizeof(uint64_t));
+    atomic_store_explicit(&cache->states[block], LUT_BLOCK_RESIDENT, memory_order_release);
+    atomic_fetch_add_explicit(&cache->resident_block_count, 1, memory_order_relaxed);
+}
+
+bool _om_lut_cache_matches(const OmLutCache_t* cache, uint64_t lut_offset, uint64_t number_of_chunks) {
+    return cache->lut_offset == lut_offset && cache->number_of_chunks == number_of_chunks;
+}
@@ -0,0 +1,259 @@
+//
+//  om_thread_pool.c
+//  OpenMeteoApi
+//
+
+#include <stdlib.h>
+#include <string.h>
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include "om_thread_pool.h"
+
+#if defined(_WIN32)
+typedef HANDLE OmThread_t;
+typedef CRITICAL_SECTION OmMutex_t;
+typedef CONDITION_VARIABLE OmCondition_t;
+#define om_mutex_init(m) InitializeCriticalSection(m)
+#define om_mutex_destroy(m) DeleteCriticalSection(m)
+#define om_mutex_lock(m) EnterCriticalSection(m)
+#define om_mutex_unlock(m) LeaveCriticalSection(m)
+#define om_condition_init(c) InitializeConditionVariable(c)
+#define om_condition_destroy(c) ((void)(c))
+#define om_condition_wait(c, m) SleepConditionVariableCS(c, m, INFINITE)
+#define om_condition_signal(c) WakeConditionVariable(c)
+#define om_condition_broadcast(c) WakeAllConditionVariable(c)
+#define om_thread_yield() SwitchToThread()
+#else
+typedef pthread_t OmThread_t;
+typedef pthread_mutex_t OmMutex_t;
+typedef pthread_cond_t OmCondition_t;
+#define om_mutex_init(m) pthread_mutex_init(m, NULL)
+#define om_mutex_destroy(m) pthread_mutex_destroy(m)
+#define om_mutex_lock(m) pthread_mutex_lock(m)
+#define om_mutex_unlock(m) pthread_mutex_unlock(m)
+#define om_condition_init(c) pthread_cond_init(c, NULL)
+#define om_condition_destroy(c) pthread_cond_destroy(c)
+#define om_condition_wait(c, m) pthread_cond_wait(c, m)
+#define om_condition_signal(c) pthread_cond_signal(c)
+#define om_condition_broadcast(c) pthread_cond_broadcast(c)
+#define om_thread_yield() sched_yield()
+#endif
+
+struct OmThreadPool {
+    OmThread_t* threads;
+    /// Number of started threads, not including the calling thread
+    uint32_t count;
+    OmMutex_t mutex;
+    OmCondition_t start;
+    OmCondition_t done;
+    /// Incremented for each job. Workers wait until it changes.
+    uint64_t generation;
+    /// Workers that have not finished the current job
+    uint32_t running;
+    /// Used while starting threads to assign worker numbers
+    uint32_t started;
+    bool shutdown;
+    OmThreadPoolJob_t job;
+    void* context;
+};
+
+#if defined(_WIN32)
+static DWORD WINAPI _om_thread_pool_worker(LPVOID argument) {
+#else
+static void* _om_thread_pool_worker(void* argument) {
+#endif
+    OmThreadPool_t* pool = (OmThreadPool_t*)argument;
+    om_mutex_lock(&pool->mutex);
+    const uint32_t worker = ++pool->started;
+    uint64_t generation = pool->generation;
+    om_condition_broadcast(&pool->done);
+    while (true) {
+        while (!pool->shutdown && pool->generation == generation) {
+            om_condition_wait(&pool->start, &pool->mutex);
+        }
+        if (pool->shutdown) {
+            break;
+        }
+        generation = pool->generation;
+        const OmThreadPoolJob_t job = pool->job;
+        void* context = pool->context;
+        om_mutex_unlock(&pool->mutex);
+        job(context, worker);
+        om_mutex_lock(&pool->mutex);
+        if (--pool->running == 0) {
+            om_condition_broadcast(&pool->done);
+        }
+    }
+    om_mutex_unlock(&pool->mutex);
+#if defined(_WIN32)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+OmThreadPool_t* om_thread_pool_create(uint32_t threads) {
+    OmThreadPool_t* pool = calloc(1, sizeof(OmThreadPool_t));
+    if (pool == NULL) {
+        return NULL;
+    }
+    om_mutex_init(&pool->mutex);
+    om_condition_init(&pool->start);
+    om_condition_init(&pool->done);
+    if (threads <= 1) {
+        return pool;
+    }
+    pool->threads = malloc((threads - 1) * sizeof(OmThread_t));
+    if (pool->threads == NULL) {
+        om_thread_pool_destroy(pool);
+        return NULL;
+    }
+    for (uint32_t i = 0; i < threads - 1; i++) {
+#if defined(_WIN32)
+        pool->threads[i] = CreateThread(NULL, 0, _om_thread_pool_worker, pool, 0, NULL);
+        if (pool->threads[i] == NULL) {
+            break;
+        }
+#else
+        if (pthread_create(&pool->threads[i], NULL, _om_thread_pool_worker, pool) != 0) {
+            break;
+        }
+#endif
+        pool->count++;
+    }
+    // Wait until all workers have their number and observed the initial generation
+    om_mutex_lock(&pool->mutex);
+    while (pool->started < pool->count) {
+        om_condition_wait(&pool->done, &pool->mutex);
+    }
+    om_mutex_unlock(&pool->mutex);
+    return pool;
+}
+
+void om_thread_pool_destroy(OmThreadPool_t* pool) {
+    om_mutex_lock(&pool->mutex);
+    pool->shutdown = true;
+    om_condition_broadcast(&pool->start);
+    om_mutex_unlock(&pool->mutex);
+    for (uint32_t i = 0; i < pool->count; i++) {
+#if defined(_WIN32)
+        WaitForSingleObject(pool->threads[i], INFINITE);
+        CloseHandle(pool->threads[i]);
+#else
+        pthread_join(pool->threads[i], NULL);
+#endif
+    }
+    free(pool->threads);
+    om_mutex_destroy(&pool->mutex);
+    om_condition_destroy(&pool->start);
+    om_condition_destroy(&pool->done);
+    free(pool);
+}
+
+uint32_t om_thread_pool_threads(const OmThreadPool_t* pool) {
+    return pool->count + 1;
+}
+
+void om_thread_pool_run(OmThreadPool_t* pool, OmThreadPoolJob_t job, void* context) {
+    if (pool->count == 0) {
+        job(context, 0);
+        return;
+    }
+    om_mutex_lock(&pool->mutex);
+    pool->job = job;
+    pool->context = context;
+    pool->running = pool->count;
+    pool->generation++;
+    om_condition_broadcast(&pool->start);
+    om_mutex_unlock(&pool->mutex);
+
+    job(context, 0);
+
+    om_mutex_lock(&pool->mutex);
+    while (pool->running > 0) {
+        om_condition_wait(&pool->done, &pool->mutex);
+    }
+    om_mutex_unlock(&pool->mutex);
+}
+
+
+// MARK: Work queue
+
+static inline void _om_work_range_lock(OmWorkRange_t* range) {
+    uint64_t spins = 0;
+    while (atomic_flag_test_and_set_explicit(&range->lock, memory_order_acquire)) {
+        // Locks are only held to update two integers. Yield if the owner was preempted.
+        if (++spins % 64 == 0) {
+            om_thread_yield();
+        }
+    }
+}
+
+static inline void _om_work_range_unlock(OmWorkRange_t* range) {
+    atomic_flag_clear_explicit(&range->lock, memory_order_release);
+}
+
+bool om_work_queue_init(OmWorkQueue_t* queue, uint64_t count, uint32_t workers) {
+    workers = max(workers, 1u);
+    queue->workers = workers;
+    queue->memory = malloc(workers * sizeof(OmWorkRange_t) + sizeof(OmWorkRange_t) - 1);
+    if (queue->memory == NULL) {
+        queue->ranges = NULL;
+        return false;
+    }
+    const uintptr_t skip = (sizeof(OmWorkRange_t) - (uintptr_t)queue->memory % sizeof(OmWorkRange_t)) % sizeof(OmWorkRange_t);
+    queue->ranges = (OmWorkRange_t*)((uint8_t*)queue->memory + skip);
+    for (uint32_t i = 0; i < workers; i++) {
+        atomic_flag_clear(&queue->ranges[i].lock);
+        queue->ranges[i].begin = count * i / workers;
+        queue->ranges[i].end = count * (i + 1) / workers;
+    }
+    return true;
+}
+
+void om_work_queue_destroy(OmWorkQueue_t* queue) {
+    free(queue->memory);
+    queue->memory = NULL;
+    queue->ranges = NULL;
+}
+
+bool om_work_queue_next(OmWorkQueue_t* queue, uint32_t worker, uint64_t* task) {
+    OmWorkRange_t* own = &queue->ranges[worker];
+    _om_work_range_lock(own);
+    if (own->begin < own->end) {
+        *task = own->begin++;
+        _om_work_range_unlock(own);
+        return true;
+    }
+    _om_work_range_unlock(own);
+
+    // Steal the back half of the first non-empty range after this worker
+    for (uint32_t i = 1; i < queue->workers; i++) {
+        OmWorkRange_t* victim = &queue->ranges[(worker + i) % queue->workers];
+        _om_work_range_lock(victim);
+        if (victim->begin >= victim->end) {
+            _om_work_range_unlock(victim);
+            continue;
+        }
+        const uint64_t remaining = victim->end - victim->begin;
+        const uint64_t end = victim->end;
+        const uint64_t begin = end - (remaining + 1) / 2;
+        victim->end = begin;
+        _om_work_range_unlock(victim);
+
+        *task = begin;
+        if (begin + 1 < end) {
+            _om_work_range_lock(own);
+            own->begin = begin + 1;
+            own->end = end;
+            _om_work_range_unlock(own);
+        }
+        return true;
+    }
+    return false;
+}
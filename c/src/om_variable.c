@@ -20,7 +20,9 @@ OmString_t om_variable_get_name(const OmVariable_t* variable) {
         case OM_MEMORY_LAYOUT_ARRAY: {
             // 'Name' is after dimension arrays
             const OmVariableArrayV3_t* meta = (const OmVariableArrayV3_t*)variable;
-            const char* name = (void *)variable + sizeof(OmVariableArrayV3_t) + 16 * meta->children_count + 16 * meta->dimension_count;
+            const uint64_t statisticsSize = (meta->compression_type & OM_COMPRESSION_FLAG_CHUNK_STATISTICS) ? 16 : 0;
+            const uint64_t mantissaBitsSize = (meta->data_type & OM_DATA_TYPE_FLAG_MANTISSA_BITS) ? 8 : 0;
+            const char* name = (void *)variable + sizeof(OmVariableArrayV3_t) + 16 * meta->children_count + 16 * meta->dimension_count + statisticsSize + mantissaBitsSize;
             return (OmString_t){.size = meta->name_size, .value = name};
         }
         case OM_MEMORY_LAYOUT_SCALAR: {
@@ -65,7 +67,7 @@ OmDataType_t om_variable_get_type(const OmVariable_t* variable) {
         case OM_MEMORY_LAYOUT_ARRAY:
         case OM_MEMORY_LAYOUT_SCALAR: {
             const OmVariableV3_t* meta = (const OmVariableV3_t*)variable;
-            return meta->data_type;
+            return meta->data_type & ~OM_DATA_TYPE_FLAG_MANTISSA_BITS;
         }
     }
 }
@@ -82,7 +84,22 @@ OmCompression_t om_variable_get_compression(const OmVariable_t* variable) {
         case OM_MEMORY_LAYOUT_ARRAY:
         case OM_MEMORY_LAYOUT_SCALAR: {
             const OmVariableV3_t* meta = (const OmVariableV3_t*)variable;
-            return meta->compression_type;
+            return meta->compression_type & ~OM_COMPRESSION_FLAGS;
+        }
+    }
+}
+
+OmLutEncoding_t om_variable_get_lut_encoding(const OmVariable_t* variable) {
+    switch (_om_variable_memory_layout(variable)) {
+        case OM_MEMORY_LAYOUT_LEGACY:
+        case OM_MEMORY_LAYOUT_SCALAR:
+            return LUT_ENCODING_PFOR;
+        case OM_MEMORY_LAYOUT_ARRAY: {
+            const OmVariableV3_t* meta = (const OmVariableV3_t*)variable;
+            if (meta->compression_type & OM_COMPRESSION_FLAG_LUT_VARIABLE) {
+                return LUT_ENCODING_PFOR_VARIABLE;
+            }
+            return (meta->compression_type & OM_COMPRESSION_FLAG_LUT_FIXED_WIDTH) ? LUT_ENCODING_FIXED_WIDTH : LUT_ENCODING_PFOR;
         }
     }
 }
@@ -94,7 +111,8 @@ OmMemoryLayout_t _om_variable_memory_layout(const OmVariable_t* variable) {
         return OM_MEMORY_LAYOUT_LEGACY;
     }
     const OmVariableV3_t* var = (const OmVariableV3_t*)variable;
-    bool isArray = var->data_type >= DATA_TYPE_INT8_ARRAY && var->data_type <= DATA_TYPE_DOUBLE_ARRAY;
+    const uint8_t data_type = var->data_type & ~OM_DATA_TYPE_FLAG_MANTISSA_BITS;
+    bool isArray = (data_type >= DATA_TYPE_INT8_ARRAY && data_type <= DATA_TYPE_DOUBLE_ARRAY) || data_type == DATA_TYPE_FLOAT16_ARRAY || data_type == DATA_TYPE_BFLOAT16_ARRAY;
     return isArray ? OM_MEMORY_LAYOUT_ARRAY : OM_MEMORY_LAYOUT_SCALAR;
 }
 
@@ -120,6 +138,20 @@ float om_variable_get_add_offset(const OmVariable_t* variable) {
     }
 }
 
+uint8_t om_variable_get_mantissa_bits(const OmVariable_t* variable) {
+    if (_om_variable_memory_layout(variable) != OM_MEMORY_LAYOUT_ARRAY) {
+        return 0;
+    }
+    const OmVariableArrayV3_t* meta = (const OmVariableArrayV3_t*)variable;
+    if (!(meta->data_type & OM_DATA_TYPE_FLAG_MANTISSA_BITS)) {
+        return 0;
+    }
+    // The number of mantissa bits follows the chunk statistics
+    const uint64_t statisticsSize = (meta->compression_type & OM_COMPRESSION_FLAG_CHUNK_STATISTICS) ? 16 : 0;
+    const uint64_t* mantissaBits = (const uint64_t*)((void *)variable + sizeof(OmVariableArrayV3_t) + 16 * meta->children_count + 16 * meta->dimension_count + statisticsSize);
+    return (uint8_t)*mantissaBits;
+}
+
 OmDimensions_t om_variable_get_dimensions(const OmVariable_t* variable) {
     switch (_om_variable_memory_layout(variable)) {
         case OM_MEMORY_LAYOUT_LEGACY: {
@@ -152,6 +184,29 @@ OmDimensions_t om_variable_get_chunks(const OmVariable_t* variable) {
     }
 }
 
+bool om_variable_has_constant_chunks(const OmVariable_t* variable) {
+    if (_om_variable_memory_layout(variable) != OM_MEMORY_LAYOUT_ARRAY) {
+        return false;
+    }
+    const OmVariableV3_t* meta = (const OmVariableV3_t*)variable;
+    return (meta->compression_type & OM_COMPRESSION_FLAG_CONSTANT_CHUNKS) != 0;
+}
+
+bool om_variable_get_chunk_statistics(const OmVariable_t* variable, uint64_t* statistics_offset, uint64_t* statistics_size) {
+    if (_om_variable_memory_layout(variable) != OM_MEMORY_LAYOUT_ARRAY) {
+        return false;
+    }
+    const OmVariableArrayV3_t* meta = (const OmVariableArrayV3_t*)variable;
+    if (!(meta->compression_type & OM_COMPRESSION_FLAG_CHUNK_STATISTICS)) {
+        return false;
+    }
+    // Offset and size follow the chunk dimensions
+    const uint64_t* statistics = (const uint64_t*)((void *)variable + sizeof(OmVariableArrayV3_t) + 16 * meta->children_count + 16 * meta->dimension_count);
+    *statistics_offset = statistics[0];
+    *statistics_size = statistics[1];
+    return true;
+}
+
 uint32_t om_variable_get_children_count(const OmVariable_t* variable) {
     switch (_om_variable_memory_layout(variable)) {
         case OM_MEMORY_LAYOUT_LEGACY:
@@ -347,10 +402,37 @@ size_t om_variable_write_numeric_array_size(uint16_t name_size, uint32_t childre
 }
 
 void om_variable_write_numeric_array(void* dst, uint16_t name_size, uint32_t children_count, const uint64_t* children_offsets, const uint64_t* children_sizes, const char* name, OmDataType_t data_type, OmCompression_t compression_type, float scale_factor, float add_offset, uint64_t dimension_count, const uint64_t *dimensions, const uint64_t *chunks, uint64_t lut_size, uint64_t lut_offset) {
+    om_variable_write_numeric_array_with_lut_encoding(dst, name_size, children_count, children_offsets, children_sizes, name, data_type, compression_type, LUT_ENCODING_PFOR, scale_factor, add_offset, dimension_count, dimensions, chunks, lut_size, lut_offset);
+}
+
+void om_variable_write_numeric_array_with_lut_encoding(void* dst, uint16_t name_size, uint32_t children_count, const uint64_t* children_offsets, const uint64_t* children_sizes, const char* name, OmDataType_t data_type, OmCompression_t compression_type, OmLutEncoding_t lut_encoding, float scale_factor, float add_offset, uint64_t dimension_count, const uint64_t *dimensions, const uint64_t *chunks, uint64_t lut_size, uint64_t lut_offset) {
+    const OmVariableArrayOptions_t options = {
+        .lut_encoding = lut_encoding
+    };
+    om_variable_write_numeric_array_with_options(dst, name_size, children_count, children_offsets, children_sizes, name, data_type, compression_type, scale_factor, add_offset, dimension_count, dimensions, chunks, lut_size, lut_offset, &options);
+}
+
+size_t om_variable_write_numeric_array_with_options_size(uint16_t name_size, uint32_t children_count, uint64_t dimension_count, const OmVariableArrayOptions_t* options) {
+    return om_variable_write_numeric_array_size(name_size, children_count, dimension_count) + (options->statistics_size > 0 ? 16 : 0) + (options->mantissa_bits > 0 ? 8 : 0);
+}
+
+void om_variable_write_numeric_array_with_options(void* dst, uint16_t name_size, uint32_t children_count, const uint64_t* children_offsets, const uint64_t* children_sizes, const char* name, OmDataType_t data_type, OmCompression_t compression_type, float scale_factor, float add_offset, uint64_t dimension_count, const uint64_t *dimensions, const uint64_t *chunks, uint64_t lut_size, uint64_t lut_offset, const OmVariableArrayOptions_t* options) {
+
+    uint8_t lut_flag = 0;
+    switch (options->lut_encoding) {
+        case LUT_ENCODING_PFOR:
+            break;
+        case LUT_ENCODING_FIXED_WIDTH:
+            lut_flag = OM_COMPRESSION_FLAG_LUT_FIXED_WIDTH;
+            break;
+        case LUT_ENCODING_PFOR_VARIABLE:
+            lut_flag = OM_COMPRESSION_FLAG_LUT_VARIABLE;
+            break;
+    }
 
     *(OmVariableArrayV3_t*)dst = (OmVariableArrayV3_t){
-        .data_type = (uint8_t)data_type,
-        .compression_type = (uint8_t)compression_type,
+        .data_type = (uint8_t)data_type | (options->mantissa_bits > 0 ? OM_DATA_TYPE_FLAG_MANTISSA_BITS : 0),
+        .compression_type = (uint8_t)compression_type | lut_flag | (options->statistics_size > 0 ? OM_COMPRESSION_FLAG_CHUNK_STATISTICS : 0) | (options->constant_chunks ? OM_COMPRESSION_FLAG_CONSTANT_CHUNKS : 0),
         .name_size = name_size,
         .children_count = children_count,
         .add_offset = add_offset,
@@ -370,8 +452,23 @@ void om_variable_write_numeric_array(void* dst, uint16_t name_size, uint32_t chi
         baseDimensions[i] = dimensions[i];
         baseChunks[i] = chunks[i];
     }
+    /// Set statistics
+    uint64_t statisticsFieldSize = 0;
+    if (options->statistics_size > 0) {
+        uint64_t* baseStatistics = (uint64_t*)(dst + sizeof(OmVariableArrayV3_t) + 16 * children_count + 16 * dimension_count);
+        baseStatistics[0] = options->statistics_offset;
+        baseStatistics[1] = options->statistics_size;
+        statisticsFieldSize = 16;
+    }
+    /// Set mantissa bits
+    uint64_t mantissaBitsFieldSize = 0;
+    if (options->mantissa_bits > 0) {
+        uint64_t* baseMantissaBits = (uint64_t*)(dst + sizeof(OmVariableArrayV3_t) + 16 * children_count + 16 * dimension_count + statisticsFieldSize);
+        baseMantissaBits[0] = options->mantissa_bits;
+        mantissaBitsFieldSize = 8;
+    }
     /// Set name
-    char* baseName = (char*)(dst + sizeof(OmVariableArrayV3_t) + 16 * children_count + 16 * dimension_count);
+    char* baseName = (char*)(dst + sizeof(OmVariableArrayV3_t) + 16 * children_count + 16 * dimension_count + statisticsFieldSize + mantissaBitsFieldSize);
     for (uint16_t i = 0; i<name_size; i++) {
         baseName[i] = name[i];
     }
@@ -0,0 +1,468 @@
+//
+//  om_writer.c
+//  OpenMeteoApi
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include "om_writer.h"
+#include "om_variable.h"
+#include "om_file.h"
+
+struct OmWriter {
+    OmWriterSink_t sink;
+    /// All data is written to this buffer before it is passed to the sink
+    uint8_t* buffer;
+    uint64_t capacity;
+    /// Capacity of new buffers after a buffer was taken by the sink
+    uint64_t initial_capacity;
+    /// Data in `buffer` starts at `start` and ends at `position`. Buffers start at the file offset modulo 8, so that variables
+    /// aligned in the file are also aligned in memory.
+    uint64_t start;
+    uint64_t position;
+    /// Number of bytes written to the file including `position`
+    uint64_t total_bytes_written;
+    uint32_t threads;
+    uint64_t in_flight_chunks;
+};
+
+struct OmWriterArray {
+    OmWriter_t* writer;
+    OmEncoder_t encoder;
+    /// Only set if the writer uses more than one thread
+    OmEncoderParallel_t* parallel;
+    OmDataType_t data_type;
+    OmCompression_t compression;
+    OmLutEncoding_t lut_encoding;
+    float scale_factor;
+    float add_offset;
+    uint64_t dimension_count;
+    /// Dimensions followed by chunks. The encoder keeps pointers to both.
+    uint64_t* dimensions;
+    uint64_t* chunks;
+    /// Total number of chunks and number of chunks written so far
+    uint64_t chunk_count;
+    uint64_t chunk_index;
+    uint64_t compressed_chunk_buffer_size;
+    uint8_t* chunk_buffer;
+
+    /// Statistics of each chunk. NULL if statistics are not stored.
+    OmChunkStatistics_t* statistics;
+    uint64_t statistics_offset;
+
+    /// Start offset of each chunk and the end of the last chunk. For `LUT_ENCODING_PFOR_VARIABLE` only the 64 entries of the current block are kept.
+    uint64_t* lut;
+    /// File offsets of the start and end of each LUT block that was written for `LUT_ENCODING_PFOR_VARIABLE`
+    uint64_t* lut_block_ranges;
+    uint64_t lut_block_count;
+
+    /// Set by `om_writer_array_finalise`
+    uint64_t lut_offset;
+    uint64_t lut_size;
+    bool finalised;
+};
+
+
+// MARK: Buffer
+
+OmWriter_t* om_writer_create(OmWriterSink_t sink, uint64_t buffer_capacity, uint32_t threads) {
+    OmWriter_t* writer = calloc(1, sizeof(OmWriter_t));
+    if (writer == NULL) {
+        return NULL;
+    }
+    writer->sink = sink;
+    writer->initial_capacity = max(buffer_capacity, (uint64_t)64);
+    writer->capacity = writer->initial_capacity;
+    writer->threads = max(threads, 1u);
+    writer->buffer = malloc(writer->capacity);
+    if (writer->buffer == NULL) {
+        free(writer);
+        return NULL;
+    }
+    om_header_write(writer->buffer);
+    writer->position = om_header_write_size();
+    writer->total_bytes_written = writer->position;
+    return writer;
+}
+
+void om_writer_set_threads(OmWriter_t* writer, uint32_t threads, uint64_t in_flight_chunks) {
+    writer->threads = max(threads, 1u);
+    writer->in_flight_chunks = in_flight_chunks;
+}
+
+void om_writer_destroy(OmWriter_t* writer) {
+    free(writer->buffer);
+    free(writer);
+}
+
+uint64_t om_writer_total_bytes_written(const OmWriter_t* writer) {
+    return writer->total_bytes_written;
+}
+
+bool om_writer_flush(OmWriter_t* writer, OmError_t* error) {
+    if (writer->position == writer->start) {
+        return true;
+    }
+    const uint64_t alignment = writer->total_bytes_written % 8;
+    if (writer->sink.take != NULL) {
+        // Allocate the next buffer first, so that no data is lost if allocation fails
+        uint8_t* next = malloc(writer->initial_capacity);
+        if (next == NULL) {
+            (*error) = ERROR_OUT_OF_MEMORY;
+            return false;
+        }
+        uint8_t* filled = writer->buffer;
+        const uint64_t start = writer->start;
+        const uint64_t size = writer->position - writer->start;
+        writer->buffer = next;
+        writer->capacity = writer->initial_capacity;
+        writer->start = writer->position = alignment;
+        if (!writer->sink.take(writer->sink.context, filled, filled + start, size)) {
+            (*error) = ERROR_IO_WRITE;
+            return false;
+        }
+        return true;
+    }
+    if (!writer->sink.write(writer->sink.context, writer->buffer + writer->start, writer->position - writer->start)) {
+        (*error) = ERROR_IO_WRITE;
+        return false;
+    }
+    writer->start = writer->position = alignment;
+    return true;
+}
+
+/// Ensure `size` bytes are available at the write position and zero them. Flushes the buffer or grows it if required.
+static uint8_t* _om_writer_reserve(OmWriter_t* writer, uint64_t size, OmError_t* error) {
+    if (writer->capacity - writer->position < size) {
+        if (!om_writer_flush(writer, error)) {
+            return NULL;
+        }
+        if (writer->capacity - writer->position < size) {
+            // Grow to a multiple of the initial capacity
+            const uint64_t capacity = divide_rounded_up(writer->position + size, writer->initial_capacity) * writer->initial_capacity;
+            uint8_t* buffer = realloc(writer->buffer, capacity);
+            if (buffer == NULL) {
+                (*error) = ERROR_OUT_OF_MEMORY;
+                return NULL;
+            }
+            writer->buffer = buffer;
+            writer->capacity = capacity;
+        }
+    }
+    // Compressors combine bits with existing output and variables do not write every padding byte
+    uint8_t* destination = writer->buffer + writer->position;
+    memset(destination, 0, size);
+    return destination;
+}
+
+static inline void _om_writer_increment(OmWriter_t* writer, uint64_t size) {
+    writer->position += size;
+    writer->total_bytes_written += size;
+}
+
+/// Pad with zeros to the next multiple of 8 bytes
+static bool _om_writer_align(OmWriter_t* writer, OmError_t* error) {
+    const uint64_t padding = (8 - writer->total_bytes_written % 8) % 8;
+    if (padding == 0) {
+        return true;
+    }
+    if (_om_writer_reserve(writer, padding, error) == NULL) {
+        return false;
+    }
+    _om_writer_increment(writer, padding);
+    return true;
+}
+
+/// Copy data into the buffer
+static bool _om_writer_append(OmWriter_t* writer, const void* data, uint64_t size, OmError_t* error) {
+    uint8_t* destination = _om_writer_reserve(writer, size, error);
+    if (destination == NULL) {
+        return false;
+    }
+    memcpy(destination, data, size);
+    _om_writer_increment(writer, size);
+    return true;
+}
+
+
+// MARK: Arrays
+
+OmWriterArray_t* om_writer_array_create(OmWriter_t* writer, OmDataType_t data_type, OmCompression_t compression, OmLutEncoding_t lut_encoding, float scale_factor, float add_offset, const uint64_t* dimensions, const uint64_t* chunks, uint64_t dimension_count, bool chunk_statistics, bool constant_chunks, uint8_t mantissa_bits, OmError_t* error) {
+    OmWriterArray_t* array = calloc(1, sizeof(OmWriterArray_t));
+    if (array == NULL) {
+        (*error) = ERROR_OUT_OF_MEMORY;
+        return NULL;
+    }
+    array->writer = writer;
+    array->data_type = data_type;
+    array->compression = compression;
+    array->lut_encoding = lut_encoding;
+    array->scale_factor = scale_factor;
+    array->add_offset = add_offset;
+    array->dimension_count = dimension_count;
+    array->dimensions = malloc(max(dimension_count, (uint64_t)1) * 2 * sizeof(uint64_t));
+    if (array->dimensions == NULL) {
+        (*error) = ERROR_OUT_OF_MEMORY;
+        om_writer_array_destroy(array);
+        return NULL;
+    }
+    array->chunks = array->dimensions + dimension_count;
+    memcpy(array->dimensions, dimensions, dimension_count * sizeof(uint64_t));
+    memcpy(array->chunks, chunks, dimension_count * sizeof(uint64_t));
+
+    const OmError_t initError = om_encoder_init(&array->encoder, scale_factor, add_offset, compression, data_type, array->dimensions, array->chunks, dimension_count);
+    if (initError != ERROR_OK) {
+        (*error) = initError;
+        om_writer_array_destroy(array);
+        return NULL;
+    }
+    om_encoder_set_constant_chunks(&array->encoder, constant_chunks);
+    const OmError_t mantissaError = om_encoder_set_mantissa_bits(&array->encoder, mantissa_bits);
+    if (mantissaError != ERROR_OK) {
+        (*error) = mantissaError;
+        om_writer_array_destroy(array);
+        return NULL;
+    }
+    array->chunk_count = om_encoder_count_chunks(&array->encoder);
+    array->compressed_chunk_buffer_size = om_encoder_compressed_chunk_buffer_size(&array->encoder);
+
+    // Fixed and PFor LUTs are encoded at once. Variable LUTs only keep the current block.
+    const uint64_t lutCount = lut_encoding == LUT_ENCODING_PFOR_VARIABLE ? LUT_CHUNK_COUNT : array->chunk_count + 1;
+    array->lut = malloc(lutCount * sizeof(uint64_t));
+    if (writer->threads > 1) {
+        array->parallel = om_encoder_parallel_create(&array->encoder, writer->threads, writer->in_flight_chunks);
+    } else {
+        array->chunk_buffer = malloc(om_encoder_chunk_buffer_size(&array->encoder));
+    }
+    if (chunk_statistics) {
+        array->statistics = malloc(array->chunk_count * sizeof(OmChunkStatistics_t));
+    }
+    const bool variableLut = lut_encoding == LUT_ENCODING_PFOR_VARIABLE;
+    if (variableLut) {
+        array->lut_block_ranges = malloc(divide_rounded_up(array->chunk_count + 1, LUT_CHUNK_COUNT) * 2 * sizeof(uint64_t));
+    }
+    if (array->lut == NULL || (array->parallel == NULL && array->chunk_buffer == NULL) || (chunk_statistics && array->statistics == NULL) || (variableLut && array->lut_block_ranges == NULL)) {
+        (*error) = ERROR_OUT_OF_MEMORY;
+        om_writer_array_destroy(array);
+        return NULL;
+    }
+    return array;
+}
+
+void om_writer_array_destroy(OmWriterArray_t* array) {
+    if (array->parallel != NULL) {
+        om_encoder_parallel_destroy(array->parallel);
+    }
+    free(array->dimensions);
+    free(array->chunk_buffer);
+    free(array->lut);
+    free(array->lut_block_ranges);
+    free(array->statistics);
+    free(array);
+}
+
+/// Compress the first `count` entries of `lut` into a variable-length LUT block and write it at the current position
+static bool _om_writer_array_write_lut_block(OmWriterArray_t* array, uint64_t count, OmError_t* error) {
+    OmWriter_t* writer = array->writer;
+    const uint64_t blockBufferSize = om_encoder_lut_block_buffer_size();
+    uint8_t* out = _om_writer_reserve(writer, blockBufferSize, error);
+    if (out == NULL) {
+        return false;
+    }
+    const uint64_t start = writer->total_bytes_written;
+    _om_writer_increment(writer, om_encoder_compress_lut_block(array->lut, count, out, blockBufferSize));
+    array->lut_block_ranges[array->lut_block_count * 2] = start;
+    array->lut_block_ranges[array->lut_block_count * 2 + 1] = writer->total_bytes_written;
+    array->lut_block_count++;
+    return true;
+}
+
+/// Set a LUT entry. For `LUT_ENCODING_PFOR_VARIABLE` each completed block of 64 entries is written directly after the data of chunk `64k+63`, which
+/// moves the start of the next chunk behind the block. Only the current block is kept in memory.
+static bool _om_writer_array_store_lut(OmWriterArray_t* array, uint64_t index, uint64_t offset, OmError_t* error) {
+    if (array->lut_encoding != LUT_ENCODING_PFOR_VARIABLE) {
+        array->lut[index] = offset;
+        return true;
+    }
+    if (index > 0 && index % LUT_CHUNK_COUNT == 0) {
+        if (!_om_writer_array_write_lut_block(array, LUT_CHUNK_COUNT, error)) {
+            return false;
+        }
+        offset = array->writer->total_bytes_written;
+    }
+    array->lut[index % LUT_CHUNK_COUNT] = offset;
+    return true;
+}
+
+bool om_writer_array_write(OmWriterArray_t* array, const void* data, const uint64_t* array_dimensions, const uint64_t* array_offset, const uint64_t* array_count, OmError_t* error) {
+    OmWriter_t* writer = array->writer;
+    const uint64_t numberOfChunksInArray = om_encoder_count_chunks_in_array(&array->encoder, array_count);
+    if (array->finalised) {
+        (*error) = ERROR_INVALID_STATE;
+        return false;
+    }
+    if (array->chunk_index + numberOfChunksInArray > array->chunk_count) {
+        (*error) = ERROR_INVALID_DIMENSIONS;
+        return false;
+    }
+    // Store data start address if this is the first time this read is called
+    if (array->chunk_index == 0 && !_om_writer_array_store_lut(array, 0, writer->total_bytes_written, error)) {
+        return false;
+    }
+
+    if (array->parallel == NULL) {
+        // Compress directly into the output buffer
+        for (uint64_t chunkIndexOffsetInThisArray = 0; chunkIndexOffsetInThisArray < numberOfChunksInArray; chunkIndexOffsetInThisArray++) {
+            uint8_t* out = _om_writer_reserve(writer, array->compressed_chunk_buffer_size, error);
+            if (out == NULL) {
+                return false;
+            }
+            OmChunkStatistics_t* statistics = array->statistics == NULL ? NULL : &array->statistics[array->chunk_index];
+            const uint64_t size = om_encoder_compress_chunk_with_statistics(&array->encoder, data, array_dimensions, array_offset, array_count, array->chunk_index, chunkIndexOffsetInThisArray, out, array->chunk_buffer, statistics, error);
+            if (size == 0) {
+                return false;
+            }
+            _om_writer_increment(writer, size);
+            if (!_om_writer_array_store_lut(array, array->chunk_index + 1, writer->total_bytes_written, error)) {
+                return false;
+            }
+            array->chunk_index++;
+        }
+        return true;
+    }
+
+    // Compress a window of chunks in parallel and append them in order
+    const uint64_t window = om_encoder_parallel_window(array->parallel);
+    for (uint64_t chunkIndexOffsetInThisArray = 0; chunkIndexOffsetInThisArray < numberOfChunksInArray; chunkIndexOffsetInThisArray += window) {
+        const uint64_t count = min(window, numberOfChunksInArray - chunkIndexOffsetInThisArray);
+        OmChunkStatistics_t* statistics = array->statistics == NULL ? NULL : &array->statistics[array->chunk_index];
+        if (!om_encoder_parallel_compress_chunks(array->parallel, data, array_dimensions, array_offset, array_count, array->chunk_index, chunkIndexOffsetInThisArray, count, statistics, error)) {
+            return false;
+        }
+        for (uint64_t i = 0; i < count; i++) {
+            uint64_t size;
+            const uint8_t* chunk = om_encoder_parallel_chunk(array->parallel, i, &size);
+            if (!_om_writer_append(writer, chunk, size, error)) {
+                return false;
+            }
+            if (!_om_writer_array_store_lut(array, array->chunk_index + 1, writer->total_bytes_written, error)) {
+                return false;
+            }
+            array->chunk_index++;
+        }
+    }
+    return true;
+}
+
+bool om_writer_array_finalise(OmWriterArray_t* array, OmError_t* error) {
+    OmWriter_t* writer = array->writer;
+    if (array->finalised || array->chunk_index != array->chunk_count) {
+        (*error) = ERROR_INVALID_STATE;
+        return false;
+    }
+    if (array->statistics != NULL) {
+        if (!_om_writer_align(writer, error)) {
+            return false;
+        }
+        array->statistics_offset = writer->total_bytes_written;
+        if (!_om_writer_append(writer, array->statistics, array->chunk_count * sizeof(OmChunkStatistics_t), error)) {
+            return false;
+        }
+    }
+    if (array->lut_encoding == LUT_ENCODING_PFOR_VARIABLE) {
+        // All other blocks were written while writing data. The last block contains the remaining 1 to 64 entries.
+        if (!_om_writer_array_write_lut_block(array, array->chunk_count % LUT_CHUNK_COUNT + 1, error)) {
+            return false;
+        }
+        // The LUT starts with the first block and ends with the block offset table
+        const uint64_t blockCount = array->lut_block_count;
+        array->lut_offset = array->lut_block_ranges[0];
+        for (uint64_t i = 0; i < blockCount * 2; i++) {
+            array->lut_block_ranges[i] -= array->lut_offset;
+        }
+        const uint64_t blockOffsetsSize = om_encoder_lut_block_offsets_size(blockCount);
+        uint8_t* out = _om_writer_reserve(writer, blockOffsetsSize, error);
+        if (out == NULL) {
+            return false;
+        }
+        _om_writer_increment(writer, om_encoder_write_lut_block_offsets(array->lut_block_ranges, blockCount, out, blockOffsetsSize));
+        array->lut_size = writer->total_bytes_written - array->lut_offset;
+    } else {
+        array->lut_offset = writer->total_bytes_written;
+        const uint64_t lutCount = array->chunk_count + 1;
+        const uint64_t bufferSize = om_encoder_lut_buffer_size_with_encoding(array->lut, lutCount, array->lut_encoding);
+        uint8_t* out = _om_writer_reserve(writer, bufferSize, error);
+        if (out == NULL) {
+            return false;
+        }
+        array->lut_size = om_encoder_compress_lut_with_encoding(array->lut, lutCount, array->lut_encoding, out, bufferSize);
+        _om_writer_increment(writer, array->lut_size);
+    }
+    array->finalised = true;
+    return true;
+}
+
+void om_writer_array_get_lut_range(const OmWriterArray_t* array, uint64_t* lut_offset, uint64_t* lut_size) {
+    (*lut_offset) = array->lut_offset;
+    (*lut_size) = array->lut_size;
+}
+
+
+// MARK: Variables and trailer
+
+bool om_writer_write_array(OmWriter_t* writer, const OmWriterArray_t* array, const char* name, uint16_t name_size, uint32_t children_count, const uint64_t* children_offsets, const uint64_t* children_sizes, uint64_t* offset, uint64_t* size, OmError_t* error) {
+    if (!array->finalised) {
+        (*error) = ERROR_INVALID_STATE;
+        return false;
+    }
+    if (!_om_writer_align(writer, error)) {
+        return false;
+    }
+    const OmVariableArrayOptions_t options = {
+        .lut_encoding = array->lut_encoding,
+        .statistics_offset = array->statistics_offset,
+        .statistics_size = array->statistics == NULL ? 0 : array->chunk_count * sizeof(OmChunkStatistics_t),
+        .constant_chunks = array->encoder.constant_chunks,
+        .mantissa_bits = array->encoder.mantissa_bits
+    };
+    const uint64_t variableSize = om_variable_write_numeric_array_with_options_size(name_size, children_count, array->dimension_count, &options);
+    uint8_t* out = _om_writer_reserve(writer, variableSize, error);
+    if (out == NULL) {
+        return false;
+    }
+    om_variable_write_numeric_array_with_options(out, name_size, children_count, children_offsets, children_sizes, name, array->data_type, array->compression, array->scale_factor, array->add_offset, array->dimension_count, array->dimensions, array->chunks, array->lut_size, array->lut_offset, &options);
+    (*offset) = writer->total_bytes_written;
+    (*size) = variableSize;
+    _om_writer_increment(writer, variableSize);
+    return true;
+}
+
+bool om_writer_write_scalar(OmWriter_t* writer, const char* name, uint16_t name_size, uint32_t children_count, const uint64_t* children_offsets, const uint64_t* children_sizes, OmDataType_t data_type, const void* value, size_t string_size, uint64_t* offset, uint64_t* size, OmError_t* error) {
+    if (!_om_writer_align(writer, error)) {
+        return false;
+    }
+    const uint64_t variableSize = om_variable_write_scalar_size(name_size, children_count, data_type, string_size);
+    uint8_t* out = _om_writer_reserve(writer, variableSize, error);
+    if (out == NULL) {
+        return false;
+    }
+    om_variable_write_scalar(out, name_size, children_count, children_offsets, children_sizes, name, data_type, value, string_size);
+    (*offset) = writer->total_bytes_written;
+    (*size) = variableSize;
+    _om_writer_increment(writer, variableSize);
+    return true;
+}
+
+bool om_writer_write_trailer(OmWriter_t* writer, uint64_t root_offset, uint64_t root_size, OmError_t* error) {
+    if (!_om_writer_align(writer, error)) {
+        return false;
+    }
+    const uint64_t trailerSize = om_trailer_size();
+    uint8_t* out = _om_writer_reserve(writer, trailerSize, error);
+    if (out == NULL) {
+        return false;
+    }
+    om_trailer_write(out, root_offset, root_size);
+    _om_writer_increment(writer, trailerSize);
+    return om_writer_flush(writer, error);
+}
@@ -0,0 +1,6 @@
+// AVX2 build of vp4c_sse.c with prefixed symbols. Selected at runtime by om_common_codecs()
+#include "om_codec_avx2.h"
+#if OM_CODEC_AVX2
+#include "vp4c_sse.c"
+OM_CODEC_AVX2_END
+#endif
@@ -8,7 +8,6 @@ struct BuildConfig {
     // target: String,
     arch: String,
     sysroot: Option<String>,
-    use_skylake: bool,
     is_windows: bool,
 }
 
@@ -16,9 +15,6 @@ fn get_build_config() -> BuildConfig {
     BuildConfig {
         arch: env::var("CARGO_CFG_TARGET_ARCH").unwrap(),
         sysroot: env::var("SYSROOT").ok(),
-        use_skylake: env::var("MARCH_SKYLAKE")
-            .map(|v| v == "TRUE")
-            .unwrap_or(false),
         is_windows: env::var("TARGET").unwrap().contains("windows"),
     }
 }
@@ -59,12 +55,8 @@ fn configure_build_flags(build: &mut cc::Build, config: &BuildConfig, compiler:
             if config.is_windows && compiler.is_like_msvc() {
                 // No special flags needed for MSVC atm
             } else {
-                // Choose between skylake and native based on environment variable
-                if config.use_skylake {
-                    build.flag("-march=skylake");
-                } else {
-                    build.flag("-march=native");
-                }
+                // Portable baseline. AVX2 builds of the codecs are selected at runtime
+                build.flag("-march=x86-64-v2");
             }
         }
         _ => {